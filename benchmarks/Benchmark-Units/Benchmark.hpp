@@ -0,0 +1,64 @@
+/**
+ * @file Benchmark-Units/Benchmark.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Minimal timing helpers shared by the benchmark programs of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header provides a best-of-N timer and an optimization barrier for the benchmark programs.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_BENCHMARK_UNITS_BENCHMARK_HPP
+#define SOFTLOQ_WHATWG_INFRA_BENCHMARK_UNITS_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <string_view>
+
+namespace Softloq::WHATWG::Infra::Benchmark
+{
+
+/**
+ * @brief Keep the compiler from optimizing away a value that is only computed for timing.
+ *
+ * @param value The value to keep.
+ */
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Run a callable several times and print the best wall-clock time.
+ *
+ * @param name The name of the case, printed before the time.
+ * @param runs The number of runs.
+ * @param function The callable to time.
+ * @return The best time in nanoseconds.
+ */
+template <typename F>
+inline double measure(std::string_view name, int runs, F&& function)
+{
+    double best = std::numeric_limits<double>::max();
+    for (int run = 0; run < runs; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+    }
+    std::printf("%-48.*s %14.0f ns\n", static_cast<int>(name.size()), name.data(), best);
+    return best;
+}
+
+} // namespace Softloq::WHATWG::Infra::Benchmark
+
+#endif // SOFTLOQ_WHATWG_INFRA_BENCHMARK_UNITS_BENCHMARK_HPP
@@ -0,0 +1,76 @@
+/**
+ * @file Benchmark-Units/Operation/Endian.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Benchmark for the endian-aware Number serialization operations in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This program serializes 10^4 frame headers of 1,000 32-bit fields into big-endian ByteSequences
+ * and reads them back, with append_numbers() and read_numbers(), which byte-swap sixteen bytes at a
+ * time, with one append_number() per field, and with one push_back per byte as the baseline.
+ */
+
+#include <Benchmark.hpp>
+#include <Softloq/WHATWG/Infra/Operation/Endian/Endian.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/UInt32/UInt32.hpp>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr std::size_t field_count = 1000;
+constexpr std::size_t header_count = 10000;
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 engine{2026};
+    NumberArray<std::uint32_t> fields;
+    for (std::size_t i = 0; i < field_count; ++i) fields.append(UInt32{static_cast<std::uint32_t>(engine())});
+
+    ByteSequence frame;
+    Benchmark::measure("encode, push_back per byte", 5, [&] {
+        for (std::size_t header = 0; header < header_count; ++header)
+        {
+            frame.clear();
+            for (const std::uint32_t field : fields.values())
+                for (int shift = 24; shift >= 0; shift -= 8) frame.push_back(Byte{static_cast<std::uint8_t>(field >> shift)});
+            Benchmark::do_not_optimize(frame);
+        }
+    });
+    Benchmark::measure("encode, append_number per field", 5, [&] {
+        for (std::size_t header = 0; header < header_count; ++header)
+        {
+            frame.clear();
+            for (const UInt32& field : fields.numbers()) append_number(frame, field, std::endian::big);
+            Benchmark::do_not_optimize(frame);
+        }
+    });
+    Benchmark::measure("encode, append_numbers", 5, [&] {
+        for (std::size_t header = 0; header < header_count; ++header)
+        {
+            frame.clear();
+            append_numbers(frame, fields, std::endian::big);
+            Benchmark::do_not_optimize(frame);
+        }
+    });
+
+    Benchmark::measure("decode, read_number per field", 5, [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t header = 0; header < header_count; ++header)
+            for (std::size_t i = 0; i < field_count; ++i) sum += read_number<std::uint32_t>(frame, 4 * i, std::endian::big).get_value();
+        Benchmark::do_not_optimize(sum);
+    });
+    Benchmark::measure("decode, read_numbers", 5, [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t header = 0; header < header_count; ++header) sum += read_numbers<std::uint32_t>(frame, 0, field_count, std::endian::big).values()[header % field_count];
+        Benchmark::do_not_optimize(sum);
+    });
+    return 0;
+}
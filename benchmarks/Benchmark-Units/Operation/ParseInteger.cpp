@@ -0,0 +1,114 @@
+/**
+ * @file Benchmark-Units/Operation/ParseInteger.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Benchmark for the integer parsing operations in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This program parses 10^6 decimal strings of 1 to 4 digits, of 5 to 10 digits and of 16 to 20
+ * digits with parse_ascii_digits(), which reads sixteen or eight digits at a time, and with
+ * std::from_chars and a digit-by-digit loop as baselines. UTF-16 input, which std::from_chars does
+ * not accept, is timed against the digit-by-digit loop only.
+ */
+
+#include <Benchmark.hpp>
+#include <Softloq/WHATWG/Infra/Operation/ParseInteger/ParseInteger.hpp>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr std::size_t string_count = 1000000;
+
+/**
+ * @brief Parse the leading digits one at a time, without overflow checks.
+ */
+template <typename C>
+std::uint64_t parse_digit_by_digit(std::basic_string_view<C> text)
+{
+    std::uint64_t value = 0;
+    for (const C c : text)
+    {
+        if (c < C{'0'} || c > C{'9'}) break;
+        value = value * 10 + static_cast<std::uint64_t>(c - C{'0'});
+    }
+    return value;
+}
+
+/**
+ * @brief Make decimal strings whose lengths lie between two bounds, each followed by a separator.
+ */
+std::vector<std::string> make_strings(std::mt19937_64& engine, std::size_t min_digits, std::size_t max_digits)
+{
+    std::vector<std::string> strings;
+    strings.reserve(string_count);
+    for (std::size_t i = 0; i < string_count; ++i)
+    {
+        const std::size_t digits = min_digits + engine() % (max_digits - min_digits + 1);
+        std::string text = std::to_string(engine() % 9 + 1);
+        while (text.size() < digits) text += static_cast<char>('0' + engine() % 10);
+        if (digits == 20) text[0] = '1'; // stay below 2^64
+        strings.push_back(text + ",");
+    }
+    return strings;
+}
+
+/**
+ * @brief Time every parser over one set of strings.
+ */
+void measure_strings(const std::string& label, const std::vector<std::string>& strings)
+{
+    std::vector<std::u16string> wide;
+    wide.reserve(strings.size());
+    for (const std::string& text : strings) wide.emplace_back(text.begin(), text.end());
+
+    Benchmark::measure(label + ", parse_ascii_digits", 5, [&] {
+        std::uint64_t sum = 0;
+        for (const std::string& text : strings) sum += parse_ascii_digits<std::uint64_t>(std::string_view{text}).value.get_value();
+        Benchmark::do_not_optimize(sum);
+    });
+    Benchmark::measure(label + ", std::from_chars", 5, [&] {
+        std::uint64_t sum = 0;
+        for (const std::string& text : strings)
+        {
+            std::uint64_t value = 0;
+            std::from_chars(text.data(), text.data() + text.size(), value);
+            sum += value;
+        }
+        Benchmark::do_not_optimize(sum);
+    });
+    Benchmark::measure(label + ", digit-by-digit baseline", 5, [&] {
+        std::uint64_t sum = 0;
+        for (const std::string& text : strings) sum += parse_digit_by_digit(std::string_view{text});
+        Benchmark::do_not_optimize(sum);
+    });
+    Benchmark::measure(label + ", UTF-16, parse_ascii_digits", 5, [&] {
+        std::uint64_t sum = 0;
+        for (const std::u16string& text : wide) sum += parse_ascii_digits<std::uint64_t>(std::u16string_view{text}).value.get_value();
+        Benchmark::do_not_optimize(sum);
+    });
+    Benchmark::measure(label + ", UTF-16, digit-by-digit baseline", 5, [&] {
+        std::uint64_t sum = 0;
+        for (const std::u16string& text : wide) sum += parse_digit_by_digit(std::u16string_view{text});
+        Benchmark::do_not_optimize(sum);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 engine{2026};
+    measure_strings("1-4 digits", make_strings(engine, 1, 4));
+    measure_strings("5-10 digits", make_strings(engine, 5, 10));
+    measure_strings("16-20 digits", make_strings(engine, 16, 20));
+    return 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file Benchmark-Units/Primitive/BigInt.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Benchmark for the arbitrary-precision bigint_t type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This program multiplies random operands of 8 to 1,024 limbs with operator*, which switches to
+ * Karatsuba at bigint_t::karatsuba_threshold limbs, against a row-at-a-time product built from
+ * one-limb multiplies, and converts them to decimal with to_decimal(), nineteen digits per pass,
+ * against one digit per division by ten. It also times 10^5 round trips of 128-bit JSON IDs,
+ * which stay in inline storage.
+ */
+
+#include <Benchmark.hpp>
+#include <Softloq/WHATWG/Infra/Operation/ParseInteger/ParseInteger.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/BigInt/BigInt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief A random non-negative bigint_t of the given number of limbs.
+ */
+bigint_t random_big(std::mt19937_64& engine, std::size_t size)
+{
+    std::vector<std::uint64_t> limbs(size);
+    for (std::uint64_t& limb : limbs) limb = engine();
+    return bigint_t::from_limbs(limbs);
+}
+
+/**
+ * @brief Multiply one limb of the right operand at a time, shifting and adding the rows.
+ */
+bigint_t multiply_by_rows(const bigint_t& lhs, const bigint_t& rhs)
+{
+    bigint_t product;
+    const auto limbs = rhs.limbs();
+    for (std::size_t index = 0; index < limbs.size(); ++index) product += (lhs * bigint_t{limbs[index]}) << static_cast<int>(64 * index);
+    return product;
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 engine{2026};
+    for (const std::size_t size : {8u, 32u, 128u, 1024u})
+    {
+        const bigint_t lhs = random_big(engine, size);
+        const bigint_t rhs = random_big(engine, size);
+        const int runs = static_cast<int>(4096 / size) + 1;
+        const std::string name = std::to_string(size) + " limbs";
+        Benchmark::measure("multiply " + name + ", by rows", 5, [&] {
+            for (int run = 0; run < runs; ++run) Benchmark::do_not_optimize(multiply_by_rows(lhs, rhs));
+        });
+        Benchmark::measure("multiply " + name + ", operator*", 5, [&] {
+            for (int run = 0; run < runs; ++run) Benchmark::do_not_optimize(lhs * rhs);
+        });
+    }
+
+    for (const std::size_t size : {4u, 64u})
+    {
+        const bigint_t value = random_big(engine, size);
+        const std::string name = std::to_string(size) + " limbs";
+        Benchmark::measure("decimal " + name + ", digit per division by ten", 5, [&] {
+            for (int run = 0; run < 100; ++run)
+            {
+                std::string digits;
+                for (bigint_t rest = value; rest; rest /= bigint_t{10}) digits.push_back(static_cast<char>('0' + static_cast<int>(rest % bigint_t{10})));
+                Benchmark::do_not_optimize(digits);
+            }
+        });
+        Benchmark::measure("decimal " + name + ", to_decimal", 5, [&] {
+            for (int run = 0; run < 100; ++run) Benchmark::do_not_optimize(value.to_decimal());
+        });
+    }
+
+    std::vector<std::string> ids;
+    for (int index = 0; index < 100000; ++index) ids.push_back(bigint_t{uint128_t{engine() >> 8, engine()}}.to_decimal());
+    Benchmark::measure("128-bit IDs, parse and format", 5, [&] {
+        std::size_t length = 0;
+        for (const std::string& id : ids) length += parse_integer<bigint_t>(std::string_view{id}).value.get_value().to_decimal().size();
+        Benchmark::do_not_optimize(length);
+    });
+    return 0;
+}
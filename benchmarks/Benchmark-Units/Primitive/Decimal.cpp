@@ -0,0 +1,92 @@
+/**
+ * @file Benchmark-Units/Primitive/Decimal.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Benchmark for decimal formatting of integers in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This program formats 10^6 integers with write_decimal() and with std::to_chars: 32-bit and 64-bit
+ * values with uniformly random digit counts, full-width 64-bit values, and 128-bit values, the last
+ * against repeated division by ten since std::to_chars has no 128-bit overload.
+ */
+
+#include <Benchmark.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr std::size_t value_count = 1000000;
+
+/**
+ * @brief Format a uint128_t by repeated division by ten.
+ */
+char* divide_by_ten_decimal(char* out, uint128_t value)
+{
+    char digits[39];
+    char* start = digits + sizeof(digits);
+    do
+    {
+        uint128_t digit;
+        value = uint128_t::divide(value, uint128_t{10}, digit);
+        *--start = static_cast<char>('0' + digit.low());
+    } while (value);
+    return std::copy(start, digits + sizeof(digits), out);
+}
+
+/**
+ * @brief Time one formatting function over every value, summing the lengths so none is skipped.
+ */
+template <typename T, typename F>
+void measure_values(const char* name, const std::vector<T>& values, F&& format)
+{
+    Benchmark::measure(name, 5, [&] {
+        char buffer[64];
+        std::size_t length = 0;
+        for (const T& value : values)
+        {
+            length += static_cast<std::size_t>(format(buffer, value) - buffer);
+            Benchmark::do_not_optimize(buffer);
+        }
+        Benchmark::do_not_optimize(length);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 engine{2026};
+    std::vector<std::uint32_t> mixed32;
+    std::vector<std::uint64_t> mixed64;
+    std::vector<std::uint64_t> full64;
+    std::vector<uint128_t> full128;
+    for (std::size_t i = 0; i < value_count; ++i)
+    {
+        mixed32.push_back(static_cast<std::uint32_t>(engine() >> (32 + engine() % 32)));
+        mixed64.push_back(engine() >> (engine() % 64));
+        full64.push_back(engine() | (std::uint64_t{1} << 63));
+        full128.emplace_back(engine() >> (engine() % 64), engine());
+    }
+
+    const auto to_chars = [](char* out, auto value) { return std::to_chars(out, out + 64, value).ptr; };
+    const auto decimal = [](char* out, auto value) { return write_decimal(out, value); };
+
+    measure_values("32-bit mixed lengths, std::to_chars", mixed32, to_chars);
+    measure_values("32-bit mixed lengths, write_decimal", mixed32, decimal);
+    measure_values("64-bit mixed lengths, std::to_chars", mixed64, to_chars);
+    measure_values("64-bit mixed lengths, write_decimal", mixed64, decimal);
+    measure_values("64-bit 20 digits, std::to_chars", full64, to_chars);
+    measure_values("64-bit 20 digits, write_decimal", full64, decimal);
+    measure_values("128-bit, divide by ten", full128, divide_by_ten_decimal);
+    measure_values("128-bit, write_decimal", full128, decimal);
+    return 0;
+}
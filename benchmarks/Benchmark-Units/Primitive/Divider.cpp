@@ -0,0 +1,88 @@
+/**
+ * @file Benchmark-Units/Primitive/Divider.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Benchmark for division by a precomputed Divider in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This program buckets 10^6 random values of each width by one divisor known only at run time, with
+ * operator/ on each Number as the baseline, with a Divider one Number at a time, and with
+ * Divider::divide() over the column, which picks the kernel once for the run.
+ */
+
+#include <Benchmark.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/Divider.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/NumberArray.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr std::size_t value_count = 1000000;
+
+/**
+ * @brief Time the three ways of dividing a column by one runtime divisor.
+ */
+template <typename T>
+void measure_width(const std::string& name, const NumberArray<T>& values, T divisor)
+{
+    const Number<T> number_divisor{divisor};
+    const Divider<T> divider{divisor};
+    Benchmark::measure(name + ", operator/", 5, [&] {
+        Number<T> sum{};
+        for (const Number<T>& value : values.numbers()) sum += value / number_divisor;
+        Benchmark::do_not_optimize(sum);
+    });
+    Benchmark::measure(name + ", Divider per Number", 5, [&] {
+        Number<T> sum{};
+        for (const Number<T>& value : values.numbers()) sum += value / divider;
+        Benchmark::do_not_optimize(sum);
+    });
+    NumberArray<T> quotients(values.size());
+    Benchmark::measure(name + ", Divider over the column", 5, [&] {
+        divider.divide(values.data(), values.size(), quotients.data());
+        Benchmark::do_not_optimize(quotients);
+    });
+}
+
+/**
+ * @brief A column of random values of T.
+ */
+template <typename T>
+NumberArray<T> random_column(std::mt19937_64& engine)
+{
+    NumberArray<T> values;
+    values.reserve(value_count);
+    for (std::size_t i = 0; i < value_count; ++i)
+    {
+        if constexpr (std::same_as<T, uint128_t>)
+            values.append(Number<T>{uint128_t{engine(), engine()}});
+        else if constexpr (std::same_as<T, uint256_t>)
+            values.append(Number<T>{uint256_t::from_words({engine(), engine(), engine(), engine()})});
+        else
+            values.append(Number<T>{static_cast<T>(engine())});
+    }
+    return values;
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 engine{2026};
+    // Divisors drawn at run time, so the compiler cannot turn operator/ into a multiply itself.
+    const std::uint64_t divisor = engine() % 1000 + 3;
+
+    measure_width("uint32_t", random_column<std::uint32_t>(engine), static_cast<std::uint32_t>(divisor));
+    measure_width("int32_t", random_column<std::int32_t>(engine), -static_cast<std::int32_t>(divisor));
+    measure_width("uint64_t", random_column<std::uint64_t>(engine), divisor * 1000003);
+    measure_width("int64_t", random_column<std::int64_t>(engine), -static_cast<std::int64_t>(divisor * 1000003));
+    measure_width("uint128_t", random_column<uint128_t>(engine), uint128_t{divisor, engine()});
+    measure_width("uint256_t", random_column<uint256_t>(engine), uint256_t::from_words({engine(), engine(), divisor, 0}));
+    return 0;
+}
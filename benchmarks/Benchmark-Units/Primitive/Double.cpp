@@ -0,0 +1,115 @@
+/**
+ * @file Benchmark-Units/Primitive/Double.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Benchmark for formatting and parsing the Double Number type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This program writes 10^6 random doubles with write_number_string(), against a std::ostringstream
+ * at precision 17, the iostream round trip it replaces, and std::to_chars. It then parses the
+ * written strings, and 10^5 decimals of 30 to 40 digits, with parse_floating_point_number()
+ * against std::istringstream and std::from_chars.
+ */
+
+#include <Benchmark.hpp>
+#include <Softloq/WHATWG/Infra/Operation/ParseFloat/ParseFloat.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/Double/Double.hpp>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Time every parser over one set of strings.
+ */
+void measure_parsing(const std::string& label, const std::vector<std::string>& strings)
+{
+    Benchmark::measure(label + ", std::istringstream", 5, [&] {
+        double sum = 0;
+        std::istringstream stream;
+        for (const std::string& text : strings)
+        {
+            stream.clear();
+            stream.str(text);
+            double value = 0;
+            stream >> value;
+            sum += value;
+        }
+        Benchmark::do_not_optimize(sum);
+    });
+    Benchmark::measure(label + ", std::from_chars", 5, [&] {
+        double sum = 0;
+        for (const std::string& text : strings)
+        {
+            double value = 0;
+            std::from_chars(text.data(), text.data() + text.size(), value);
+            sum += value;
+        }
+        Benchmark::do_not_optimize(sum);
+    });
+    Benchmark::measure(label + ", parse_floating_point_number", 5, [&] {
+        double sum = 0;
+        for (const std::string& text : strings) sum += parse_floating_point_number(std::string_view{text}).value.get_value();
+        Benchmark::do_not_optimize(sum);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 engine{2026};
+    std::vector<double> values;
+    for (int index = 0; index < 1000000; ++index) values.push_back(std::bit_cast<double>(engine() & 0x7FEFFFFFFFFFFFFFULL));
+
+    Benchmark::measure("format 10^6 doubles, std::ostringstream", 5, [&] {
+        std::size_t length = 0;
+        std::ostringstream stream;
+        stream.precision(17);
+        for (const double value : values)
+        {
+            stream.str({});
+            stream << value;
+            length += stream.view().size();
+        }
+        Benchmark::do_not_optimize(length);
+    });
+    Benchmark::measure("format 10^6 doubles, std::to_chars", 5, [&] {
+        std::size_t length = 0;
+        char buffer[32];
+        for (const double value : values) length += static_cast<std::size_t>(std::to_chars(buffer, buffer + sizeof(buffer), value).ptr - buffer);
+        Benchmark::do_not_optimize(length);
+    });
+    Benchmark::measure("format 10^6 doubles, write_number_string", 5, [&] {
+        std::size_t length = 0;
+        char buffer[max_number_string_length];
+        for (const double value : values) length += static_cast<std::size_t>(write_number_string(buffer, value) - buffer);
+        Benchmark::do_not_optimize(length);
+    });
+
+    std::vector<std::string> shortest;
+    char buffer[max_number_string_length];
+    for (const double value : values) shortest.emplace_back(buffer, write_number_string(buffer, value));
+    measure_parsing("parse 10^6 shortest strings", shortest);
+
+    std::vector<std::string> long_decimals;
+    for (int index = 0; index < 100000; ++index)
+    {
+        std::string text = "0.";
+        const std::size_t digits = 30 + engine() % 11;
+        while (text.size() < digits + 2) text += static_cast<char>('0' + engine() % 10);
+        long_decimals.push_back(text + "e" + std::to_string(static_cast<int>(engine() % 600) - 300));
+    }
+    measure_parsing("parse 10^5 decimals of 30 to 40 digits", long_decimals);
+    return 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file Benchmark-Units/Primitive/NumberArray.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Benchmark for the NumberArray reductions and transforms in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This program sums, bounds, scans, counts and filters 2^22 random 32-bit integers stored in a
+ * NumberArray, against the same operations over a std::vector of Int32 and over a std::vector of
+ * raw integers with the standard algorithms.
+ */
+
+#include <Benchmark.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/NumberArray.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Numbers/Numbers.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr std::size_t value_count = std::size_t{1} << 22;
+constexpr int runs = 20;
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 engine{2026};
+    std::vector<std::int32_t> raw(value_count);
+    for (std::int32_t& value : raw) value = static_cast<std::int32_t>(engine());
+    const NumberArray<std::int32_t> array{std::span<const std::int32_t>(raw)};
+    const std::vector<Int32> numbers(raw.begin(), raw.end());
+    const std::int32_t threshold = 0;
+
+    Benchmark::measure("sum: std::vector<Int32>", runs, [&] {
+        std::int64_t total = 0;
+        for (const Int32& number : numbers) total += number.get_value();
+        Benchmark::do_not_optimize(total);
+    });
+    Benchmark::measure("sum: std::accumulate", runs, [&] {
+        Benchmark::do_not_optimize(std::accumulate(raw.begin(), raw.end(), std::int64_t{0}));
+    });
+    Benchmark::measure("sum: NumberArray", runs, [&] { Benchmark::do_not_optimize(array.sum()); });
+
+    Benchmark::measure("min: std::vector<Int32>", runs, [&] {
+        Benchmark::do_not_optimize(std::min_element(numbers.begin(), numbers.end())->get_value());
+    });
+    Benchmark::measure("min: std::min_element", runs, [&] { Benchmark::do_not_optimize(*std::min_element(raw.begin(), raw.end())); });
+    Benchmark::measure("min: NumberArray", runs, [&] { Benchmark::do_not_optimize(array.min()); });
+
+    std::vector<std::int32_t> scanned(value_count);
+    Benchmark::measure("prefix sum: std::inclusive_scan", runs, [&] {
+        std::inclusive_scan(raw.begin(), raw.end(), scanned.begin(), [](std::int32_t lhs, std::int32_t rhs) {
+            return static_cast<std::int32_t>(static_cast<std::uint32_t>(lhs) + static_cast<std::uint32_t>(rhs));
+        });
+        Benchmark::do_not_optimize(scanned.data());
+    });
+    Benchmark::measure("prefix sum: NumberArray", runs, [&] { Benchmark::do_not_optimize(array.prefix_sum()); });
+
+    Benchmark::measure("count: std::vector<Int32>", runs, [&] {
+        Benchmark::do_not_optimize(std::count_if(numbers.begin(), numbers.end(), [&](const Int32& number) { return number.get_value() > threshold; }));
+    });
+    Benchmark::measure("count: std::count_if", runs, [&] {
+        Benchmark::do_not_optimize(std::count_if(raw.begin(), raw.end(), [&](std::int32_t value) { return value > threshold; }));
+    });
+    Benchmark::measure("count: NumberArray", runs, [&] { Benchmark::do_not_optimize(array.count(Comparison::Greater, Int32{threshold})); });
+
+    Benchmark::measure("filter: std::copy_if", runs, [&] {
+        std::vector<std::int32_t> kept;
+        kept.reserve(value_count);
+        std::copy_if(raw.begin(), raw.end(), std::back_inserter(kept), [&](std::int32_t value) { return value > threshold; });
+        Benchmark::do_not_optimize(kept.data());
+    });
+    Benchmark::measure("filter: NumberArray", runs, [&] { Benchmark::do_not_optimize(array.filter(Comparison::Greater, Int32{threshold})); });
+    return 0;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file Benchmark-Units/Primitive/StringRope.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Benchmark for repeated String concatenation with and without ropes in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This program concatenates 10^5 fragments with String::concat, once copying flat and once building
+ * a rope, and reads the result afterwards so the rope timing includes flattening.
+ */
+
+#include <Benchmark.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/String/String.hpp>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr std::size_t fragment_count = 100000;
+
+/**
+ * @brief Concatenate every fragment onto the result as `result = result + fragment` would, then read the result.
+ */
+std::size_t concatenate_all(const std::vector<String>& fragments, const StringRopeThresholds& thresholds)
+{
+    String result;
+    for (const String& fragment : fragments) result = String::concat(result, fragment, thresholds);
+    return result.size() + result[result.size() / 2].get_value();
+}
+
+} // namespace
+
+int main()
+{
+    std::vector<String> fragments;
+    fragments.reserve(fragment_count);
+    for (std::size_t i = 0; i < fragment_count; ++i)
+    {
+        std::string fragment = "<item id=";
+        fragment += std::to_string(i);
+        fragment += '>';
+        fragments.push_back(String::from_latin1(fragment));
+    }
+
+    const StringRopeThresholds flat{.min_length = std::numeric_limits<std::size_t>::max()};
+    const StringRopeThresholds rope{};
+
+    Benchmark::measure("concat 10^5 fragments, flat copies", 1, [&] { Benchmark::do_not_optimize(concatenate_all(fragments, flat)); });
+    Benchmark::measure("concat 10^5 fragments, rope", 5, [&] { Benchmark::do_not_optimize(concatenate_all(fragments, rope)); });
+    return 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file Benchmark-Units/Primitive/StringSort.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Benchmark for sorting Strings by code unit less than in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This program sorts 10^5 attribute-like names with long shared prefixes three ways: std::sort with a
+ * comparator reading one code unit at a time, std::sort with String::operator<, and
+ * sort_code_unit_less_than. Every case copies the unsorted list first, so the copy is in all timings.
+ */
+
+#include <Benchmark.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/String/StringSort.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr std::size_t string_count = 100000;
+
+/**
+ * @brief Compares two Strings by code unit less than, one code unit per call of operator[].
+ */
+bool naive_less(const String& lhs, const String& rhs)
+{
+    const std::size_t common = std::min(lhs.size(), rhs.size());
+    for (std::size_t index = 0; index < common; ++index)
+    {
+        const auto left = lhs[index].get_value();
+        const auto right = rhs[index].get_value();
+        if (left != right) return left < right;
+    }
+    return lhs.size() < rhs.size();
+}
+
+} // namespace
+
+int main()
+{
+    static constexpr const char* prefixes[] = {"data-analytics-event-", "aria-describedby-", "data-component-state-", "https://example.com/assets/"};
+    std::mt19937 engine{2026};
+    std::vector<String> strings;
+    strings.reserve(string_count);
+    for (std::size_t i = 0; i < string_count; ++i)
+    {
+        std::string name = prefixes[engine() % std::size(prefixes)];
+        name += std::to_string(engine() % 50000);
+        strings.push_back(String::from_latin1(name));
+    }
+
+    Benchmark::measure("std::sort, naive comparator", 5, [&] {
+        std::vector<String> copy = strings;
+        std::ranges::sort(copy, naive_less);
+        Benchmark::do_not_optimize(copy);
+    });
+    Benchmark::measure("std::sort, operator< (vectorized mismatch)", 5, [&] {
+        std::vector<String> copy = strings;
+        std::ranges::sort(copy, std::less<>{});
+        Benchmark::do_not_optimize(copy);
+    });
+    Benchmark::measure("sort_code_unit_less_than (multikey quicksort)", 5, [&] {
+        std::vector<String> copy = strings;
+        sort_code_unit_less_than(copy);
+        Benchmark::do_not_optimize(copy);
+    });
+    return 0;
+}
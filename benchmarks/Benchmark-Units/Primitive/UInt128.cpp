@@ -0,0 +1,82 @@
+/**
+ * @file Benchmark-Units/Primitive/UInt128.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Benchmark for uint128_t multiplication and division in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This program multiplies, divides and takes the remainder of 10^6 random pairs with uint128_t,
+ * whose operators use unsigned __int128 where the compiler has it, and with the portable two-word
+ * arithmetic used otherwise. Divisions are timed separately for divisors that fit in 64 bits and
+ * for wider ones, since they take different paths. A shift-and-subtract division is the baseline.
+ */
+
+#include <Benchmark.hpp>
+#include <Reference.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/UInt128/uint128_t.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr std::size_t pair_count = 1000000;
+
+/**
+ * @brief Time one binary operation over every pair, summing the results so none is skipped.
+ */
+template <typename F>
+void measure_pairs(const char* name, const std::vector<uint128_t>& lhs, const std::vector<uint128_t>& rhs, F&& operation)
+{
+    Benchmark::measure(name, 5, [&] {
+        uint128_t sum;
+        for (std::size_t i = 0; i < lhs.size(); ++i) sum += operation(lhs[i], rhs[i]);
+        Benchmark::do_not_optimize(sum);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 engine{2026};
+    std::vector<uint128_t> dividends;
+    std::vector<uint128_t> narrow_divisors;
+    std::vector<uint128_t> wide_divisors;
+    dividends.reserve(pair_count);
+    narrow_divisors.reserve(pair_count);
+    wide_divisors.reserve(pair_count);
+    for (std::size_t i = 0; i < pair_count; ++i)
+    {
+        dividends.emplace_back(engine(), engine());
+        narrow_divisors.emplace_back(0, engine() | 1);
+        wide_divisors.emplace_back(engine() >> (engine() % 64) | 1, engine());
+    }
+
+    measure_pairs("multiply, operator*", dividends, wide_divisors, [](const uint128_t& a, const uint128_t& b) { return a * b; });
+    measure_pairs("multiply, portable 64x64 + cross terms", dividends, wide_divisors, [](const uint128_t& a, const uint128_t& b) {
+        uint128_t product = UInt128Portable::multiply(a.low(), b.low());
+        return uint128_t{product.high() + a.high() * b.low() + a.low() * b.high(), product.low()};
+    });
+
+    measure_pairs("divide by 64-bit divisor, operator/", dividends, narrow_divisors, [](const uint128_t& a, const uint128_t& b) { return a / b; });
+    measure_pairs("divide by 64-bit divisor, portable", dividends, narrow_divisors, [](const uint128_t& a, const uint128_t& b) {
+        uint128_t remainder;
+        return UInt128Portable::divide(a, b, remainder);
+    });
+    measure_pairs("divide by wide divisor, operator/", dividends, wide_divisors, [](const uint128_t& a, const uint128_t& b) { return a / b; });
+    measure_pairs("divide by wide divisor, portable", dividends, wide_divisors, [](const uint128_t& a, const uint128_t& b) {
+        uint128_t remainder;
+        return UInt128Portable::divide(a, b, remainder);
+    });
+    measure_pairs("modulo by wide divisor, operator%", dividends, wide_divisors, [](const uint128_t& a, const uint128_t& b) { return a % b; });
+    measure_pairs("divide, shift-and-subtract baseline", dividends, wide_divisors, [](const uint128_t& lhs, const uint128_t& rhs) {
+        uint128_t remainder;
+        return Reference::divide(lhs, rhs, remainder);
+    });
+    return 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file Benchmark-Units/Primitive/WideInt.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Benchmark for uint256_t arithmetic and decimal formatting in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This program adds, multiplies and divides 10^5 random uint256_t pairs, timing divisions separately
+ * for one-word divisors and for wider ones, since they take different paths, and writes every
+ * dividend in decimal. A shift-and-subtract division is the baseline.
+ */
+
+#include <Benchmark.hpp>
+#include <Reference.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr std::size_t pair_count = 100000;
+
+/**
+ * @brief Time one binary operation over every pair, summing the results so none is skipped.
+ */
+template <typename F>
+void measure_pairs(const char* name, const std::vector<uint256_t>& lhs, const std::vector<uint256_t>& rhs, F&& operation)
+{
+    Benchmark::measure(name, 5, [&] {
+        uint256_t sum;
+        for (std::size_t i = 0; i < lhs.size(); ++i) sum += operation(lhs[i], rhs[i]);
+        Benchmark::do_not_optimize(sum);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 engine{2026};
+    std::vector<uint256_t> dividends;
+    std::vector<uint256_t> narrow_divisors;
+    std::vector<uint256_t> wide_divisors;
+    dividends.reserve(pair_count);
+    narrow_divisors.reserve(pair_count);
+    wide_divisors.reserve(pair_count);
+    for (std::size_t i = 0; i < pair_count; ++i)
+    {
+        dividends.push_back(uint256_t::from_words({engine(), engine(), engine(), engine()}));
+        narrow_divisors.push_back(uint256_t{engine() | 1});
+        wide_divisors.push_back(uint256_t::from_words({engine(), engine(), engine() >> (engine() % 64) | 1, 0}));
+    }
+
+    measure_pairs("add, carry chain", dividends, wide_divisors, [](const uint256_t& a, const uint256_t& b) { return a + b; });
+    measure_pairs("multiply, truncated schoolbook", dividends, wide_divisors, [](const uint256_t& a, const uint256_t& b) { return a * b; });
+    measure_pairs("multiply, full width", dividends, wide_divisors, [](const uint256_t& a, const uint256_t& b) {
+        uint256_t high;
+        return uint256_t::multiply(a, b, high) ^ high;
+    });
+
+    measure_pairs("divide by 64-bit divisor, operator/", dividends, narrow_divisors, [](const uint256_t& a, const uint256_t& b) { return a / b; });
+    measure_pairs("divide by wide divisor, operator/", dividends, wide_divisors, [](const uint256_t& a, const uint256_t& b) { return a / b; });
+    measure_pairs("divide, shift-and-subtract baseline", dividends, wide_divisors, [](const uint256_t& lhs, const uint256_t& rhs) {
+        uint256_t remainder;
+        return Reference::divide(lhs, rhs, remainder);
+    });
+
+    Benchmark::measure("write_decimal", 5, [&] {
+        std::size_t length = 0;
+        char buffer[max_decimal_length<uint256_t>];
+        for (const uint256_t& value : dividends) length += static_cast<std::size_t>(write_decimal(buffer, value) - buffer);
+        Benchmark::do_not_optimize(length);
+    });
+    return 0;
+}
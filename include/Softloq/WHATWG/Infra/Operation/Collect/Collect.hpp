@@ -0,0 +1,183 @@
+/**
+ * @file Softloq/WHATWG/Infra/Operation/Collect/Collect.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the collect a sequence of code points operation for the WHATWG Infra library, the position-variable parsing primitive of the WHATWG Infra specification.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the collect a sequence of code points and skip ASCII whitespace operations for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_OPERATION_COLLECT_COLLECT_HPP
+#define SOFTLOQ_WHATWG_INFRA_OPERATION_COLLECT_COLLECT_HPP
+
+#include "Softloq/WHATWG/Infra/Operation/CodePointClass/CodePointClass.hpp"
+#include "Softloq/WHATWG/Infra/Operation/SequenceElement/SequenceElement.hpp"
+#include "Softloq/WHATWG/Infra/SIMD/ClassScan.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <ranges>
+#include <span>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Returns the number of leading elements of a sequence whose code points belong to a code point class.
+ *
+ * This is the scanning step of collect a sequence of code points for code point classes, exposed for
+ * operations that scan runs without a position variable. For UTF-16 input, a surrogate pair is
+ * classified as the code point it encodes and counts as two elements.
+ *
+ * @tparam P The code point class.
+ * @param data The first element of the sequence.
+ * @param size The number of elements in the sequence.
+ * @return The length of the run of elements in the class.
+ */
+template <CodePointClass P, SequenceElement E>
+[[nodiscard]] std::size_t code_point_class_run_length(const E* data, std::size_t size) noexcept;
+
+/**
+ * @brief Returns the number of leading elements of a sequence whose code points lie in a set of ranges chosen at run time.
+ *
+ * The run-time counterpart of code_point_class_run_length, for conditions such as a delimiter code
+ * point that are not known at compile time. A code point matches if it lies inside one of the
+ * ranges, or outside all of them when inverted is true.
+ *
+ * @param data The first element of the sequence.
+ * @param size The number of elements in the sequence.
+ * @param ranges The code point ranges.
+ * @param inverted Whether the ranges list the code points that do not match.
+ * @return The length of the run of matching elements.
+ */
+template <SequenceElement E>
+[[nodiscard]] std::size_t code_point_range_run_length(const E* data, std::size_t size, std::span<const CodePointRange> ranges, bool inverted) noexcept;
+
+/**
+ * @brief Collect a sequence of code points meeting a condition from an input, given a position variable.
+ *
+ * As defined by the WHATWG Infra specification: starting at position, advances position past every
+ * code point that meets the condition and returns the code points passed over. The result is a
+ * non-owning view into the input rather than a new string.
+ *
+ * The input may be a sequence of bytes, UTF-16 code units or code points. Bytes and code points are
+ * each treated as one code point. For UTF-16 input, position is a code unit index and a surrogate
+ * pair is tested as the single code point it encodes.
+ *
+ * If the predicate is a code point class (e.g. ASCIIDigit, Not<ASCIIWhitespace>), the run is found
+ * with a lookup table, or with the vectorized kernels when the input is raw contiguous storage.
+ *
+ * @tparam P The code point class or callable predicate.
+ * @param input The sequence to collect from.
+ * @param position The position variable, advanced past the collected code points.
+ * @param predicate The condition the collected code points meet.
+ * @return A view of the collected elements of input.
+ */
+template <CodePointPredicate P, ViewableSequenceInput R>
+[[nodiscard]] std::span<const std::ranges::range_value_t<R>> collect_a_sequence_of_code_points(R&& input, std::size_t& position, const P& predicate = P{});
+
+/**
+ * @brief Skip ASCII whitespace in an input, given a position variable.
+ *
+ * As defined by the WHATWG Infra specification: collects a sequence of code points that are ASCII
+ * whitespace from the input given position, and discards the result.
+ *
+ * @param input The sequence to skip whitespace in.
+ * @param position The position variable, advanced past the whitespace.
+ */
+template <SequenceInput R>
+void skip_ascii_whitespace(R&& input, std::size_t& position);
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <CodePointClass P, SequenceElement E>
+std::size_t code_point_class_run_length(const E* data, std::size_t size) noexcept
+{
+    using Traits = SequenceElementTraits<E>;
+    using Unit = typename Traits::unit_type;
+
+    std::size_t length = 0;
+    if constexpr (sizeof(Unit) != 2 || code_point_class_below_surrogates<P>)
+    {
+        if constexpr (Traits::is_raw)
+            return SIMD::class_prefix_length(reinterpret_cast<const Unit*>(data), size, P::ranges, P::inverted);
+        else
+            while (length < size && in_code_point_class<P>(Traits::value(data[length])))
+                ++length;
+    }
+    else
+    {
+        while (length < size)
+        {
+            const DecodedCodePoint code_point = decode_code_point(data, size, length);
+            if (!in_code_point_class<P>(code_point.value)) break;
+            length += code_point.length;
+        }
+    }
+    return length;
+}
+
+template <SequenceElement E>
+std::size_t code_point_range_run_length(const E* data, std::size_t size, std::span<const CodePointRange> ranges, bool inverted) noexcept
+{
+    using Traits = SequenceElementTraits<E>;
+    using Unit = typename Traits::unit_type;
+
+    std::size_t length = 0;
+    if (sizeof(Unit) != 2 || std::ranges::all_of(ranges, [](const CodePointRange& range) { return range.last < 0xD800; }))
+    {
+        if constexpr (Traits::is_raw)
+            return SIMD::class_prefix_length(reinterpret_cast<const Unit*>(data), size, ranges, inverted);
+        else
+            while (length < size && SIMD::unit_in_class(Traits::value(data[length]), ranges, inverted))
+                ++length;
+    }
+    else
+    {
+        while (length < size)
+        {
+            const DecodedCodePoint code_point = decode_code_point(data, size, length);
+            if (!SIMD::unit_in_class(code_point.value, ranges, inverted)) break;
+            length += code_point.length;
+        }
+    }
+    return length;
+}
+
+template <CodePointPredicate P, ViewableSequenceInput R>
+std::span<const std::ranges::range_value_t<R>> collect_a_sequence_of_code_points(R&& input, std::size_t& position, const P& predicate)
+{
+    using Element = std::ranges::range_value_t<R>;
+
+    const Element* data = std::ranges::data(input);
+    const std::size_t size = std::ranges::size(input);
+    if (position >= size) return {};
+    const std::size_t start = position;
+
+    if constexpr (CodePointClass<P>)
+    {
+        position += code_point_class_run_length<P>(data + start, size - start);
+    }
+    else
+    {
+        while (position < size)
+        {
+            const DecodedCodePoint code_point = decode_code_point(data, size, position);
+            if (!code_point_predicate_matches(predicate, code_point.value)) break;
+            position += code_point.length;
+        }
+    }
+    return std::span<const Element>{data + start, position - start};
+}
+
+template <SequenceInput R>
+void skip_ascii_whitespace(R&& input, std::size_t& position)
+{
+    static_cast<void>(collect_a_sequence_of_code_points<ASCIIWhitespace>(input, position));
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_OPERATION_COLLECT_COLLECT_HPP
@@ -0,0 +1,246 @@
+/**
+ * @file Softloq/WHATWG/Infra/Operation/Split/Split.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the split operations for the WHATWG Infra library, lazy views over the tokens of byte, code unit and code point sequences.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the SplitView type and the split on ASCII whitespace, strictly split and split on
+ * commas operations for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_OPERATION_SPLIT_SPLIT_HPP
+#define SOFTLOQ_WHATWG_INFRA_OPERATION_SPLIT_SPLIT_HPP
+
+#include "Softloq/WHATWG/Infra/Operation/CodePointClass/CodePointClass.hpp"
+#include "Softloq/WHATWG/Infra/Operation/Collect/Collect.hpp"
+#include "Softloq/WHATWG/Infra/Operation/SequenceElement/SequenceElement.hpp"
+#include "Softloq/WHATWG/Infra/Operation/Whitespace/Whitespace.hpp"
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief The splitting algorithm a SplitView follows.
+ */
+enum class SplitMode
+{
+    ASCIIWhitespace, ///< Split on ASCII whitespace: tokens are the runs between whitespace; no empty tokens.
+    Strict,          ///< Strictly split on a delimiter: every delimiter ends a token, so empty tokens are kept.
+    Commas           ///< Split on commas: tokens between commas, each stripped of leading and trailing ASCII whitespace.
+};
+
+/**
+ * @brief The SplitView class is a lazy, non-owning view of the tokens of a sequence.
+ *
+ * Tokens are produced one at a time as the view is iterated, each as a std::span into the input, so
+ * splitting allocates nothing. Delimiters are located with the vectorized class scan. The input must
+ * outlive the view and its tokens.
+ *
+ * @tparam E The element type of the sequence.
+ */
+template <SequenceElement E>
+class SplitView : public std::ranges::view_interface<SplitView<E>>
+{
+public:
+    class Iterator;
+
+    // Constructors and destructor
+public:
+    constexpr SplitView() noexcept = default;
+
+    /**
+     * @brief Construct a view of the tokens of a sequence.
+     *
+     * @param input The sequence to split.
+     * @param mode The splitting algorithm.
+     * @param delimiter The delimiter code point for SplitMode::Strict; ignored otherwise.
+     */
+    constexpr SplitView(std::span<const E> input, SplitMode mode, char32_t delimiter = U',') noexcept
+        : m_input{input}, m_mode{mode}, m_delimiter{delimiter}
+    {
+    }
+
+    // Range interface
+public:
+    /**
+     * @brief Returns an iterator to the first token.
+     */
+    [[nodiscard]] constexpr Iterator begin() const noexcept { return Iterator{m_input, m_mode, m_delimiter}; }
+
+    /**
+     * @brief Returns the sentinel marking the end of the tokens.
+     */
+    [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+private:
+    std::span<const E> m_input{};
+    SplitMode m_mode{SplitMode::ASCIIWhitespace};
+    char32_t m_delimiter{U','};
+};
+
+/**
+ * @brief The forward iterator of a SplitView, yielding each token as a std::span of the input.
+ */
+template <SequenceElement E>
+class SplitView<E>::Iterator
+{
+public:
+    using value_type = std::span<const E>;
+    using difference_type = std::ptrdiff_t;
+
+    // Constructors and destructor
+public:
+    constexpr Iterator() noexcept = default;
+
+    constexpr Iterator(std::span<const E> input, SplitMode mode, char32_t delimiter) noexcept
+        : m_data{input.data()}, m_size{input.size()}, m_mode{mode}, m_delimiter{delimiter, delimiter}
+    {
+        if (m_mode == SplitMode::ASCIIWhitespace) m_position = code_point_class_run_length<ASCIIWhitespace>(m_data, m_size);
+        m_done = false;
+        advance();
+    }
+
+    // Iterator interface
+public:
+    [[nodiscard]] constexpr value_type operator*() const noexcept { return m_token; }
+
+    constexpr Iterator& operator++() noexcept
+    {
+        advance();
+        return *this;
+    }
+
+    constexpr Iterator operator++(int) noexcept
+    {
+        Iterator previous = *this;
+        advance();
+        return previous;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const Iterator& other) const noexcept
+    {
+        return m_done == other.m_done && (m_done || (m_data == other.m_data && m_position == other.m_position));
+    }
+
+    [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept { return m_done; }
+
+private:
+    /**
+     * @brief Collects the next token into m_token, or marks the iterator done.
+     */
+    constexpr void advance() noexcept
+    {
+        if (m_position > m_size || (m_position == m_size && m_mode != SplitMode::Strict))
+        {
+            m_done = true;
+            m_token = {};
+            return;
+        }
+
+        const std::size_t start = m_position;
+        if (m_mode == SplitMode::ASCIIWhitespace)
+        {
+            m_position += code_point_class_run_length<Not<ASCIIWhitespace>>(m_data + start, m_size - start);
+            m_token = value_type{m_data + start, m_position - start};
+            m_position += code_point_class_run_length<ASCIIWhitespace>(m_data + m_position, m_size - m_position);
+            return;
+        }
+
+        const CodePointRange ranges[1]{m_delimiter};
+        m_position += code_point_range_run_length(m_data + start, m_size - start, ranges, true);
+        m_token = value_type{m_data + start, m_position - start};
+        if (m_mode == SplitMode::Commas) m_token = strip_leading_and_trailing_ascii_whitespace(m_token);
+
+        // Step past the delimiter; a strict split past the last delimiter has no more tokens.
+        if (m_position < m_size)
+            m_position += decode_code_point(m_data, m_size, m_position).length;
+        else if (m_mode == SplitMode::Strict)
+            m_position = m_size + 1;
+    }
+
+    const E* m_data{nullptr};
+    std::size_t m_size{0};
+    std::size_t m_position{0};
+    value_type m_token{};
+    SplitMode m_mode{SplitMode::ASCIIWhitespace};
+    CodePointRange m_delimiter{};
+    bool m_done{true};
+};
+
+/**
+ * @brief Split an input on ASCII whitespace.
+ *
+ * As defined by the WHATWG Infra specification: the tokens are the maximal runs of code points that
+ * are not ASCII whitespace. Leading, trailing and repeated whitespace produce no empty tokens.
+ *
+ * @param input The sequence to split.
+ * @return A lazy view of the tokens.
+ */
+template <ViewableSequenceInput R>
+[[nodiscard]] SplitView<std::ranges::range_value_t<R>> split_on_ascii_whitespace(R&& input) noexcept;
+
+/**
+ * @brief Strictly split an input on a particular delimiter code point.
+ *
+ * As defined by the WHATWG Infra specification: every delimiter ends a token, so an input with n
+ * delimiters always yields n + 1 tokens, some of which may be empty.
+ *
+ * @param input The sequence to split.
+ * @param delimiter The delimiter code point.
+ * @return A lazy view of the tokens.
+ */
+template <ViewableSequenceInput R>
+[[nodiscard]] SplitView<std::ranges::range_value_t<R>> strictly_split(R&& input, char32_t delimiter) noexcept;
+
+/**
+ * @brief Split an input on commas.
+ *
+ * As defined by the WHATWG Infra specification: the tokens are the runs between U+002C (,) code
+ * points, each stripped of leading and trailing ASCII whitespace. A trailing comma does not produce
+ * a trailing empty token.
+ *
+ * @param input The sequence to split.
+ * @return A lazy view of the tokens.
+ */
+template <ViewableSequenceInput R>
+[[nodiscard]] SplitView<std::ranges::range_value_t<R>> split_on_commas(R&& input) noexcept;
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <ViewableSequenceInput R>
+SplitView<std::ranges::range_value_t<R>> split_on_ascii_whitespace(R&& input) noexcept
+{
+    using Element = std::ranges::range_value_t<R>;
+    return SplitView<Element>{std::span<const Element>{std::ranges::data(input), std::ranges::size(input)}, SplitMode::ASCIIWhitespace};
+}
+
+template <ViewableSequenceInput R>
+SplitView<std::ranges::range_value_t<R>> strictly_split(R&& input, char32_t delimiter) noexcept
+{
+    using Element = std::ranges::range_value_t<R>;
+    return SplitView<Element>{std::span<const Element>{std::ranges::data(input), std::ranges::size(input)}, SplitMode::Strict, delimiter};
+}
+
+template <ViewableSequenceInput R>
+SplitView<std::ranges::range_value_t<R>> split_on_commas(R&& input) noexcept
+{
+    using Element = std::ranges::range_value_t<R>;
+    return SplitView<Element>{std::span<const Element>{std::ranges::data(input), std::ranges::size(input)}, SplitMode::Commas, U','};
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+/**
+ * @brief SplitView iterators point into the input, not the view, so they may outlive the view.
+ */
+template <Softloq::WHATWG::Infra::SequenceElement E>
+inline constexpr bool std::ranges::enable_borrowed_range<Softloq::WHATWG::Infra::SplitView<E>> = true;
+
+#endif // SOFTLOQ_WHATWG_INFRA_OPERATION_SPLIT_SPLIT_HPP
@@ -0,0 +1,167 @@
+/**
+ * @file Softloq/WHATWG/Infra/Operation/Whitespace/Whitespace.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the whitespace and newline operations for the WHATWG Infra library, stripping, collapsing and normalizing byte, code unit and code point sequences.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the strip newlines, normalize newlines, strip leading and trailing ASCII whitespace,
+ * and strip and collapse ASCII whitespace operations for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_OPERATION_WHITESPACE_WHITESPACE_HPP
+#define SOFTLOQ_WHATWG_INFRA_OPERATION_WHITESPACE_WHITESPACE_HPP
+
+#include "Softloq/WHATWG/Infra/Operation/CodePointClass/CodePointClass.hpp"
+#include "Softloq/WHATWG/Infra/Operation/Collect/Collect.hpp"
+#include "Softloq/WHATWG/Infra/Operation/SequenceElement/SequenceElement.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <ranges>
+#include <span>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Strip newlines from a sequence in place.
+ *
+ * As defined by the WHATWG Infra specification: removes every U+000A LF and U+000D CR code point.
+ * Runs between newlines are found with the vectorized class scan and moved down in one pass; the
+ * sequence is then shrunk, so no memory is allocated.
+ *
+ * @param sequence The sequence to strip.
+ */
+template <ResizableSequence S>
+void strip_newlines(S& sequence);
+
+/**
+ * @brief Normalize newlines in a sequence in place.
+ *
+ * As defined by the WHATWG Infra specification: replaces every U+000D CR U+000A LF pair with a single
+ * U+000A LF, and then every remaining U+000D CR with U+000A LF. Both replacements are done in one pass.
+ *
+ * @param sequence The sequence to normalize.
+ */
+template <ResizableSequence S>
+void normalize_newlines(S& sequence);
+
+/**
+ * @brief Strip leading and trailing ASCII whitespace from an input.
+ *
+ * As defined by the WHATWG Infra specification: removes the ASCII whitespace at the start and end of
+ * the input. The result is a non-owning view into the input; nothing is copied.
+ *
+ * @param input The sequence to strip.
+ * @return A view of input without its leading and trailing ASCII whitespace.
+ */
+template <ViewableSequenceInput R>
+[[nodiscard]] std::span<const std::ranges::range_value_t<R>> strip_leading_and_trailing_ascii_whitespace(R&& input) noexcept;
+
+/**
+ * @brief Strip and collapse ASCII whitespace in a sequence in place.
+ *
+ * As defined by the WHATWG Infra specification: replaces every run of one or more ASCII whitespace
+ * code points with a single U+0020 SPACE, and then removes the leading and trailing ASCII whitespace.
+ * Both steps are done in one pass.
+ *
+ * @param sequence The sequence to strip and collapse.
+ */
+template <ResizableSequence S>
+void strip_and_collapse_ascii_whitespace(S& sequence);
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <ResizableSequence S>
+void strip_newlines(S& sequence)
+{
+    auto* data = std::ranges::data(sequence);
+    const std::size_t size = std::ranges::size(sequence);
+    std::size_t read = 0;
+    std::size_t write = 0;
+    while (read < size)
+    {
+        const std::size_t run = code_point_class_run_length<Not<ASCIINewline>>(data + read, size - read);
+        if (write != read) std::copy(data + read, data + read + run, data + write);
+        read += run;
+        write += run;
+        read += code_point_class_run_length<ASCIINewline>(data + read, size - read);
+    }
+    sequence.resize(write);
+}
+
+template <ResizableSequence S>
+void normalize_newlines(S& sequence)
+{
+    using Traits = SequenceElementTraits<std::ranges::range_value_t<S>>;
+
+    auto* data = std::ranges::data(sequence);
+    const std::size_t size = std::ranges::size(sequence);
+    std::size_t read = 0;
+    std::size_t write = 0;
+    while (read < size)
+    {
+        const std::size_t run = code_point_class_run_length<Not<ASCIINewline>>(data + read, size - read);
+        if (write != read) std::copy(data + read, data + read + run, data + write);
+        read += run;
+        write += run;
+        if (read == size) break;
+
+        if (Traits::value(data[read]) == U'\r')
+        {
+            data[write++] = Traits::from_value(U'\n');
+            ++read;
+            if (read < size && Traits::value(data[read]) == U'\n') ++read;
+        }
+        else
+        {
+            if (write != read) data[write] = data[read];
+            ++read;
+            ++write;
+        }
+    }
+    sequence.resize(write);
+}
+
+template <ViewableSequenceInput R>
+std::span<const std::ranges::range_value_t<R>> strip_leading_and_trailing_ascii_whitespace(R&& input) noexcept
+{
+    using Element = std::ranges::range_value_t<R>;
+    using Traits = SequenceElementTraits<Element>;
+
+    const Element* data = std::ranges::data(input);
+    std::size_t last = std::ranges::size(input);
+    const std::size_t first = code_point_class_run_length<ASCIIWhitespace>(data, last);
+    while (last > first && in_code_point_class<ASCIIWhitespace>(Traits::value(data[last - 1])))
+        --last;
+    return std::span<const Element>{data + first, last - first};
+}
+
+template <ResizableSequence S>
+void strip_and_collapse_ascii_whitespace(S& sequence)
+{
+    using Traits = SequenceElementTraits<std::ranges::range_value_t<S>>;
+
+    auto* data = std::ranges::data(sequence);
+    const std::size_t size = std::ranges::size(sequence);
+    std::size_t read = code_point_class_run_length<ASCIIWhitespace>(data, size);
+    std::size_t write = 0;
+    while (read < size)
+    {
+        const std::size_t run = code_point_class_run_length<Not<ASCIIWhitespace>>(data + read, size - read);
+        if (write != read) std::copy(data + read, data + read + run, data + write);
+        read += run;
+        write += run;
+
+        const std::size_t spaces = code_point_class_run_length<ASCIIWhitespace>(data + read, size - read);
+        read += spaces;
+        if (spaces != 0 && read < size) data[write++] = Traits::from_value(U' ');
+    }
+    sequence.resize(write);
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_OPERATION_WHITESPACE_WHITESPACE_HPP
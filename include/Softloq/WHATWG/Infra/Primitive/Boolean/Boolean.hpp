@@ -24,22 +24,13 @@ namespace Softloq::WHATWG::Infra
  * It provides value construction, mutation, logical negation, equality comparison,
  * and implicit conversion to the underlying bool type.
  */
-class Boolean final : public Primitive
+class Boolean final : public Primitive<PrimitiveType::Boolean>
 {
 // Constructors and destructor
 public:
-    SOFTLOQ_WHATWG_INFRA_API Boolean() noexcept;
+    Boolean() noexcept = default;
     SOFTLOQ_WHATWG_INFRA_API explicit Boolean(bool value) noexcept;
-    SOFTLOQ_WHATWG_INFRA_API ~Boolean() noexcept;
-
-// Primitive interface
-public:
-    /**
-     * @brief Get the type of the primitive.
-     *
-     * @return The type of the primitive, which is PrimitiveType::Boolean.
-     */
-    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API PrimitiveType get_type() const noexcept override;
+    ~Boolean() noexcept = default;
 
 // Accessors
 public:
@@ -25,23 +25,13 @@ namespace Softloq::WHATWG::Infra
  * specification. It provides value construction, mutation, equality comparison,
  * and explicit conversion to the underlying std::uint8_t type.
  */
-class Byte final : public Primitive
+class Byte final : public Primitive<PrimitiveType::Byte>
 {
 // Constructors and destructor
 public:
-    SOFTLOQ_WHATWG_INFRA_API Byte() noexcept;
+    Byte() noexcept = default;
     SOFTLOQ_WHATWG_INFRA_API explicit Byte(std::uint8_t value) noexcept;
-    SOFTLOQ_WHATWG_INFRA_API Byte(const Byte& other) noexcept;
-    SOFTLOQ_WHATWG_INFRA_API ~Byte() noexcept;
-
-// Primitive interface
-public:
-    /**
-     * @brief Get the type of the primitive.
-     *
-     * @return The type of the primitive, which is PrimitiveType::Byte.
-     */
-    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API PrimitiveType get_type() const noexcept override;
+    ~Byte() noexcept = default;
 
 // Accessors
 public:
@@ -14,6 +14,7 @@
 #include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Primitive.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Byte/Byte.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
 #include <cstddef>
 #include <initializer_list>
 #include <vector>
@@ -26,10 +27,9 @@ namespace Softloq::WHATWG::Infra
  *
  * The ByteSequence type represents a sequence of zero or more bytes, as defined by the WHATWG
  * Infra specification. It provides construction, element access, mutation, WHATWG Infra operations
- * (byte_lowercase, byte_uppercase, starts_with), and equality comparison. Isomorphic decode is
- * omitted until the String primitive is available.
+ * (byte_lowercase, byte_uppercase, starts_with, isomorphic_decode), and equality comparison.
  */
-class ByteSequence final : public Primitive
+class ByteSequence final : public Primitive<PrimitiveType::ByteSequence>
 {
 // Constructors and destructor
 public:
@@ -38,15 +38,6 @@ public:
     SOFTLOQ_WHATWG_INFRA_API ByteSequence(const ByteSequence& other) noexcept;
     SOFTLOQ_WHATWG_INFRA_API ~ByteSequence() noexcept;
 
-// Primitive interface
-public:
-    /**
-     * @brief Get the type of the primitive.
-     *
-     * @return The type of the primitive, which is PrimitiveType::ByteSequence.
-     */
-    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API PrimitiveType get_type() const noexcept override;
-
 // Container interface
 public:
     /**
@@ -109,6 +100,13 @@ public:
      */
     SOFTLOQ_WHATWG_INFRA_API void clear() noexcept;
 
+    /**
+     * @brief Resize the sequence to the given number of bytes, appending 0x00 bytes when growing.
+     *
+     * @param size The new number of bytes.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void resize(std::size_t size);
+
     /**
      * @brief Returns an iterator to the first byte of the sequence.
      */
@@ -184,6 +182,17 @@ public:
      */
     [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool starts_with(const ByteSequence& other) const noexcept;
 
+    /**
+     * @brief Isomorphic decode the byte sequence into a String.
+     *
+     * Isomorphic decode maps each byte to the code point of equal value, as defined by the WHATWG
+     * Infra specification. Use IsomorphicStringView to compare or search the decoded String without
+     * materializing it.
+     *
+     * @return An 8-bit String whose code units are the bytes of this sequence.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API String isomorphic_decode() const;
+
 private:
     std::vector<Byte> m_bytes;
 };
@@ -25,22 +25,13 @@ namespace Softloq::WHATWG::Infra
  * equality comparison, explicit conversion to the underlying char32_t type, and a full set
  * of Unicode attribute predicates (e.g. is_surrogate, is_ascii, is_ascii_whitespace).
  */
-class CodePoint final : public Primitive
+class CodePoint final : public Primitive<PrimitiveType::CodePoint>
 {
 // Constructors and destructor
 public:
-    SOFTLOQ_WHATWG_INFRA_API CodePoint() noexcept;
+    CodePoint() noexcept = default;
     SOFTLOQ_WHATWG_INFRA_API explicit CodePoint(char32_t value) noexcept;
-    SOFTLOQ_WHATWG_INFRA_API ~CodePoint() noexcept;
-
-// Primitive interface
-public:
-    /**
-     * @brief Get the type of the primitive.
-     *
-     * @return The type of the primitive, which is PrimitiveType::CodePoint.
-     */
-    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API PrimitiveType get_type() const noexcept override;
+    ~CodePoint() noexcept = default;
 
 // Accessors
 public:
@@ -30,22 +30,13 @@ namespace Softloq::WHATWG::Infra
  * @note This is an auxiliary class to the String primitive. It is used internally by the
  * String type to represent individual elements of a UTF-16 encoded string.
  */
-class CodeUnit final : public Primitive
+class CodeUnit final : public Primitive<PrimitiveType::CodeUnit>
 {
 // Constructors and destructor
 public:
-    SOFTLOQ_WHATWG_INFRA_API CodeUnit() noexcept;
+    CodeUnit() noexcept = default;
     SOFTLOQ_WHATWG_INFRA_API explicit CodeUnit(std::uint16_t value) noexcept;
-    SOFTLOQ_WHATWG_INFRA_API ~CodeUnit() noexcept;
-
-// Primitive interface
-public:
-    /**
-     * @brief Get the type of the primitive.
-     *
-     * @return The type of the primitive, which is PrimitiveType::CodeUnit.
-     */
-    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API PrimitiveType get_type() const noexcept override;
+    ~CodeUnit() noexcept = default;
 
 // Accessors
 public:
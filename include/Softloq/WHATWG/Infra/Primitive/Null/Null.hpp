@@ -23,20 +23,12 @@ namespace Softloq::WHATWG::Infra
  * The Null type represents a null value in the context of web APIs.
  * It is used to indicate the absence of a value or a null reference.
  */
-class Null final : public Primitive
+class Null final : public Primitive<PrimitiveType::Null>
 {
 // Constructors and destructor
 public:
-    SOFTLOQ_WHATWG_INFRA_API Null() noexcept;
-    SOFTLOQ_WHATWG_INFRA_API ~Null() noexcept;
-
-public:
-    /**
-     * @brief Get the type of the primitive.
-     * 
-     * @return The type of the primitive, which is PrimitiveType::Null.
-     */
-    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API PrimitiveType get_type() const noexcept override;
+    Null() noexcept = default;
+    ~Null() noexcept = default;
 };
 
 } // namespace Softloq::WHATWG::Infra
@@ -0,0 +1,34 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/BigInt/BigInt.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the BigInt type for the WHATWG Infra library, representing integer numeric values of arbitrary precision in the context of web APIs.
+ * 
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the BigInt type for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_BIGINT_BIGINT_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_BIGINT_BIGINT_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/BigInt/bigint_t.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+
+namespace Softloq::WHATWG::Infra
+{
+
+static_assert(IntegralConcept<bigint_t>, "bigint_t must be an integral type"); // Passes
+extern template class SOFTLOQ_WHATWG_INFRA_API Number<bigint_t>;
+
+/**
+ * @brief Alias for an arbitrary-precision integer Number.
+ */
+using BigInt = Number<bigint_t>;
+
+} // namespace Softloq::WHATWG::Infra
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/BigInt/Formatter.tpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/BigInt/OStream.inl"
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_BIGINT_BIGINT_HPP
\ No newline at end of file
@@ -0,0 +1,36 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/BigInt/Formatter.tpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Formatter specialization for the BigInt primitive type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains the formatter specialization for the BigInt primitive type.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_BIGINT_FORMATTER_TPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_BIGINT_FORMATTER_TPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/BigInt/BigInt.hpp"
+#include <algorithm>
+#include <format>
+#include <string>
+
+/**
+ * @brief Formatter specialization for BigInt (Number<bigint_t>).
+ *
+ * Writes the value with bigint_t::to_decimal().
+ */
+template <>
+struct std::formatter<Softloq::WHATWG::Infra::Number<Softloq::WHATWG::Infra::bigint_t>>
+{
+    constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+    auto format(const Softloq::WHATWG::Infra::Number<Softloq::WHATWG::Infra::bigint_t>& value, std::format_context& ctx) const
+    {
+        const std::string digits = value.get_value().to_decimal();
+        return std::copy(digits.begin(), digits.end(), ctx.out());
+    }
+};
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_BIGINT_FORMATTER_TPP
@@ -0,0 +1,519 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/Divider.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the Divider type template, which divides many integers by one divisor with a multiply and a shift.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines Divider<T> for every fixed-width integer type, and the Number division and modulo operators that take one.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DIVIDER_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DIVIDER_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Overflow.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/uint128_t.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp"
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief The unsigned type of the same width as T, which the magic-number arithmetic runs in: the unsigned WideInt of the same width for WideInt.
+ */
+template <FixedWidthInteger T>
+struct divider_unsigned
+{
+    using type = std::make_unsigned_t<T>;
+};
+
+template <>
+struct divider_unsigned<uint128_t>
+{
+    using type = uint128_t;
+};
+
+template <std::size_t Bits, bool Signed>
+struct divider_unsigned<WideInt<Bits, Signed>>
+{
+    using type = WideInt<Bits, false>;
+};
+
+/**
+ * @brief The unsigned type of the same width as T.
+ */
+template <FixedWidthInteger T>
+using divider_unsigned_t = typename divider_unsigned<T>::type;
+
+/**
+ * @brief Divides integers by a divisor fixed at construction, with a multiply and a shift instead of a hardware divide.
+ *
+ * The constructor pays for one division to find a magic number m and a shift s such that
+ * n / d == mulhi(m, n) >> s for every n of type T, where mulhi is the high half of the full product
+ * (libdivide's algorithm, after Granlund and Montgomery). Divisors for which m needs one bit more
+ * than T has take a fix-up add, and powers of two take a plain shift. Signed division truncates
+ * towards zero, like the built-in operator, and INT_MIN / -1 wraps to INT_MIN. 8-bit to 32-bit
+ * types multiply in 64 bits, 64-bit types in uint128_t, and uint128_t and WideInt from 64 x 64 bit
+ * word products, so the gain over operator/ grows with the width: a 64-bit or 128-bit hardware divide
+ * costs tens of cycles, a wide WideInt divide runs Knuth's algorithm D. All operations are constexpr.
+ *
+ * @tparam T The fixed-width integer type of the dividends and the divisor.
+ */
+template <FixedWidthInteger T>
+class Divider final
+{
+public:
+    /**
+     * @brief The unsigned type of the same width as T.
+     */
+    using unsigned_type = divider_unsigned_t<T>;
+
+// Constructors and destructor
+public:
+    /**
+     * @brief Precompute the magic number of a divisor.
+     *
+     * @param divisor The divisor.
+     * @throws std::invalid_argument if divisor is zero.
+     */
+    constexpr explicit Divider(T divisor);
+
+    /**
+     * @brief Precompute the magic number of a Number divisor.
+     *
+     * @see Divider(T)
+     */
+    constexpr explicit Divider(const Number<T>& divisor);
+
+    constexpr ~Divider() noexcept = default;
+
+// Accessors
+public:
+    /**
+     * @brief Get the divisor.
+     *
+     * @return The divisor the Divider was constructed with.
+     */
+    [[nodiscard]] constexpr T get_divisor() const noexcept;
+
+// Division
+public:
+    /**
+     * @brief Divide an integer by the divisor.
+     *
+     * @param dividend The dividend.
+     * @return dividend / divisor, truncated towards zero.
+     */
+    [[nodiscard]] constexpr T divide(T dividend) const noexcept;
+
+    /**
+     * @brief Get the remainder of dividing an integer by the divisor, as dividend - quotient * divisor.
+     *
+     * @param dividend The dividend.
+     * @return dividend % divisor, which takes the sign of the dividend.
+     */
+    [[nodiscard]] constexpr T modulo(T dividend) const noexcept;
+
+    /**
+     * @brief Divide a run of integers by the divisor.
+     *
+     * The choice between the shift, the multiply and the multiply with the fix-up add is made once for
+     * the run, so the loop body is branch-free.
+     *
+     * @param dividends The dividends.
+     * @param count The number of dividends.
+     * @param out Where to write the count quotients. It may be dividends.
+     */
+    constexpr void divide(const T* dividends, std::size_t count, T* out) const noexcept;
+
+    /**
+     * @brief Get the remainders of dividing a run of integers by the divisor.
+     *
+     * @param dividends The dividends.
+     * @param count The number of dividends.
+     * @param out Where to write the count remainders. It may be dividends.
+     */
+    constexpr void modulo(const T* dividends, std::size_t count, T* out) const noexcept;
+
+// Number operators
+public:
+    /**
+     * @brief Division of a Number by the divisor.
+     */
+    [[nodiscard]] friend constexpr Number<T> operator/(const Number<T>& dividend, const Divider& divider) noexcept
+    {
+        return Number<T>{divider.divide(dividend.get_value())};
+    }
+
+    /**
+     * @brief Modulo of a Number by the divisor.
+     */
+    [[nodiscard]] friend constexpr Number<T> operator%(const Number<T>& dividend, const Divider& divider) noexcept
+    {
+        return Number<T>{divider.modulo(dividend.get_value())};
+    }
+
+    /**
+     * @brief Division assignment of a Number by the divisor.
+     */
+    friend constexpr Number<T>& operator/=(Number<T>& dividend, const Divider& divider) noexcept
+    {
+        dividend.set_value(divider.divide(dividend.get_value()));
+        return dividend;
+    }
+
+    /**
+     * @brief Modulo assignment of a Number by the divisor.
+     */
+    friend constexpr Number<T>& operator%=(Number<T>& dividend, const Divider& divider) noexcept
+    {
+        dividend.set_value(divider.modulo(dividend.get_value()));
+        return dividend;
+    }
+
+private:
+    static constexpr int bits = static_cast<int>(8 * sizeof(T));
+    static constexpr bool is_signed = !std::same_as<T, unsigned_type>;
+
+    /**
+     * @brief Divide or reduce a run of integers, choosing the quotient kernel once for the run.
+     */
+    template <bool Remainder>
+    constexpr void divide_run(const T* dividends, std::size_t count, T* out) const noexcept;
+
+    /**
+     * @brief The remainder of a dividend, given its quotient.
+     */
+    [[nodiscard]] constexpr T remainder_of(T dividend, T quotient) const noexcept;
+
+    /**
+     * @brief The quotient when the divisor is a power of two, or minus one.
+     */
+    [[nodiscard]] constexpr T divide_by_shift(T dividend) const noexcept;
+
+    /**
+     * @brief The quotient when the divisor has a magic number, with the fix-up add or not.
+     */
+    template <bool Add>
+    [[nodiscard]] constexpr T divide_by_magic(T dividend) const noexcept;
+
+    T m_divisor;
+    unsigned_type m_magic{};
+    int m_shift{0};
+    bool m_add{false};
+    bool m_negative{false};
+};
+
+/**
+ * @brief Reinterpret an integer as the unsigned type of the same width.
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr divider_unsigned_t<T> to_unsigned(const T& value) noexcept
+{
+    if constexpr (std::same_as<T, divider_unsigned_t<T>>)
+        return value;
+    else if constexpr (std::integral<T>)
+        return static_cast<divider_unsigned_t<T>>(value);
+    else
+        return divider_unsigned_t<T>{value};
+}
+
+/**
+ * @brief Reinterpret an unsigned integer as T, of the same width.
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr T from_unsigned(const divider_unsigned_t<T>& value) noexcept
+{
+    if constexpr (std::same_as<T, divider_unsigned_t<T>>)
+        return value;
+    else if constexpr (std::integral<T>)
+        return static_cast<T>(value);
+    else
+        return T{value};
+}
+
+/**
+ * @brief The number of bits needed to represent an unsigned value, 0 for zero.
+ */
+template <typename U>
+[[nodiscard]] constexpr int unsigned_bit_width(const U& value) noexcept
+{
+    if constexpr (std::integral<U>)
+        return static_cast<int>(std::bit_width(value));
+    else if constexpr (std::same_as<U, uint128_t>)
+        return value.high() != 0 ? 64 + static_cast<int>(std::bit_width(value.high())) : static_cast<int>(std::bit_width(value.low()));
+    else
+    {
+        for (std::size_t index = U::word_count; index-- > 0;)
+            if (value.word(index) != 0) return static_cast<int>(64 * index + std::bit_width(value.word(index)));
+        return 0;
+    }
+}
+
+/**
+ * @brief Whether the top bit of an unsigned value is set, i.e. whether it is negative as a signed value.
+ */
+template <typename U>
+[[nodiscard]] constexpr bool is_top_bit_set(const U& value) noexcept
+{
+    return (value >> static_cast<int>(8 * sizeof(U) - 1)) != U{};
+}
+
+/**
+ * @brief All ones if the top bit of an unsigned value is set, zero otherwise, so the quotient kernels need no branch on the sign.
+ */
+template <typename U>
+[[nodiscard]] constexpr U sign_mask(const U& value) noexcept
+{
+    return static_cast<U>(U{} - static_cast<U>(value >> static_cast<int>(8 * sizeof(U) - 1)));
+}
+
+/**
+ * @brief The product of two unsigned values modulo 2^N, without the promotion to int of the narrow types.
+ */
+template <typename U>
+[[nodiscard]] constexpr U multiply_low(const U& lhs, const U& rhs) noexcept
+{
+    if constexpr (std::integral<U> && sizeof(U) < sizeof(unsigned))
+        return static_cast<U>(static_cast<unsigned>(lhs) * static_cast<unsigned>(rhs));
+    else
+        return lhs * rhs;
+}
+
+/**
+ * @brief The high half of the full product of two unsigned values.
+ */
+template <typename U>
+[[nodiscard]] constexpr U multiply_high(const U& lhs, const U& rhs) noexcept
+{
+    if constexpr (std::integral<U> && sizeof(U) <= 4)
+        return static_cast<U>((static_cast<std::uint64_t>(lhs) * rhs) >> (8 * sizeof(U)));
+    else if constexpr (std::integral<U>)
+        return uint128_t::multiply(lhs, rhs).high();
+    else if constexpr (std::same_as<U, uint128_t>)
+    {
+        // Four 64 x 64 bit products; the middle column is summed in 128 bits to keep its carries.
+        const uint128_t low_low = uint128_t::multiply(lhs.low(), rhs.low());
+        const uint128_t low_high = uint128_t::multiply(lhs.low(), rhs.high());
+        const uint128_t high_low = uint128_t::multiply(lhs.high(), rhs.low());
+        const uint128_t high_high = uint128_t::multiply(lhs.high(), rhs.high());
+        const uint128_t middle = uint128_t{low_low.high()} + uint128_t{low_high.low()} + uint128_t{high_low.low()};
+        return high_high + uint128_t{low_high.high()} + uint128_t{high_low.high()} + uint128_t{middle.high()};
+    }
+    else
+    {
+        U high;
+        static_cast<void>(U::multiply(lhs, rhs, high));
+        return high;
+    }
+}
+
+/**
+ * @brief The high half of the full product of two values of the unsigned type, read as signed.
+ *
+ * The signed product differs from the unsigned one by the other operand for each negative operand.
+ */
+template <typename U>
+[[nodiscard]] constexpr U multiply_high_signed(const U& lhs, const U& rhs) noexcept
+{
+    const U high = multiply_high(lhs, rhs);
+    return static_cast<U>(static_cast<U>(high - static_cast<U>(rhs & sign_mask(lhs))) - static_cast<U>(lhs & sign_mask(rhs)));
+}
+
+/**
+ * @brief Shift an unsigned value right, filling with its top bit as a signed shift does.
+ */
+template <typename U>
+[[nodiscard]] constexpr U shift_right_signed(const U& value, int shift) noexcept
+{
+    const U mask = sign_mask(value);
+    return static_cast<U>(static_cast<U>(static_cast<U>(value ^ mask) >> shift) ^ mask);
+}
+
+/**
+ * @brief Divide 2^exponent by an unsigned divisor in twice its width, for exponents below twice its width.
+ *
+ * @param exponent The power of two to divide.
+ * @param divisor The divisor, greater than 2^(exponent - N) so the quotient fits in U.
+ * @param remainder Receives the remainder.
+ * @return The quotient.
+ */
+template <typename U>
+[[nodiscard]] constexpr U divide_power_of_two(int exponent, const U& divisor, U& remainder) noexcept
+{
+    if constexpr (std::integral<U> && sizeof(U) <= 4)
+    {
+        const std::uint64_t dividend = std::uint64_t{1} << exponent;
+        remainder = static_cast<U>(dividend % divisor);
+        return static_cast<U>(dividend / divisor);
+    }
+    else if constexpr (std::integral<U>)
+    {
+        uint128_t wide_remainder;
+        const uint128_t quotient = uint128_t::divide(uint128_t{1} << exponent, uint128_t{divisor}, wide_remainder);
+        remainder = wide_remainder.low();
+        return quotient.low();
+    }
+    else
+    {
+        using Wide = WideInt<16 * sizeof(U), false>;
+        Wide wide_remainder;
+        const Wide quotient = Wide::divide(Wide{1} << exponent, Wide{divisor}, wide_remainder);
+        if constexpr (std::same_as<U, uint128_t>)
+        {
+            remainder = static_cast<uint128_t>(wide_remainder);
+            return static_cast<uint128_t>(quotient);
+        }
+        else
+        {
+            remainder = U{wide_remainder};
+            return U{quotient};
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <FixedWidthInteger T>
+constexpr Divider<T>::Divider(T divisor) : m_divisor{divisor}
+{
+    using U = unsigned_type;
+    const U raw = to_unsigned(divisor);
+    if (raw == U{}) throw std::invalid_argument("Divider of zero");
+
+    m_negative = is_signed && is_top_bit_set(raw);
+    const U magnitude = m_negative ? static_cast<U>(U{} - raw) : raw;
+    const int floor_log2 = unsigned_bit_width(magnitude) - 1;
+    if ((magnitude & static_cast<U>(magnitude - U{1})) == U{})
+    {
+        // A power of two, or its negation: m_magic stays zero and the quotient is a shift.
+        m_shift = floor_log2;
+        return;
+    }
+
+    // m = 2^(N + L) / |d| for the unsigned types, 2^(N + L - 1) / |d| for the signed ones, whose
+    // products keep one bit less. When the error e = |d| - remainder is below 2^L, m + 1 is exact
+    // for every dividend; otherwise the doubled m + 1 needs N + 1 bits, whose top bit is the fix-up add.
+    const int scale = is_signed ? floor_log2 - 1 : floor_log2;
+    U remainder{};
+    U magic = divide_power_of_two(bits + scale, magnitude, remainder);
+    const U error = static_cast<U>(magnitude - remainder);
+    if (error < static_cast<U>(U{1} << floor_log2))
+        m_shift = scale;
+    else
+    {
+        magic = static_cast<U>(magic + magic);
+        const U twice_remainder = static_cast<U>(remainder + remainder);
+        if (twice_remainder >= magnitude || twice_remainder < remainder) magic = static_cast<U>(magic + U{1});
+        m_shift = floor_log2;
+        m_add = true;
+    }
+    m_magic = static_cast<U>(magic + U{1});
+    if (m_negative) m_magic = static_cast<U>(U{} - m_magic);
+}
+
+template <FixedWidthInteger T>
+constexpr Divider<T>::Divider(const Number<T>& divisor) : Divider{divisor.get_value()}
+{
+}
+
+template <FixedWidthInteger T>
+constexpr T Divider<T>::get_divisor() const noexcept { return m_divisor; }
+
+template <FixedWidthInteger T>
+constexpr T Divider<T>::divide(T dividend) const noexcept
+{
+    if (m_magic == unsigned_type{}) return divide_by_shift(dividend);
+    return m_add ? divide_by_magic<true>(dividend) : divide_by_magic<false>(dividend);
+}
+
+template <FixedWidthInteger T>
+constexpr T Divider<T>::modulo(T dividend) const noexcept { return remainder_of(dividend, divide(dividend)); }
+
+template <FixedWidthInteger T>
+constexpr void Divider<T>::divide(const T* dividends, std::size_t count, T* out) const noexcept { divide_run<false>(dividends, count, out); }
+
+template <FixedWidthInteger T>
+constexpr void Divider<T>::modulo(const T* dividends, std::size_t count, T* out) const noexcept { divide_run<true>(dividends, count, out); }
+
+template <FixedWidthInteger T>
+template <bool Remainder>
+constexpr void Divider<T>::divide_run(const T* dividends, std::size_t count, T* out) const noexcept
+{
+    const auto run = [&](auto quotient_of) {
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            const T dividend = dividends[index];
+            if constexpr (Remainder)
+                out[index] = remainder_of(dividend, quotient_of(dividend));
+            else
+                out[index] = quotient_of(dividend);
+        }
+    };
+    if (m_magic == unsigned_type{})
+        run([this](T dividend) { return divide_by_shift(dividend); });
+    else if (m_add)
+        run([this](T dividend) { return divide_by_magic<true>(dividend); });
+    else
+        run([this](T dividend) { return divide_by_magic<false>(dividend); });
+}
+
+template <FixedWidthInteger T>
+constexpr T Divider<T>::remainder_of(T dividend, T quotient) const noexcept
+{
+    const unsigned_type product = multiply_low(to_unsigned(quotient), to_unsigned(m_divisor));
+    return from_unsigned<T>(static_cast<unsigned_type>(to_unsigned(dividend) - product));
+}
+
+template <FixedWidthInteger T>
+constexpr T Divider<T>::divide_by_shift(T dividend) const noexcept
+{
+    using U = unsigned_type;
+    const U value = to_unsigned(dividend);
+    if constexpr (!is_signed)
+        return static_cast<U>(value >> m_shift);
+    else
+    {
+        // Negative dividends are biased by 2^s - 1 so the shift rounds towards zero.
+        const U bias = static_cast<U>(static_cast<U>(static_cast<U>(U{1} << m_shift) - U{1}) & sign_mask(value));
+        const U quotient = shift_right_signed(static_cast<U>(value + bias), m_shift);
+        return from_unsigned<T>(m_negative ? static_cast<U>(U{} - quotient) : quotient);
+    }
+}
+
+template <FixedWidthInteger T>
+template <bool Add>
+constexpr T Divider<T>::divide_by_magic(T dividend) const noexcept
+{
+    using U = unsigned_type;
+    const U value = to_unsigned(dividend);
+    if constexpr (!is_signed)
+    {
+        U quotient = multiply_high(m_magic, value);
+        // The magic number's missing top bit adds the dividend once more; halving first avoids the carry.
+        if constexpr (Add) quotient = static_cast<U>(static_cast<U>(static_cast<U>(value - quotient) >> 1) + quotient);
+        return static_cast<U>(quotient >> m_shift);
+    }
+    else
+    {
+        U quotient = multiply_high_signed(m_magic, value);
+        if constexpr (Add) quotient = m_negative ? static_cast<U>(quotient - value) : static_cast<U>(quotient + value);
+        quotient = shift_right_signed(quotient, m_shift);
+        // The shift rounds down; a negative quotient is rounded back up towards zero.
+        quotient = static_cast<U>(quotient + static_cast<U>(quotient >> (bits - 1)));
+        return from_unsigned<T>(quotient);
+    }
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DIVIDER_HPP
@@ -0,0 +1,35 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/Double/Double.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the Double type for the WHATWG Infra library, representing IEEE 754 double-precision numeric values in the context of web APIs.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the Double type for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_DOUBLE_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_DOUBLE_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Double/ShortestDecimal.hpp"
+#include <limits>
+
+namespace Softloq::WHATWG::Infra
+{
+
+static_assert(std::numeric_limits<double>::is_iec559, "double must be an IEEE 754 binary64 type"); // Passes
+extern template class SOFTLOQ_WHATWG_INFRA_API Number<double>;
+
+/**
+ * @brief Alias for an IEEE 754 double-precision Number, the Number type of JSON and ECMAScript.
+ */
+using Double = Number<double>;
+
+} // namespace Softloq::WHATWG::Infra
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Double/Formatter.tpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Double/OStream.inl"
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_DOUBLE_HPP
@@ -0,0 +1,37 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/Double/Formatter.tpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Formatter specialization for the Double primitive type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains the formatter specialization for the Double primitive type.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_FORMATTER_TPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_FORMATTER_TPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Double/Double.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Double/ShortestDecimal.hpp"
+#include <algorithm>
+#include <format>
+
+/**
+ * @brief Formatter specialization for Double (Number<double>).
+ *
+ * Writes the value with write_number_string(), as ECMAScript's Number::toString does.
+ */
+template <>
+struct std::formatter<Softloq::WHATWG::Infra::Number<double>>
+{
+    constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+    auto format(const Softloq::WHATWG::Infra::Number<double>& value, std::format_context& ctx) const
+    {
+        char buffer[Softloq::WHATWG::Infra::max_number_string_length];
+        char* end = Softloq::WHATWG::Infra::write_number_string(buffer, value.get_value());
+        return std::copy(buffer, end, ctx.out());
+    }
+};
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_FORMATTER_TPP
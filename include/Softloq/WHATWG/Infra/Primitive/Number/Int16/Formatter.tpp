@@ -12,10 +12,14 @@
 #define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT16_FORMATTER_TPP
 
 #include "Softloq/WHATWG/Infra/Primitive/Number/Int16/Int16.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp"
+#include <algorithm>
 #include <format>
 
 /**
  * @brief Formatter specialization for Int16 (Number<std::int16_t>).
+ *
+ * Writes the value with write_decimal().
  */
 template <>
 struct std::formatter<Softloq::WHATWG::Infra::Number<std::int16_t>>
@@ -24,7 +28,9 @@ struct std::formatter<Softloq::WHATWG::Infra::Number<std::int16_t>>
 
     auto format(const Softloq::WHATWG::Infra::Number<std::int16_t>& value, std::format_context& ctx) const
     {
-        return std::format_to(ctx.out(), "{}", value.get_value());
+        char buffer[Softloq::WHATWG::Infra::max_decimal_length<std::int16_t>];
+        char* end = Softloq::WHATWG::Infra::write_decimal(buffer, value.get_value());
+        return std::copy(buffer, end, ctx.out());
     }
 };
 
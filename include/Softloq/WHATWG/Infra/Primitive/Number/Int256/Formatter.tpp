@@ -0,0 +1,37 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/Int256/Formatter.tpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Formatter specialization for the Int256 primitive type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains the formatter specialization for the Int256 primitive type.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT256_FORMATTER_TPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT256_FORMATTER_TPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Int256/Int256.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp"
+#include <algorithm>
+#include <format>
+
+/**
+ * @brief Formatter specialization for Int256 (Number<int256_t>).
+ *
+ * Writes the value with write_decimal().
+ */
+template <>
+struct std::formatter<Softloq::WHATWG::Infra::Number<Softloq::WHATWG::Infra::int256_t>>
+{
+    constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+    auto format(const Softloq::WHATWG::Infra::Number<Softloq::WHATWG::Infra::int256_t>& value, std::format_context& ctx) const
+    {
+        char buffer[Softloq::WHATWG::Infra::max_decimal_length<Softloq::WHATWG::Infra::int256_t>];
+        char* end = Softloq::WHATWG::Infra::write_decimal(buffer, value.get_value());
+        return std::copy(buffer, end, ctx.out());
+    }
+};
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT256_FORMATTER_TPP
@@ -0,0 +1,35 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/Int256/Int256.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the Int256 type for the WHATWG Infra library, representing 256-bit signed integer numeric values in the context of web APIs.
+ * 
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the Int256 type for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT256_INT256_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT256_INT256_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include <cstdint>
+
+namespace Softloq::WHATWG::Infra
+{
+
+static_assert(IntegralConcept<int256_t>, "int256_t must be an integral type"); // Passes
+extern template class SOFTLOQ_WHATWG_INFRA_API Number<int256_t>;
+
+/**
+ * @brief Alias for a 256-bit signed integer Number.
+ */
+using Int256 = Number<int256_t>;
+
+} // namespace Softloq::WHATWG::Infra
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Int256/Formatter.tpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Int256/OStream.inl"
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT256_INT256_HPP
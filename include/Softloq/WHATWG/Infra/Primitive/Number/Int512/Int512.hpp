@@ -0,0 +1,35 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/Int512/Int512.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the Int512 type for the WHATWG Infra library, representing 512-bit signed integer numeric values in the context of web APIs.
+ * 
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the Int512 type for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT512_INT512_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT512_INT512_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include <cstdint>
+
+namespace Softloq::WHATWG::Infra
+{
+
+static_assert(IntegralConcept<int512_t>, "int512_t must be an integral type"); // Passes
+extern template class SOFTLOQ_WHATWG_INFRA_API Number<int512_t>;
+
+/**
+ * @brief Alias for a 512-bit signed integer Number.
+ */
+using Int512 = Number<int512_t>;
+
+} // namespace Softloq::WHATWG::Infra
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Int512/Formatter.tpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Int512/OStream.inl"
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT512_INT512_HPP
@@ -12,12 +12,14 @@
 #define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT8_FORMATTER_TPP
 
 #include "Softloq/WHATWG/Infra/Primitive/Number/Int8/Int8.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp"
+#include <algorithm>
 #include <format>
 
 /**
  * @brief Formatter specialization for Int8 (Number<std::int8_t>).
  *
- * Casts to int before formatting to avoid treating the value as a character.
+ * Writes the value with write_decimal(), which also keeps byte-sized values from formatting as characters.
  */
 template <>
 struct std::formatter<Softloq::WHATWG::Infra::Number<std::int8_t>>
@@ -26,7 +28,9 @@ struct std::formatter<Softloq::WHATWG::Infra::Number<std::int8_t>>
 
     auto format(const Softloq::WHATWG::Infra::Number<std::int8_t>& value, std::format_context& ctx) const
     {
-        return std::format_to(ctx.out(), "{}", static_cast<int>(value.get_value()));
+        char buffer[Softloq::WHATWG::Infra::max_decimal_length<std::int8_t>];
+        char* end = Softloq::WHATWG::Infra::write_decimal(buffer, value.get_value());
+        return std::copy(buffer, end, ctx.out());
     }
 };
 
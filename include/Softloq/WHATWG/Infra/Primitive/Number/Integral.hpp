@@ -13,7 +13,9 @@
 #define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INTEGRAL_HPP
 
 #include <concepts>
+#include <cstddef>
 #include <ostream>
+#include <type_traits>
 
 namespace Softloq::WHATWG::Infra
 {
@@ -56,12 +58,40 @@ concept IntegralConcept =
         { os << a } -> std::same_as<std::ostream&>;
     };
 
+template <std::size_t Bits, bool Signed>
+class WideInt;
+
+/**
+ * @brief Whether T is a specialization of WideInt.
+ */
+template <typename T>
+struct is_wide_integer : std::false_type
+{
+};
+
+template <std::size_t Bits, bool Signed>
+struct is_wide_integer<WideInt<Bits, Signed>> : std::true_type
+{
+};
+
+/**
+ * @brief Concept for the WideInt specializations, the fixed-width integers wider than the built-in ones.
+ */
+template <typename T>
+concept WideInteger = is_wide_integer<T>::value;
+
 /**
  * @brief Concept for integral types, including both standard integral types and user-defined types that satisfy IntegralLike.
  */
 template <typename T>
 concept Integral = std::integral<T> || IntegralConcept<T>;
 
+/**
+ * @brief Concept for the types a Number can hold: the Integral types, and double for IEEE 754 values.
+ */
+template <typename T>
+concept Numeric = Integral<T> || std::same_as<T, double>;
+
 } // namespace Softloq::WHATWG::Infra
 
 #endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INTEGRAL_HPP
\ No newline at end of file
@@ -0,0 +1,497 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/NumberArray.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the NumberArray type for the WHATWG Infra library, a contiguous column of integers read and written as Numbers.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the NumberArray type.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_NUMBERARRAY_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_NUMBERARRAY_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Divider.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include "Softloq/WHATWG/Infra/SIMD/Columnar.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief The comparison NumberArray::compare(), count() and filter() test each element against a value with.
+ */
+using Comparison = SIMD::Comparison;
+
+/**
+ * @brief The NumberArray type stores a column of integers contiguously and reads and writes them as Numbers.
+ *
+ * NumberArray stores the raw values of type T back to back, builds a Number only when an element
+ * is read, and runs its reductions and transforms over the raw values: sum(), min(), max(), count(),
+ * prefix_sum(), compare() and filter() use the SSE2 columnar kernels for the eight fixed-width
+ * integers, and portable loops otherwise. divide() and modulo() take a precomputed Divider, so a
+ * column divided by one runtime divisor costs a multiply and a shift per element.
+ *
+ * Masks are NumberArrays of std::uint8_t holding 1 for kept elements and 0 for dropped ones, so a
+ * mask can itself be counted with sum() or combined element by element.
+ *
+ * @tparam T A fixed-width integer type (e.g. std::int32_t, uint128_t, uint256_t).
+ */
+template <FixedWidthInteger T>
+class NumberArray final
+{
+public:
+    /**
+     * @brief The type of the stored values.
+     */
+    using value_type = T;
+
+    /**
+     * @brief The type sum() adds the values in: 64 bits of the same signedness, or T itself for uint128_t and WideInt.
+     */
+    using sum_type = SIMD::ColumnSum<T>;
+
+// Constructors
+public:
+    NumberArray() noexcept = default;
+
+    /**
+     * @brief Construct an array of count copies of a Number.
+     *
+     * @param count The number of elements.
+     * @param value The value of every element.
+     */
+    explicit NumberArray(std::size_t count, const Number<T>& value = Number<T>{});
+
+    /**
+     * @brief Construct an array from a list of raw values.
+     *
+     * @param values The values of the elements, in order.
+     */
+    NumberArray(std::initializer_list<T> values);
+
+    /**
+     * @brief Construct an array by copying a run of raw values.
+     *
+     * @param values The values of the elements, in order.
+     */
+    explicit NumberArray(std::span<const T> values);
+
+// Capacity
+public:
+    /**
+     * @brief Get the number of elements.
+     *
+     * @return The number of elements.
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @brief Returns true if the array has no elements.
+     */
+    [[nodiscard]] bool is_empty() const noexcept;
+
+    /**
+     * @brief Get the number of elements the array can hold without reallocating.
+     *
+     * @return The capacity in elements.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept;
+
+    /**
+     * @brief Reserve room for at least the given number of elements.
+     *
+     * @param capacity The number of elements to reserve.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Remove every element.
+     */
+    void clear() noexcept;
+
+// Element access
+public:
+    /**
+     * @brief Get an element without checking the index.
+     *
+     * @param index The index of the element, which must be less than size().
+     * @return The element as a Number.
+     */
+    [[nodiscard]] Number<T> operator[](std::size_t index) const noexcept;
+
+    /**
+     * @brief Get an element.
+     *
+     * @param index The index of the element.
+     * @return The element as a Number.
+     * @throws std::out_of_range if index is out of bounds.
+     */
+    [[nodiscard]] Number<T> at(std::size_t index) const;
+
+    /**
+     * @brief Replace an element.
+     *
+     * @param index The index of the element.
+     * @param value The new value of the element.
+     * @throws std::out_of_range if index is out of bounds.
+     */
+    void set(std::size_t index, const Number<T>& value);
+
+    /**
+     * @brief Append an element to the end of the array.
+     *
+     * @param value The value to append.
+     */
+    void append(const Number<T>& value);
+
+    /**
+     * @brief Get the raw values, for passing the column to code that works on T.
+     *
+     * @return A pointer to the size() values.
+     */
+    [[nodiscard]] T* data() noexcept;
+
+    /**
+     * @brief Get the raw values, for passing the column to code that works on T.
+     *
+     * @return A pointer to the size() values.
+     */
+    [[nodiscard]] const T* data() const noexcept;
+
+    /**
+     * @brief Get a view of the raw values.
+     *
+     * @return A span over the size() values.
+     */
+    [[nodiscard]] std::span<const T> values() const noexcept;
+
+    /**
+     * @brief Get a view of the elements as Numbers, built as they are read.
+     *
+     * @return A random-access range of Number<T>.
+     */
+    [[nodiscard]] auto numbers() const noexcept;
+
+// Reductions
+public:
+    /**
+     * @brief Sum the elements in sum_type, wrapping modulo 2^64 (modulo 2^N for uint128_t and WideInt).
+     *
+     * @return The sum, 0 for an empty array.
+     */
+    [[nodiscard]] Number<sum_type> sum() const noexcept;
+
+    /**
+     * @brief Get the least element.
+     *
+     * @return The least element.
+     * @throws std::out_of_range if the array is empty.
+     */
+    [[nodiscard]] Number<T> min() const;
+
+    /**
+     * @brief Get the greatest element.
+     *
+     * @return The greatest element.
+     * @throws std::out_of_range if the array is empty.
+     */
+    [[nodiscard]] Number<T> max() const;
+
+    /**
+     * @brief Count the elements for which a comparison against a value holds.
+     *
+     * @param comparison How each element is compared, as the left operand.
+     * @param value The right operand of every comparison.
+     * @return The number of elements for which the comparison holds.
+     */
+    [[nodiscard]] std::size_t count(Comparison comparison, const Number<T>& value) const noexcept;
+
+// Transforms
+public:
+    /**
+     * @brief Get the inclusive prefix sums of the elements, wrapping modulo 2^N.
+     *
+     * @return An array whose element i is the sum of the elements 0 to i.
+     */
+    [[nodiscard]] NumberArray prefix_sum() const;
+
+    /**
+     * @brief Compare every element against a value.
+     *
+     * @param comparison How each element is compared, as the left operand.
+     * @param value The right operand of every comparison.
+     * @return A mask holding 1 where the comparison holds and 0 elsewhere.
+     */
+    [[nodiscard]] NumberArray<std::uint8_t> compare(Comparison comparison, const Number<T>& value) const;
+
+    /**
+     * @brief Get the elements whose mask element is nonzero, in order.
+     *
+     * @param mask The mask, one element per element of the array.
+     * @return An array of the kept elements.
+     * @throws std::invalid_argument if mask.size() is not size().
+     */
+    [[nodiscard]] NumberArray filter(const NumberArray<std::uint8_t>& mask) const;
+
+    /**
+     * @brief Get the elements for which a comparison against a value holds, in order.
+     *
+     * The mask is built and consumed in blocks that stay in cache, without allocating it whole.
+     *
+     * @param comparison How each element is compared, as the left operand.
+     * @param value The right operand of every comparison.
+     * @return An array of the kept elements.
+     */
+    [[nodiscard]] NumberArray filter(Comparison comparison, const Number<T>& value) const;
+
+    /**
+     * @brief Divide every element by a precomputed divisor.
+     *
+     * @param divider The divisor.
+     * @return An array whose element i is element i / the divisor, truncated towards zero.
+     */
+    [[nodiscard]] NumberArray divide(const Divider<T>& divider) const;
+
+    /**
+     * @brief Get the remainder of every element by a precomputed divisor.
+     *
+     * @param divider The divisor.
+     * @return An array whose element i is element i % the divisor.
+     */
+    [[nodiscard]] NumberArray modulo(const Divider<T>& divider) const;
+
+// Comparison operators
+public:
+    /**
+     * @brief Equality comparison.
+     *
+     * @param other The array to compare against.
+     * @return true if both arrays hold the same elements in the same order.
+     */
+    [[nodiscard]] bool operator==(const NumberArray& other) const noexcept;
+
+private:
+    /**
+     * @brief The number of elements the comparison filter works on at a time.
+     */
+    static constexpr std::size_t block_size = 4096;
+
+    /**
+     * @brief Compare a run of values against a value with the vectorized kernel where one exists.
+     */
+    static std::size_t compare_block(const T* data, std::size_t size, Comparison comparison, T value, std::uint8_t* mask) noexcept;
+
+    /**
+     * @brief Filter a run of values by a mask with the vectorized kernel where one exists.
+     */
+    static std::size_t filter_block(const T* data, std::size_t size, const std::uint8_t* mask, T* out) noexcept;
+
+    std::vector<T> m_values;
+};
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <FixedWidthInteger T>
+NumberArray<T>::NumberArray(std::size_t count, const Number<T>& value)
+    : m_values(count, value.get_value())
+{}
+
+template <FixedWidthInteger T>
+NumberArray<T>::NumberArray(std::initializer_list<T> values)
+    : m_values(values)
+{}
+
+template <FixedWidthInteger T>
+NumberArray<T>::NumberArray(std::span<const T> values)
+    : m_values(values.begin(), values.end())
+{}
+
+template <FixedWidthInteger T>
+std::size_t NumberArray<T>::size() const noexcept { return m_values.size(); }
+
+template <FixedWidthInteger T>
+bool NumberArray<T>::is_empty() const noexcept { return m_values.empty(); }
+
+template <FixedWidthInteger T>
+std::size_t NumberArray<T>::capacity() const noexcept { return m_values.capacity(); }
+
+template <FixedWidthInteger T>
+void NumberArray<T>::reserve(std::size_t capacity) { m_values.reserve(capacity); }
+
+template <FixedWidthInteger T>
+void NumberArray<T>::clear() noexcept { m_values.clear(); }
+
+template <FixedWidthInteger T>
+Number<T> NumberArray<T>::operator[](std::size_t index) const noexcept { return Number<T>{m_values[index]}; }
+
+template <FixedWidthInteger T>
+Number<T> NumberArray<T>::at(std::size_t index) const
+{
+    if (index >= m_values.size()) throw std::out_of_range("NumberArray index out of range");
+    return Number<T>{m_values[index]};
+}
+
+template <FixedWidthInteger T>
+void NumberArray<T>::set(std::size_t index, const Number<T>& value)
+{
+    if (index >= m_values.size()) throw std::out_of_range("NumberArray index out of range");
+    m_values[index] = value.get_value();
+}
+
+template <FixedWidthInteger T>
+void NumberArray<T>::append(const Number<T>& value) { m_values.push_back(value.get_value()); }
+
+template <FixedWidthInteger T>
+T* NumberArray<T>::data() noexcept { return m_values.data(); }
+
+template <FixedWidthInteger T>
+const T* NumberArray<T>::data() const noexcept { return m_values.data(); }
+
+template <FixedWidthInteger T>
+std::span<const T> NumberArray<T>::values() const noexcept { return m_values; }
+
+template <FixedWidthInteger T>
+auto NumberArray<T>::numbers() const noexcept
+{
+    return std::views::transform(values(), [](T value) { return Number<T>{value}; });
+}
+
+template <FixedWidthInteger T>
+Number<typename NumberArray<T>::sum_type> NumberArray<T>::sum() const noexcept
+{
+    if constexpr (SIMD::ColumnElement<T>)
+        return Number<sum_type>{SIMD::column_sum(m_values.data(), m_values.size())};
+    else
+        return Number<sum_type>{SIMD::ColumnPortable::sum(m_values.data(), m_values.size())};
+}
+
+template <FixedWidthInteger T>
+Number<T> NumberArray<T>::min() const
+{
+    if (m_values.empty()) throw std::out_of_range("NumberArray::min of an empty array");
+    if constexpr (SIMD::ColumnElement<T>)
+        return Number<T>{SIMD::column_min(m_values.data(), m_values.size())};
+    else
+        return Number<T>{SIMD::ColumnPortable::min(m_values.data(), m_values.size())};
+}
+
+template <FixedWidthInteger T>
+Number<T> NumberArray<T>::max() const
+{
+    if (m_values.empty()) throw std::out_of_range("NumberArray::max of an empty array");
+    if constexpr (SIMD::ColumnElement<T>)
+        return Number<T>{SIMD::column_max(m_values.data(), m_values.size())};
+    else
+        return Number<T>{SIMD::ColumnPortable::max(m_values.data(), m_values.size())};
+}
+
+template <FixedWidthInteger T>
+std::size_t NumberArray<T>::count(Comparison comparison, const Number<T>& value) const noexcept
+{
+    if constexpr (SIMD::ColumnElement<T>)
+        return SIMD::column_count(m_values.data(), m_values.size(), comparison, value.get_value());
+    else
+        return SIMD::ColumnPortable::count(m_values.data(), m_values.size(), comparison, value.get_value());
+}
+
+template <FixedWidthInteger T>
+NumberArray<T> NumberArray<T>::prefix_sum() const
+{
+    NumberArray result;
+    result.m_values.resize(m_values.size());
+    if constexpr (SIMD::ColumnElement<T>)
+        SIMD::column_prefix_sum(m_values.data(), m_values.size(), result.m_values.data());
+    else
+        SIMD::ColumnPortable::prefix_sum(m_values.data(), m_values.size(), result.m_values.data());
+    return result;
+}
+
+template <FixedWidthInteger T>
+NumberArray<std::uint8_t> NumberArray<T>::compare(Comparison comparison, const Number<T>& value) const
+{
+    NumberArray<std::uint8_t> mask(m_values.size());
+    compare_block(m_values.data(), m_values.size(), comparison, value.get_value(), mask.data());
+    return mask;
+}
+
+template <FixedWidthInteger T>
+NumberArray<T> NumberArray<T>::filter(const NumberArray<std::uint8_t>& mask) const
+{
+    if (mask.size() != m_values.size()) throw std::invalid_argument("NumberArray::filter mask size does not match the array");
+    NumberArray result;
+    result.m_values.resize(m_values.size());
+    result.m_values.resize(filter_block(m_values.data(), m_values.size(), mask.data(), result.m_values.data()));
+    return result;
+}
+
+template <FixedWidthInteger T>
+NumberArray<T> NumberArray<T>::filter(Comparison comparison, const Number<T>& value) const
+{
+    std::array<std::uint8_t, block_size> mask;
+    NumberArray result;
+    result.m_values.resize(m_values.size());
+    std::size_t kept = 0;
+    for (std::size_t index = 0; index < m_values.size(); index += block_size)
+    {
+        const std::size_t length = std::min(block_size, m_values.size() - index);
+        compare_block(m_values.data() + index, length, comparison, value.get_value(), mask.data());
+        kept += filter_block(m_values.data() + index, length, mask.data(), result.m_values.data() + kept);
+    }
+    result.m_values.resize(kept);
+    return result;
+}
+
+template <FixedWidthInteger T>
+NumberArray<T> NumberArray<T>::divide(const Divider<T>& divider) const
+{
+    NumberArray result;
+    result.m_values.resize(m_values.size());
+    divider.divide(m_values.data(), m_values.size(), result.m_values.data());
+    return result;
+}
+
+template <FixedWidthInteger T>
+NumberArray<T> NumberArray<T>::modulo(const Divider<T>& divider) const
+{
+    NumberArray result;
+    result.m_values.resize(m_values.size());
+    divider.modulo(m_values.data(), m_values.size(), result.m_values.data());
+    return result;
+}
+
+template <FixedWidthInteger T>
+bool NumberArray<T>::operator==(const NumberArray& other) const noexcept { return m_values == other.m_values; }
+
+template <FixedWidthInteger T>
+std::size_t NumberArray<T>::compare_block(const T* data, std::size_t size, Comparison comparison, T value, std::uint8_t* mask) noexcept
+{
+    if constexpr (SIMD::ColumnElement<T>)
+        return SIMD::column_compare(data, size, comparison, value, mask);
+    else
+        return SIMD::ColumnPortable::compare(data, size, comparison, value, mask);
+}
+
+template <FixedWidthInteger T>
+std::size_t NumberArray<T>::filter_block(const T* data, std::size_t size, const std::uint8_t* mask, T* out) noexcept
+{
+    if constexpr (SIMD::ColumnElement<T>)
+        return SIMD::column_filter(data, size, mask, out);
+    else
+        return SIMD::ColumnPortable::filter(data, size, mask, out);
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_NUMBERARRAY_HPP
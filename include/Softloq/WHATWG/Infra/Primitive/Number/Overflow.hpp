@@ -0,0 +1,276 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/Overflow.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the overflow-detecting integer arithmetic of the WHATWG Infra library, shared by every Number width.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines overflowing_add(), overflowing_sub() and overflowing_mul(), which compute the wrapped result and report whether it overflowed.
+ * Defining SOFTLOQ_WHATWG_INFRA_NO_OVERFLOW_BUILTINS before inclusion forces the portable implementations.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_OVERFLOW_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_OVERFLOW_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/uint128_t.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp"
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// Detect the GCC and Clang overflow builtins, which compile to the operation and one flag test
+#if !defined(SOFTLOQ_WHATWG_INFRA_NO_OVERFLOW_BUILTINS) && defined(__has_builtin)
+    #if __has_builtin(__builtin_add_overflow) && __has_builtin(__builtin_sub_overflow) && __has_builtin(__builtin_mul_overflow)
+        #define SOFTLOQ_WHATWG_INFRA_OVERFLOW_BUILTINS 1
+    #endif
+#endif
+#ifndef SOFTLOQ_WHATWG_INFRA_OVERFLOW_BUILTINS
+    #define SOFTLOQ_WHATWG_INFRA_OVERFLOW_BUILTINS 0
+#endif
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Concept for the fixed-width integer types with overflow-detecting arithmetic: the built-in integers other than bool, uint128_t and WideInt.
+ */
+template <typename T>
+concept FixedWidthInteger = (std::integral<T> && !std::same_as<T, bool>) || std::same_as<T, uint128_t> || WideInteger<T>;
+
+/**
+ * @brief Add two integers, wrapping modulo 2^N.
+ *
+ * @param lhs The first operand.
+ * @param rhs The second operand.
+ * @param result Receives the wrapped sum.
+ * @return true if the exact sum does not fit in T.
+ */
+template <FixedWidthInteger T>
+constexpr bool overflowing_add(T lhs, T rhs, T& result) noexcept;
+
+/**
+ * @brief Subtract two integers, wrapping modulo 2^N.
+ *
+ * @param lhs The minuend.
+ * @param rhs The subtrahend.
+ * @param result Receives the wrapped difference.
+ * @return true if the exact difference does not fit in T.
+ */
+template <FixedWidthInteger T>
+constexpr bool overflowing_sub(T lhs, T rhs, T& result) noexcept;
+
+/**
+ * @brief Multiply two integers, wrapping modulo 2^N.
+ *
+ * @param lhs The first factor.
+ * @param rhs The second factor.
+ * @param result Receives the wrapped product.
+ * @return true if the exact product does not fit in T.
+ */
+template <FixedWidthInteger T>
+constexpr bool overflowing_mul(T lhs, T rhs, T& result) noexcept;
+
+/**
+ * @brief The value a saturating operation clamps to when it overflows: the maximum if positive is true, the minimum otherwise.
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr T saturation_bound(bool positive) noexcept
+{
+    if constexpr (std::same_as<T, uint128_t>)
+        return positive ? ~uint128_t{} : uint128_t{};
+    else
+        return positive ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+}
+
+/**
+ * @brief Returns true if the value is below zero, which only a signed type can be.
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr bool is_negative(T value) noexcept
+{
+    if constexpr (WideInteger<T>)
+        return value.is_negative();
+    else if constexpr (std::is_signed_v<T>)
+        return value < 0;
+    else
+        return false;
+}
+
+/**
+ * @brief The overflow-detecting arithmetic without compiler builtins, used where they are missing.
+ *
+ * Operands are computed on the unsigned type of the same width, which wraps without undefined
+ * behaviour; sums and differences overflow by sign rules, and products are checked with a wider
+ * type or, for 64-bit and 128-bit operands, with the full-width product of uint128_t. WideInt
+ * operands are checked the same way on their own carry chains and full-width products.
+ */
+namespace OverflowPortable
+{
+
+/**
+ * @brief Portable overflowing_add().
+ */
+template <FixedWidthInteger T>
+constexpr bool add(T lhs, T rhs, T& result) noexcept
+{
+    if constexpr (std::same_as<T, uint128_t>)
+    {
+        result = lhs + rhs;
+        return result < lhs;
+    }
+    else if constexpr (WideInteger<T>)
+    {
+        result = lhs + rhs;
+        if constexpr (T::is_signed)
+            return lhs.is_negative() == rhs.is_negative() && result.is_negative() != lhs.is_negative();
+        else
+            return result < lhs;
+    }
+    else
+    {
+        using Unsigned = std::make_unsigned_t<T>;
+        result = static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(lhs) + static_cast<Unsigned>(rhs)));
+        if constexpr (std::is_signed_v<T>)
+            return ((lhs ^ result) & (rhs ^ result)) < 0; // both operands differ in sign from the sum
+        else
+            return result < lhs;
+    }
+}
+
+/**
+ * @brief Portable overflowing_sub().
+ */
+template <FixedWidthInteger T>
+constexpr bool sub(T lhs, T rhs, T& result) noexcept
+{
+    if constexpr (std::same_as<T, uint128_t>)
+    {
+        result = lhs - rhs;
+        return lhs < rhs;
+    }
+    else if constexpr (WideInteger<T>)
+    {
+        result = lhs - rhs;
+        if constexpr (T::is_signed)
+            return lhs.is_negative() != rhs.is_negative() && result.is_negative() != lhs.is_negative();
+        else
+            return lhs < rhs;
+    }
+    else
+    {
+        using Unsigned = std::make_unsigned_t<T>;
+        result = static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(lhs) - static_cast<Unsigned>(rhs)));
+        if constexpr (std::is_signed_v<T>)
+            return ((lhs ^ rhs) & (lhs ^ result)) < 0; // operands of different sign, and the difference took the subtrahend's
+        else
+            return lhs < rhs;
+    }
+}
+
+/**
+ * @brief Portable overflowing_mul().
+ */
+template <FixedWidthInteger T>
+constexpr bool mul(T lhs, T rhs, T& result) noexcept
+{
+    if constexpr (std::same_as<T, uint128_t>)
+    {
+        const uint128_t low = uint128_t::multiply(lhs.low(), rhs.low());
+        const uint128_t cross_left = uint128_t::multiply(lhs.high(), rhs.low());
+        const uint128_t cross_right = uint128_t::multiply(lhs.low(), rhs.high());
+        bool overflow = (lhs.high() != 0 && rhs.high() != 0) || cross_left.high() != 0 || cross_right.high() != 0;
+        std::uint64_t high = low.high() + cross_left.low();
+        overflow = overflow || high < cross_left.low();
+        high += cross_right.low();
+        overflow = overflow || high < cross_right.low();
+        result = uint128_t{high, low.low()};
+        return overflow;
+    }
+    else if constexpr (WideInteger<T>)
+    {
+        using Unsigned = WideInt<T::bits, false>;
+        const bool negative = is_negative(lhs) != is_negative(rhs);
+        const auto magnitude = [](const T& value) { return is_negative(value) ? -Unsigned{value} : Unsigned{value}; };
+        Unsigned high;
+        const Unsigned low = Unsigned::multiply(magnitude(lhs), magnitude(rhs), high);
+        result = lhs * rhs;
+        if (high) return true;
+        if constexpr (T::is_signed)
+            return low > Unsigned{std::numeric_limits<T>::max()} + Unsigned{negative ? 1 : 0};
+        else
+            return false;
+    }
+    else if constexpr (sizeof(T) < sizeof(std::int64_t))
+    {
+        // The exact product of two narrower operands always fits in 64 bits.
+        using Wide = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+        const Wide product = static_cast<Wide>(lhs) * static_cast<Wide>(rhs);
+        result = static_cast<T>(static_cast<std::make_unsigned_t<T>>(product));
+        if constexpr (std::is_signed_v<T>)
+            return product < std::numeric_limits<T>::min() || product > std::numeric_limits<T>::max();
+        else
+            return product > std::numeric_limits<T>::max();
+    }
+    else
+    {
+        using Unsigned = std::make_unsigned_t<T>;
+        const bool negative = is_negative(lhs) != is_negative(rhs);
+        const auto magnitude = [](T value) { return is_negative(value) ? Unsigned{0} - static_cast<Unsigned>(value) : static_cast<Unsigned>(value); };
+        const uint128_t product = uint128_t::multiply(magnitude(lhs), magnitude(rhs));
+        const Unsigned bits = static_cast<Unsigned>(static_cast<Unsigned>(lhs) * static_cast<Unsigned>(rhs));
+        result = static_cast<T>(bits);
+        if (product.high() != 0) return true;
+        const auto limit = static_cast<Unsigned>(std::numeric_limits<T>::max()) + (negative ? 1u : 0u);
+        return product.low() > limit;
+    }
+}
+
+} // namespace OverflowPortable
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <FixedWidthInteger T>
+constexpr bool overflowing_add(T lhs, T rhs, T& result) noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_OVERFLOW_BUILTINS
+    if constexpr (std::integral<T>)
+        return __builtin_add_overflow(lhs, rhs, &result);
+#endif
+    return OverflowPortable::add(lhs, rhs, result);
+}
+
+template <FixedWidthInteger T>
+constexpr bool overflowing_sub(T lhs, T rhs, T& result) noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_OVERFLOW_BUILTINS
+    if constexpr (std::integral<T>)
+        return __builtin_sub_overflow(lhs, rhs, &result);
+#endif
+    return OverflowPortable::sub(lhs, rhs, result);
+}
+
+template <FixedWidthInteger T>
+constexpr bool overflowing_mul(T lhs, T rhs, T& result) noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_OVERFLOW_BUILTINS
+    if constexpr (std::integral<T>)
+        return __builtin_mul_overflow(lhs, rhs, &result);
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+    else if constexpr (std::same_as<T, uint128_t>)
+    {
+        uint128_t::native_type product = 0;
+        const bool overflow = __builtin_mul_overflow(static_cast<uint128_t::native_type>(lhs), static_cast<uint128_t::native_type>(rhs), &product);
+        result = uint128_t{product};
+        return overflow;
+    }
+#endif
+#endif
+    return OverflowPortable::mul(lhs, rhs, result);
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_OVERFLOW_HPP
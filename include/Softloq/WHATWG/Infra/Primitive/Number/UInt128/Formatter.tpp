@@ -11,11 +11,15 @@
 #ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT128_FORMATTER_TPP
 #define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT128_FORMATTER_TPP
 
-#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/UInt128.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp"
+#include <algorithm>
 #include <format>
 
 /**
  * @brief Formatter specialization for UInt128 (Number<uint128_t>).
+ *
+ * Writes the value with write_decimal().
  */
 template <>
 struct std::formatter<Softloq::WHATWG::Infra::Number<Softloq::WHATWG::Infra::uint128_t>>
@@ -24,7 +28,9 @@ struct std::formatter<Softloq::WHATWG::Infra::Number<Softloq::WHATWG::Infra::uin
 
     auto format(const Softloq::WHATWG::Infra::Number<Softloq::WHATWG::Infra::uint128_t>& value, std::format_context& ctx) const
     {
-        return std::format_to(ctx.out(), "{}", value.get_value());
+        char buffer[Softloq::WHATWG::Infra::max_decimal_length<Softloq::WHATWG::Infra::uint128_t>];
+        char* end = Softloq::WHATWG::Infra::write_decimal(buffer, value.get_value());
+        return std::copy(buffer, end, ctx.out());
     }
 };
 
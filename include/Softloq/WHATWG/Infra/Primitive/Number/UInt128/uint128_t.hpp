@@ -1,170 +1,486 @@
 /**
  * @file Softloq/WHATWG/Infra/Primitive/Number/UInt128/uint128_t.hpp
  * @brief This header defines the uint128_t type. It is a struct representing a 128-bit unsigned integer, composed of two 64-bit parts: high and low.
- * 
+ *
  * Copyright (c) 2026 Softloq. All rights reserved.
  * Softloq implementation of the WHATWG Infra library.
  * This header defines the uint128_t type, a struct representing a 128-bit unsigned integer, composed of two 64-bit parts: high and low.
+ * Defining SOFTLOQ_WHATWG_INFRA_NO_INT128 before inclusion forces the portable two-word arithmetic.
  */
 
 #ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT128_UINT128_T_HPP
 #define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT128_UINT128_T_HPP
 
 #include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include <bit>
 #include <compare>
+#include <concepts>
 #include <cstdint>
-#include <ostream>
+
+// Detect a native 128-bit integer type, which GCC and Clang provide on 64-bit targets
+#if !defined(SOFTLOQ_WHATWG_INFRA_NO_INT128) && defined(__SIZEOF_INT128__)
+    #define SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE 1
+#else
+    #define SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE 0
+#endif
+
+// Detect the MSVC 64x64 -> 128 multiply and 128 / 64 divide intrinsics
+#if !SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE && defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    #define SOFTLOQ_WHATWG_INFRA_UINT128_MSVC 1
+    #include <intrin.h>
+#else
+    #define SOFTLOQ_WHATWG_INFRA_UINT128_MSVC 0
+#endif
 
 namespace Softloq::WHATWG::Infra
 {
 
 /**
  * @brief A struct representing a 128-bit unsigned integer, composed of two 64-bit parts: high and low.
+ *
+ * Arithmetic wraps modulo 2^128 like the built-in unsigned types. Where the compiler has an
+ * unsigned __int128, every operation compiles to it. Otherwise the full 64x64 -> 128 product
+ * uses the MSVC multiply intrinsics or four 32-bit partial products, and division is Knuth's
+ * algorithm D on 32-bit digits, reduced to at most two 128 / 64 steps (see UInt128Portable).
+ * All operations are constexpr.
+ *
+ * Dividing by zero is undefined, as for the built-in types. The output stream operator, which
+ * writes the decimal form, is defined with write_decimal() in Decimal.hpp.
  */
 class uint128_t final
 {
-    std::uint64_t high;
-    std::uint64_t low;
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+public:
+    /**
+     * @brief The compiler's native 128-bit unsigned integer type.
+     */
+    __extension__ typedef unsigned __int128 native_type;
+#endif
 
-// std::regular requirements
+// Constructors
 public:
-    uint128_t() noexcept = default;
-    uint128_t(std::uint64_t high_part, std::uint64_t low_part) noexcept : high(high_part), low(low_part) {}
-    uint128_t(const uint128_t&) noexcept = default;
-    uint128_t& operator=(const uint128_t& other) noexcept
-    {
-        if (this != &other)
-        {
-            high = other.high;
-            low = other.low;
-        }
-        return *this;
-    }
-    friend bool operator==(const uint128_t&, const uint128_t&) = default;
+    constexpr uint128_t() noexcept = default;
+
+    /**
+     * @brief Construct from a 64-bit value, which becomes the low part.
+     *
+     * @param value The value.
+     */
+    constexpr uint128_t(std::uint64_t value) noexcept;
+
+    /**
+     * @brief Construct from the high and low 64-bit parts.
+     *
+     * @param high_part The high 64 bits.
+     * @param low_part The low 64 bits.
+     */
+    constexpr uint128_t(std::uint64_t high_part, std::uint64_t low_part) noexcept;
 
-// std::totally_ordered requirements
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+    /**
+     * @brief Construct from the native 128-bit type. Other integer types use the 64-bit constructor.
+     *
+     * @param value The value.
+     */
+    template <std::same_as<native_type> T>
+    constexpr explicit uint128_t(T value) noexcept;
+
+    /**
+     * @brief Explicit conversion to the native 128-bit type.
+     */
+    [[nodiscard]] constexpr explicit operator native_type() const noexcept;
+#endif
+
+// Accessors
 public:
-    friend bool operator<(const uint128_t& lhs, const uint128_t& rhs) noexcept
-    {
-        if (lhs.high != rhs.high)
-            return lhs.high < rhs.high;
-        return lhs.low < rhs.low;
-    }
+    /**
+     * @brief Get the high 64 bits.
+     */
+    [[nodiscard]] constexpr std::uint64_t high() const noexcept;
 
-    friend bool operator>(const uint128_t& lhs, const uint128_t& rhs) noexcept
-    {
-        if (lhs.high != rhs.high)
-            return lhs.high > rhs.high;
-        return lhs.low > rhs.low;
-    }
+    /**
+     * @brief Get the low 64 bits.
+     */
+    [[nodiscard]] constexpr std::uint64_t low() const noexcept;
 
-    friend bool operator<=(const uint128_t& lhs, const uint128_t& rhs) noexcept
-    {
-        if (lhs.high != rhs.high)
-            return lhs.high < rhs.high;
-        return lhs.low <= rhs.low;
-    }
+    /**
+     * @brief Explicit conversion to the low 64 bits, truncating like the built-in conversions.
+     */
+    [[nodiscard]] constexpr explicit operator std::uint64_t() const noexcept;
 
-    friend bool operator>=(const uint128_t& lhs, const uint128_t& rhs) noexcept
-    {
-        if (lhs.high != rhs.high)
-            return lhs.high > rhs.high;
-        return lhs.low >= rhs.low;
-    }
+    /**
+     * @brief Returns true if the value is not zero.
+     */
+    [[nodiscard]] constexpr explicit operator bool() const noexcept;
 
-    auto operator<=>(const uint128_t& other) noexcept
-    {
-        if (high != other.high)
-            return high <=> other.high;
-        return low <=> other.low;
-    }
+// Full-width arithmetic
+public:
+    /**
+     * @brief Multiply two 64-bit values without losing the high half of the product.
+     *
+     * @param lhs The left operand.
+     * @param rhs The right operand.
+     * @return The full 128-bit product.
+     */
+    [[nodiscard]] static constexpr uint128_t multiply(std::uint64_t lhs, std::uint64_t rhs) noexcept;
+
+    /**
+     * @brief Divide, producing the quotient and the remainder in one step.
+     *
+     * @param dividend The dividend.
+     * @param divisor The divisor, which must not be zero.
+     * @param remainder Receives dividend % divisor.
+     * @return dividend / divisor.
+     */
+    [[nodiscard]] static constexpr uint128_t divide(const uint128_t& dividend, const uint128_t& divisor, uint128_t& remainder) noexcept;
+
+// std::regular and std::totally_ordered requirements
+public:
+    friend constexpr bool operator==(const uint128_t&, const uint128_t&) noexcept = default;
+    friend constexpr std::strong_ordering operator<=>(const uint128_t&, const uint128_t&) noexcept = default;
 
 // Arithmetic operator requirements
 public:
-    uint128_t operator+(const uint128_t& other) const noexcept
-    {
-        uint128_t result;
-        result.low = low + other.low;
-        result.high = high + other.high + (result.low < low); // Handle carry
-        return result;
-    }
+    [[nodiscard]] constexpr uint128_t operator+(const uint128_t& other) const noexcept;
+    [[nodiscard]] constexpr uint128_t operator-(const uint128_t& other) const noexcept;
+    [[nodiscard]] constexpr uint128_t operator*(const uint128_t& other) const noexcept;
+    [[nodiscard]] constexpr uint128_t operator/(const uint128_t& other) const noexcept;
+    [[nodiscard]] constexpr uint128_t operator%(const uint128_t& other) const noexcept;
 
-    uint128_t operator-(const uint128_t& other) const noexcept
-    {
-        uint128_t result;
-        result.low = low - other.low;
-        result.high = high - other.high - (low < other.low); // Handle borrow
-        return result;
-    }
+    constexpr uint128_t& operator+=(const uint128_t& other) noexcept { *this = *this + other; return *this; }
+    constexpr uint128_t& operator-=(const uint128_t& other) noexcept { *this = *this - other; return *this; }
+    constexpr uint128_t& operator*=(const uint128_t& other) noexcept { *this = *this * other; return *this; }
+    constexpr uint128_t& operator/=(const uint128_t& other) noexcept { *this = *this / other; return *this; }
+    constexpr uint128_t& operator%=(const uint128_t& other) noexcept { *this = *this % other; return *this; }
+
+    constexpr uint128_t& operator++() noexcept { *this += uint128_t{0, 1}; return *this; }
+    constexpr uint128_t operator++(int) noexcept { uint128_t copy = *this; ++(*this); return copy; }
+    constexpr uint128_t& operator--() noexcept { *this -= uint128_t{0, 1}; return *this; }
+    constexpr uint128_t operator--(int) noexcept { uint128_t copy = *this; --(*this); return copy; }
+
+// Bitwise operators
+public:
+    [[nodiscard]] constexpr uint128_t operator~() const noexcept { return uint128_t{~m_high, ~m_low}; }
+    [[nodiscard]] constexpr uint128_t operator&(const uint128_t& other) const noexcept { return uint128_t{m_high & other.m_high, m_low & other.m_low}; }
+    [[nodiscard]] constexpr uint128_t operator|(const uint128_t& other) const noexcept { return uint128_t{m_high | other.m_high, m_low | other.m_low}; }
+    [[nodiscard]] constexpr uint128_t operator^(const uint128_t& other) const noexcept { return uint128_t{m_high ^ other.m_high, m_low ^ other.m_low}; }
+
+    constexpr uint128_t& operator&=(const uint128_t& other) noexcept { *this = *this & other; return *this; }
+    constexpr uint128_t& operator|=(const uint128_t& other) noexcept { *this = *this | other; return *this; }
+    constexpr uint128_t& operator^=(const uint128_t& other) noexcept { *this = *this ^ other; return *this; }
+
+    /**
+     * @brief Shift left. Shifts of 128 or more give zero.
+     */
+    [[nodiscard]] constexpr uint128_t operator<<(int shift) const noexcept;
+
+    /**
+     * @brief Shift right. Shifts of 128 or more give zero.
+     */
+    [[nodiscard]] constexpr uint128_t operator>>(int shift) const noexcept;
+
+    constexpr uint128_t& operator<<=(int shift) noexcept { *this = *this << shift; return *this; }
+    constexpr uint128_t& operator>>=(int shift) noexcept { *this = *this >> shift; return *this; }
+
+private:
+    // High part first, so the defaulted comparisons order by it.
+    std::uint64_t m_high = 0;
+    std::uint64_t m_low = 0;
+};
+
+/**
+ * @brief The portable two-word arithmetic that uint128_t uses when the compiler has no 128-bit integer type.
+ *
+ * These are always available, so they can be checked against the native arithmetic.
+ */
+namespace UInt128Portable
+{
+
+/**
+ * @brief Multiply two 64-bit values from four 32-bit partial products.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return The full 128-bit product.
+ */
+[[nodiscard]] constexpr uint128_t multiply(std::uint64_t lhs, std::uint64_t rhs) noexcept;
+
+/**
+ * @brief Divide a 128-bit value by a 64-bit divisor, with Knuth's algorithm D on 32-bit digits.
+ *
+ * The quotient must fit in 64 bits, i.e. high must be less than divisor.
+ *
+ * @param high The high 64 bits of the dividend.
+ * @param low The low 64 bits of the dividend.
+ * @param divisor The divisor, which must be greater than high.
+ * @param remainder Receives the remainder.
+ * @return The quotient.
+ */
+[[nodiscard]] constexpr std::uint64_t divide(std::uint64_t high, std::uint64_t low, std::uint64_t divisor, std::uint64_t& remainder) noexcept;
 
-    uint128_t operator*(const uint128_t& other) const noexcept
+/**
+ * @brief Divide two 128-bit values with at most two 128 / 64 divisions.
+ *
+ * A divisor that fits in 64 bits divides the high and then the low part. A wider divisor leaves a
+ * quotient below 2^64, which is estimated from the normalized top 64 bits of the divisor and then
+ * corrected by at most one.
+ *
+ * @param dividend The dividend.
+ * @param divisor The divisor, which must not be zero.
+ * @param remainder Receives dividend % divisor.
+ * @return dividend / divisor.
+ */
+[[nodiscard]] constexpr uint128_t divide(const uint128_t& dividend, const uint128_t& divisor, uint128_t& remainder) noexcept;
+
+} // namespace UInt128Portable
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+constexpr uint128_t::uint128_t(std::uint64_t value) noexcept
+    : m_low{value}
+{
+}
+
+constexpr uint128_t::uint128_t(std::uint64_t high_part, std::uint64_t low_part) noexcept
+    : m_high{high_part}, m_low{low_part}
+{
+}
+
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+template <std::same_as<uint128_t::native_type> T>
+constexpr uint128_t::uint128_t(T value) noexcept
+    : m_high{static_cast<std::uint64_t>(value >> 64)}, m_low{static_cast<std::uint64_t>(value)}
+{
+}
+
+constexpr uint128_t::operator native_type() const noexcept { return (static_cast<native_type>(m_high) << 64) | m_low; }
+#endif
+
+constexpr std::uint64_t uint128_t::high() const noexcept { return m_high; }
+
+constexpr std::uint64_t uint128_t::low() const noexcept { return m_low; }
+
+constexpr uint128_t::operator std::uint64_t() const noexcept { return m_low; }
+
+constexpr uint128_t::operator bool() const noexcept { return (m_high | m_low) != 0; }
+
+constexpr uint128_t uint128_t::multiply(std::uint64_t lhs, std::uint64_t rhs) noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+    return uint128_t{static_cast<native_type>(lhs) * rhs};
+#else
+#if SOFTLOQ_WHATWG_INFRA_UINT128_MSVC
+    if !consteval
     {
-        // This is a simple implementation that does not handle overflow.
-        // A complete implementation would need to handle the full 128-bit multiplication.
-        uint128_t result;
-        result.low = low * other.low;
-        result.high = high * other.low + low * other.high; // Cross terms
-        return result;
+    #if defined(_M_X64)
+        std::uint64_t high = 0;
+        const std::uint64_t low = _umul128(lhs, rhs, &high);
+        return uint128_t{high, low};
+    #else
+        return uint128_t{__umulh(lhs, rhs), lhs * rhs};
+    #endif
     }
+#endif
+    return UInt128Portable::multiply(lhs, rhs);
+#endif
+}
+
+constexpr uint128_t uint128_t::divide(const uint128_t& dividend, const uint128_t& divisor, uint128_t& remainder) noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+    const native_type numerator{dividend};
+    const native_type denominator{divisor};
+    remainder = uint128_t{numerator % denominator};
+    return uint128_t{numerator / denominator};
+#else
+    return UInt128Portable::divide(dividend, divisor, remainder);
+#endif
+}
+
+constexpr uint128_t uint128_t::operator+(const uint128_t& other) const noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+    return uint128_t{native_type{*this} + native_type{other}};
+#else
+    uint128_t result;
+    result.m_low = m_low + other.m_low;
+    result.m_high = m_high + other.m_high + (result.m_low < m_low); // Handle carry
+    return result;
+#endif
+}
+
+constexpr uint128_t uint128_t::operator-(const uint128_t& other) const noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+    return uint128_t{native_type{*this} - native_type{other}};
+#else
+    uint128_t result;
+    result.m_low = m_low - other.m_low;
+    result.m_high = m_high - other.m_high - (m_low < other.m_low); // Handle borrow
+    return result;
+#endif
+}
+
+constexpr uint128_t uint128_t::operator*(const uint128_t& other) const noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+    return uint128_t{native_type{*this} * native_type{other}};
+#else
+    // The cross terms only reach the high part, so their own high halves wrap away.
+    uint128_t result = multiply(m_low, other.m_low);
+    result.m_high += m_high * other.m_low + m_low * other.m_high;
+    return result;
+#endif
+}
+
+constexpr uint128_t uint128_t::operator/(const uint128_t& other) const noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+    return uint128_t{native_type{*this} / native_type{other}};
+#else
+    uint128_t remainder;
+    return divide(*this, other, remainder);
+#endif
+}
+
+constexpr uint128_t uint128_t::operator%(const uint128_t& other) const noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+    return uint128_t{native_type{*this} % native_type{other}};
+#else
+    uint128_t remainder;
+    (void)divide(*this, other, remainder);
+    return remainder;
+#endif
+}
+
+constexpr uint128_t uint128_t::operator<<(int shift) const noexcept
+{
+    if (shift >= 128)
+        return uint128_t{0, 0};
+    else if (shift >= 64)
+        return uint128_t{m_low << (shift - 64), 0};
+    else if (shift == 0)
+        return *this;
+    else
+        return uint128_t{(m_high << shift) | (m_low >> (64 - shift)), m_low << shift};
+}
+
+constexpr uint128_t uint128_t::operator>>(int shift) const noexcept
+{
+    if (shift >= 128)
+        return uint128_t{0, 0};
+    else if (shift >= 64)
+        return uint128_t{0, m_high >> (shift - 64)};
+    else if (shift == 0)
+        return *this;
+    else
+        return uint128_t{m_high >> shift, (m_low >> shift) | (m_high << (64 - shift))};
+}
+
+constexpr uint128_t UInt128Portable::multiply(std::uint64_t lhs, std::uint64_t rhs) noexcept
+{
+    const std::uint64_t lhs_low = lhs & 0xFFFFFFFF;
+    const std::uint64_t lhs_high = lhs >> 32;
+    const std::uint64_t rhs_low = rhs & 0xFFFFFFFF;
+    const std::uint64_t rhs_high = rhs >> 32;
+
+    const std::uint64_t low_low = lhs_low * rhs_low;
+    const std::uint64_t high_low = lhs_high * rhs_low;
+    const std::uint64_t low_high = lhs_low * rhs_high;
+    const std::uint64_t high_high = lhs_high * rhs_high;
+
+    // The middle column fits in 64 bits: at most (2^32 - 1)^2 + 2 * (2^32 - 1) = 2^64 - 1.
+    const std::uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFF) + low_high;
+    return uint128_t{high_high + (high_low >> 32) + (middle >> 32), (middle << 32) | (low_low & 0xFFFFFFFF)};
+}
 
-    uint128_t operator/(const uint128_t& other) const noexcept
+constexpr std::uint64_t UInt128Portable::divide(std::uint64_t high, std::uint64_t low, std::uint64_t divisor, std::uint64_t& remainder) noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_UINT128_MSVC && defined(_M_X64)
+    if !consteval
     {
-        // Division of 128-bit integers is complex and typically requires a more sophisticated algorithm.
-        // This is a placeholder implementation that does not perform actual division.
-        return uint128_t{};
+        return _udiv128(high, low, divisor, &remainder);
     }
+#endif
+    constexpr std::uint64_t base = std::uint64_t{1} << 32;
+
+    // Normalize so the divisor's top bit is set, which bounds each digit estimate's error by two.
+    const int shift = std::countl_zero(divisor);
+    divisor <<= shift;
+    const std::uint64_t divisor_high = divisor >> 32;
+    const std::uint64_t divisor_low = divisor & 0xFFFFFFFF;
+    const std::uint64_t numerator_high = shift == 0 ? high : (high << shift) | (low >> (64 - shift));
+    const std::uint64_t numerator_low = low << shift;
+    const std::uint64_t numerator_digit1 = numerator_low >> 32;
+    const std::uint64_t numerator_digit0 = numerator_low & 0xFFFFFFFF;
 
-    uint128_t operator%(const uint128_t& other) const noexcept
+    // First quotient digit from the top three numerator digits.
+    std::uint64_t quotient1 = numerator_high / divisor_high;
+    std::uint64_t estimate_remainder = numerator_high - quotient1 * divisor_high;
+    while (quotient1 >= base || quotient1 * divisor_low > base * estimate_remainder + numerator_digit1)
     {
-        // Modulo of 128-bit integers is complex and typically requires a more sophisticated algorithm.
-        // This is a placeholder implementation that does not perform actual modulo.
-        return uint128_t{};
+        --quotient1;
+        estimate_remainder += divisor_high;
+        if (estimate_remainder >= base) break;
     }
+    const std::uint64_t partial = numerator_high * base + numerator_digit1 - quotient1 * divisor;
 
-    uint128_t& operator+=(const uint128_t& other) noexcept { *this = *this + other; return *this; }
-    uint128_t& operator-=(const uint128_t& other) noexcept { *this = *this - other; return *this; }
-    uint128_t& operator*=(const uint128_t& other) noexcept { *this = *this * other; return *this; }
-    uint128_t& operator/=(const uint128_t& other) noexcept { *this = *this / other; return *this; }
-    uint128_t& operator%=(const uint128_t& other) noexcept { *this = *this % other; return *this; }
-
-    uint128_t& operator++() noexcept { *this += uint128_t{0, 1}; return *this; }
-    uint128_t operator++(int) noexcept { uint128_t copy = *this; ++(*this); return copy; }
-    uint128_t& operator--() noexcept { *this -= uint128_t{0, 1}; return *this; }
-    uint128_t operator--(int) noexcept { uint128_t copy = *this; --(*this); return copy; }
-    
-    uint128_t operator<<(int shift) const noexcept
+    // Second quotient digit from the partial remainder and the last numerator digit.
+    std::uint64_t quotient0 = partial / divisor_high;
+    estimate_remainder = partial - quotient0 * divisor_high;
+    while (quotient0 >= base || quotient0 * divisor_low > base * estimate_remainder + numerator_digit0)
     {
-        if (shift >= 128)
-            return uint128_t{0, 0};
-        else if (shift >= 64)
-            return uint128_t{low << (shift - 64), 0};
-        else
-            return uint128_t{(high << shift) | (low >> (64 - shift)), low << shift};
+        --quotient0;
+        estimate_remainder += divisor_high;
+        if (estimate_remainder >= base) break;
     }
 
-    uint128_t operator>>(int shift) const noexcept
+    remainder = (partial * base + numerator_digit0 - quotient0 * divisor) >> shift;
+    return quotient1 * base + quotient0;
+}
+
+constexpr uint128_t UInt128Portable::divide(const uint128_t& dividend, const uint128_t& divisor, uint128_t& remainder) noexcept
+{
+    if (divisor.high() == 0)
     {
-        if (shift >= 128)
-            return uint128_t{0, 0};
-        else if (shift >= 64)
-            return uint128_t{0, high >> (shift - 64)};
-        else
-            return uint128_t{high >> shift, (low >> shift) | (high << (64 - shift))};
+        std::uint64_t remainder_low = 0;
+        if (dividend.high() < divisor.low())
+        {
+            const std::uint64_t quotient = divide(dividend.high(), dividend.low(), divisor.low(), remainder_low);
+            remainder = uint128_t{remainder_low};
+            return uint128_t{quotient};
+        }
+        const std::uint64_t quotient_high = dividend.high() / divisor.low();
+        const std::uint64_t quotient_low = divide(dividend.high() % divisor.low(), dividend.low(), divisor.low(), remainder_low);
+        remainder = uint128_t{remainder_low};
+        return uint128_t{quotient_high, quotient_low};
     }
 
-    uint128_t& operator<<=(int shift) noexcept { *this = *this << shift; return *this; }
-    uint128_t& operator>>=(int shift) noexcept { *this = *this >> shift; return *this; }
+    // The quotient is below 2^64. Estimate it from the dividend halved (so the 128 / 64 step cannot
+    // overflow) over the divisor's normalized top 64 bits; the estimate is the quotient or one more.
+    const int shift = std::countl_zero(divisor.high());
+    const std::uint64_t divisor_top = (divisor << shift).high();
+    const uint128_t halved = dividend >> 1;
+    std::uint64_t unused = 0;
+    std::uint64_t quotient = divide(halved.high(), halved.low(), divisor_top, unused) >> (63 - shift);
+    if (quotient != 0) --quotient;
 
-// Output stream operator requirements
-public:
-    friend std::ostream& operator<<(std::ostream& os, const uint128_t& value)
+    uint128_t product = uint128_t::multiply(quotient, divisor.low());
+    product = uint128_t{product.high() + quotient * divisor.high(), product.low()};
+    remainder = dividend - product;
+    if (remainder >= divisor)
     {
-        // This is a simple implementation that prints the high and low parts in hexadecimal.
-        // A more complete implementation might convert the entire 128-bit value to decimal.
-        return os << std::hex << value.high << std::hex << value.low << std::dec;
+        ++quotient;
+        remainder -= divisor;
     }
-};
+    return uint128_t{quotient};
+}
 
 } // namespace Softloq::WHATWG::Infra
 
-#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT128_UINT128_T_HPP
\ No newline at end of file
+#include "Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp"
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT128_UINT128_T_HPP
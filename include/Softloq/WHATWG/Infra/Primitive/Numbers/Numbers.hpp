@@ -16,9 +16,16 @@
 #include "Softloq/WHATWG/Infra/Primitive/Number/UInt32/UInt32.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Number/UInt64/UInt64.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/UInt128.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt256/UInt256.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt512/UInt512.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Number/Int8/Int8.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Number/Int16/Int16.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Number/Int32/Int32.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Number/Int64/Int64.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Int128/Int128.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Int256/Int256.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Int512/Int512.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/BigInt/BigInt.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Double/Double.hpp"
 
 #endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBERS_NUMBERS_HPP
@@ -1,44 +1,63 @@
 /**
  * @file Softloq/WHATWG/Infra/Primitive/Primitive.hpp
  * @author Softloq CEO - Brandon Foster (Paradox Gene)
- * @brief This header defines the primitive abstract class for the WHATWG Infra library.
+ * @brief This header defines the primitive base class template for the WHATWG Infra library.
  *
  * Copyright (c) 2026 Softloq. All rights reserved.
  * Softloq implementation of the WHATWG Infra library.
- * This header defines the primitive abstract class for the WHATWG Infra library.
+ * This header defines the primitive base class template and the primitive type trait for the WHATWG Infra library.
  */
 
 #ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_PRIMITIVE_HPP
 #define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_PRIMITIVE_HPP
 
-#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/PrimitiveType.hpp"
+#include <concepts>
 
 namespace Softloq::WHATWG::Infra
 {
 
 /**
- * @brief The Primitive class is an abstract base class for all primitive types in the WHATWG Infra library.
+ * @brief The Primitive class template is the empty base class of every primitive type in the WHATWG Infra library.
  *
- * The Primitive class is an abstract base class for all primitive types in the WHATWG Infra library.
- * It provides a common interface for all primitive types and allows for polymorphic behavior.
+ * Each primitive type derives from Primitive with its own PrimitiveType, so the type of a primitive
+ * is known at compile time and costs neither a virtual table pointer nor a virtual call. The base
+ * is empty, so a primitive is exactly as large as its value, and the primitives that hold a single
+ * value stay trivially copyable. Callers that need the type of a primitive at run time use PrimitiveRef.
+ *
+ * @tparam Type The type of the deriving primitive.
  */
+template <PrimitiveType Type>
 class Primitive
 {
-// Constructors and destructor
 public:
-    SOFTLOQ_WHATWG_INFRA_API Primitive() noexcept;
-    SOFTLOQ_WHATWG_INFRA_API virtual ~Primitive() noexcept = 0;
+    /**
+     * @brief The type of the primitive.
+     */
+    static constexpr PrimitiveType primitive_type = Type;
 
-public:
     /**
      * @brief Get the type of the primitive.
      *
      * @return The type of the primitive.
      */
-    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API virtual PrimitiveType get_type() const noexcept = 0;
+    [[nodiscard]] static constexpr PrimitiveType get_type() noexcept { return Type; }
 };
 
+/**
+ * @brief Concept for the primitive types: the classes derived from the Primitive of their own PrimitiveType.
+ */
+template <typename T>
+concept PrimitiveConcept = requires {
+    { T::primitive_type } -> std::convertible_to<PrimitiveType>;
+} && std::derived_from<T, Primitive<T::primitive_type>>;
+
+/**
+ * @brief The type of the primitive type T.
+ */
+template <PrimitiveConcept T>
+inline constexpr PrimitiveType primitive_type_v = T::primitive_type;
+
 } // namespace Softloq::WHATWG::Infra
 
 #endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_PRIMITIVE_HPP
@@ -0,0 +1,104 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/PrimitiveRef.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the PrimitiveRef type for the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the type-erased reference to a primitive of any type for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_PRIMITIVEREF_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_PRIMITIVEREF_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Primitive.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/PrimitiveType.hpp"
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief The PrimitiveRef type refers to a primitive of any type and knows its type at run time.
+ *
+ * Primitives carry their type at compile time only. A PrimitiveRef is the runtime view for the
+ * callers that handle primitives of several types through one interface: it holds the address of
+ * the primitive along with its PrimitiveType and the exact C++ type it was made from, so it can be
+ * asked for the type and safely cast back. It does not own the primitive, which must outlive it.
+ */
+class PrimitiveRef final
+{
+// Constructors
+public:
+    /**
+     * @brief Construct a reference to a primitive.
+     *
+     * @param primitive The primitive to refer to, which must outlive the reference.
+     */
+    template <PrimitiveConcept T>
+    constexpr PrimitiveRef(const T& primitive) noexcept
+        : m_primitive{&primitive}, m_type{T::primitive_type}, m_tag{&tag<T>}
+    {
+    }
+
+    /**
+     * @brief A reference to a temporary primitive would dangle, so it cannot be created.
+     */
+    template <PrimitiveConcept T>
+    PrimitiveRef(const T&&) = delete;
+
+// Accessors
+public:
+    /**
+     * @brief Get the type of the referred primitive.
+     *
+     * @return The type of the referred primitive.
+     */
+    [[nodiscard]] constexpr PrimitiveType get_type() const noexcept { return m_type; }
+
+    /**
+     * @brief Check whether the referred primitive is of type T.
+     *
+     * Every Number<T> shares PrimitiveType::Number, so this tells the widths apart where get_type() cannot.
+     *
+     * @return True if the referred primitive is a T, false otherwise.
+     */
+    template <PrimitiveConcept T>
+    [[nodiscard]] constexpr bool holds() const noexcept
+    {
+        return m_tag == &tag<T>;
+    }
+
+    /**
+     * @brief Get the referred primitive as a T.
+     *
+     * @return The referred primitive, or nullptr if it is not a T.
+     */
+    template <PrimitiveConcept T>
+    [[nodiscard]] const T* get_if() const noexcept
+    {
+        return holds<T>() ? static_cast<const T*>(m_primitive) : nullptr;
+    }
+
+// Comparison
+public:
+    /**
+     * @brief Check whether two references refer to the same primitive.
+     */
+    [[nodiscard]] constexpr bool operator==(const PrimitiveRef& other) const noexcept { return m_primitive == other.m_primitive && m_tag == other.m_tag; }
+
+// Implementation
+private:
+    /**
+     * @brief One object per primitive type, whose address identifies the type.
+     */
+    template <typename T>
+    static constexpr char tag{};
+
+    const void* m_primitive;
+    PrimitiveType m_type;
+    const char* m_tag;
+};
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_PRIMITIVEREF_HPP
@@ -0,0 +1,155 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/Atom.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the Atom type for the WHATWG Infra library, an interned immutable String compared by identity.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the Atom type and its global, thread-safe atom table.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_ATOM_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_ATOM_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/StaticAtoms.hpp"
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <string_view>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief An interned, immutable String.
+ *
+ * Every Atom with the same code units refers to the same entry of a global atom table, so atoms are
+ * compared by pointer and hashed by a value computed once when the entry is created. Element names,
+ * attribute names and namespace URIs that repeat across a document are therefore compared in O(1)
+ * instead of code unit by code unit.
+ *
+ * The common vocabulary is pre-seeded as StaticAtom entries that are never freed and are found
+ * through a compile-time hash table without taking the table lock. Other atoms are reference
+ * counted; an entry whose last Atom is destroyed stays in the table until the next sweep, which the
+ * next intern runs once enough entries have become unused, or collect_unused() runs on demand.
+ * Destroying an Atom never locks the table. The table is safe to use from several threads.
+ *
+ * The default-constructed Atom is the empty string.
+ */
+class Atom final
+{
+public:
+    struct Entry;
+
+// Constructors and destructor
+public:
+    SOFTLOQ_WHATWG_INFRA_API Atom() noexcept;
+
+    /**
+     * @brief Intern a String.
+     *
+     * @param value The String to intern.
+     */
+    SOFTLOQ_WHATWG_INFRA_API explicit Atom(const String& value);
+
+    /**
+     * @brief Intern UTF-16 code units.
+     *
+     * @param value The code units to intern.
+     */
+    SOFTLOQ_WHATWG_INFRA_API explicit Atom(std::u16string_view value);
+
+    /**
+     * @brief Get a static atom. This never looks up the table.
+     *
+     * @param value The static atom.
+     */
+    SOFTLOQ_WHATWG_INFRA_API Atom(StaticAtom value);
+
+    SOFTLOQ_WHATWG_INFRA_API Atom(const Atom& other) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API Atom(Atom&& other) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API ~Atom() noexcept;
+
+    SOFTLOQ_WHATWG_INFRA_API Atom& operator=(const Atom& other) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API Atom& operator=(Atom&& other) noexcept;
+
+// Accessors
+public:
+    /**
+     * @brief Get the interned String.
+     *
+     * @return The String, which lives as long as the atom's table entry.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API const String& string() const noexcept;
+
+    /**
+     * @brief Get the hash of the atom, equal to the hash() of its String.
+     *
+     * @return The precomputed hash.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t hash() const noexcept;
+
+    /**
+     * @brief Returns true if the atom is one of the pre-seeded StaticAtom entries or the empty string.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool is_static() const noexcept;
+
+// Atom table
+public:
+    /**
+     * @brief Remove the entries of the atom table that no Atom refers to any more.
+     *
+     * @return The number of entries removed.
+     */
+    SOFTLOQ_WHATWG_INFRA_API static std::size_t collect_unused();
+
+    /**
+     * @brief Get the number of reference-counted entries in the atom table, including unused ones not yet collected.
+     *
+     * @return The number of dynamic entries.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API static std::size_t dynamic_count();
+
+// Operators
+public:
+    /**
+     * @brief Equality comparison: true if both atoms refer to the same table entry, i.e. hold the same code units.
+     *
+     * @param other The Atom to compare against.
+     */
+    [[nodiscard]] bool operator==(const Atom& other) const noexcept { return m_entry == other.m_entry; }
+
+    /**
+     * @brief Inequality comparison.
+     *
+     * @param other The Atom to compare against.
+     */
+    [[nodiscard]] bool operator!=(const Atom& other) const noexcept { return m_entry != other.m_entry; }
+
+private:
+    /**
+     * @brief Find or create the table entry for the given code units and take a reference to it.
+     */
+    template <typename Unit>
+    static const Entry* intern(std::span<const Unit> code_units);
+
+    static void retain(const Entry* entry) noexcept;
+    static void release(const Entry* entry) noexcept;
+
+    const Entry* m_entry;
+};
+
+} // namespace Softloq::WHATWG::Infra
+
+/**
+ * @brief Hash specialization for the Atom type, returning its precomputed hash.
+ */
+template <>
+struct std::hash<Softloq::WHATWG::Infra::Atom>
+{
+    inline std::size_t operator()(const Softloq::WHATWG::Infra::Atom& value) const noexcept { return value.hash(); }
+};
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_ATOM_HPP
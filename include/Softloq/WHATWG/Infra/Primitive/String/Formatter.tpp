@@ -0,0 +1,76 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/Formatter.tpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Formatter specialization for the String primitive type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains the formatter specialization for the String primitive type.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_FORMATTER_TPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_FORMATTER_TPP
+
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include <format>
+#include <string>
+
+/**
+ * @brief Formatter specialization for the String primitive type.
+ *
+ * This formatter specialization allows the String primitive type to be formatted
+ * as a string using std::format. When formatted, the String is written as UTF-8 text;
+ * lone surrogates are written as U+FFFD REPLACEMENT CHARACTER.
+ */
+template <>
+struct std::formatter<Softloq::WHATWG::Infra::String> : std::formatter<std::string>
+{
+    inline auto format(const Softloq::WHATWG::Infra::String& value, format_context& ctx) const
+    {
+        // ASCII is its own UTF-8 encoding.
+        if (value.is_8bit() && value.is_ascii())
+        {
+            const auto units = value.latin1_span();
+            return formatter<std::string>::format(std::string(units.begin(), units.end()), ctx);
+        }
+        std::string result;
+        result.reserve(value.size());
+        value.visit([&result](auto units)
+        {
+            for (std::size_t i = 0; i < units.size(); ++i)
+            {
+                char32_t code_point = units[i];
+                if (code_point >= 0xD800 && code_point <= 0xDFFF)
+                {
+                    if (code_point <= 0xDBFF && i + 1 < units.size() && units[i + 1] >= 0xDC00 && units[i + 1] <= 0xDFFF)
+                        code_point = 0x10000 + ((code_point - 0xD800) << 10) + (units[++i] - 0xDC00);
+                    else
+                        code_point = 0xFFFD;
+                }
+                if (code_point < 0x80)
+                    result += static_cast<char>(code_point);
+                else if (code_point < 0x800)
+                {
+                    result += static_cast<char>(0xC0 | (code_point >> 6));
+                    result += static_cast<char>(0x80 | (code_point & 0x3F));
+                }
+                else if (code_point < 0x10000)
+                {
+                    result += static_cast<char>(0xE0 | (code_point >> 12));
+                    result += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                    result += static_cast<char>(0x80 | (code_point & 0x3F));
+                }
+                else
+                {
+                    result += static_cast<char>(0xF0 | (code_point >> 18));
+                    result += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+                    result += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                    result += static_cast<char>(0x80 | (code_point & 0x3F));
+                }
+            }
+        });
+        return formatter<std::string>::format(result, ctx);
+    }
+};
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_FORMATTER_TPP
@@ -0,0 +1,154 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/IsomorphicStringView.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the IsomorphicStringView type for the WHATWG Infra library, a lazily isomorphic-decoded view of a byte sequence.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the IsomorphicStringView type, which reads a ByteSequence as the String its
+ * isomorphic decode would produce without materializing that String.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_ISOMORPHICSTRINGVIEW_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_ISOMORPHICSTRINGVIEW_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/ByteSequence/ByteSequence.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/CodeUnit/CodeUnit.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include <cstddef>
+#include <string_view>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief A non-owning view of a ByteSequence as the String its isomorphic decode would produce.
+ *
+ * Isomorphic decode maps every byte to the code unit of equal value, so the code units of the view
+ * are computed from the bytes on access. Comparing or searching a decoded header value therefore
+ * never allocates; to_string() materializes the decoded String when one is actually needed.
+ *
+ * The view refers to the ByteSequence it was created from, which must outlive it. Mutating the
+ * ByteSequence is reflected by the view.
+ */
+class IsomorphicStringView final
+{
+// Constructors
+public:
+    /**
+     * @brief Create a view of a byte sequence.
+     *
+     * @param bytes The byte sequence to view.
+     */
+    SOFTLOQ_WHATWG_INFRA_API explicit IsomorphicStringView(const ByteSequence& bytes) noexcept;
+
+    /**
+     * @brief A view of a temporary byte sequence would dangle, so it cannot be created.
+     */
+    IsomorphicStringView(const ByteSequence&&) = delete;
+
+// Container interface
+public:
+    /**
+     * @brief The value returned by find() when there is no match.
+     */
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /**
+     * @brief Get the length of the view in code units, equal to the number of bytes.
+     *
+     * @return The number of code units.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t size() const noexcept;
+
+    /**
+     * @brief Returns true if the view contains no code units.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool is_empty() const noexcept;
+
+    /**
+     * @brief Access a code unit by index without bounds checking.
+     *
+     * @param index The index of the code unit.
+     * @return The code unit of equal value to the byte at the given index.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API CodeUnit operator[](std::size_t index) const noexcept;
+
+    /**
+     * @brief Access a code unit by index with bounds checking.
+     *
+     * @param index The index of the code unit.
+     * @return The code unit of equal value to the byte at the given index.
+     * @throws std::out_of_range if index is out of bounds.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API CodeUnit at(std::size_t index) const;
+
+// Searching
+public:
+    /**
+     * @brief Returns true if the view starts with the code units of a String.
+     *
+     * @param prefix The String to look for.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool starts_with(const String& prefix) const;
+
+    /**
+     * @brief Find the first occurrence of a code unit.
+     *
+     * @param code_unit The code unit to look for.
+     * @param position The index to start searching at.
+     * @return The index of the code unit, or npos if it does not occur.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t find(CodeUnit code_unit, std::size_t position = 0) const noexcept;
+
+    /**
+     * @brief Find the first occurrence of the code units of a String.
+     *
+     * @param needle The String to look for.
+     * @param position The index to start searching at.
+     * @return The index of the first code unit of the match, or npos if there is none.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t find(const String& needle, std::size_t position = 0) const;
+
+// Conversion
+public:
+    /**
+     * @brief Isomorphic decode the viewed bytes into a String.
+     *
+     * @return An 8-bit String with the code units of the view.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API String to_string() const;
+
+// Operators
+public:
+    /**
+     * @brief Equality comparison with another view.
+     *
+     * @param other The view to compare against.
+     * @return true if both views contain the same code units in the same order.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool operator==(const IsomorphicStringView& other) const noexcept;
+
+    /**
+     * @brief Equality comparison with a String, whatever its representation.
+     *
+     * @param other The String to compare against.
+     * @return true if the String contains the code units of the view in the same order.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool operator==(const String& other) const;
+
+    /**
+     * @brief Equality comparison with UTF-16 code units.
+     *
+     * @param other The code units to compare against.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool operator==(std::u16string_view other) const noexcept;
+
+private:
+    const ByteSequence* m_bytes;
+};
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_ISOMORPHICSTRINGVIEW_HPP
@@ -0,0 +1,509 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/StaticAtoms.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the static atoms of the WHATWG Infra library, the pre-interned vocabulary of element names, attribute names and namespaces.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the StaticAtom enumeration, the text of each static atom, and a compile-time
+ * hash table that finds a static atom by its text.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STATICATOMS_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STATICATOMS_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief The static atoms: common HTML element names, attribute names and namespace URIs.
+ *
+ * Static atoms are part of the atom table from the start, so interning one of these strings never
+ * allocates or takes the table lock. The enumerator names are the text in PascalCase; namespaces
+ * are suffixed with Namespace.
+ */
+enum class StaticAtom : std::uint16_t
+{
+    A,
+    Abbr,
+    Address,
+    Area,
+    Article,
+    Aside,
+    Audio,
+    B,
+    Base,
+    Bdi,
+    Bdo,
+    Blockquote,
+    Body,
+    Br,
+    Button,
+    Canvas,
+    Caption,
+    Cite,
+    Code,
+    Col,
+    Colgroup,
+    Data,
+    Datalist,
+    Dd,
+    Del,
+    Details,
+    Dfn,
+    Dialog,
+    Div,
+    Dl,
+    Dt,
+    Em,
+    Embed,
+    Fieldset,
+    Figcaption,
+    Figure,
+    Footer,
+    Form,
+    H1,
+    H2,
+    H3,
+    H4,
+    H5,
+    H6,
+    Head,
+    Header,
+    Hgroup,
+    Hr,
+    Html,
+    I,
+    Iframe,
+    Img,
+    Input,
+    Ins,
+    Kbd,
+    Label,
+    Legend,
+    Li,
+    Link,
+    Main,
+    Map,
+    Mark,
+    Math,
+    Menu,
+    Meta,
+    Meter,
+    Nav,
+    Noscript,
+    Object,
+    Ol,
+    Optgroup,
+    Option,
+    Output,
+    P,
+    Picture,
+    Pre,
+    Progress,
+    Q,
+    Rp,
+    Rt,
+    Ruby,
+    S,
+    Samp,
+    Script,
+    Search,
+    Section,
+    Select,
+    Slot,
+    Small,
+    Source,
+    Span,
+    Strong,
+    Style,
+    Sub,
+    Summary,
+    Sup,
+    Svg,
+    Table,
+    Tbody,
+    Td,
+    Template,
+    Textarea,
+    Tfoot,
+    Th,
+    Thead,
+    Time,
+    Title,
+    Tr,
+    Track,
+    U,
+    Ul,
+    Var,
+    Video,
+    Wbr,
+    Accept,
+    AcceptCharset,
+    Accesskey,
+    Action,
+    Alt,
+    Async,
+    Autocomplete,
+    Autofocus,
+    Charset,
+    Checked,
+    Class,
+    Cols,
+    Colspan,
+    Content,
+    Contenteditable,
+    Controls,
+    Coords,
+    Crossorigin,
+    Datetime,
+    Defer,
+    Dir,
+    Disabled,
+    Download,
+    Draggable,
+    Enctype,
+    For,
+    Height,
+    Hidden,
+    High,
+    Href,
+    Hreflang,
+    HttpEquiv,
+    Id,
+    Integrity,
+    Is,
+    Lang,
+    List,
+    Loading,
+    Low,
+    Max,
+    Maxlength,
+    Media,
+    Method,
+    Min,
+    Minlength,
+    Multiple,
+    Muted,
+    Name,
+    Nonce,
+    Novalidate,
+    Onchange,
+    Onclick,
+    Onerror,
+    Oninput,
+    Onload,
+    Onsubmit,
+    Open,
+    Optimum,
+    Pattern,
+    Placeholder,
+    Poster,
+    Preload,
+    Readonly,
+    Rel,
+    Required,
+    Reversed,
+    Rows,
+    Rowspan,
+    Sandbox,
+    Scope,
+    Selected,
+    Shape,
+    Size,
+    Sizes,
+    Src,
+    Srcdoc,
+    Srclang,
+    Srcset,
+    Start,
+    Step,
+    Tabindex,
+    Target,
+    Translate,
+    Type,
+    Usemap,
+    Value,
+    Width,
+    Wrap,
+    HTMLNamespace,
+    MathMLNamespace,
+    SVGNamespace,
+    XLinkNamespace,
+    XMLNamespace,
+    XMLNSNamespace,
+};
+
+/**
+ * @brief The text of each static atom, indexed by StaticAtom.
+ */
+inline constexpr std::u16string_view static_atom_texts[]{
+    u"a",
+    u"abbr",
+    u"address",
+    u"area",
+    u"article",
+    u"aside",
+    u"audio",
+    u"b",
+    u"base",
+    u"bdi",
+    u"bdo",
+    u"blockquote",
+    u"body",
+    u"br",
+    u"button",
+    u"canvas",
+    u"caption",
+    u"cite",
+    u"code",
+    u"col",
+    u"colgroup",
+    u"data",
+    u"datalist",
+    u"dd",
+    u"del",
+    u"details",
+    u"dfn",
+    u"dialog",
+    u"div",
+    u"dl",
+    u"dt",
+    u"em",
+    u"embed",
+    u"fieldset",
+    u"figcaption",
+    u"figure",
+    u"footer",
+    u"form",
+    u"h1",
+    u"h2",
+    u"h3",
+    u"h4",
+    u"h5",
+    u"h6",
+    u"head",
+    u"header",
+    u"hgroup",
+    u"hr",
+    u"html",
+    u"i",
+    u"iframe",
+    u"img",
+    u"input",
+    u"ins",
+    u"kbd",
+    u"label",
+    u"legend",
+    u"li",
+    u"link",
+    u"main",
+    u"map",
+    u"mark",
+    u"math",
+    u"menu",
+    u"meta",
+    u"meter",
+    u"nav",
+    u"noscript",
+    u"object",
+    u"ol",
+    u"optgroup",
+    u"option",
+    u"output",
+    u"p",
+    u"picture",
+    u"pre",
+    u"progress",
+    u"q",
+    u"rp",
+    u"rt",
+    u"ruby",
+    u"s",
+    u"samp",
+    u"script",
+    u"search",
+    u"section",
+    u"select",
+    u"slot",
+    u"small",
+    u"source",
+    u"span",
+    u"strong",
+    u"style",
+    u"sub",
+    u"summary",
+    u"sup",
+    u"svg",
+    u"table",
+    u"tbody",
+    u"td",
+    u"template",
+    u"textarea",
+    u"tfoot",
+    u"th",
+    u"thead",
+    u"time",
+    u"title",
+    u"tr",
+    u"track",
+    u"u",
+    u"ul",
+    u"var",
+    u"video",
+    u"wbr",
+    u"accept",
+    u"accept-charset",
+    u"accesskey",
+    u"action",
+    u"alt",
+    u"async",
+    u"autocomplete",
+    u"autofocus",
+    u"charset",
+    u"checked",
+    u"class",
+    u"cols",
+    u"colspan",
+    u"content",
+    u"contenteditable",
+    u"controls",
+    u"coords",
+    u"crossorigin",
+    u"datetime",
+    u"defer",
+    u"dir",
+    u"disabled",
+    u"download",
+    u"draggable",
+    u"enctype",
+    u"for",
+    u"height",
+    u"hidden",
+    u"high",
+    u"href",
+    u"hreflang",
+    u"http-equiv",
+    u"id",
+    u"integrity",
+    u"is",
+    u"lang",
+    u"list",
+    u"loading",
+    u"low",
+    u"max",
+    u"maxlength",
+    u"media",
+    u"method",
+    u"min",
+    u"minlength",
+    u"multiple",
+    u"muted",
+    u"name",
+    u"nonce",
+    u"novalidate",
+    u"onchange",
+    u"onclick",
+    u"onerror",
+    u"oninput",
+    u"onload",
+    u"onsubmit",
+    u"open",
+    u"optimum",
+    u"pattern",
+    u"placeholder",
+    u"poster",
+    u"preload",
+    u"readonly",
+    u"rel",
+    u"required",
+    u"reversed",
+    u"rows",
+    u"rowspan",
+    u"sandbox",
+    u"scope",
+    u"selected",
+    u"shape",
+    u"size",
+    u"sizes",
+    u"src",
+    u"srcdoc",
+    u"srclang",
+    u"srcset",
+    u"start",
+    u"step",
+    u"tabindex",
+    u"target",
+    u"translate",
+    u"type",
+    u"usemap",
+    u"value",
+    u"width",
+    u"wrap",
+    u"http://www.w3.org/1999/xhtml",
+    u"http://www.w3.org/1998/Math/MathML",
+    u"http://www.w3.org/2000/svg",
+    u"http://www.w3.org/1999/xlink",
+    u"http://www.w3.org/XML/1998/namespace",
+    u"http://www.w3.org/2000/xmlns/",
+};
+
+/**
+ * @brief The number of static atoms.
+ */
+inline constexpr std::size_t static_atom_count = std::size(static_atom_texts);
+
+static_assert(static_cast<std::size_t>(StaticAtom::XMLNSNamespace) + 1 == static_atom_count, "every StaticAtom needs a text");
+
+/**
+ * @brief The compile-time open-addressing hash table of the static atoms.
+ *
+ * Each slot holds a StaticAtom index, or static_atom_empty_slot. A static atom with hash h is found
+ * by probing linearly from slot h % static_atom_slot_count.
+ */
+inline constexpr std::size_t static_atom_slot_count = 1024;
+inline constexpr std::uint16_t static_atom_empty_slot = 0xFFFF;
+
+inline constexpr std::array<std::uint16_t, static_atom_slot_count> static_atom_slots = []
+{
+    std::array<std::uint16_t, static_atom_slot_count> slots{};
+    slots.fill(static_atom_empty_slot);
+    for (std::size_t index = 0; index < static_atom_count; ++index)
+    {
+        std::size_t slot = hash_code_units(std::span<const char16_t>{static_atom_texts[index]}) % static_atom_slot_count;
+        while (slots[slot] != static_atom_empty_slot) slot = (slot + 1) % static_atom_slot_count;
+        slots[slot] = static_cast<std::uint16_t>(index);
+    }
+    return slots;
+}();
+
+/**
+ * @brief Find the static atom with the given code units.
+ *
+ * @param code_units The code units to look up.
+ * @param hash The hash_code_units() of the code units.
+ * @return The index of the static atom, or static_atom_count if there is none.
+ */
+template <typename Unit>
+[[nodiscard]] constexpr std::size_t find_static_atom(std::span<const Unit> code_units, std::size_t hash) noexcept
+{
+    for (std::size_t slot = hash % static_atom_slot_count; static_atom_slots[slot] != static_atom_empty_slot; slot = (slot + 1) % static_atom_slot_count)
+    {
+        const std::u16string_view text = static_atom_texts[static_atom_slots[slot]];
+        if (text.size() == code_units.size() && std::equal(text.begin(), text.end(), code_units.begin(), [](char16_t lhs, Unit rhs) { return lhs == static_cast<char16_t>(rhs); }))
+            return static_atom_slots[slot];
+    }
+    return static_atom_count;
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STATICATOMS_HPP
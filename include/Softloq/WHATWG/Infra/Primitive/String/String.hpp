@@ -0,0 +1,589 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/String.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the String type for the WHATWG Infra library, representing a sequence of UTF-16 code units in the context of web APIs.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the String type for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRING_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRING_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Primitive.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/CodePoint/CodePoint.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/CodeUnit/CodeUnit.hpp"
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Thresholds that decide when concatenating Strings builds a rope instead of copying.
+ */
+struct StringRopeThresholds
+{
+    /**
+     * @brief Concatenations shorter than this many code units are copied into a flat String.
+     */
+    std::size_t min_length = 256;
+
+    /**
+     * @brief Concatenations that would make a rope deeper than this are flattened instead.
+     */
+    std::size_t max_depth = 512;
+};
+
+/**
+ * @brief Thresholds that decide when a substring shares its String's buffer instead of copying.
+ */
+struct StringSliceThresholds
+{
+    /**
+     * @brief Substrings shorter than this many code units are copied, which is cheaper than sharing.
+     */
+    std::size_t min_length = 32;
+
+    /**
+     * @brief A substring is copied instead of shared if the buffer it would keep alive is more than this many times its length.
+     *
+     * 0 copies every substring.
+     */
+    std::size_t max_waste_ratio = 16;
+};
+
+/**
+ * @brief Hash a sequence of code units with 64-bit FNV-1a, reduced to std::size_t.
+ *
+ * Each code unit is hashed as its 16-bit value, so 8-bit and UTF-16 storage of the same code units
+ * hash equal.
+ *
+ * @param code_units The code units to hash.
+ * @return The hash.
+ */
+template <typename Unit>
+[[nodiscard]] constexpr std::size_t hash_code_units(std::span<const Unit> code_units) noexcept;
+
+/**
+ * @brief The String type represents a sequence of UTF-16 code units in the context of web APIs.
+ *
+ * The String type represents a sequence of zero or more 16-bit unsigned integers (code units), as
+ * defined by the WHATWG Infra specification. Most strings on the web are ASCII or Latin-1, so a
+ * String stores one byte per code unit whenever every code unit is at most 0x00FF (the 8-bit, or
+ * Latin-1, representation) and widens to two bytes per code unit only when a larger code unit is
+ * stored. The representation never changes the value: an 8-bit String and a UTF-16 String holding
+ * the same code units compare equal.
+ *
+ * The visit() member hands the storage to byte- or code-unit-level algorithms as a
+ * std::span<const std::uint8_t> or std::span<const char16_t>, so the vectorized operations run on
+ * narrow strings directly.
+ *
+ * Concatenating long Strings with concat() or operator+ builds a rope: a shared tree node that
+ * refers to both operands instead of copying them. The first access to the code units of a rope
+ * flattens it into a buffer cached in the tree node. Flattening is synchronized, so a rope can be
+ * read from several threads like any other String.
+ *
+ * The hash, whether the String is ASCII or a scalar value string, and its length in code points are
+ * computed on first use and cached in the String until it is mutated, so repeated checks on
+ * immutable Strings such as dictionary keys and atoms cost O(1). The cache is updated atomically,
+ * so it may be filled from several threads reading the same String.
+ *
+ * A code unit substring of a long String is a slice: it refers to a window of the parent's buffer,
+ * which is immutable and kept alive by an atomic reference count, instead of copying the code
+ * units. Slices that would keep a much larger buffer alive are copied out instead. Mutating a slice
+ * first copies its window into a buffer of its own.
+ *
+ * Code point access on a long UTF-16 String with surrogate pairs uses a sparse index built on first
+ * use, which records the code unit offset of every code_point_index_stride-th code point. Mapping
+ * between code point and code unit offsets then walks at most one stride instead of the whole
+ * String.
+ */
+class String final : public Primitive<PrimitiveType::String>
+{
+public:
+    using Latin1Buffer = std::vector<std::uint8_t>;
+    using UTF16Buffer = std::vector<char16_t>;
+    struct RopeNode;
+    using RopeBuffer = std::shared_ptr<const RopeNode>;
+
+    /**
+     * @brief A window of code units in a buffer shared with other Strings.
+     */
+    struct SliceBuffer
+    {
+        /**
+         * @brief The owner of the shared buffer, which the slice keeps alive.
+         */
+        std::shared_ptr<const void> owner;
+
+        /**
+         * @brief The first code unit of the window: a std::uint8_t if is_8bit, a char16_t otherwise.
+         */
+        const void* data = nullptr;
+
+        /**
+         * @brief The number of code units in the window.
+         */
+        std::size_t length = 0;
+
+        /**
+         * @brief The number of code units in the whole shared buffer.
+         */
+        std::size_t owner_length = 0;
+
+        bool is_8bit = true;
+    };
+    struct CodePointIndex;
+
+    /**
+     * @brief The number of code points between two entries of the code point index.
+     */
+    static constexpr std::size_t code_point_index_stride = 64;
+
+    /**
+     * @brief UTF-16 Strings shorter than this many code units map code point offsets without an index.
+     */
+    static constexpr std::size_t code_point_index_min_length = 256;
+
+// Constructors and destructor
+public:
+    SOFTLOQ_WHATWG_INFRA_API String() noexcept;
+
+    /**
+     * @brief Construct a String from UTF-16 code units, using the 8-bit representation when they all fit.
+     *
+     * @param code_units The code units of the string. Lone surrogates are kept as they are.
+     */
+    SOFTLOQ_WHATWG_INFRA_API explicit String(std::u16string_view code_units);
+
+    /**
+     * @brief Construct a String from code points, encoding supplementary code points as surrogate pairs.
+     *
+     * @param code_points The code points of the string.
+     */
+    SOFTLOQ_WHATWG_INFRA_API explicit String(std::u32string_view code_points);
+
+    SOFTLOQ_WHATWG_INFRA_API String(const String& other);
+    SOFTLOQ_WHATWG_INFRA_API String(String&& other) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API ~String() noexcept;
+
+    SOFTLOQ_WHATWG_INFRA_API String& operator=(const String& other);
+    SOFTLOQ_WHATWG_INFRA_API String& operator=(String&& other) noexcept;
+
+    /**
+     * @brief Construct an 8-bit String whose code units are the given Latin-1 bytes.
+     *
+     * @param bytes The bytes, each becoming the code unit of equal value.
+     * @return The String.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API static String from_latin1(std::span<const std::uint8_t> bytes);
+
+    /**
+     * @brief Construct an 8-bit String whose code units are the given Latin-1 characters.
+     *
+     * @param bytes The characters, each read as an unsigned byte becoming the code unit of equal value.
+     * @return The String.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API static String from_latin1(std::string_view bytes);
+
+    /**
+     * @brief Construct an 8-bit String that takes ownership of a buffer of code units without copying it.
+     *
+     * @param code_units The code units, one byte each.
+     * @return The String.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API static String from_buffer(Latin1Buffer&& code_units) noexcept;
+
+    /**
+     * @brief Construct a UTF-16 String that takes ownership of a buffer of code units without copying it.
+     *
+     * The buffer is kept in the UTF-16 representation even if every code unit would fit in 8 bits;
+     * call try_narrow() to switch.
+     *
+     * @param code_units The code units.
+     * @return The String.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API static String from_buffer(UTF16Buffer&& code_units) noexcept;
+
+    /**
+     * @brief Concatenate two Strings, building a rope when the result is long enough.
+     *
+     * The result is a rope referring to both operands if it has at least thresholds.min_length code
+     * units and the rope would be at most thresholds.max_depth deep; otherwise the code units are
+     * copied into a flat String. Concatenating ropes only copies their shared tree nodes, so
+     * repeatedly concatenating fragments is linear rather than quadratic.
+     *
+     * @param lhs The first String.
+     * @param rhs The second String.
+     * @param thresholds The rope thresholds.
+     * @return The concatenation of lhs and rhs.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API static String concat(String lhs, String rhs, const StringRopeThresholds& thresholds = {});
+
+// Representation
+public:
+    /**
+     * @brief Returns true if the String uses the 8-bit (Latin-1) representation.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool is_8bit() const noexcept;
+
+    /**
+     * @brief Returns true if the String is a rope that has not been flattened yet.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool is_rope() const noexcept;
+
+    /**
+     * @brief Returns true if the String is a slice sharing another String's buffer.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool is_slice() const noexcept;
+
+    /**
+     * @brief Replace a rope or a slice with a flat buffer of its own holding the same code units. Does nothing if the String is already flat.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void flatten();
+
+    /**
+     * @brief Get the code units of an 8-bit String, flattening it first if it is a rope.
+     *
+     * @return The code units, one byte each; empty if the String is not 8-bit.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::span<const std::uint8_t> latin1_span() const;
+
+    /**
+     * @brief Get the code units of a UTF-16 String, flattening it first if it is a rope.
+     *
+     * @return The code units; empty if the String is 8-bit.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::span<const char16_t> utf16_span() const;
+
+    /**
+     * @brief Switch to the UTF-16 representation. The code units are unchanged.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void widen();
+
+    /**
+     * @brief Switch to the 8-bit representation if every code unit is at most 0x00FF.
+     *
+     * @return true if the String is 8-bit afterwards.
+     */
+    SOFTLOQ_WHATWG_INFRA_API bool try_narrow();
+
+    /**
+     * @brief Call a visitor with the storage of the String, flattening it first if it is a rope.
+     *
+     * The visitor is called with a std::span<const std::uint8_t> for an 8-bit String and a
+     * std::span<const char16_t> otherwise, and must return the same type for both.
+     *
+     * @param visitor The callable to invoke.
+     * @return The visitor's result.
+     */
+    template <typename F>
+    decltype(auto) visit(F&& visitor) const;
+
+// Container interface
+public:
+    /**
+     * @brief Get the length of the String in code units.
+     *
+     * @return The number of code units.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t size() const noexcept;
+
+    /**
+     * @brief Returns true if the String contains no code units.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool is_empty() const noexcept;
+
+    /**
+     * @brief Access a code unit by index without bounds checking, flattening a rope first.
+     *
+     * @param index The index of the code unit.
+     * @return The code unit at the given index.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API CodeUnit operator[](std::size_t index) const;
+
+    /**
+     * @brief Access a code unit by index with bounds checking.
+     *
+     * @param index The index of the code unit.
+     * @return The code unit at the given index.
+     * @throws std::out_of_range if index is out of bounds.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API CodeUnit at(std::size_t index) const;
+
+    /**
+     * @brief Append a code unit, widening the String if it does not fit in 8 bits.
+     *
+     * @param code_unit The code unit to append.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void push_back(CodeUnit code_unit);
+
+    /**
+     * @brief Append the code units of another String, widening this String only if the other is not 8-bit.
+     *
+     * A flat String grows its buffer in place. A rope String is extended with concat() instead.
+     *
+     * @param other The String to append.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void append(const String& other);
+
+    /**
+     * @brief Remove all code units. The String becomes 8-bit.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void clear() noexcept;
+
+    /**
+     * @brief Get the code unit substring from start with the given length.
+     *
+     * As defined by the WHATWG Infra specification: the code units of the String from index start,
+     * length of them. A substring of at least thresholds.min_length code units is a slice sharing
+     * this String's buffer, unless the buffer is more than thresholds.max_waste_ratio times longer
+     * than the substring; then, like shorter substrings, it is copied.
+     *
+     * A flat String first moves its buffer into shared storage, without copying it, so that this
+     * String and its slices share it. Because that changes the storage, this overload is not const;
+     * the const overload shares only a buffer that is already shared (a slice or a rope) and copies
+     * otherwise.
+     *
+     * @param start The index of the first code unit.
+     * @param length The number of code units.
+     * @param thresholds The slice thresholds.
+     * @return The substring.
+     * @throws std::out_of_range if start + length is greater than size().
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API String code_unit_substring(std::size_t start, std::size_t length, const StringSliceThresholds& thresholds = {});
+
+    /**
+     * @brief Get the code unit substring from start with the given length, sharing the buffer only if it is already shared.
+     *
+     * @see code_unit_substring(std::size_t, std::size_t, const StringSliceThresholds&)
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API String code_unit_substring(std::size_t start, std::size_t length, const StringSliceThresholds& thresholds = {}) const;
+
+// Conversion
+public:
+    /**
+     * @brief Get a copy of the code units as a std::u16string.
+     *
+     * @return The code units of the String.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::u16string to_utf16() const;
+
+    /**
+     * @brief Hash the code units of the String, independent of its representation.
+     *
+     * @return The hash_code_units() of the code units.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t hash() const;
+
+// Cached properties
+public:
+    /**
+     * @brief Returns true if every code unit is an ASCII code point (at most 0x007F).
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool is_ascii() const;
+
+    /**
+     * @brief Returns true if the String is a scalar value string, i.e. contains no lone surrogates.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool is_scalar_value_string() const;
+
+    /**
+     * @brief Get the length of the String in code points, counting a surrogate pair as one code point and a lone surrogate as one.
+     *
+     * @return The number of code points.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t code_point_length() const;
+
+// Code points
+public:
+    /**
+     * @brief Get the code point at a code point index, decoding surrogate pairs.
+     *
+     * A lone surrogate is its own code point. For long UTF-16 Strings this uses the code point index.
+     *
+     * @param index The index of the code point.
+     * @return The code point.
+     * @throws std::out_of_range if index is not less than code_point_length().
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API CodePoint code_point_at(std::size_t index) const;
+
+    /**
+     * @brief Get the code unit offset at which a code point starts.
+     *
+     * @param code_point_offset The index of the code point; code_point_length() maps to size().
+     * @return The offset of its first code unit.
+     * @throws std::out_of_range if code_point_offset is greater than code_point_length().
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t code_unit_offset(std::size_t code_point_offset) const;
+
+    /**
+     * @brief Get the index of the code point that contains a code unit.
+     *
+     * The trailing surrogate of a pair belongs to the code point of the pair.
+     *
+     * @param code_unit_offset The offset of the code unit; size() maps to code_point_length().
+     * @return The index of the code point.
+     * @throws std::out_of_range if code_unit_offset is greater than size().
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t code_point_offset(std::size_t code_unit_offset) const;
+
+// Operators
+public:
+    /**
+     * @brief Equality comparison: true if both Strings hold the same code units, whatever their representations.
+     *
+     * @param other The String to compare against.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool operator==(const String& other) const;
+
+    /**
+     * @brief Inequality comparison.
+     *
+     * @param other The String to compare against.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool operator!=(const String& other) const;
+
+    /**
+     * @brief Three-way comparison by the WHATWG Infra code unit less than ordering.
+     *
+     * The Strings are compared code unit by code unit; at the first difference, the String with the
+     * smaller code unit is less, and if one String is a prefix of the other, the shorter is less.
+     * The common prefix is skipped sixteen bytes at a time, also when one String is 8-bit and the
+     * other UTF-16.
+     *
+     * @param other The String to compare against.
+     * @return The ordering of this String relative to other.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::strong_ordering operator<=>(const String& other) const;
+
+private:
+    /**
+     * @brief Get the depth of the rope, or 0 if the String is flat.
+     */
+    [[nodiscard]] std::size_t rope_depth() const noexcept;
+
+    /**
+     * @brief Move a flat buffer into shared storage, turning the String into a slice of all of it.
+     */
+    void share();
+
+    /**
+     * @brief The bits of m_properties telling which cached properties are known, and their boolean values.
+     */
+    enum PropertyBits : std::uint32_t
+    {
+        HashKnown = 1u << 0,
+        ScanKnown = 1u << 1,
+        ASCIIBit = 1u << 2,
+        ScalarValueBit = 1u << 3,
+    };
+
+    /**
+     * @brief Scan the code units for the ASCII, scalar value string and code point length properties.
+     *
+     * @param code_point_length Receives the length in code points.
+     * @return The property bits found, including ScanKnown.
+     */
+    std::uint32_t compute_properties(std::size_t& code_point_length) const;
+
+    /**
+     * @brief Get the property bits, scanning the code units first unless the scan is cached.
+     *
+     * @return The property bits after the scan.
+     */
+    std::uint32_t scan_properties() const;
+
+    /**
+     * @brief Returns true if the hashes of both Strings are cached and differ, so the Strings cannot be equal.
+     */
+    [[nodiscard]] bool hashes_differ(const String& other) const noexcept;
+
+    /**
+     * @brief Copy the cached properties of another String holding the same code units.
+     */
+    void copy_properties(const String& other) noexcept;
+
+    /**
+     * @brief Forget the cached properties and the code point index after the code units changed.
+     */
+    void invalidate_properties() noexcept;
+
+    /**
+     * @brief Take over the code point index of a String being moved from.
+     */
+    void take_code_point_index(String& other) noexcept;
+
+    /**
+     * @brief Get the code point index of a UTF-16 String, building it on first use.
+     */
+    const CodePointIndex& code_point_index() const;
+
+    std::variant<Latin1Buffer, UTF16Buffer, RopeBuffer, SliceBuffer> m_units;
+    mutable std::atomic<std::uint32_t> m_properties{0};
+    mutable std::atomic<std::size_t> m_hash{0};
+    mutable std::atomic<std::size_t> m_code_point_length{0};
+    mutable std::atomic<const CodePointIndex*> m_code_point_index{nullptr};
+};
+
+/**
+ * @brief Concatenate two Strings with the default rope thresholds.
+ *
+ * @param lhs The first String.
+ * @param rhs The second String.
+ * @return The concatenation of lhs and rhs.
+ * @see String::concat
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API String operator+(String lhs, const String& rhs);
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <typename Unit>
+constexpr std::size_t hash_code_units(std::span<const Unit> code_units) noexcept
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (const Unit unit : code_units)
+    {
+        hash ^= static_cast<std::uint16_t>(unit);
+        hash *= 0x100000001B3ull;
+    }
+    return static_cast<std::size_t>(hash);
+}
+
+template <typename F>
+decltype(auto) String::visit(F&& visitor) const
+{
+    if (is_8bit()) return std::forward<F>(visitor)(latin1_span());
+    return std::forward<F>(visitor)(utf16_span());
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+/**
+ * @brief Hash specialization for the String primitive type, so it can key unordered containers.
+ */
+template <>
+struct std::hash<Softloq::WHATWG::Infra::String>
+{
+    inline std::size_t operator()(const Softloq::WHATWG::Infra::String& value) const { return value.hash(); }
+};
+
+#include "Softloq/WHATWG/Infra/Primitive/String/Formatter.tpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/OStream.inl"
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRING_HPP
@@ -0,0 +1,214 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/StringBuilder.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the StringBuilder type for the WHATWG Infra library, which builds a String from pieces without repeated reallocation.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the StringBuilder type.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRINGBUILDER_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRINGBUILDER_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/CodePoint/CodePoint.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/CodeUnit/CodeUnit.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief The StringBuilder type builds a String by appending pieces to one growing buffer.
+ *
+ * Short results are built in storage inside the builder and only allocate when released. Longer
+ * results grow a heap buffer in the representation the String will use: 8-bit while every
+ * appended code unit fits in a byte, UTF-16 once one does not. reserve() allocates exactly the
+ * requested capacity, so a caller that knows the final length allocates once. release() moves
+ * the heap buffer into the String without copying it.
+ *
+ * Appending whole sequences of code units, code points, Latin-1 or UTF-8 costs one call per
+ * sequence rather than one per element.
+ */
+class StringBuilder final
+{
+public:
+    /**
+     * @brief The number of 8-bit code units stored inside the builder before it allocates.
+     */
+    static constexpr std::size_t inline_capacity = 64;
+
+// Constructors and destructor
+public:
+    SOFTLOQ_WHATWG_INFRA_API StringBuilder() noexcept;
+
+    /**
+     * @brief Construct a builder with room for the given number of code units.
+     *
+     * @param capacity The number of code units to reserve.
+     */
+    SOFTLOQ_WHATWG_INFRA_API explicit StringBuilder(std::size_t capacity);
+
+// Capacity
+public:
+    /**
+     * @brief Get the number of code units appended so far.
+     *
+     * @return The number of code units.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t size() const noexcept;
+
+    /**
+     * @brief Returns true if nothing has been appended.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool is_empty() const noexcept;
+
+    /**
+     * @brief Get the number of code units the builder can hold without reallocating.
+     *
+     * @return The capacity in code units.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t capacity() const noexcept;
+
+    /**
+     * @brief Returns true if every code unit appended so far fits in 8 bits.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool is_8bit() const noexcept;
+
+    /**
+     * @brief Make room for exactly the given total number of code units. Does nothing if the capacity is already enough.
+     *
+     * @param capacity The total number of code units to make room for.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void reserve(std::size_t capacity);
+
+// Appending
+public:
+    /**
+     * @brief Append a code unit.
+     *
+     * @param code_unit The code unit to append.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void append(CodeUnit code_unit);
+
+    /**
+     * @brief Append a code point, as a surrogate pair if it is supplementary.
+     *
+     * @param code_point The code point to append.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void append(CodePoint code_point);
+
+    /**
+     * @brief Append the code units of a String.
+     *
+     * @param value The String to append.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void append(const String& value);
+
+    /**
+     * @brief Append UTF-16 code units. Lone surrogates are kept as they are.
+     *
+     * @param code_units The code units to append.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void append_code_units(std::u16string_view code_units);
+
+    /**
+     * @brief Append code points, encoding supplementary code points as surrogate pairs.
+     *
+     * @param code_points The code points to append.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void append_code_points(std::u32string_view code_points);
+
+    /**
+     * @brief Append Latin-1 bytes, each becoming the code unit of equal value.
+     *
+     * @param bytes The bytes to append.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void append_latin1(std::span<const std::uint8_t> bytes);
+
+    /**
+     * @brief Append Latin-1 characters, each read as an unsigned byte becoming the code unit of equal value.
+     *
+     * @param bytes The characters to append.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void append_latin1(std::string_view bytes);
+
+    /**
+     * @brief Append UTF-8 text, decoded as by the WHATWG Encoding specification's UTF-8 decode.
+     *
+     * Each maximal ill-formed subsequence is replaced by U+FFFD REPLACEMENT CHARACTER. A leading
+     * byte order mark is not removed.
+     *
+     * @param bytes The UTF-8 bytes to append.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void append_utf8(std::string_view bytes);
+
+// Finalization
+public:
+    /**
+     * @brief Move the built code units into a String and empty the builder.
+     *
+     * A heap buffer is handed to the String without copying. Code units still in the inline
+     * storage are copied into a buffer of exactly their size.
+     *
+     * @return The built String.
+     */
+    [[nodiscard]] SOFTLOQ_WHATWG_INFRA_API String release();
+
+    /**
+     * @brief Remove all code units. Heap buffers keep their capacity for the next build.
+     */
+    SOFTLOQ_WHATWG_INFRA_API void clear() noexcept;
+
+private:
+    /**
+     * @brief Where the code units are stored.
+     */
+    enum class Storage : std::uint8_t
+    {
+        Inline,
+        Latin1,
+        UTF16,
+    };
+
+    /**
+     * @brief Append a code unit to the current storage, widening it if needed.
+     */
+    void push_code_unit(char16_t code_unit);
+
+    /**
+     * @brief Append a code point, as a surrogate pair if it is supplementary.
+     */
+    void push_code_point(char32_t code_point);
+
+    /**
+     * @brief Make room for additional code units, moving the inline code units to the heap if they no longer fit.
+     */
+    void grow_8bit(std::size_t additional);
+
+    /**
+     * @brief Switch to UTF-16 storage with room for additional code units.
+     */
+    void widen(std::size_t additional);
+
+    /**
+     * @brief Get the capacity to grow to so that additional code units fit, at least doubling the current one.
+     */
+    [[nodiscard]] std::size_t grown_capacity(std::size_t additional) const noexcept;
+
+    std::array<std::uint8_t, inline_capacity> m_inline{};
+    std::size_t m_inline_size = 0;
+    String::Latin1Buffer m_latin1;
+    String::UTF16Buffer m_utf16;
+    Storage m_storage = Storage::Inline;
+};
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRINGBUILDER_HPP
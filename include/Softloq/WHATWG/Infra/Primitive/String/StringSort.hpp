@@ -0,0 +1,36 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/StringSort.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header declares the String sort of the WHATWG Infra library, which sorts Strings in ascending order with code unit less than.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header declares the multikey quicksort specialization for lists of Strings.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRINGSORT_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRINGSORT_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include <span>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Sort Strings in ascending order with code unit less than.
+ *
+ * The result is the order of std::sort with String::operator<. Instead of comparing whole Strings,
+ * the Strings are partitioned by their code unit at one offset at a time (multikey quicksort), so
+ * a shared prefix is read once per partition level rather than once per comparison. Small
+ * partitions are finished by insertion sort, comparing from the current offset with the vectorized
+ * mismatch kernels.
+ *
+ * @param strings The Strings to sort in place.
+ */
+SOFTLOQ_WHATWG_INFRA_API void sort_code_unit_less_than(std::span<String> strings);
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRINGSORT_HPP
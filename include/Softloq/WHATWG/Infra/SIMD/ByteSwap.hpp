@@ -0,0 +1,88 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/ByteSwap.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header declares the vectorized byte-swapping kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header declares the kernels that copy a run of integers while reversing the byte order of each.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_SIMD_BYTESWAP_HPP
+#define SOFTLOQ_WHATWG_INFRA_SIMD_BYTESWAP_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+/**
+ * @brief Concept for the integer widths, in bytes, the vectorized byte-swapping kernel is built for.
+ */
+template <std::size_t Width>
+concept ByteSwapWidth = Width == 2 || Width == 4 || Width == 8;
+
+/**
+ * @brief Copy a run of integers of Width bytes each, reversing the byte order of every integer.
+ *
+ * Sixteen bytes are swapped at a time. The source and destination may be the same run, but must
+ * not otherwise overlap.
+ *
+ * @param source The integers to copy, as bytes.
+ * @param count The number of integers.
+ * @param destination Where to write count * Width bytes.
+ */
+template <std::size_t Width>
+    requires ByteSwapWidth<Width>
+SOFTLOQ_WHATWG_INFRA_API void byte_swap(const std::uint8_t* source, std::size_t count, std::uint8_t* destination) noexcept;
+
+/**
+ * @brief The byte-swapping kernel one integer at a time, for integers of any width.
+ *
+ * This finishes the runs the vectorized kernel leaves over, and serves the widths it is not built
+ * for, such as uint128_t and WideInt.
+ */
+namespace ByteSwapPortable
+{
+
+/**
+ * @brief Portable byte_swap().
+ */
+template <std::size_t Width>
+constexpr void byte_swap(const std::uint8_t* source, std::size_t count, std::uint8_t* destination) noexcept
+{
+    for (std::size_t index = 0; index < count; ++index, source += Width, destination += Width)
+    {
+        if constexpr (ByteSwapWidth<Width>)
+        {
+            if !consteval
+            {
+                using Word = std::conditional_t<Width == 2, std::uint16_t, std::conditional_t<Width == 4, std::uint32_t, std::uint64_t>>;
+                Word word;
+                std::memcpy(&word, source, Width);
+                word = std::byteswap(word);
+                std::memcpy(destination, &word, Width);
+                continue;
+            }
+        }
+        // Swap pairs from both ends, so a run swapped in place reads each byte before it is overwritten.
+        for (std::size_t low = 0; low < Width / 2; ++low)
+        {
+            const std::uint8_t first = source[low];
+            destination[low] = source[Width - 1 - low];
+            destination[Width - 1 - low] = first;
+        }
+        if constexpr (Width % 2 == 1) destination[Width / 2] = source[Width / 2];
+    }
+}
+
+} // namespace ByteSwapPortable
+
+} // namespace Softloq::WHATWG::Infra::SIMD
+
+#endif // SOFTLOQ_WHATWG_INFRA_SIMD_BYTESWAP_HPP
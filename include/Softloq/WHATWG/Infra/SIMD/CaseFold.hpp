@@ -0,0 +1,80 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/CaseFold.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header declares the vectorized ASCII case conversion and case-insensitive comparison kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header declares the vectorized ASCII case conversion and case-insensitive comparison kernels of the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_SIMD_CASEFOLD_HPP
+#define SOFTLOQ_WHATWG_INFRA_SIMD_CASEFOLD_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+/**
+ * @brief Returns the unit with U+0041..U+005A converted to U+0061..U+007A.
+ */
+[[nodiscard]] constexpr char32_t ascii_lowercase_unit(char32_t value) noexcept
+{
+    return value >= U'A' && value <= U'Z' ? value + 0x20 : value;
+}
+
+/**
+ * @brief Converts the ASCII letters of the units to lowercase or uppercase in place.
+ *
+ * Only U+0041..U+005A or U+0061..U+007A are changed; every other unit, including non-ASCII letters,
+ * is left as is. Sixteen bytes are converted at a time.
+ *
+ * @param data The units to convert.
+ * @param size The number of units.
+ * @param to_uppercase True to convert a-z to A-Z, false to convert A-Z to a-z.
+ */
+SOFTLOQ_WHATWG_INFRA_API void ascii_case_convert(std::uint8_t* data, std::size_t size, bool to_uppercase) noexcept;
+
+/**
+ * @brief Converts the ASCII letters of the UTF-16 code units to lowercase or uppercase in place.
+ *
+ * @see ascii_case_convert(std::uint8_t*, std::size_t, bool)
+ */
+SOFTLOQ_WHATWG_INFRA_API void ascii_case_convert(char16_t* data, std::size_t size, bool to_uppercase) noexcept;
+
+/**
+ * @brief Converts the ASCII letters of the code points to lowercase or uppercase in place.
+ *
+ * @see ascii_case_convert(std::uint8_t*, std::size_t, bool)
+ */
+SOFTLOQ_WHATWG_INFRA_API void ascii_case_convert(char32_t* data, std::size_t size, bool to_uppercase) noexcept;
+
+/**
+ * @brief Returns true if two runs of units are equal after converting their ASCII upper alphas to lowercase.
+ *
+ * @param lhs The first run of units.
+ * @param rhs The second run of units.
+ * @param size The number of units in each run.
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool ascii_case_insensitive_equal(const std::uint8_t* lhs, const std::uint8_t* rhs, std::size_t size) noexcept;
+
+/**
+ * @brief Returns true if two runs of UTF-16 code units are equal after converting their ASCII upper alphas to lowercase.
+ *
+ * @see ascii_case_insensitive_equal(const std::uint8_t*, const std::uint8_t*, std::size_t)
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool ascii_case_insensitive_equal(const char16_t* lhs, const char16_t* rhs, std::size_t size) noexcept;
+
+/**
+ * @brief Returns true if two runs of code points are equal after converting their ASCII upper alphas to lowercase.
+ *
+ * @see ascii_case_insensitive_equal(const std::uint8_t*, const std::uint8_t*, std::size_t)
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool ascii_case_insensitive_equal(const char32_t* lhs, const char32_t* rhs, std::size_t size) noexcept;
+
+} // namespace Softloq::WHATWG::Infra::SIMD
+
+#endif // SOFTLOQ_WHATWG_INFRA_SIMD_CASEFOLD_HPP
@@ -0,0 +1,69 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/ClassScan.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header declares the vectorized code point class scanning kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header declares the vectorized code point class scanning kernels of the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_SIMD_CLASSSCAN_HPP
+#define SOFTLOQ_WHATWG_INFRA_SIMD_CLASSSCAN_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include "Softloq/WHATWG/Infra/Operation/CodePointClass/CodePointClass.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+/**
+ * @brief Classes with more ranges than this are scanned with the scalar loop.
+ */
+inline constexpr std::size_t class_scan_max_vector_ranges = 8;
+
+/**
+ * @brief Returns true if the unit satisfies the code point class described by the ranges and inverted flag.
+ */
+[[nodiscard]] constexpr bool unit_in_class(char32_t value, std::span<const CodePointRange> ranges, bool inverted) noexcept
+{
+    for (const auto& range : ranges)
+        if (range.contains(value)) return !inverted;
+    return inverted;
+}
+
+/**
+ * @brief Returns the length of the longest prefix of the units that all satisfy a code point class.
+ *
+ * A unit satisfies the class if its value lies inside one of the ranges, or outside all of them
+ * when inverted is true. Up to eight ranges are compared sixteen bytes at a time; larger classes
+ * fall back to a scalar scan.
+ *
+ * @param data The units to scan.
+ * @param size The number of units.
+ * @param ranges The ranges of the code point class.
+ * @param inverted Whether the class is the complement of the ranges.
+ * @return The index of the first unit that does not satisfy the class, or size if all do.
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t class_prefix_length(const std::uint8_t* data, std::size_t size, std::span<const CodePointRange> ranges, bool inverted) noexcept;
+
+/**
+ * @brief Returns the length of the longest prefix of the UTF-16 code units that all satisfy a code point class.
+ *
+ * @see class_prefix_length(const std::uint8_t*, std::size_t, std::span<const CodePointRange>, bool)
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t class_prefix_length(const char16_t* data, std::size_t size, std::span<const CodePointRange> ranges, bool inverted) noexcept;
+
+/**
+ * @brief Returns the length of the longest prefix of the code points that all satisfy a code point class.
+ *
+ * @see class_prefix_length(const std::uint8_t*, std::size_t, std::span<const CodePointRange>, bool)
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t class_prefix_length(const char32_t* data, std::size_t size, std::span<const CodePointRange> ranges, bool inverted) noexcept;
+
+} // namespace Softloq::WHATWG::Infra::SIMD
+
+#endif // SOFTLOQ_WHATWG_INFRA_SIMD_CLASSSCAN_HPP
@@ -0,0 +1,269 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/Columnar.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header declares the vectorized columnar integer kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header declares the kernels that sum, bound, scan, compare and filter contiguous runs of integers.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_HPP
+#define SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Overflow.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+/**
+ * @brief Concept for the integer types the vectorized columnar kernels are built for: the eight fixed-width integers.
+ */
+template <typename T>
+concept ColumnElement =
+    std::same_as<T, std::int8_t> || std::same_as<T, std::int16_t> || std::same_as<T, std::int32_t> || std::same_as<T, std::int64_t>
+    || std::same_as<T, std::uint8_t> || std::same_as<T, std::uint16_t> || std::same_as<T, std::uint32_t> || std::same_as<T, std::uint64_t>;
+
+/**
+ * @brief The type a column of T is summed in: 64 bits of the same signedness, or T itself for uint128_t and WideInt.
+ */
+template <FixedWidthInteger T>
+using ColumnSum = std::conditional_t<std::same_as<T, uint128_t> || WideInteger<T>, T,
+                                     std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+
+/**
+ * @brief The comparison a column is tested against a value with.
+ */
+enum class Comparison : std::uint8_t
+{
+    Equal,
+    NotEqual,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual
+};
+
+/**
+ * @brief Returns the sum of a run of integers, wrapping modulo 2^64.
+ *
+ * Runs of 8-bit, 16-bit and 32-bit integers are widened sixteen bytes at a time, so the sum only
+ * wraps once it leaves the 64-bit range.
+ *
+ * @param data The integers to sum.
+ * @param size The number of integers.
+ */
+template <ColumnElement T>
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API ColumnSum<T> column_sum(const T* data, std::size_t size) noexcept;
+
+/**
+ * @brief Returns the least of a nonempty run of integers.
+ *
+ * @param data The integers, at least one.
+ * @param size The number of integers, which must not be zero.
+ */
+template <ColumnElement T>
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API T column_min(const T* data, std::size_t size) noexcept;
+
+/**
+ * @brief Returns the greatest of a nonempty run of integers.
+ *
+ * @see column_min()
+ */
+template <ColumnElement T>
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API T column_max(const T* data, std::size_t size) noexcept;
+
+/**
+ * @brief Writes the inclusive prefix sums of a run of integers, wrapping modulo 2^N.
+ *
+ * Each group of sixteen bytes is scanned in registers with shifted additions, then offset by the
+ * last sum of the group before it.
+ *
+ * @param data The integers to scan.
+ * @param size The number of integers.
+ * @param out Receives the size sums; may be data.
+ */
+template <ColumnElement T>
+SOFTLOQ_WHATWG_INFRA_API void column_prefix_sum(const T* data, std::size_t size, T* out) noexcept;
+
+/**
+ * @brief Compares every integer of a run against a value.
+ *
+ * @param data The integers to compare.
+ * @param size The number of integers.
+ * @param comparison How each integer is compared, as the left operand.
+ * @param value The right operand of every comparison.
+ * @param mask Receives size bytes, 1 where the comparison holds and 0 elsewhere.
+ * @return The number of integers for which the comparison holds.
+ */
+template <ColumnElement T>
+SOFTLOQ_WHATWG_INFRA_API std::size_t column_compare(const T* data, std::size_t size, Comparison comparison, T value, std::uint8_t* mask) noexcept;
+
+/**
+ * @brief Counts the integers of a run for which a comparison against a value holds, without writing a mask.
+ *
+ * @see column_compare()
+ */
+template <ColumnElement T>
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t column_count(const T* data, std::size_t size, Comparison comparison, T value) noexcept;
+
+/**
+ * @brief Copies the integers of a run whose mask byte is nonzero, in order.
+ *
+ * Sixteen mask bytes are tested at a time, so runs the mask keeps or drops whole are copied or
+ * skipped without looking at each byte.
+ *
+ * @param data The integers to filter.
+ * @param size The number of integers.
+ * @param mask The size mask bytes.
+ * @param out Receives the kept integers; must have room for size integers.
+ * @return The number of integers kept.
+ */
+template <ColumnElement T>
+SOFTLOQ_WHATWG_INFRA_API std::size_t column_filter(const T* data, std::size_t size, const std::uint8_t* mask, T* out) noexcept;
+
+/**
+ * @brief The columnar kernels one element at a time, for every fixed-width integer.
+ *
+ * These finish the runs the vectorized kernels leave over, and serve the types those kernels are
+ * not built for. Sums are computed on unsigned types, which wrap without undefined behaviour.
+ */
+namespace ColumnPortable
+{
+
+/**
+ * @brief Portable column_sum().
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr ColumnSum<T> sum(const T* data, std::size_t size) noexcept
+{
+    if constexpr (std::same_as<T, uint128_t> || WideInteger<T>)
+    {
+        T total{};
+        for (std::size_t index = 0; index < size; ++index) total += data[index];
+        return total;
+    }
+    else
+    {
+        std::uint64_t total = 0;
+        for (std::size_t index = 0; index < size; ++index) total += static_cast<std::uint64_t>(static_cast<ColumnSum<T>>(data[index]));
+        return static_cast<ColumnSum<T>>(total);
+    }
+}
+
+/**
+ * @brief Portable column_min().
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr T min(const T* data, std::size_t size) noexcept
+{
+    T result = data[0];
+    for (std::size_t index = 1; index < size; ++index) result = std::min(result, data[index]);
+    return result;
+}
+
+/**
+ * @brief Portable column_max().
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr T max(const T* data, std::size_t size) noexcept
+{
+    T result = data[0];
+    for (std::size_t index = 1; index < size; ++index) result = std::max(result, data[index]);
+    return result;
+}
+
+/**
+ * @brief Portable column_prefix_sum(), continuing from a running sum.
+ *
+ * @return The last sum written, or total if size is zero.
+ */
+template <FixedWidthInteger T>
+constexpr T prefix_sum(const T* data, std::size_t size, T* out, T total = T{}) noexcept
+{
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        static_cast<void>(overflowing_add(total, data[index], total));
+        out[index] = total;
+    }
+    return total;
+}
+
+/**
+ * @brief Calls apply with the predicate that tests an integer against value, one lambda type per comparison.
+ *
+ * Each comparison gets its own loop in apply, so the loop bodies stay branch-free.
+ */
+template <FixedWidthInteger T, typename Apply>
+constexpr std::size_t with_comparison(Comparison comparison, T value, Apply apply) noexcept
+{
+    switch (comparison)
+    {
+    case Comparison::Equal: return apply([value](T element) { return element == value; });
+    case Comparison::NotEqual: return apply([value](T element) { return element != value; });
+    case Comparison::Less: return apply([value](T element) { return element < value; });
+    case Comparison::LessEqual: return apply([value](T element) { return element <= value; });
+    case Comparison::Greater: return apply([value](T element) { return element > value; });
+    case Comparison::GreaterEqual: return apply([value](T element) { return element >= value; });
+    }
+    return 0;
+}
+
+/**
+ * @brief Portable column_compare().
+ */
+template <FixedWidthInteger T>
+constexpr std::size_t compare(const T* data, std::size_t size, Comparison comparison, T value, std::uint8_t* mask) noexcept
+{
+    return with_comparison(comparison, value, [&](auto holds) {
+        std::size_t count = 0;
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            const bool result = holds(data[index]);
+            mask[index] = result;
+            count += result;
+        }
+        return count;
+    });
+}
+
+/**
+ * @brief Portable column_count().
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr std::size_t count(const T* data, std::size_t size, Comparison comparison, T value) noexcept
+{
+    return with_comparison(comparison, value, [&](auto holds) {
+        std::size_t count = 0;
+        for (std::size_t index = 0; index < size; ++index) count += holds(data[index]);
+        return count;
+    });
+}
+
+/**
+ * @brief Portable column_filter().
+ */
+template <FixedWidthInteger T>
+constexpr std::size_t filter(const T* data, std::size_t size, const std::uint8_t* mask, T* out) noexcept
+{
+    std::size_t count = 0;
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        // Write unconditionally and advance only past kept integers, which never writes beyond index.
+        out[count] = data[index];
+        count += mask[index] != 0;
+    }
+    return count;
+}
+
+} // namespace ColumnPortable
+
+} // namespace Softloq::WHATWG::Infra::SIMD
+
+#endif // SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_HPP
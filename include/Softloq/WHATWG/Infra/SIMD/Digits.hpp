@@ -0,0 +1,123 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/Digits.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header declares the vectorized decimal digit parsing kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header declares the kernels that turn runs of ASCII digits into integers several digits at a time.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_SIMD_DIGITS_HPP
+#define SOFTLOQ_WHATWG_INFRA_SIMD_DIGITS_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+/**
+ * @brief Returns eight units packed into a 64-bit word, the first unit in the lowest byte.
+ *
+ * Units above 0xFF are replaced by 0xFF, which is not a digit, so the word can be scanned for
+ * digits whatever the unit width. Outside constant evaluation on little-endian targets, 8-bit units
+ * are loaded as one word and UTF-16 units are narrowed two words at a time.
+ *
+ * @param data The eight units to pack.
+ */
+template <typename U>
+[[nodiscard]] constexpr std::uint64_t pack_eight_units(const U* data) noexcept
+{
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        if !consteval
+        {
+            if constexpr (sizeof(U) == 1)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, data, sizeof(word));
+                return word;
+            }
+            else if constexpr (sizeof(U) == 2)
+            {
+                std::uint64_t halves[2];
+                std::memcpy(halves, data, sizeof(halves));
+                for (std::uint64_t& half : halves)
+                {
+                    // Set the low byte of every unit with a nonzero high byte to 0xFF, then gather the low bytes.
+                    const std::uint64_t wide = ((half >> 8) & 0x00FF00FF00FF00FF) + 0x00FF00FF00FF00FF;
+                    const std::uint64_t flags = wide & 0x0100010001000100;
+                    half = (half | (flags - (flags >> 8))) & 0x00FF00FF00FF00FF;
+                    half = (half | (half >> 8)) & 0x0000FFFF0000FFFF;
+                    half = (half | (half >> 16)) & 0x00000000FFFFFFFF;
+                }
+                return halves[0] | (halves[1] << 32);
+            }
+        }
+    }
+    std::uint64_t word = 0;
+    for (std::size_t index = 0; index < 8; ++index)
+    {
+        const auto unit = static_cast<std::uint64_t>(data[index]);
+        word |= (unit > 0xFF ? 0xFF : unit) << (8 * index);
+    }
+    return word;
+}
+
+/**
+ * @brief Returns the number of leading bytes of a packed word, from the lowest, that are ASCII digits.
+ *
+ * A byte is a digit if its high nibble is 3 and adding 6 to it keeps the high nibble at 3. The
+ * addition can carry into the next byte only from a byte of 0xFA or more, which is not a digit,
+ * so the carry never changes the count of leading digits.
+ */
+[[nodiscard]] constexpr std::size_t eight_digit_prefix_length(std::uint64_t word) noexcept
+{
+    constexpr std::uint64_t high_nibbles = 0xF0F0F0F0F0F0F0F0;
+    const std::uint64_t nibbles = (word & high_nibbles) | (((word + 0x0606060606060606) & high_nibbles) >> 4);
+    const std::uint64_t differ = nibbles ^ 0x3333333333333333;
+    constexpr std::uint64_t low_bits = 0x7F7F7F7F7F7F7F7F;
+    const std::uint64_t non_digits = (((differ & low_bits) + low_bits) | differ) & ~low_bits;
+    return static_cast<std::size_t>(std::countr_zero(non_digits)) / 8;
+}
+
+/**
+ * @brief Returns the value of the eight ASCII digits packed into a word, the first digit the most significant.
+ *
+ * Neighbouring digits are combined in three multiplications: into pairs, then groups of four, then
+ * the whole. Bytes that are zero count as leading zeros, so a word holding m < 8 digits can be
+ * parsed by first shifting it left by 8 * (8 - m) bits.
+ */
+[[nodiscard]] constexpr std::uint32_t parse_eight_digits(std::uint64_t word) noexcept
+{
+    word = ((word & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+    word = ((word & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+    return static_cast<std::uint32_t>(((word & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+}
+
+/**
+ * @brief Parses sixteen ASCII digits at once.
+ *
+ * The digits are checked and combined sixteen bytes at a time: neighbouring digits are multiplied
+ * and added into pairs, groups of four and groups of eight, and the two groups of eight are joined.
+ *
+ * @param data The sixteen bytes to parse.
+ * @param value Receives the value of the digits, the first digit the most significant.
+ * @return true if all sixteen bytes are ASCII digits; value is left unchanged otherwise.
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool parse_sixteen_digits(const std::uint8_t* data, std::uint64_t& value) noexcept;
+
+/**
+ * @brief Parses sixteen UTF-16 code units that are ASCII digits at once.
+ *
+ * @see parse_sixteen_digits(const std::uint8_t*, std::uint64_t&)
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API bool parse_sixteen_digits(const char16_t* data, std::uint64_t& value) noexcept;
+
+} // namespace Softloq::WHATWG::Infra::SIMD
+
+#endif // SOFTLOQ_WHATWG_INFRA_SIMD_DIGITS_HPP
@@ -0,0 +1,61 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/Mismatch.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header declares the vectorized mismatch-finding kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header declares the kernels that find the first differing unit of two runs of code units.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_SIMD_MISMATCH_HPP
+#define SOFTLOQ_WHATWG_INFRA_SIMD_MISMATCH_HPP
+
+#include "Softloq/WHATWG/Infra/API-Library/Macro.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+/**
+ * @brief Returns the index of the first unit at which two runs differ.
+ *
+ * Sixteen bytes of each run are compared at a time.
+ *
+ * @param lhs The first run of units.
+ * @param rhs The second run of units.
+ * @param size The number of units in each run.
+ * @return The index of the first differing unit, or size if the runs are equal.
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t mismatch(const std::uint8_t* lhs, const std::uint8_t* rhs, std::size_t size) noexcept;
+
+/**
+ * @brief Returns the index of the first UTF-16 code unit at which two runs differ.
+ *
+ * @see mismatch(const std::uint8_t*, const std::uint8_t*, std::size_t)
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t mismatch(const char16_t* lhs, const char16_t* rhs, std::size_t size) noexcept;
+
+/**
+ * @brief Returns the index of the first code unit at which a run of 8-bit code units and a run of UTF-16 code units differ.
+ *
+ * The 8-bit code units are zero-extended to 16 bits before they are compared.
+ *
+ * @see mismatch(const std::uint8_t*, const std::uint8_t*, std::size_t)
+ */
+[[nodiscard]] SOFTLOQ_WHATWG_INFRA_API std::size_t mismatch(const std::uint8_t* lhs, const char16_t* rhs, std::size_t size) noexcept;
+
+/**
+ * @brief Returns the index of the first code unit at which a run of UTF-16 code units and a run of 8-bit code units differ.
+ *
+ * @see mismatch(const std::uint8_t*, const char16_t*, std::size_t)
+ */
+[[nodiscard]] inline std::size_t mismatch(const char16_t* lhs, const std::uint8_t* rhs, std::size_t size) noexcept
+{
+    return mismatch(rhs, lhs, size);
+}
+
+} // namespace Softloq::WHATWG::Infra::SIMD
+
+#endif // SOFTLOQ_WHATWG_INFRA_SIMD_MISMATCH_HPP
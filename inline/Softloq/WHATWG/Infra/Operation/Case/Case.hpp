@@ -0,0 +1,154 @@
+/**
+ * @file Softloq/WHATWG/Infra/Operation/Case/Case.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the ASCII case operations for the WHATWG Infra library, lowercasing, uppercasing and case-insensitively matching code unit and code point sequences.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the ASCII lowercase, ASCII uppercase and ASCII case-insensitive match operations
+ * for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_OPERATION_CASE_CASE_HPP
+#define SOFTLOQ_WHATWG_INFRA_OPERATION_CASE_CASE_HPP
+
+#include "Softloq/WHATWG/Infra/Operation/CodePointClass/CodePointClass.hpp"
+#include "Softloq/WHATWG/Infra/Operation/Collect/Collect.hpp"
+#include "Softloq/WHATWG/Infra/Operation/SequenceElement/SequenceElement.hpp"
+#include "Softloq/WHATWG/Infra/SIMD/CaseFold.hpp"
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief ASCII lowercase a sequence in place.
+ *
+ * As defined by the WHATWG Infra specification: replaces every ASCII upper alpha with the
+ * corresponding ASCII lower alpha. The sequence is first scanned for its first ASCII upper alpha,
+ * so input that is already lowercase is only read, never written.
+ *
+ * @param sequence The sequence to lowercase.
+ */
+template <MutableSequenceInput R>
+constexpr void ascii_lowercase(R&& sequence) noexcept;
+
+/**
+ * @brief ASCII uppercase a sequence in place.
+ *
+ * As defined by the WHATWG Infra specification: replaces every ASCII lower alpha with the
+ * corresponding ASCII upper alpha. Input that is already uppercase is only read, never written.
+ *
+ * @param sequence The sequence to uppercase.
+ */
+template <MutableSequenceInput R>
+constexpr void ascii_uppercase(R&& sequence) noexcept;
+
+/**
+ * @brief Returns true if two sequences are an ASCII case-insensitive match.
+ *
+ * As defined by the WHATWG Infra specification: the sequences match if they are identical after
+ * ASCII lowercasing both. The sequences may have different element types, e.g. a UTF-16 attribute
+ * value and a char literal; if their storage units match, they are compared sixteen bytes at a time.
+ *
+ * @param lhs The first sequence.
+ * @param rhs The second sequence.
+ */
+template <SequenceInput A, SequenceInput B>
+[[nodiscard]] constexpr bool ascii_case_insensitive_match(A&& lhs, B&& rhs) noexcept;
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Converts the ASCII letters of a sequence from the class From to the other case.
+ */
+template <CodePointClass From, MutableSequenceInput R>
+constexpr void ascii_case_convert_sequence(R&& sequence) noexcept
+{
+    using Element = std::ranges::range_value_t<R>;
+    using Traits = SequenceElementTraits<Element>;
+    using Unit = typename Traits::unit_type;
+
+    Element* data = std::ranges::data(sequence);
+    const std::size_t size = std::ranges::size(sequence);
+    const std::size_t first = code_point_class_run_length<Not<From>>(data, size);
+    if (first == size) return;
+
+    if constexpr (Traits::is_raw)
+    {
+        if !consteval
+        {
+            SIMD::ascii_case_convert(reinterpret_cast<Unit*>(data + first), size - first, std::is_same_v<From, ASCIILowerAlpha>);
+            return;
+        }
+    }
+    for (std::size_t index = first; index < size; ++index)
+    {
+        const char32_t value = Traits::value(data[index]);
+        if (in_code_point_class<From>(value)) data[index] = Traits::from_value(value ^ 0x20);
+    }
+}
+
+template <MutableSequenceInput R>
+constexpr void ascii_lowercase(R&& sequence) noexcept
+{
+    ascii_case_convert_sequence<ASCIIUpperAlpha>(sequence);
+}
+
+template <MutableSequenceInput R>
+constexpr void ascii_uppercase(R&& sequence) noexcept
+{
+    ascii_case_convert_sequence<ASCIILowerAlpha>(sequence);
+}
+
+template <SequenceInput A, SequenceInput B>
+constexpr bool ascii_case_insensitive_match(A&& lhs, B&& rhs) noexcept
+{
+    using LeftTraits = SequenceElementTraits<std::ranges::range_value_t<A>>;
+    using RightTraits = SequenceElementTraits<std::ranges::range_value_t<B>>;
+    using LeftUnit = typename LeftTraits::unit_type;
+    using RightUnit = typename RightTraits::unit_type;
+
+    const auto* left = std::ranges::data(lhs);
+    const auto* right = std::ranges::data(rhs);
+    const std::size_t left_size = std::ranges::size(lhs);
+    const std::size_t right_size = std::ranges::size(rhs);
+
+    if constexpr (std::is_same_v<LeftUnit, RightUnit>)
+    {
+        // Same unit width: the code points line up element by element.
+        if (left_size != right_size) return false;
+        if constexpr (LeftTraits::is_raw && RightTraits::is_raw)
+        {
+            if !consteval
+            {
+                return SIMD::ascii_case_insensitive_equal(reinterpret_cast<const LeftUnit*>(left), reinterpret_cast<const RightUnit*>(right), left_size);
+            }
+        }
+        for (std::size_t index = 0; index < left_size; ++index)
+            if (SIMD::ascii_lowercase_unit(LeftTraits::value(left[index])) != SIMD::ascii_lowercase_unit(RightTraits::value(right[index]))) return false;
+        return true;
+    }
+    else
+    {
+        std::size_t left_index = 0;
+        std::size_t right_index = 0;
+        while (left_index < left_size && right_index < right_size)
+        {
+            const DecodedCodePoint left_code_point = decode_code_point(left, left_size, left_index);
+            const DecodedCodePoint right_code_point = decode_code_point(right, right_size, right_index);
+            if (SIMD::ascii_lowercase_unit(left_code_point.value) != SIMD::ascii_lowercase_unit(right_code_point.value)) return false;
+            left_index += left_code_point.length;
+            right_index += right_code_point.length;
+        }
+        return left_index == left_size && right_index == right_size;
+    }
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_OPERATION_CASE_CASE_HPP
@@ -0,0 +1,296 @@
+/**
+ * @file Softloq/WHATWG/Infra/Operation/CodePointClass/CodePointClass.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the code point classes for the WHATWG Infra library, table-classifiable predicate classes for the code point categories of the WHATWG Infra specification.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the code point classes for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_OPERATION_CODEPOINTCLASS_CODEPOINTCLASS_HPP
+#define SOFTLOQ_WHATWG_INFRA_OPERATION_CODEPOINTCLASS_CODEPOINTCLASS_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/CodePoint/CodePoint.hpp"
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <functional>
+#include <span>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief An inclusive range of code points [first, last].
+ */
+struct CodePointRange
+{
+    char32_t first{U'\0'};
+    char32_t last{U'\0'};
+
+    /**
+     * @brief Returns true if the code point lies inside the range.
+     */
+    [[nodiscard]] constexpr bool contains(char32_t value) const noexcept
+    {
+        return value >= first && value <= last;
+    }
+};
+
+/**
+ * @brief Concept for table-classifiable predicate classes.
+ *
+ * A code point class describes its members as a static list of code point ranges and a static
+ * inverted flag. A code point belongs to the class if it lies inside one of the ranges, or outside
+ * all of them when inverted is true. Such classes can be evaluated with a lookup table and scanned
+ * with vectorized range comparisons.
+ */
+template <typename P>
+concept CodePointClass = requires
+{
+    std::span<const CodePointRange>{P::ranges};
+    { P::inverted } -> std::convertible_to<bool>;
+};
+
+/**
+ * @brief Lookup table of the class membership of the code points U+0000 to U+00FF.
+ */
+template <CodePointClass P>
+inline constexpr std::array<bool, 256> code_point_class_table = []
+{
+    std::array<bool, 256> table{};
+    for (char32_t value = 0; value < 256; ++value)
+    {
+        const bool in_ranges = std::ranges::any_of(P::ranges, [value](const CodePointRange& range) { return range.contains(value); });
+        table[value] = in_ranges != P::inverted;
+    }
+    return table;
+}();
+
+/**
+ * @brief True if every range of the class ends below the surrogate block (U+D800).
+ *
+ * Such classes can classify UTF-16 input one code unit at a time: a surrogate pair and both of its
+ * surrogates always fall outside the ranges, so they are classified alike.
+ */
+template <CodePointClass P>
+inline constexpr bool code_point_class_below_surrogates =
+    std::ranges::all_of(P::ranges, [](const CodePointRange& range) { return range.last < 0xD800; });
+
+/**
+ * @brief Returns true if the code point belongs to the code point class.
+ *
+ * @tparam P The code point class.
+ * @param value The code point to classify.
+ */
+template <CodePointClass P>
+[[nodiscard]] constexpr bool in_code_point_class(char32_t value) noexcept
+{
+    if (value < 256) return code_point_class_table<P>[value];
+    const bool in_ranges = std::ranges::any_of(P::ranges, [value](const CodePointRange& range) { return range.contains(value); });
+    return in_ranges != P::inverted;
+}
+
+// ---------------------------------------------------------------------------
+// Code point classes of the WHATWG Infra specification
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Matches a surrogate (U+D800 to U+DFFF).
+ */
+struct Surrogate
+{
+    static constexpr std::array<CodePointRange, 1> ranges{{{0xD800, 0xDFFF}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches a scalar value (any code point that is not a surrogate).
+ */
+struct ScalarValue
+{
+    static constexpr std::array<CodePointRange, 1> ranges{{{0xD800, 0xDFFF}}};
+    static constexpr bool inverted = true;
+};
+
+/**
+ * @brief Matches an ASCII code point (U+0000 to U+007F).
+ */
+struct ASCIICodePoint
+{
+    static constexpr std::array<CodePointRange, 1> ranges{{{0x0000, 0x007F}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches an ASCII tab or newline (U+0009, U+000A, U+000D).
+ */
+struct ASCIITabOrNewline
+{
+    static constexpr std::array<CodePointRange, 2> ranges{{{0x0009, 0x000A}, {0x000D, 0x000D}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches a newline (U+000A LF or U+000D CR).
+ */
+struct ASCIINewline
+{
+    static constexpr std::array<CodePointRange, 2> ranges{{{0x000A, 0x000A}, {0x000D, 0x000D}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches ASCII whitespace (U+0009, U+000A, U+000C, U+000D, U+0020).
+ */
+struct ASCIIWhitespace
+{
+    static constexpr std::array<CodePointRange, 3> ranges{{{0x0009, 0x000A}, {0x000C, 0x000D}, {0x0020, 0x0020}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches a C0 control (U+0000 to U+001F).
+ */
+struct C0Control
+{
+    static constexpr std::array<CodePointRange, 1> ranges{{{0x0000, 0x001F}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches a C0 control or U+0020 SPACE.
+ */
+struct C0ControlOrSpace
+{
+    static constexpr std::array<CodePointRange, 1> ranges{{{0x0000, 0x0020}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches a control (C0, U+007F DEL, or U+0080 to U+009F).
+ */
+struct Control
+{
+    static constexpr std::array<CodePointRange, 2> ranges{{{0x0000, 0x001F}, {0x007F, 0x009F}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches an ASCII digit (U+0030 to U+0039).
+ */
+struct ASCIIDigit
+{
+    static constexpr std::array<CodePointRange, 1> ranges{{{0x0030, 0x0039}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches an ASCII upper hex digit (U+0030..U+0039 or U+0041..U+0046).
+ */
+struct ASCIIUpperHexDigit
+{
+    static constexpr std::array<CodePointRange, 2> ranges{{{0x0030, 0x0039}, {0x0041, 0x0046}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches an ASCII lower hex digit (U+0030..U+0039 or U+0061..U+0066).
+ */
+struct ASCIILowerHexDigit
+{
+    static constexpr std::array<CodePointRange, 2> ranges{{{0x0030, 0x0039}, {0x0061, 0x0066}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches an ASCII hex digit (upper or lower).
+ */
+struct ASCIIHexDigit
+{
+    static constexpr std::array<CodePointRange, 3> ranges{{{0x0030, 0x0039}, {0x0041, 0x0046}, {0x0061, 0x0066}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches an ASCII upper alpha (U+0041 to U+005A).
+ */
+struct ASCIIUpperAlpha
+{
+    static constexpr std::array<CodePointRange, 1> ranges{{{0x0041, 0x005A}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches an ASCII lower alpha (U+0061 to U+007A).
+ */
+struct ASCIILowerAlpha
+{
+    static constexpr std::array<CodePointRange, 1> ranges{{{0x0061, 0x007A}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches an ASCII alpha (upper or lower).
+ */
+struct ASCIIAlpha
+{
+    static constexpr std::array<CodePointRange, 2> ranges{{{0x0041, 0x005A}, {0x0061, 0x007A}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches an ASCII alphanumeric (digit or alpha).
+ */
+struct ASCIIAlphanumeric
+{
+    static constexpr std::array<CodePointRange, 3> ranges{{{0x0030, 0x0039}, {0x0041, 0x005A}, {0x0061, 0x007A}}};
+    static constexpr bool inverted = false;
+};
+
+/**
+ * @brief Matches every code point that the code point class P does not match.
+ *
+ * @tparam P The code point class to complement.
+ */
+template <CodePointClass P>
+struct Not
+{
+    static constexpr auto ranges = P::ranges;
+    static constexpr bool inverted = !P::inverted;
+};
+
+// ---------------------------------------------------------------------------
+// Code point predicates
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Concept for code point predicates: code point classes, or callables taking a CodePoint or a char32_t.
+ */
+template <typename P>
+concept CodePointPredicate =
+    CodePointClass<P>
+    || std::predicate<const P&, CodePoint>
+    || std::predicate<const P&, char32_t>;
+
+/**
+ * @brief Returns true if the code point meets the condition of the predicate.
+ *
+ * @param predicate The code point class or callable predicate.
+ * @param value The code point to test.
+ */
+template <CodePointPredicate P>
+[[nodiscard]] constexpr bool code_point_predicate_matches(const P& predicate, char32_t value)
+{
+    if constexpr (CodePointClass<P>)
+        return in_code_point_class<P>(value);
+    else if constexpr (std::predicate<const P&, CodePoint>)
+        return std::invoke(predicate, CodePoint{value});
+    else
+        return std::invoke(predicate, value);
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_OPERATION_CODEPOINTCLASS_CODEPOINTCLASS_HPP
@@ -0,0 +1,351 @@
+/**
+ * @file Softloq/WHATWG/Infra/Operation/Concatenate/Concatenate.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the concatenate operations for the WHATWG Infra library, joining lists of strings or byte sequences with an optional separator.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the concatenate operation for Strings and its counterpart for ByteSequences.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_OPERATION_CONCATENATE_CONCATENATE_HPP
+#define SOFTLOQ_WHATWG_INFRA_OPERATION_CONCATENATE_CONCATENATE_HPP
+
+#include "Softloq/WHATWG/Infra/Operation/Collect/Collect.hpp"
+#include "Softloq/WHATWG/Infra/Operation/SequenceElement/SequenceElement.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/ByteSequence/ByteSequence.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/StringBuilder.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Concept for the items concatenate joins into a String: a String, or a sequence of bytes, code units or code points.
+ *
+ * Bytes are taken as the code units of equal value, as by isomorphic decode. Code points above
+ * U+FFFF become surrogate pairs.
+ */
+template <typename T>
+concept StringConcatenateItem = std::same_as<std::remove_cvref_t<T>, String> || SequenceInput<T>;
+
+/**
+ * @brief Concept for the items concatenate_bytes joins into a ByteSequence: a ByteSequence or another sequence of 8-bit elements.
+ */
+template <typename T>
+concept ByteConcatenateItem = SequenceInput<T> && std::same_as<typename SequenceElementTraits<std::ranges::range_value_t<T>>::unit_type, std::uint8_t>;
+
+/**
+ * @brief Concept for a list of items to concatenate into a String, such as std::vector<String> or a SplitView.
+ */
+template <typename R>
+concept StringConcatenateInput = std::ranges::input_range<R> && StringConcatenateItem<std::ranges::range_reference_t<R>>;
+
+/**
+ * @brief Concept for a list of items to concatenate into a ByteSequence, such as std::vector<ByteSequence> or a SplitView<char>.
+ */
+template <typename R>
+concept ByteConcatenateInput = std::ranges::input_range<R> && ByteConcatenateItem<std::ranges::range_reference_t<R>>;
+
+/**
+ * @brief Concatenate a list of strings.
+ *
+ * As defined by the WHATWG Infra specification: the result holds the items of the list in order,
+ * and is the empty string if the list is empty.
+ *
+ * If the list can be iterated more than once (a forward range, e.g. a container or a SplitView),
+ * a first pass adds up the exact length and checks whether every item fits in 8 bits, and a second
+ * pass writes the items into a buffer of exactly that length, allocated once, which becomes the
+ * String's storage. A single-pass list is appended to a StringBuilder instead.
+ *
+ * @param list The items to concatenate.
+ * @return The concatenated String.
+ */
+template <StringConcatenateInput R>
+[[nodiscard]] constexpr String concatenate(R&& list);
+
+/**
+ * @brief Concatenate a list of strings, using a separator.
+ *
+ * As defined by the WHATWG Infra specification: the result holds the items of the list in order,
+ * separated from each other by the separator. Pass a string literal separator as a
+ * std::u16string_view.
+ *
+ * @see concatenate(R&&)
+ *
+ * @param list The items to concatenate.
+ * @param separator The String or sequence placed between consecutive items.
+ * @return The concatenated String.
+ */
+template <StringConcatenateInput R, StringConcatenateItem S>
+    requires(!std::is_array_v<std::remove_cvref_t<S>>)
+[[nodiscard]] constexpr String concatenate(R&& list, const S& separator);
+
+/**
+ * @brief Concatenate a list of byte sequences.
+ *
+ * The byte sequence counterpart of concatenate, e.g. for serializing a list of header values. The
+ * exact length is computed first for forward ranges, so the result is allocated once.
+ *
+ * @param list The byte sequences to concatenate.
+ * @return The concatenated ByteSequence.
+ */
+template <ByteConcatenateInput R>
+[[nodiscard]] constexpr ByteSequence concatenate_bytes(R&& list);
+
+/**
+ * @brief Concatenate a list of byte sequences, using a separator.
+ *
+ * @see concatenate_bytes(R&&)
+ *
+ * @param list The byte sequences to concatenate.
+ * @param separator The byte sequence placed between consecutive items, e.g. std::string_view{", "}.
+ * @return The concatenated ByteSequence.
+ */
+template <ByteConcatenateInput R, ByteConcatenateItem S>
+    requires(!std::is_array_v<std::remove_cvref_t<S>>)
+[[nodiscard]] constexpr ByteSequence concatenate_bytes(R&& list, const S& separator);
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Returns the number of UTF-16 code units an item contributes to a concatenated String.
+ */
+template <typename T>
+constexpr std::size_t concatenate_item_length(const T& item) noexcept
+{
+    if constexpr (std::same_as<T, String>)
+        return item.size();
+    else
+    {
+        using Element = std::ranges::range_value_t<T>;
+        using Traits = SequenceElementTraits<Element>;
+        const std::size_t size = std::ranges::size(item);
+        if constexpr (sizeof(typename Traits::unit_type) != 4)
+            return size;
+        else
+        {
+            // Each code point above U+FFFF becomes a surrogate pair.
+            constexpr CodePointRange basic_plane[1]{{0x0000, 0xFFFF}};
+            const Element* data = std::ranges::data(item);
+            std::size_t length = size;
+            for (std::size_t index = code_point_range_run_length(data, size, basic_plane, false); index < size; ++index)
+                if (Traits::value(data[index]) > 0xFFFF) ++length;
+            return length;
+        }
+    }
+}
+
+/**
+ * @brief Returns true if every code unit an item contributes to a concatenated String fits in 8 bits.
+ */
+template <typename T>
+constexpr bool concatenate_item_is_8bit(const T& item) noexcept
+{
+    if constexpr (std::same_as<T, String>)
+        return item.is_8bit();
+    else
+    {
+        using Element = std::ranges::range_value_t<T>;
+        if constexpr (sizeof(typename SequenceElementTraits<Element>::unit_type) == 1)
+            return true;
+        else
+        {
+            constexpr CodePointRange latin1[1]{{0x0000, 0x00FF}};
+            const std::size_t size = std::ranges::size(item);
+            return code_point_range_run_length(std::ranges::data(item), size, latin1, false) == size;
+        }
+    }
+}
+
+/**
+ * @brief Writes the code units of an item to a concatenated String's buffer and returns the end of what was written.
+ */
+template <typename Unit, typename T>
+constexpr Unit* concatenate_write_item(const T& item, Unit* out) noexcept
+{
+    if constexpr (std::same_as<T, String>)
+    {
+        return item.visit([out](auto units) mutable
+        {
+            for (const auto unit : units) *out++ = static_cast<Unit>(unit);
+            return out;
+        });
+    }
+    else
+    {
+        using Element = std::ranges::range_value_t<T>;
+        using Traits = SequenceElementTraits<Element>;
+        for (const Element& element : item)
+        {
+            const char32_t value = Traits::value(element);
+            if constexpr (sizeof(Unit) == 2 && sizeof(typename Traits::unit_type) == 4)
+            {
+                if (value > 0xFFFF)
+                {
+                    *out++ = static_cast<Unit>(0xD800 + ((value - 0x10000) >> 10));
+                    *out++ = static_cast<Unit>(0xDC00 + ((value - 0x10000) & 0x3FF));
+                    continue;
+                }
+            }
+            *out++ = static_cast<Unit>(value);
+        }
+        return out;
+    }
+}
+
+/**
+ * @brief Appends an item to a StringBuilder, for lists that can only be iterated once.
+ */
+template <typename T>
+constexpr void concatenate_append_item(StringBuilder& builder, const T& item)
+{
+    if constexpr (std::same_as<T, String>)
+        builder.append(item);
+    else
+    {
+        using Element = std::ranges::range_value_t<T>;
+        using Traits = SequenceElementTraits<Element>;
+        if constexpr (std::same_as<Element, std::uint8_t>)
+            builder.append_latin1(std::span<const std::uint8_t>{std::ranges::data(item), std::ranges::size(item)});
+        else if constexpr (std::same_as<Element, char16_t>)
+            builder.append_code_units(std::u16string_view{std::ranges::data(item), std::ranges::size(item)});
+        else if constexpr (std::same_as<Element, char32_t>)
+            builder.append_code_points(std::u32string_view{std::ranges::data(item), std::ranges::size(item)});
+        else if constexpr (sizeof(typename Traits::unit_type) == 4)
+            for (const Element& element : item) builder.append(CodePoint{Traits::value(element)});
+        else
+            for (const Element& element : item) builder.append(CodeUnit{static_cast<std::uint16_t>(Traits::value(element))});
+    }
+}
+
+template <StringConcatenateInput R>
+constexpr String concatenate(R&& list)
+{
+    return concatenate(std::forward<R>(list), std::u16string_view{});
+}
+
+template <StringConcatenateInput R, StringConcatenateItem S>
+    requires(!std::is_array_v<std::remove_cvref_t<S>>)
+constexpr String concatenate(R&& list, const S& separator)
+{
+    if constexpr (!std::ranges::forward_range<R>)
+    {
+        StringBuilder builder;
+        bool first = true;
+        for (auto&& item : list)
+        {
+            if (!first) concatenate_append_item(builder, separator);
+            first = false;
+            concatenate_append_item(builder, item);
+        }
+        return builder.release();
+    }
+    else
+    {
+        std::size_t length = 0;
+        std::size_t count = 0;
+        bool is_8bit = concatenate_item_is_8bit(separator);
+        for (auto&& item : list)
+        {
+            length += concatenate_item_length(item);
+            is_8bit = is_8bit && concatenate_item_is_8bit(item);
+            ++count;
+        }
+        if (count == 0) return String{};
+        length += (count - 1) * concatenate_item_length(separator);
+
+        const auto write = [&list, &separator](auto* out)
+        {
+            bool first = true;
+            for (auto&& item : list)
+            {
+                if (!first) out = concatenate_write_item(separator, out);
+                first = false;
+                out = concatenate_write_item(item, out);
+            }
+        };
+        if (is_8bit)
+        {
+            String::Latin1Buffer units(length);
+            write(units.data());
+            return String::from_buffer(std::move(units));
+        }
+        String::UTF16Buffer units(length);
+        write(units.data());
+        return String::from_buffer(std::move(units));
+    }
+}
+
+/**
+ * @brief Writes the bytes of an item to a concatenated ByteSequence and returns the end of what was written.
+ */
+template <typename T, typename Iterator>
+constexpr Iterator concatenate_write_bytes(const T& item, Iterator out) noexcept
+{
+    using Element = std::ranges::range_value_t<T>;
+    for (const Element& element : item) (out++)->set_value(static_cast<std::uint8_t>(SequenceElementTraits<Element>::value(element)));
+    return out;
+}
+
+template <ByteConcatenateInput R>
+constexpr ByteSequence concatenate_bytes(R&& list)
+{
+    return concatenate_bytes(std::forward<R>(list), std::string_view{});
+}
+
+template <ByteConcatenateInput R, ByteConcatenateItem S>
+    requires(!std::is_array_v<std::remove_cvref_t<S>>)
+constexpr ByteSequence concatenate_bytes(R&& list, const S& separator)
+{
+    using SeparatorElement = std::ranges::range_value_t<S>;
+    ByteSequence result;
+    if constexpr (!std::ranges::forward_range<R>)
+    {
+        bool first = true;
+        for (auto&& item : list)
+        {
+            if (!first)
+                for (const SeparatorElement& element : separator) result.push_back(Byte{static_cast<std::uint8_t>(SequenceElementTraits<SeparatorElement>::value(element))});
+            first = false;
+            using Element = std::ranges::range_value_t<decltype(item)>;
+            for (const Element& element : item) result.push_back(Byte{static_cast<std::uint8_t>(SequenceElementTraits<Element>::value(element))});
+        }
+        return result;
+    }
+    else
+    {
+        std::size_t length = 0;
+        std::size_t count = 0;
+        for (auto&& item : list)
+        {
+            length += std::ranges::size(item);
+            ++count;
+        }
+        if (count == 0) return result;
+        result.resize(length + (count - 1) * std::ranges::size(separator));
+
+        auto out = result.begin();
+        bool first = true;
+        for (auto&& item : list)
+        {
+            if (!first) out = concatenate_write_bytes(separator, out);
+            first = false;
+            out = concatenate_write_bytes(item, out);
+        }
+        return result;
+    }
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_OPERATION_CONCATENATE_CONCATENATE_HPP
@@ -0,0 +1,299 @@
+/**
+ * @file Softloq/WHATWG/Infra/Operation/Endian/Endian.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the endian-aware operations for the WHATWG Infra library, turning Numbers into byte sequences and back.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the reads and writes of single Numbers at an offset of a ByteSequence, and the
+ * bulk encoding and decoding of runs of integers, in big-endian or little-endian byte order.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_OPERATION_ENDIAN_ENDIAN_HPP
+#define SOFTLOQ_WHATWG_INFRA_OPERATION_ENDIAN_ENDIAN_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/ByteSequence/ByteSequence.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/NumberArray.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Overflow.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/uint128_t.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp"
+#include "Softloq/WHATWG/Infra/SIMD/ByteSwap.hpp"
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Write a run of integers as bytes in the given byte order.
+ *
+ * Runs of 16-bit, 32-bit and 64-bit integers in the non-native order are byte-swapped sixteen bytes
+ * at a time with the SIMD kernel; runs in the native order are copied. uint128_t and WideInt values
+ * are written one 64-bit word at a time, most significant word first for big-endian.
+ *
+ * @param values The integers to write.
+ * @param count The number of integers.
+ * @param order The byte order to write in.
+ * @param out Where to write count * sizeof(T) bytes.
+ */
+template <FixedWidthInteger T>
+void store_integers(const T* values, std::size_t count, std::endian order, std::uint8_t* out) noexcept;
+
+/**
+ * @brief Read a run of integers from bytes in the given byte order.
+ *
+ * @param bytes The count * sizeof(T) bytes to read.
+ * @param count The number of integers.
+ * @param order The byte order to read in.
+ * @param out Where to write the integers.
+ * @see store_integers()
+ */
+template <FixedWidthInteger T>
+void load_integers(const std::uint8_t* bytes, std::size_t count, std::endian order, T* out) noexcept;
+
+/**
+ * @brief Read the Number whose sizeof(T) bytes start at an offset of a byte sequence.
+ *
+ * @param bytes The byte sequence to read.
+ * @param offset The index of the first byte.
+ * @param order The byte order to read in.
+ * @return The Number read.
+ * @throws std::out_of_range if the bytes run past the end of the sequence.
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] Number<T> read_number(const ByteSequence& bytes, std::size_t offset, std::endian order);
+
+/**
+ * @brief Overwrite the sizeof(T) bytes at an offset of a byte sequence with a Number.
+ *
+ * @param bytes The byte sequence to write into.
+ * @param offset The index of the first byte.
+ * @param value The Number to write.
+ * @param order The byte order to write in.
+ * @throws std::out_of_range if the bytes run past the end of the sequence.
+ */
+template <FixedWidthInteger T>
+void write_number(ByteSequence& bytes, std::size_t offset, const Number<T>& value, std::endian order);
+
+/**
+ * @brief Append a Number to the end of a byte sequence.
+ *
+ * @param bytes The byte sequence to grow.
+ * @param value The Number to append.
+ * @param order The byte order to write in.
+ */
+template <FixedWidthInteger T>
+void append_number(ByteSequence& bytes, const Number<T>& value, std::endian order);
+
+/**
+ * @brief Read a run of Numbers starting at an offset of a byte sequence, in one pass.
+ *
+ * @param bytes The byte sequence to read.
+ * @param offset The index of the first byte.
+ * @param count The number of Numbers to read.
+ * @param order The byte order to read in.
+ * @return The Numbers read.
+ * @throws std::out_of_range if the bytes run past the end of the sequence.
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] NumberArray<T> read_numbers(const ByteSequence& bytes, std::size_t offset, std::size_t count, std::endian order);
+
+/**
+ * @brief Append a run of integers to the end of a byte sequence, in one pass.
+ *
+ * @param bytes The byte sequence to grow.
+ * @param values The integers to append.
+ * @param order The byte order to write in.
+ */
+template <FixedWidthInteger T>
+void append_numbers(ByteSequence& bytes, std::span<const T> values, std::endian order);
+
+/**
+ * @brief Append the Numbers of a NumberArray to the end of a byte sequence, in one pass.
+ *
+ * @see append_numbers(ByteSequence&, std::span<const T>, std::endian)
+ */
+template <FixedWidthInteger T>
+void append_numbers(ByteSequence& bytes, const NumberArray<T>& values, std::endian order);
+
+/**
+ * @brief The number of 64-bit words in a uint128_t or WideInt value.
+ */
+template <FixedWidthInteger T>
+inline constexpr std::size_t integer_word_count = sizeof(T) / sizeof(std::uint64_t);
+
+/**
+ * @brief The 64-bit words of a uint128_t or WideInt value, least significant first.
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr std::array<std::uint64_t, integer_word_count<T>> integer_words(const T& value) noexcept
+{
+    if constexpr (std::same_as<T, uint128_t>)
+        return {value.low(), value.high()};
+    else
+        return value.words();
+}
+
+/**
+ * @brief The uint128_t or WideInt value with the given 64-bit words, least significant first.
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr T integer_from_words(const std::array<std::uint64_t, integer_word_count<T>>& words) noexcept
+{
+    if constexpr (std::same_as<T, uint128_t>)
+        return uint128_t{words[1], words[0]};
+    else
+        return T::from_words(words);
+}
+
+/**
+ * @brief Throws std::out_of_range unless size bytes starting at offset lie within a byte sequence of length bytes.
+ */
+inline void check_byte_range(std::size_t length, std::size_t offset, std::size_t size, const char* operation)
+{
+    if (offset > length || length - offset < size) throw std::out_of_range(operation);
+}
+
+/**
+ * @brief The storage of a byte sequence as raw bytes, for the loads to read.
+ */
+inline const std::uint8_t* raw_bytes(const ByteSequence& bytes) noexcept
+{
+    static_assert(sizeof(Byte) == 1 && std::is_trivially_copyable_v<Byte>, "a Byte must be stored as exactly one raw byte");
+    return reinterpret_cast<const std::uint8_t*>(std::ranges::data(bytes));
+}
+
+/**
+ * @brief The storage of a byte sequence as raw bytes, for the stores to write.
+ */
+inline std::uint8_t* raw_bytes(ByteSequence& bytes) noexcept
+{
+    static_assert(sizeof(Byte) == 1 && std::is_trivially_copyable_v<Byte>, "a Byte must be stored as exactly one raw byte");
+    return reinterpret_cast<std::uint8_t*>(std::ranges::data(bytes));
+}
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <FixedWidthInteger T>
+void store_integers(const T* values, std::size_t count, std::endian order, std::uint8_t* out) noexcept
+{
+    if (count == 0) return;
+    if constexpr (std::integral<T>)
+    {
+        const auto* source = reinterpret_cast<const std::uint8_t*>(values);
+        if constexpr (SIMD::ByteSwapWidth<sizeof(T)>)
+        {
+            if (order != std::endian::native) return SIMD::byte_swap<sizeof(T)>(source, count, out);
+        }
+        std::memcpy(out, source, count * sizeof(T));
+    }
+    else
+    {
+        constexpr std::size_t words = integer_word_count<T>;
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            const auto value_words = integer_words(values[index]);
+            for (std::size_t word = 0; word < words; ++word)
+            {
+                std::uint64_t bits = value_words[order == std::endian::little ? word : words - 1 - word];
+                if (order != std::endian::native) bits = std::byteswap(bits);
+                std::memcpy(out + sizeof(T) * index + sizeof(std::uint64_t) * word, &bits, sizeof(bits));
+            }
+        }
+    }
+}
+
+template <FixedWidthInteger T>
+void load_integers(const std::uint8_t* bytes, std::size_t count, std::endian order, T* out) noexcept
+{
+    if (count == 0) return;
+    if constexpr (std::integral<T>)
+    {
+        auto* destination = reinterpret_cast<std::uint8_t*>(out);
+        if constexpr (SIMD::ByteSwapWidth<sizeof(T)>)
+        {
+            if (order != std::endian::native) return SIMD::byte_swap<sizeof(T)>(bytes, count, destination);
+        }
+        std::memcpy(destination, bytes, count * sizeof(T));
+    }
+    else
+    {
+        constexpr std::size_t words = integer_word_count<T>;
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            std::array<std::uint64_t, words> value_words{};
+            for (std::size_t word = 0; word < words; ++word)
+            {
+                std::uint64_t bits = 0;
+                std::memcpy(&bits, bytes + sizeof(T) * index + sizeof(std::uint64_t) * word, sizeof(bits));
+                if (order != std::endian::native) bits = std::byteswap(bits);
+                value_words[order == std::endian::little ? word : words - 1 - word] = bits;
+            }
+            out[index] = integer_from_words<T>(value_words);
+        }
+    }
+}
+
+template <FixedWidthInteger T>
+Number<T> read_number(const ByteSequence& bytes, std::size_t offset, std::endian order)
+{
+    check_byte_range(bytes.size(), offset, sizeof(T), "read_number past the end of the ByteSequence");
+    T value{};
+    load_integers(raw_bytes(bytes) + offset, 1, order, &value);
+    return Number<T>{value};
+}
+
+template <FixedWidthInteger T>
+void write_number(ByteSequence& bytes, std::size_t offset, const Number<T>& value, std::endian order)
+{
+    check_byte_range(bytes.size(), offset, sizeof(T), "write_number past the end of the ByteSequence");
+    const T raw = value.get_value();
+    store_integers(&raw, 1, order, raw_bytes(bytes) + offset);
+}
+
+template <FixedWidthInteger T>
+void append_number(ByteSequence& bytes, const Number<T>& value, std::endian order)
+{
+    const std::size_t offset = bytes.size();
+    bytes.resize(offset + sizeof(T));
+    write_number(bytes, offset, value, order);
+}
+
+template <FixedWidthInteger T>
+NumberArray<T> read_numbers(const ByteSequence& bytes, std::size_t offset, std::size_t count, std::endian order)
+{
+    if (count > bytes.size() / sizeof(T)) throw std::out_of_range("read_numbers past the end of the ByteSequence");
+    check_byte_range(bytes.size(), offset, count * sizeof(T), "read_numbers past the end of the ByteSequence");
+    NumberArray<T> result(count);
+    load_integers(raw_bytes(bytes) + offset, count, order, result.data());
+    return result;
+}
+
+template <FixedWidthInteger T>
+void append_numbers(ByteSequence& bytes, std::span<const T> values, std::endian order)
+{
+    const std::size_t offset = bytes.size();
+    bytes.resize(offset + values.size() * sizeof(T));
+    store_integers(values.data(), values.size(), order, raw_bytes(bytes) + offset);
+}
+
+template <FixedWidthInteger T>
+void append_numbers(ByteSequence& bytes, const NumberArray<T>& values, std::endian order)
+{
+    append_numbers(bytes, values.values(), order);
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_OPERATION_ENDIAN_ENDIAN_HPP
@@ -0,0 +1,388 @@
+/**
+ * @file Softloq/WHATWG/Infra/Operation/ParseFloat/ParseFloat.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the floating-point number parsing operation for the WHATWG Infra library, turning byte, code unit and code point sequences into doubles.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the HTML rules for parsing floating-point number values, and decimal_to_double(), the correctly rounded conversion they are built on.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_OPERATION_PARSEFLOAT_PARSEFLOAT_HPP
+#define SOFTLOQ_WHATWG_INFRA_OPERATION_PARSEFLOAT_PARSEFLOAT_HPP
+
+#include "Softloq/WHATWG/Infra/Operation/Collect/Collect.hpp"
+#include "Softloq/WHATWG/Infra/Operation/SequenceElement/SequenceElement.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/BigInt/bigint_t.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Double/PowersOfTen.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/uint128_t.hpp"
+#include "Softloq/WHATWG/Infra/SIMD/Digits.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Why a floating-point number could not be parsed.
+ */
+enum class FloatParseError : std::uint8_t
+{
+    None,       ///< The number was parsed.
+    NoDigits,   ///< No ASCII digit was found where the number should start.
+    OutOfRange  ///< The number rounds to 2^1024 or -2^1024, past the largest finite double.
+};
+
+/**
+ * @brief The result of parsing a floating-point number: the value, where parsing stopped, and whether it failed.
+ */
+struct FloatParseResult
+{
+    Number<double> value;                         ///< The parsed value, or zero if parsing failed.
+    std::size_t position{0};                      ///< The index where the rules stopped reading, or 0 if there were no digits.
+    FloatParseError error{FloatParseError::None};
+
+    /**
+     * @brief Returns true if the number was parsed.
+     */
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return error == FloatParseError::None; }
+};
+
+/**
+ * @brief Round significand * 10^exponent to the nearest double, ties to even.
+ *
+ * Exact cases take Clinger's fast path, one multiplication or division of two exact doubles. The
+ * rest take the Eisel-Lemire algorithm, which rounds from one or two 64x64-bit products with a
+ * 128-bit power of ten and needs no fallback for a 64-bit significand.
+ *
+ * @param significand The decimal significand.
+ * @param exponent The decimal exponent.
+ * @return The rounded value: 0 below the subnormals, infinity past the largest finite double.
+ */
+[[nodiscard]] constexpr double decimal_to_double(std::uint64_t significand, int exponent) noexcept;
+
+/**
+ * @brief Parse a number by the HTML rules for parsing floating-point number values.
+ *
+ * ASCII whitespace is skipped, then an optional '-' or '+' sign, then ASCII digits and an optional
+ * '.' with fraction digits, or a '.' and at least one fraction digit, then an optional exponent
+ * after an 'e' or 'E'. Anything after the number is ignored. The value is rounded to the nearest double,
+ * ties to even, and -0 becomes 0; a value that rounds past the largest finite double fails with
+ * OutOfRange. Up to nineteen significant digits are converted with decimal_to_double(); longer
+ * significands that fall too close to a tie between two doubles are rounded exactly with bigint_t.
+ *
+ * @param input The sequence to parse.
+ * @return The value, the index where the rules stopped reading, and the error, if any.
+ */
+template <SequenceInput R>
+[[nodiscard]] constexpr FloatParseResult parse_floating_point_number(R&& input);
+
+/**
+ * @brief The bits of significand * 10^exponent rounded to a positive double, by Eisel-Lemire.
+ *
+ * This follows fast_float's compute_float(). The table entries are rounded down, except from 10^-27
+ * to 10^-1, where the algorithm is proven exact with them rounded up.
+ */
+[[nodiscard]] constexpr std::uint64_t eisel_lemire(std::uint64_t significand, int exponent) noexcept
+{
+    constexpr int fraction_bits = 52;
+    constexpr std::uint64_t fraction_mask = (std::uint64_t{1} << fraction_bits) - 1;
+    constexpr std::uint64_t infinity = std::uint64_t{0x7FF} << fraction_bits;
+    if (significand == 0 || exponent < double_powers_of_ten_min) return 0;
+    if (exponent > 308) return infinity;
+
+    const int leading_zeros = std::countl_zero(significand);
+    const std::uint64_t normalized = significand << leading_zeros;
+    const uint128_t power = double_powers_of_ten[static_cast<std::size_t>(exponent - double_powers_of_ten_min)] + uint128_t{exponent >= -27 && exponent < 0 ? 1u : 0u};
+
+    // The top 55 bits of the product, refined with the low half of the power only when they are in doubt.
+    uint128_t product = uint128_t::multiply(normalized, power.high());
+    constexpr std::uint64_t precision_mask = std::numeric_limits<std::uint64_t>::max() >> (fraction_bits + 3);
+    if ((product.high() & precision_mask) == precision_mask) product += uint128_t{uint128_t::multiply(normalized, power.low()).high()};
+
+    const auto upper_bit = static_cast<int>(product.high() >> 63);
+    const int shift = upper_bit + 64 - fraction_bits - 3;
+    std::uint64_t mantissa = product.high() >> shift;
+    // floor(log2(10^exponent)) + 63 is the exponent of the top bit of the normalized product.
+    int biased_exponent = (((152170 + 65536) * exponent) >> 16) + 63 + upper_bit - leading_zeros + 1023;
+
+    if (biased_exponent <= 0)
+    {
+        // Subnormal: shift down to the fixed exponent and round half up, since no tie is this small.
+        if (-biased_exponent + 1 >= 64) return 0;
+        mantissa >>= -biased_exponent + 1;
+        mantissa += mantissa & 1;
+        return mantissa >> 1;
+    }
+
+    // An exact tie, possible only while 5^|exponent| fits in 64 bits, rounds to even instead of up.
+    if (product.low() <= 1 && exponent >= -4 && exponent <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == product.high()) mantissa &= ~std::uint64_t{1};
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (std::uint64_t{2} << fraction_bits))
+    {
+        mantissa = std::uint64_t{1} << fraction_bits;
+        ++biased_exponent;
+    }
+    if (biased_exponent >= 0x7FF) return infinity;
+    return (static_cast<std::uint64_t>(biased_exponent) << fraction_bits) | (mantissa & fraction_mask);
+}
+
+/**
+ * @brief The bits of (value + fraction) * 2^exponent rounded to a positive double, for a fraction in [0, 1).
+ *
+ * @param value The integer part, at least 2^54 when sticky is set, so that the fraction is below the rounding bit.
+ * @param sticky Whether the fraction is nonzero.
+ */
+[[nodiscard]] constexpr std::uint64_t round_to_double_bits(const bigint_t& value, int exponent, bool sticky)
+{
+    constexpr int fraction_bits = 52;
+    constexpr std::uint64_t fraction_mask = (std::uint64_t{1} << fraction_bits) - 1;
+    // Keep 53 bits, or fewer where the value is subnormal and its lowest bit is fixed at 2^-1074.
+    const int drop = std::max(static_cast<int>(value.bit_width()) - fraction_bits - 1, -1074 - exponent);
+    std::uint64_t mantissa = 0;
+    if (drop <= 0)
+        mantissa = static_cast<std::uint64_t>(value << -drop);
+    else
+    {
+        const bigint_t rounding = value >> (drop - 1);
+        mantissa = static_cast<std::uint64_t>(rounding >> 1);
+        sticky = sticky || (rounding << (drop - 1)) != value;
+        if ((static_cast<std::uint64_t>(rounding) & 1) != 0 && (sticky || (mantissa & 1) != 0)) ++mantissa;
+    }
+    exponent += drop;
+    if (mantissa == std::uint64_t{2} << fraction_bits)
+    {
+        mantissa >>= 1;
+        ++exponent;
+    }
+    if (mantissa <= fraction_mask) return mantissa;
+    const int biased_exponent = exponent + fraction_bits + 1023;
+    if (biased_exponent >= 0x7FF) return std::uint64_t{0x7FF} << fraction_bits;
+    return (static_cast<std::uint64_t>(biased_exponent) << fraction_bits) | (mantissa & fraction_mask);
+}
+
+/**
+ * @brief The bits of digits * 10^exponent rounded to a positive double, computed exactly.
+ *
+ * @param sticky Whether nonzero digits were left out after digits, which can only break a tie.
+ */
+[[nodiscard]] constexpr std::uint64_t exact_decimal_to_double_bits(const bigint_t& digits, int exponent, bool sticky)
+{
+    // The decimal magnitude is within a few digits of this; past 10^310 or below 10^-325 nothing is left to round.
+    const int magnitude = static_cast<int>(digits.bit_width() * 3 / 10) + exponent;
+    if (!digits || magnitude < -330) return 0;
+    if (magnitude > 312) return std::uint64_t{0x7FF} << 52;
+
+    bigint_t power{1};
+    for (int remaining = exponent < 0 ? -exponent : exponent; remaining > 0; remaining -= 19)
+    {
+        std::uint64_t factor = 1;
+        for (int index = std::min(remaining, 19); index > 0; --index) factor *= 10;
+        power.multiply_add(factor, 0);
+    }
+    if (exponent >= 0) return round_to_double_bits(digits * power, 0, sticky);
+
+    // Scale the dividend so the quotient has at least 64 bits; the remainder is the fraction below them.
+    const int scale = std::max(0, static_cast<int>(power.bit_width()) + 64 - static_cast<int>(digits.bit_width()));
+    bigint_t remainder;
+    const bigint_t quotient = bigint_t::divide(digits << scale, power, remainder);
+    return round_to_double_bits(quotient, -scale, sticky || static_cast<bool>(remainder));
+}
+
+/**
+ * @brief Accumulate the leading ASCII digits of a sequence into a 64-bit significand, wrapping past nineteen digits.
+ *
+ * Raw 8-bit and UTF-16 inputs take eight digits at a time from a packed word.
+ *
+ * @return The number of leading digits.
+ */
+template <SequenceElement E>
+constexpr std::size_t accumulate_float_digits(const E* data, std::size_t size, std::uint64_t& significand) noexcept
+{
+    using Traits = SequenceElementTraits<E>;
+    std::size_t length = 0;
+    if constexpr (Traits::is_raw)
+    {
+        for (; size - length >= 8; length += 8)
+        {
+            const std::uint64_t word = SIMD::pack_eight_units(data + length);
+            if (SIMD::eight_digit_prefix_length(word) != 8) break;
+            significand = significand * 100000000 + SIMD::parse_eight_digits(word);
+        }
+    }
+    for (; length < size; ++length)
+    {
+        const char32_t value = Traits::value(data[length]);
+        if (value < U'0' || value > U'9') break;
+        significand = significand * 10 + (value - U'0');
+    }
+    return length;
+}
+
+/**
+ * @brief The significant digits the exact conversion keeps: a double is decided by its first 768, and the rest only tell a tie from just above one.
+ */
+inline constexpr std::size_t max_significant_digits = 800;
+
+/**
+ * @brief Append the significant digits of a run of ASCII digits to a bigint_t, nineteen at a time, up to a limit.
+ *
+ * @param count Counts the significant digits seen, including those past the limit.
+ * @param sticky Set to true if a nonzero digit past the limit is left out.
+ */
+template <SequenceElement E>
+constexpr void append_significant_digits(const E* data, std::size_t size, bigint_t& digits, std::size_t& count, bool& sticky)
+{
+    using Traits = SequenceElementTraits<E>;
+    std::uint64_t chunk = 0;
+    std::uint64_t scale = 1;
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        const auto digit = static_cast<std::uint64_t>(Traits::value(data[index]) - U'0');
+        if (count == 0 && digit == 0) continue;
+        if (count++ >= max_significant_digits)
+        {
+            sticky = sticky || digit != 0;
+            continue;
+        }
+        chunk = chunk * 10 + digit;
+        scale *= 10;
+        if (scale == 10000000000000000000ULL)
+        {
+            digits.multiply_add(scale, chunk);
+            chunk = 0;
+            scale = 1;
+        }
+    }
+    if (scale != 1) digits.multiply_add(scale, chunk);
+}
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+constexpr double decimal_to_double(std::uint64_t significand, int exponent) noexcept
+{
+    // Every integer up to 2^53 and every power of ten up to 10^22 is a double, so one operation rounds once.
+    constexpr std::array<double, 23> exact_powers = [] {
+        std::array<double, 23> powers{};
+        powers[0] = 1;
+        for (std::size_t index = 1; index < powers.size(); ++index) powers[index] = powers[index - 1] * 10;
+        return powers;
+    }();
+    if (significand <= (std::uint64_t{1} << 53) && exponent >= -22 && exponent <= 22)
+    {
+        const auto value = static_cast<double>(significand);
+        return exponent < 0 ? value / exact_powers[static_cast<std::size_t>(-exponent)] : value * exact_powers[static_cast<std::size_t>(exponent)];
+    }
+    return std::bit_cast<double>(eisel_lemire(significand, exponent));
+}
+
+template <SequenceInput R>
+constexpr FloatParseResult parse_floating_point_number(R&& input)
+{
+    using Traits = SequenceElementTraits<std::ranges::range_value_t<R>>;
+
+    const auto* data = std::ranges::data(input);
+    const std::size_t size = std::ranges::size(input);
+    const auto is_digit_at = [&](std::size_t index) {
+        if (index >= size) return false;
+        const char32_t value = Traits::value(data[index]);
+        return value >= U'0' && value <= U'9';
+    };
+    const auto is_at = [&](std::size_t index, char32_t first, char32_t second) {
+        if (index >= size) return false;
+        const char32_t value = Traits::value(data[index]);
+        return value == first || value == second;
+    };
+
+    std::size_t position = 0;
+    skip_ascii_whitespace(input, position);
+    bool negative = false;
+    if (is_at(position, U'-', U'+'))
+    {
+        negative = Traits::value(data[position]) == U'-';
+        ++position;
+    }
+    // A number can only start with a '.' when a digit follows it; after integer digits, the '.' is read either way.
+    if (!is_digit_at(position) && !(is_at(position, U'.', U'.') && is_digit_at(position + 1))) return {Number<double>{}, 0, FloatParseError::NoDigits};
+
+    // The integer and fraction digits, accumulated as one significand that is exact up to nineteen digits.
+    std::uint64_t significand = 0;
+    const std::size_t integer_start = position;
+    position += accumulate_float_digits(data + position, size - position, significand);
+    const std::size_t integer_end = position;
+    if (is_at(position, U'.', U'.')) ++position;
+    const std::size_t fraction_start = position;
+    position += accumulate_float_digits(data + position, size - position, significand);
+    const std::size_t fraction_end = position;
+
+    // Exponents are clamped far past the range of doubles, so a long run of exponent digits cannot overflow.
+    constexpr std::int64_t exponent_limit = 100000;
+    std::int64_t exponent = 0;
+    if (is_at(position, U'e', U'E'))
+    {
+        ++position;
+        bool negative_exponent = false;
+        if (is_at(position, U'-', U'+'))
+        {
+            negative_exponent = Traits::value(data[position]) == U'-';
+            ++position;
+        }
+        for (; is_digit_at(position); ++position) exponent = std::min<std::int64_t>(exponent * 10 + (Traits::value(data[position]) - U'0'), exponent_limit);
+        if (negative_exponent) exponent = -exponent;
+    }
+    exponent -= static_cast<std::int64_t>(fraction_end - fraction_start);
+    const auto clamped = [&](std::int64_t value) { return static_cast<int>(std::clamp(value, -2 * exponent_limit, 2 * exponent_limit)); };
+
+    // Leading zeros, of the integer and then of the fraction, are not significant.
+    std::size_t leading_zeros = 0;
+    while (integer_start + leading_zeros < integer_end && Traits::value(data[integer_start + leading_zeros]) == U'0') ++leading_zeros;
+    if (integer_start + leading_zeros == integer_end)
+        for (std::size_t index = fraction_start; index < fraction_end && Traits::value(data[index]) == U'0'; ++index) ++leading_zeros;
+    const std::size_t digit_count = (integer_end - integer_start) + (fraction_end - fraction_start) - leading_zeros;
+
+    double value = 0;
+    if (digit_count <= 19)
+        value = decimal_to_double(significand, clamped(exponent));
+    else
+    {
+        // Keep the first nineteen significant digits; the value is at least them and below them plus one in the last place.
+        const std::size_t integer_zeros = std::min(leading_zeros, integer_end - integer_start);
+        const std::size_t integer_digits = std::min<std::size_t>(integer_end - integer_start - integer_zeros, 19);
+        const std::size_t fraction_zeros = leading_zeros - integer_zeros;
+        significand = 0;
+        accumulate_float_digits(data + integer_start + integer_zeros, integer_digits, significand);
+        accumulate_float_digits(data + fraction_start + fraction_zeros, 19 - integer_digits, significand);
+        const std::int64_t truncated_exponent = exponent + static_cast<std::int64_t>(digit_count - 19);
+
+        // When both ends round to the same double, so does the value; otherwise it is rounded exactly.
+        const std::uint64_t lower = eisel_lemire(significand, clamped(truncated_exponent));
+        if (lower == eisel_lemire(significand + 1, clamped(truncated_exponent)))
+            value = std::bit_cast<double>(lower);
+        else
+        {
+            bigint_t digits;
+            std::size_t count = 0;
+            bool sticky = false;
+            append_significant_digits(data + integer_start, integer_end - integer_start, digits, count, sticky);
+            append_significant_digits(data + fraction_start, fraction_end - fraction_start, digits, count, sticky);
+            const auto left_out = static_cast<std::int64_t>(count - std::min(count, max_significant_digits));
+            value = std::bit_cast<double>(exact_decimal_to_double_bits(digits, clamped(exponent + left_out), sticky));
+        }
+    }
+    if (value == std::numeric_limits<double>::infinity()) return {Number<double>{}, position, FloatParseError::OutOfRange};
+    // The rules have no -0, so a negative value that rounds to zero is 0.
+    return {Number<double>{negative && value != 0 ? -value : value}, position, FloatParseError::None};
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_OPERATION_PARSEFLOAT_PARSEFLOAT_HPP
@@ -0,0 +1,420 @@
+/**
+ * @file Softloq/WHATWG/Infra/Operation/ParseInteger/ParseInteger.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the integer parsing operations for the WHATWG Infra library, turning byte, code unit and code point sequences into Numbers.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines parse_ascii_digits() and the HTML rules for parsing integers and non-negative integers, for every Number width.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_OPERATION_PARSEINTEGER_PARSEINTEGER_HPP
+#define SOFTLOQ_WHATWG_INFRA_OPERATION_PARSEINTEGER_PARSEINTEGER_HPP
+
+#include "Softloq/WHATWG/Infra/Operation/Collect/Collect.hpp"
+#include "Softloq/WHATWG/Infra/Operation/SequenceElement/SequenceElement.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/BigInt/bigint_t.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/uint128_t.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp"
+#include "Softloq/WHATWG/Infra/SIMD/Digits.hpp"
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Why an integer could not be parsed.
+ */
+enum class IntegerParseError : std::uint8_t
+{
+    None,       ///< The integer was parsed.
+    NoDigits,   ///< No ASCII digit was found where the integer should start.
+    OutOfRange  ///< The digits (and sign) denote a value the integer type cannot hold.
+};
+
+/**
+ * @brief The types integers can be parsed into: the fixed-width integers of DecimalInteger, and bigint_t, which never overflows.
+ */
+template <typename T>
+concept ParseableInteger = DecimalInteger<T> || std::same_as<T, bigint_t>;
+
+/**
+ * @brief The result of parsing an integer: the value, where parsing stopped, and whether it failed.
+ *
+ * @tparam T The integer type parsed into.
+ */
+template <ParseableInteger T>
+struct IntegerParseResult
+{
+    Number<T> value;                                ///< The parsed value, or zero if parsing failed.
+    std::size_t position{0};                        ///< The index one past the last digit, or the starting position if there were no digits.
+    IntegerParseError error{IntegerParseError::None};
+
+    /**
+     * @brief Returns true if the integer was parsed.
+     */
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return error == IntegerParseError::None; }
+};
+
+/**
+ * @brief Parse the run of ASCII digits at a position as a base-ten integer.
+ *
+ * No whitespace or sign is accepted. Raw 8-bit and UTF-16 inputs are parsed sixteen digits at a
+ * time with the SIMD kernels, then eight at a time from a packed 64-bit word; other inputs digit by
+ * digit. Leading zeros are allowed, and a run too long for T is consumed whole and reported as
+ * OutOfRange.
+ *
+ * @param input The sequence to parse.
+ * @param position The index of the first digit.
+ * @return The value, the index one past the last digit, and the error, if any.
+ */
+template <ParseableInteger T, SequenceInput R>
+[[nodiscard]] constexpr IntegerParseResult<T> parse_ascii_digits(R&& input, std::size_t position = 0);
+
+/**
+ * @brief Parse an integer by the HTML rules for parsing integers.
+ *
+ * ASCII whitespace is skipped, then an optional '-' or '+' sign, then at least one ASCII digit is
+ * required. Anything after the digits is ignored. A negative value fails with OutOfRange when T is
+ * unsigned, except for -0.
+ *
+ * @param input The sequence to parse.
+ * @return The value, the index one past the last digit, and the error, if any.
+ */
+template <ParseableInteger T, SequenceInput R>
+[[nodiscard]] constexpr IntegerParseResult<T> parse_integer(R&& input);
+
+/**
+ * @brief Parse an integer by the HTML rules for parsing non-negative integers.
+ *
+ * The same as parse_integer(), except that a value below zero fails with OutOfRange whatever T is.
+ *
+ * @param input The sequence to parse.
+ * @return The value, the index one past the last digit, and the error, if any.
+ */
+template <ParseableInteger T, SequenceInput R>
+[[nodiscard]] constexpr IntegerParseResult<T> parse_non_negative_integer(R&& input);
+
+/**
+ * @brief The unsigned type digits are accumulated in before they are range checked against T: the unsigned WideInt of the same width for WideInt, and a non-negative bigint_t for bigint_t.
+ */
+template <ParseableInteger T>
+struct decimal_magnitude
+{
+    using type = std::conditional_t<std::same_as<T, uint128_t>, uint128_t, std::uint64_t>;
+};
+
+template <std::size_t Bits, bool Signed>
+struct decimal_magnitude<WideInt<Bits, Signed>>
+{
+    using type = WideInt<Bits, false>;
+};
+
+template <>
+struct decimal_magnitude<bigint_t>
+{
+    using type = bigint_t;
+};
+
+/**
+ * @brief The unsigned type digits are accumulated in before they are range checked against T.
+ */
+template <ParseableInteger T>
+using decimal_magnitude_t = typename decimal_magnitude<T>::type;
+
+/**
+ * @brief The powers of ten from 10^0 to 10^19.
+ */
+inline constexpr std::array<std::uint64_t, 20> decimal_powers_of_ten = [] {
+    std::array<std::uint64_t, 20> powers{};
+    powers[0] = 1;
+    for (std::size_t exponent = 1; exponent < powers.size(); ++exponent) powers[exponent] = powers[exponent - 1] * 10;
+    return powers;
+}();
+
+/**
+ * @brief Append digits to a 64-bit magnitude: magnitude * 10^digits + chunk.
+ *
+ * @return false, leaving the magnitude unchanged, if the result does not fit.
+ */
+constexpr bool append_decimal_digits(std::uint64_t& magnitude, std::uint64_t chunk, std::size_t digits) noexcept
+{
+    const uint128_t product = uint128_t::multiply(magnitude, decimal_powers_of_ten[digits]);
+    const std::uint64_t sum = product.low() + chunk;
+    if (product.high() != 0 || sum < chunk) return false;
+    magnitude = sum;
+    return true;
+}
+
+/**
+ * @brief Append digits to a 128-bit magnitude: magnitude * 10^digits + chunk.
+ *
+ * @return false, leaving the magnitude unchanged, if the result does not fit.
+ */
+constexpr bool append_decimal_digits(uint128_t& magnitude, std::uint64_t chunk, std::size_t digits) noexcept
+{
+    const std::uint64_t scale = decimal_powers_of_ten[digits];
+    const uint128_t low = uint128_t::multiply(magnitude.low(), scale);
+    const uint128_t high = uint128_t::multiply(magnitude.high(), scale);
+    const std::uint64_t upper = high.low() + low.high();
+    if (high.high() != 0 || upper < low.high()) return false;
+    const uint128_t product{upper, low.low()};
+    const uint128_t sum = product + uint128_t{chunk};
+    if (sum < product) return false;
+    magnitude = sum;
+    return true;
+}
+
+/**
+ * @brief Append digits to a WideInt magnitude: magnitude * 10^digits + chunk.
+ *
+ * @return false, leaving the magnitude unchanged, if the result does not fit.
+ */
+template <std::size_t Bits>
+constexpr bool append_decimal_digits(WideInt<Bits, false>& magnitude, std::uint64_t chunk, std::size_t digits) noexcept
+{
+    WideInt<Bits, false> result;
+    if (WideInt<Bits, false>::multiply_add(magnitude, decimal_powers_of_ten[digits], chunk, result) != 0) return false;
+    magnitude = result;
+    return true;
+}
+
+/**
+ * @brief Append digits to a bigint_t magnitude: magnitude * 10^digits + chunk.
+ *
+ * @return true, since the magnitude grows to fit.
+ */
+constexpr bool append_decimal_digits(bigint_t& magnitude, std::uint64_t chunk, std::size_t digits)
+{
+    magnitude.multiply_add(decimal_powers_of_ten[digits], chunk);
+    return true;
+}
+
+/**
+ * @brief Append one digit to a magnitude, multiplying by ten directly while the magnitude is small enough not to overflow.
+ *
+ * @return false, leaving the magnitude unchanged, if the result does not fit.
+ */
+template <typename M>
+constexpr bool append_decimal_digit(M& magnitude, std::uint32_t digit) noexcept
+{
+    constexpr std::uint64_t limit = std::numeric_limits<std::uint64_t>::max() / 10;
+    if constexpr (std::same_as<M, std::uint64_t>)
+    {
+        if (magnitude < limit)
+        {
+            magnitude = magnitude * 10 + digit;
+            return true;
+        }
+    }
+    else if constexpr (std::same_as<M, uint128_t>)
+    {
+        if (magnitude.high() == 0 && magnitude.low() < limit)
+        {
+            magnitude = uint128_t{magnitude.low() * 10 + digit};
+            return true;
+        }
+    }
+    return append_decimal_digits(magnitude, digit, 1);
+}
+
+/**
+ * @brief Accumulate the leading ASCII digits of a raw sequence of at least eight units, sixteen and then eight at a time.
+ *
+ * @return The number of digits accumulated; fewer than eight units are left after them unless the run has ended.
+ */
+template <SequenceElement E, typename M>
+constexpr std::size_t accumulate_decimal_words(const E* data, std::size_t size, M& magnitude, bool& overflow) noexcept
+{
+    using Unit = typename SequenceElementTraits<E>::unit_type;
+    std::size_t length = 0;
+    if constexpr (sizeof(Unit) <= 2)
+    {
+        if !consteval
+        {
+            std::uint64_t chunk = 0;
+            while (size - length >= 16 && SIMD::parse_sixteen_digits(reinterpret_cast<const Unit*>(data) + length, chunk))
+            {
+                overflow = overflow || !append_decimal_digits(magnitude, chunk, 16);
+                length += 16;
+            }
+        }
+    }
+    while (size - length >= 8)
+    {
+        const std::uint64_t word = SIMD::pack_eight_units(data + length);
+        const std::size_t digits = SIMD::eight_digit_prefix_length(word);
+        if (digits == 0) break;
+        // Shifting the digits to the top of the word turns the vacated bytes into leading zeros.
+        overflow = overflow || !append_decimal_digits(magnitude, SIMD::parse_eight_digits(word << (8 * (8 - digits))), digits);
+        length += digits;
+        if (digits < 8) break;
+    }
+    return length;
+}
+
+/**
+ * @brief Accumulate the leading ASCII digits of a sequence into a magnitude.
+ *
+ * Once the magnitude would overflow, the remaining digits are still counted but no longer added.
+ *
+ * @param data The first element of the sequence.
+ * @param size The number of elements in the sequence.
+ * @param magnitude Receives the digits appended to it.
+ * @param overflow Set to true if the digits did not fit.
+ * @return The number of leading digits.
+ */
+template <SequenceElement E, typename M>
+constexpr std::size_t accumulate_decimal_digits(const E* data, std::size_t size, M& magnitude, bool& overflow) noexcept
+{
+    using Traits = SequenceElementTraits<E>;
+    std::size_t length = 0;
+    if constexpr (Traits::is_raw)
+    {
+        if (size >= 8) length = accumulate_decimal_words(data, size, magnitude, overflow);
+
+        // Fewer than eight units are left, so the tail is gathered without overflow checks and appended once.
+        const std::size_t start = length;
+        std::uint64_t tail = 0;
+        for (; length < size; ++length)
+        {
+            const char32_t value = Traits::value(data[length]);
+            if (value < U'0' || value > U'9') break;
+            tail = tail * 10 + (value - U'0');
+        }
+        if (length != start) overflow = overflow || !append_decimal_digits(magnitude, tail, length - start);
+        return length;
+    }
+    else
+    {
+        for (; length < size; ++length)
+        {
+            const char32_t value = Traits::value(data[length]);
+            if (value < U'0' || value > U'9') break;
+            overflow = overflow || !append_decimal_digit(magnitude, value - U'0');
+        }
+        return length;
+    }
+}
+
+/**
+ * @brief Convert a magnitude and sign to T.
+ *
+ * @return false if the signed value is outside the range of T.
+ */
+template <ParseableInteger T, typename M>
+constexpr bool decimal_magnitude_to_integer(const M& magnitude, bool negative, T& value) noexcept
+{
+    if constexpr (std::same_as<T, bigint_t>)
+        value = negative ? -magnitude : magnitude;
+    else if constexpr (std::same_as<T, uint128_t>)
+    {
+        if (negative && magnitude != uint128_t{}) return false;
+        value = magnitude;
+    }
+    else if constexpr (WideInteger<T>)
+    {
+        // The most negative signed value is the one magnitude past the maximum.
+        if constexpr (T::is_signed)
+        {
+            const M limit = M{1} << (T::bits - 1);
+            if (negative ? magnitude > limit : magnitude >= limit) return false;
+        }
+        else if (negative && magnitude != M{})
+            return false;
+        value = T{negative ? -magnitude : magnitude};
+    }
+    else
+    {
+        using Unsigned = std::make_unsigned_t<T>;
+        std::uint64_t limit = static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+        if (negative) limit = std::is_signed_v<T> ? limit + 1 : 0;
+        if (magnitude > limit) return false;
+        const auto bits = static_cast<Unsigned>(magnitude);
+        value = static_cast<T>(negative ? static_cast<Unsigned>(Unsigned{0} - bits) : bits);
+    }
+    return true;
+}
+
+/**
+ * @brief Parse the digits at a position with a known sign, shared by the public parsing operations.
+ *
+ * @param start The position reported if there are no digits.
+ */
+template <ParseableInteger T, SequenceInput R>
+constexpr IntegerParseResult<T> parse_signed_ascii_digits(R&& input, std::size_t position, std::size_t start, bool negative)
+{
+    const auto* data = std::ranges::data(input);
+    const std::size_t size = std::ranges::size(input);
+    if (position >= size) return {Number<T>{}, start, IntegerParseError::NoDigits};
+
+    decimal_magnitude_t<T> magnitude{};
+    bool overflow = false;
+    const std::size_t length = accumulate_decimal_digits(data + position, size - position, magnitude, overflow);
+    if (length == 0) return {Number<T>{}, start, IntegerParseError::NoDigits};
+
+    // The value is only written when it is in range, so it stays zero on failure.
+    T value{};
+    const bool in_range = !overflow && decimal_magnitude_to_integer(magnitude, negative, value);
+    return {Number<T>{value}, position + length, in_range ? IntegerParseError::None : IntegerParseError::OutOfRange};
+}
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <ParseableInteger T, SequenceInput R>
+constexpr IntegerParseResult<T> parse_ascii_digits(R&& input, std::size_t position)
+{
+    return parse_signed_ascii_digits<T>(input, position, position, false);
+}
+
+template <ParseableInteger T, SequenceInput R>
+constexpr IntegerParseResult<T> parse_integer(R&& input)
+{
+    using Traits = SequenceElementTraits<std::ranges::range_value_t<R>>;
+
+    const auto* data = std::ranges::data(input);
+    const std::size_t size = std::ranges::size(input);
+    std::size_t position = 0;
+    skip_ascii_whitespace(input, position);
+
+    bool negative = false;
+    if (position < size)
+    {
+        const char32_t sign = Traits::value(data[position]);
+        if (sign == U'-' || sign == U'+')
+        {
+            negative = sign == U'-';
+            ++position;
+        }
+    }
+    return parse_signed_ascii_digits<T>(input, position, 0, negative);
+}
+
+template <ParseableInteger T, SequenceInput R>
+constexpr IntegerParseResult<T> parse_non_negative_integer(R&& input)
+{
+    IntegerParseResult<T> result = parse_integer<T>(input);
+    if constexpr (std::numeric_limits<T>::is_signed)
+    {
+        if (result && result.value.get_value() < T{})
+        {
+            result.value = Number<T>{};
+            result.error = IntegerParseError::OutOfRange;
+        }
+    }
+    return result;
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_OPERATION_PARSEINTEGER_PARSEINTEGER_HPP
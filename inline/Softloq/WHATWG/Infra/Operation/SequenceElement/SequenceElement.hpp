@@ -0,0 +1,196 @@
+/**
+ * @file Softloq/WHATWG/Infra/Operation/SequenceElement/SequenceElement.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the SequenceElement traits for the WHATWG Infra library, describing the element types that string and byte sequence operations accept.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the SequenceElement traits for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_OPERATION_SEQUENCEELEMENT_SEQUENCEELEMENT_HPP
+#define SOFTLOQ_WHATWG_INFRA_OPERATION_SEQUENCEELEMENT_SEQUENCEELEMENT_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Byte/Byte.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/CodePoint/CodePoint.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/CodeUnit/CodeUnit.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief The SequenceElementTraits template describes an element of a byte, code unit or code point sequence.
+ *
+ * Each specialization provides:
+ * - unit_type: the raw storage unit (std::uint8_t, char16_t or char32_t) the element corresponds to.
+ * - is_raw: true if the element is itself a raw unit whose storage can be scanned by the vectorized kernels.
+ * - value(): the element's value as a code point (bytes and code units map to the code point of equal value).
+ * - from_value(): the element holding a code point value; the value must fit the element type.
+ *
+ * @tparam T The element type.
+ */
+template <typename T>
+struct SequenceElementTraits;
+
+template <>
+struct SequenceElementTraits<std::uint8_t>
+{
+    using unit_type = std::uint8_t;
+    static constexpr bool is_raw = true;
+    [[nodiscard]] static constexpr char32_t value(std::uint8_t element) noexcept { return element; }
+    [[nodiscard]] static constexpr std::uint8_t from_value(char32_t value) noexcept { return static_cast<std::uint8_t>(value); }
+};
+
+template <>
+struct SequenceElementTraits<char>
+{
+    using unit_type = std::uint8_t;
+    static constexpr bool is_raw = true;
+    [[nodiscard]] static constexpr char32_t value(char element) noexcept { return static_cast<unsigned char>(element); }
+    [[nodiscard]] static constexpr char from_value(char32_t value) noexcept { return static_cast<char>(value); }
+};
+
+template <>
+struct SequenceElementTraits<char8_t>
+{
+    using unit_type = std::uint8_t;
+    static constexpr bool is_raw = true;
+    [[nodiscard]] static constexpr char32_t value(char8_t element) noexcept { return element; }
+    [[nodiscard]] static constexpr char8_t from_value(char32_t value) noexcept { return static_cast<char8_t>(value); }
+};
+
+template <>
+struct SequenceElementTraits<char16_t>
+{
+    using unit_type = char16_t;
+    static constexpr bool is_raw = true;
+    [[nodiscard]] static constexpr char32_t value(char16_t element) noexcept { return element; }
+    [[nodiscard]] static constexpr char16_t from_value(char32_t value) noexcept { return static_cast<char16_t>(value); }
+};
+
+template <>
+struct SequenceElementTraits<char32_t>
+{
+    using unit_type = char32_t;
+    static constexpr bool is_raw = true;
+    [[nodiscard]] static constexpr char32_t value(char32_t element) noexcept { return element; }
+    [[nodiscard]] static constexpr char32_t from_value(char32_t value) noexcept { return value; }
+};
+
+template <>
+struct SequenceElementTraits<Byte>
+{
+    using unit_type = std::uint8_t;
+    static constexpr bool is_raw = false;
+    [[nodiscard]] static constexpr char32_t value(const Byte& element) noexcept { return element.get_value(); }
+    [[nodiscard]] static constexpr Byte from_value(char32_t value) noexcept { return Byte{static_cast<std::uint8_t>(value)}; }
+};
+
+template <>
+struct SequenceElementTraits<CodeUnit>
+{
+    using unit_type = char16_t;
+    static constexpr bool is_raw = false;
+    [[nodiscard]] static constexpr char32_t value(const CodeUnit& element) noexcept { return element.get_value(); }
+    [[nodiscard]] static constexpr CodeUnit from_value(char32_t value) noexcept { return CodeUnit{static_cast<std::uint16_t>(value)}; }
+};
+
+template <>
+struct SequenceElementTraits<CodePoint>
+{
+    using unit_type = char32_t;
+    static constexpr bool is_raw = false;
+    [[nodiscard]] static constexpr char32_t value(const CodePoint& element) noexcept { return element.get_value(); }
+    [[nodiscard]] static constexpr CodePoint from_value(char32_t value) noexcept { return CodePoint{value}; }
+};
+
+/**
+ * @brief Concept for types that can be an element of a byte, code unit or code point sequence.
+ */
+template <typename T>
+concept SequenceElement = requires(const T& element)
+{
+    typename SequenceElementTraits<T>::unit_type;
+    { SequenceElementTraits<T>::is_raw } -> std::convertible_to<bool>;
+    { SequenceElementTraits<T>::value(element) } -> std::same_as<char32_t>;
+    { SequenceElementTraits<T>::from_value(char32_t{}) } -> std::same_as<T>;
+};
+
+/**
+ * @brief A code point decoded from a sequence, and the number of elements that encode it.
+ */
+struct DecodedCodePoint
+{
+    char32_t value{U'\0'};
+    std::size_t length{1};
+};
+
+/**
+ * @brief Decodes the code point starting at an index of a sequence.
+ *
+ * Bytes, code points and lone surrogates decode to themselves in one element. In UTF-16 input, a
+ * leading surrogate followed by a trailing surrogate decodes to the supplementary code point the
+ * pair encodes, in two elements.
+ *
+ * @param data The first element of the sequence.
+ * @param size The number of elements in the sequence.
+ * @param index The index of the first element of the code point; must be less than size.
+ */
+template <SequenceElement E>
+[[nodiscard]] constexpr DecodedCodePoint decode_code_point(const E* data, std::size_t size, std::size_t index) noexcept
+{
+    using Traits = SequenceElementTraits<E>;
+    const char32_t value = Traits::value(data[index]);
+    if constexpr (sizeof(typename Traits::unit_type) == 2)
+    {
+        if (value >= 0xD800 && value <= 0xDBFF && index + 1 < size)
+        {
+            const char32_t trailing = Traits::value(data[index + 1]);
+            if (trailing >= 0xDC00 && trailing <= 0xDFFF)
+                return {0x10000 + ((value - 0xD800) << 10) + (trailing - 0xDC00), 2};
+        }
+    }
+    return {value, 1};
+}
+
+/**
+ * @brief Concept for contiguous ranges of sequence elements, such as ByteSequence, std::u16string_view or std::span<const CodePoint>.
+ */
+template <typename R>
+concept SequenceInput =
+    std::ranges::contiguous_range<R>
+    && std::ranges::sized_range<R>
+    && SequenceElement<std::ranges::range_value_t<R>>;
+
+/**
+ * @brief Concept for sequence inputs that a non-owning view may safely be taken from (lvalues and borrowed ranges).
+ */
+template <typename R>
+concept ViewableSequenceInput =
+    SequenceInput<R>
+    && (std::is_lvalue_reference_v<R> || std::ranges::borrowed_range<R>);
+
+/**
+ * @brief Concept for sequence inputs whose elements may be rewritten in place, such as std::u16string& or std::span<char32_t>.
+ */
+template <typename R>
+concept MutableSequenceInput =
+    SequenceInput<R>
+    && std::is_same_v<std::ranges::range_reference_t<R>, std::ranges::range_value_t<R>&>;
+
+/**
+ * @brief Concept for mutable sequences that in-place operations may rewrite and shrink, such as ByteSequence, std::u16string or std::vector<CodePoint>.
+ */
+template <typename S>
+concept ResizableSequence =
+    MutableSequenceInput<S&>
+    && requires(S& sequence, std::size_t size) { sequence.resize(size); };
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_OPERATION_SEQUENCEELEMENT_SEQUENCEELEMENT_HPP
@@ -23,7 +23,7 @@ namespace Softloq::WHATWG::Infra
  * It provides value construction, mutation, logical negation, equality comparison,
  * and implicit conversion to the underlying bool type.
  */
-class Boolean final : public Primitive
+class Boolean final : public Primitive<PrimitiveType::Boolean>
 {
 // Constructors and destructor
 public:
@@ -36,18 +36,6 @@ public:
 
     constexpr ~Boolean() noexcept = default;
 
-// Primitive interface
-public:
-    /**
-     * @brief Get the type of the primitive.
-     *
-     * @return The type of the primitive, which is PrimitiveType::Boolean.
-     */
-    [[nodiscard]] constexpr PrimitiveType get_type() const noexcept override
-    {
-        return PrimitiveType::Boolean;
-    }
-
 // Accessors
 public:
     /**
@@ -24,7 +24,7 @@ namespace Softloq::WHATWG::Infra
  * specification. It provides value construction, mutation, equality comparison,
  * and explicit conversion to the underlying std::uint8_t type.
  */
-class Byte final : public Primitive
+class Byte final : public Primitive<PrimitiveType::Byte>
 {
 // Constructors and destructor
 public:
@@ -35,25 +35,8 @@ public:
     {
     }
 
-    constexpr Byte(const Byte& other) noexcept
-        : m_value{other.m_value}
-    {
-    }
-
     constexpr ~Byte() noexcept = default;
 
-// Primitive interface
-public:
-    /**
-     * @brief Get the type of the primitive.
-     *
-     * @return The type of the primitive, which is PrimitiveType::Byte.
-     */
-    [[nodiscard]] constexpr PrimitiveType get_type() const noexcept override
-    {
-        return PrimitiveType::Byte;
-    }
-
 // Accessors
 public:
     /**
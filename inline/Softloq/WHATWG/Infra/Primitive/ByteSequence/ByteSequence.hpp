@@ -13,8 +13,13 @@
 
 #include "Softloq/WHATWG/Infra/Primitive/Primitive.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Byte/Byte.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace Softloq::WHATWG::Infra
@@ -25,10 +30,9 @@ namespace Softloq::WHATWG::Infra
  *
  * The ByteSequence type represents a sequence of zero or more bytes, as defined by the WHATWG
  * Infra specification. It provides construction, element access, mutation, WHATWG Infra operations
- * (byte_lowercase, byte_uppercase, starts_with), and equality comparison. Isomorphic decode is
- * omitted until the String primitive is available.
+ * (byte_lowercase, byte_uppercase, starts_with, isomorphic_decode), and equality comparison.
  */
-class ByteSequence final : public Primitive
+class ByteSequence final : public Primitive<PrimitiveType::ByteSequence>
 {
 // Constructors and destructor
 public:
@@ -48,18 +52,6 @@ public:
 
     constexpr ~ByteSequence() noexcept = default;
 
-// Primitive interface
-public:
-    /**
-     * @brief Get the type of the primitive.
-     *
-     * @return The type of the primitive, which is PrimitiveType::ByteSequence.
-     */
-    [[nodiscard]] constexpr PrimitiveType get_type() const noexcept override
-    {
-        return PrimitiveType::ByteSequence;
-    }
-
 // Container interface
 public:
     /**
@@ -146,6 +138,16 @@ public:
         m_bytes.clear();
     }
 
+    /**
+     * @brief Resize the sequence to the given number of bytes, appending 0x00 bytes when growing.
+     *
+     * @param size The new number of bytes.
+     */
+    constexpr void resize(std::size_t size)
+    {
+        m_bytes.resize(size);
+    }
+
     /**
      * @brief Returns an iterator to the first byte of the sequence.
      */
@@ -270,6 +272,22 @@ public:
         return true;
     }
 
+    /**
+     * @brief Isomorphic decode the byte sequence into a String.
+     *
+     * Isomorphic decode maps each byte to the code point of equal value, as defined by the WHATWG
+     * Infra specification. Use IsomorphicStringView to compare or search the decoded String without
+     * materializing it.
+     *
+     * @return An 8-bit String whose code units are the bytes of this sequence.
+     */
+    [[nodiscard]] constexpr String isomorphic_decode() const
+    {
+        String::Latin1Buffer bytes(m_bytes.size());
+        std::ranges::transform(m_bytes, bytes.begin(), [](const Byte& byte) { return byte.get_value(); });
+        return String::from_buffer(std::move(bytes));
+    }
+
 private:
     std::vector<Byte> m_bytes;
 };
@@ -24,7 +24,7 @@ namespace Softloq::WHATWG::Infra
  * equality comparison, explicit conversion to the underlying char32_t type, and a full set
  * of Unicode attribute predicates (e.g. is_surrogate, is_ascii, is_ascii_whitespace).
  */
-class CodePoint final : public Primitive
+class CodePoint final : public Primitive<PrimitiveType::CodePoint>
 {
 // Constructors and destructor
 public:
@@ -37,18 +37,6 @@ public:
 
     constexpr ~CodePoint() noexcept = default;
 
-// Primitive interface
-public:
-    /**
-     * @brief Get the type of the primitive.
-     *
-     * @return The type of the primitive, which is PrimitiveType::CodePoint.
-     */
-    [[nodiscard]] constexpr PrimitiveType get_type() const noexcept override
-    {
-        return PrimitiveType::CodePoint;
-    }
-
 // Accessors
 public:
     /**
@@ -29,7 +29,7 @@ namespace Softloq::WHATWG::Infra
  * @note This is an auxiliary class to the String primitive. It is used internally by the
  * String type to represent individual elements of a UTF-16 encoded string.
  */
-class CodeUnit final : public Primitive
+class CodeUnit final : public Primitive<PrimitiveType::CodeUnit>
 {
 // Constructors and destructor
 public:
@@ -42,18 +42,6 @@ public:
 
     constexpr ~CodeUnit() noexcept = default;
 
-// Primitive interface
-public:
-    /**
-     * @brief Get the type of the primitive.
-     *
-     * @return The type of the primitive, which is PrimitiveType::CodeUnit.
-     */
-    [[nodiscard]] constexpr PrimitiveType get_type() const noexcept override
-    {
-        return PrimitiveType::CodeUnit;
-    }
-
 // Accessors
 public:
     /**
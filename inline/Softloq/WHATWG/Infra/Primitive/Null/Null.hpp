@@ -22,23 +22,12 @@ namespace Softloq::WHATWG::Infra
  * The Null type represents a null value in the context of web APIs.
  * It is used to indicate the absence of a value or a null reference.
  */
-class Null final : public Primitive
+class Null final : public Primitive<PrimitiveType::Null>
 {
 // Constructors and destructor
 public:
     constexpr Null() noexcept = default;
     constexpr ~Null() noexcept = default;
-
-public:
-    /**
-     * @brief Get the type of the primitive.
-     * 
-     * @return The type of the primitive, which is PrimitiveType::Null.
-     */
-    [[nodiscard]] constexpr PrimitiveType get_type() const noexcept override
-    {
-        return PrimitiveType::Null;
-    }
 };
 
 } // namespace Softloq::WHATWG::Infra
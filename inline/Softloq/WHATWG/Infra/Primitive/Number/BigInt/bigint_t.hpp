@@ -0,0 +1,861 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/BigInt/bigint_t.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the bigint_t type, a signed integer of arbitrary precision.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines bigint_t, its std::numeric_limits and its output stream operator.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_BIGINT_BIGINT_T_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_BIGINT_BIGINT_T_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/uint128_t.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief A signed integer of arbitrary precision, stored as a sign and a magnitude of 64-bit limbs, least significant first.
+ *
+ * Magnitudes of up to two limbs (128 bits) are stored inside the object, so small values never
+ * allocate; larger ones move to a heap buffer and back when they shrink. Addition and subtraction
+ * run one carry chain over the limbs. Multiplication is schoolbook below karatsuba_threshold limbs
+ * and Karatsuba above it, splitting the longer operand into blocks when the operands are unbalanced.
+ * Division is a one-limb short division or Knuth's algorithm D, truncating towards zero like the
+ * built-in types; dividing by zero throws std::domain_error. Shifts act as on an infinitely wide
+ * two's complement value: << multiplies by 2^n and >> divides by 2^n rounding down. Decimal
+ * conversion peels off nineteen digits per pass over the limbs, dividing by 10^19 with a
+ * precomputed reciprocal instead of a hardware divide.
+ */
+class bigint_t final
+{
+public:
+    /**
+     * @brief The number of limbs stored inside the object before the magnitude moves to the heap.
+     */
+    static constexpr std::size_t inline_limbs = 2;
+
+    /**
+     * @brief The operand size, in limbs, from which multiplication switches from schoolbook to Karatsuba.
+     */
+    static constexpr std::size_t karatsuba_threshold = 32;
+
+// Constructors and destructor
+public:
+    constexpr bigint_t() noexcept = default;
+
+    /**
+     * @brief Construct from a built-in integer.
+     *
+     * @param value The value.
+     */
+    template <std::integral T>
+    constexpr bigint_t(T value) noexcept;
+
+    /**
+     * @brief Construct from a uint128_t.
+     *
+     * @param value The value.
+     */
+    constexpr explicit bigint_t(const uint128_t& value) noexcept;
+
+    /**
+     * @brief Construct from a WideInt, reading a signed one as two's complement.
+     *
+     * @param value The value.
+     */
+    template <std::size_t Bits, bool Signed>
+    constexpr explicit bigint_t(const WideInt<Bits, Signed>& value);
+
+    /**
+     * @brief Build a value from the limbs of its magnitude and its sign.
+     *
+     * @param limbs The limbs of the magnitude, least significant first. Leading zero limbs are dropped.
+     * @param negative Whether the value is negative. Ignored for a zero magnitude.
+     * @return The value.
+     */
+    [[nodiscard]] static constexpr bigint_t from_limbs(std::span<const std::uint64_t> limbs, bool negative = false);
+
+// Accessors
+public:
+    /**
+     * @brief Get the limbs of the magnitude, least significant first, without leading zero limbs.
+     *
+     * @return The limbs; empty for zero.
+     */
+    [[nodiscard]] constexpr std::span<const std::uint64_t> limbs() const noexcept;
+
+    /**
+     * @brief Returns true if the value is below zero.
+     */
+    [[nodiscard]] constexpr bool is_negative() const noexcept;
+
+    /**
+     * @brief Returns true if the magnitude is stored inside the object, which it is whenever it fits in 128 bits.
+     */
+    [[nodiscard]] constexpr bool is_inline() const noexcept;
+
+    /**
+     * @brief Get the number of bits of the magnitude.
+     *
+     * @return The position of the highest set bit plus one; 0 for zero.
+     */
+    [[nodiscard]] constexpr std::size_t bit_width() const noexcept;
+
+    /**
+     * @brief Convert to a built-in integer, keeping the low bits of the two's complement value.
+     */
+    template <std::integral T>
+    [[nodiscard]] constexpr explicit operator T() const noexcept;
+
+    /**
+     * @brief Convert to a uint128_t, keeping the low 128 bits of the two's complement value.
+     */
+    [[nodiscard]] constexpr explicit operator uint128_t() const noexcept;
+
+    /**
+     * @brief Convert to a WideInt, keeping the low Bits bits of the two's complement value.
+     */
+    template <std::size_t Bits, bool Signed>
+    [[nodiscard]] constexpr explicit operator WideInt<Bits, Signed>() const noexcept;
+
+    /**
+     * @brief Returns true if the value is not zero.
+     */
+    [[nodiscard]] constexpr explicit operator bool() const noexcept;
+
+// Decimal conversion
+public:
+    /**
+     * @brief Write the value in decimal, with a leading '-' if it is negative.
+     *
+     * @return The decimal digits.
+     */
+    [[nodiscard]] constexpr std::string to_decimal() const;
+
+    /**
+     * @brief Multiply a non-negative value by a word and add a word, in place, as decimal parsing does per chunk of digits.
+     *
+     * @param factor The word to multiply by.
+     * @param addend The word to add.
+     */
+    constexpr void multiply_add(std::uint64_t factor, std::uint64_t addend);
+
+// Full-width arithmetic
+public:
+    /**
+     * @brief Divide, producing the quotient and the remainder in one step.
+     *
+     * The quotient truncates towards zero, and the remainder takes the sign of the dividend.
+     *
+     * @param dividend The dividend.
+     * @param divisor The divisor.
+     * @param remainder Receives dividend % divisor.
+     * @return dividend / divisor.
+     * @throws std::domain_error if divisor is zero.
+     */
+    [[nodiscard]] static constexpr bigint_t divide(const bigint_t& dividend, const bigint_t& divisor, bigint_t& remainder);
+
+// Comparison operators
+public:
+    friend constexpr bool operator==(const bigint_t& lhs, const bigint_t& rhs) noexcept
+    {
+        return lhs.m_negative == rhs.m_negative && std::ranges::equal(lhs.limbs(), rhs.limbs());
+    }
+
+    friend constexpr std::strong_ordering operator<=>(const bigint_t& lhs, const bigint_t& rhs) noexcept
+    {
+        if (lhs.m_negative != rhs.m_negative) return lhs.m_negative ? std::strong_ordering::less : std::strong_ordering::greater;
+        const std::strong_ordering magnitude = compare_limbs(lhs.limb_data(), lhs.m_size, rhs.limb_data(), rhs.m_size);
+        return lhs.m_negative ? 0 <=> magnitude : magnitude;
+    }
+
+// Arithmetic operator requirements
+public:
+    [[nodiscard]] constexpr bigint_t operator+(const bigint_t& other) const;
+    [[nodiscard]] constexpr bigint_t operator-(const bigint_t& other) const;
+    [[nodiscard]] constexpr bigint_t operator*(const bigint_t& other) const;
+    [[nodiscard]] constexpr bigint_t operator/(const bigint_t& other) const;
+    [[nodiscard]] constexpr bigint_t operator%(const bigint_t& other) const;
+    [[nodiscard]] constexpr bigint_t operator-() const;
+
+    constexpr bigint_t& operator+=(const bigint_t& other) { *this = *this + other; return *this; }
+    constexpr bigint_t& operator-=(const bigint_t& other) { *this = *this - other; return *this; }
+    constexpr bigint_t& operator*=(const bigint_t& other) { *this = *this * other; return *this; }
+    constexpr bigint_t& operator/=(const bigint_t& other) { *this = *this / other; return *this; }
+    constexpr bigint_t& operator%=(const bigint_t& other) { *this = *this % other; return *this; }
+
+    constexpr bigint_t& operator++() { *this += bigint_t{1}; return *this; }
+    constexpr bigint_t operator++(int) { bigint_t copy = *this; ++(*this); return copy; }
+    constexpr bigint_t& operator--() { *this -= bigint_t{1}; return *this; }
+    constexpr bigint_t operator--(int) { bigint_t copy = *this; --(*this); return copy; }
+
+// Shift operators
+public:
+    /**
+     * @brief Multiply by 2^shift.
+     */
+    [[nodiscard]] constexpr bigint_t operator<<(int shift) const;
+
+    /**
+     * @brief Divide by 2^shift, rounding towards negative infinity.
+     */
+    [[nodiscard]] constexpr bigint_t operator>>(int shift) const;
+
+    constexpr bigint_t& operator<<=(int shift) { *this = *this << shift; return *this; }
+    constexpr bigint_t& operator>>=(int shift) { *this = *this >> shift; return *this; }
+
+private:
+    /**
+     * @brief The limbs of the magnitude: inside the object up to inline_limbs, on the heap above.
+     */
+    [[nodiscard]] constexpr const std::uint64_t* limb_data() const noexcept;
+    [[nodiscard]] constexpr std::uint64_t* limb_data() noexcept;
+
+    /**
+     * @brief Resize the magnitude to size limbs, keeping the limbs below both sizes and zeroing new ones.
+     *
+     * @return The limbs.
+     */
+    constexpr std::uint64_t* resize_limbs(std::size_t size);
+
+    /**
+     * @brief Drop leading zero limbs, moving the magnitude back inside the object if it now fits, and clear the sign of zero.
+     */
+    constexpr void normalize() noexcept;
+
+    /**
+     * @brief Set the magnitude from a heap buffer of limbs, taking it over when it does not fit inside the object.
+     */
+    constexpr void assign_limbs(std::vector<std::uint64_t>&& limbs, bool negative);
+
+    /**
+     * @brief The sum of two values when their signs are given, so subtraction is an addition with the sign flipped.
+     */
+    [[nodiscard]] static constexpr bigint_t add_signed(const bigint_t& lhs, const bigint_t& rhs, bool rhs_negative);
+
+    /**
+     * @brief Compare two magnitudes without leading zero limbs.
+     */
+    [[nodiscard]] static constexpr std::strong_ordering compare_limbs(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size) noexcept;
+
+    /**
+     * @brief out = lhs + rhs over lhs_size limbs, where lhs_size >= rhs_size. out may be lhs.
+     *
+     * @return The carry out of the top limb.
+     */
+    static constexpr std::uint64_t add_limbs(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size, std::uint64_t* out) noexcept;
+
+    /**
+     * @brief out = lhs - rhs over lhs_size limbs, where lhs_size >= rhs_size and lhs >= rhs. out may be lhs.
+     */
+    static constexpr void subtract_limbs(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size, std::uint64_t* out) noexcept;
+
+    /**
+     * @brief out = lhs * rhs over lhs_size + rhs_size limbs, schoolbook or Karatsuba by size. out must not overlap the operands.
+     */
+    static constexpr void multiply_limbs(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size, std::uint64_t* out);
+
+    /**
+     * @brief The schoolbook multiplication of multiply_limbs().
+     */
+    static constexpr void multiply_schoolbook(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size, std::uint64_t* out) noexcept;
+
+    /**
+     * @brief The Karatsuba multiplication of multiply_limbs(), for lhs_size >= rhs_size > lhs_size / 2.
+     */
+    static constexpr void multiply_karatsuba(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size, std::uint64_t* out);
+
+    /**
+     * @brief quotient = dividend / divisor for a one-limb divisor. quotient may be dividend.
+     *
+     * @return The remainder.
+     */
+    static constexpr std::uint64_t divide_limb(const std::uint64_t* dividend, std::size_t size, std::uint64_t divisor, std::uint64_t* quotient) noexcept;
+
+    /**
+     * @brief quotient = dividend / 10^19, one multiply by the reciprocal of 10^19 per limb. quotient may be dividend.
+     *
+     * @return The remainder.
+     */
+    static constexpr std::uint64_t divide_ten_pow_19(const std::uint64_t* dividend, std::size_t size, std::uint64_t* quotient) noexcept;
+
+    /**
+     * @brief Knuth's algorithm D, for dividend_size >= divisor_size >= 2.
+     *
+     * @param quotient Receives dividend_size - divisor_size + 1 limbs.
+     * @param remainder Receives divisor_size limbs.
+     */
+    static constexpr void divide_limbs(const std::uint64_t* dividend, std::size_t dividend_size, const std::uint64_t* divisor, std::size_t divisor_size, std::uint64_t* quotient, std::uint64_t* remainder);
+
+    std::array<std::uint64_t, inline_limbs> m_inline{};
+    std::vector<std::uint64_t> m_heap;
+    std::size_t m_size = 0;
+    bool m_negative = false;
+};
+
+/**
+ * @brief Output stream operator for bigint_t, writing its decimal form.
+ */
+inline std::ostream& operator<<(std::ostream& os, const bigint_t& value)
+{
+    return os << value.to_decimal();
+}
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <std::integral T>
+constexpr bigint_t::bigint_t(T value) noexcept
+{
+    using Unsigned = std::make_unsigned_t<T>;
+    auto magnitude = static_cast<Unsigned>(value);
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (value < 0)
+        {
+            m_negative = true;
+            magnitude = static_cast<Unsigned>(Unsigned{0} - magnitude);
+        }
+    }
+    m_inline[0] = magnitude;
+    m_size = magnitude != 0 ? 1 : 0;
+}
+
+constexpr bigint_t::bigint_t(const uint128_t& value) noexcept
+{
+    m_inline = {value.low(), value.high()};
+    m_size = value.high() != 0 ? 2 : (value.low() != 0 ? 1 : 0);
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr bigint_t::bigint_t(const WideInt<Bits, Signed>& value)
+{
+    const WideInt<Bits, false> magnitude{value.is_negative() ? -value : value};
+    *this = from_limbs(magnitude.words(), value.is_negative());
+}
+
+constexpr bigint_t bigint_t::from_limbs(std::span<const std::uint64_t> limbs, bool negative)
+{
+    bigint_t result;
+    std::ranges::copy(limbs, result.resize_limbs(limbs.size()));
+    result.m_negative = negative;
+    result.normalize();
+    return result;
+}
+
+constexpr std::span<const std::uint64_t> bigint_t::limbs() const noexcept { return {limb_data(), m_size}; }
+
+constexpr bool bigint_t::is_negative() const noexcept { return m_negative; }
+
+constexpr bool bigint_t::is_inline() const noexcept { return m_size <= inline_limbs; }
+
+constexpr std::size_t bigint_t::bit_width() const noexcept
+{
+    return m_size == 0 ? 0 : 64 * (m_size - 1) + static_cast<std::size_t>(std::bit_width(limb_data()[m_size - 1]));
+}
+
+template <std::integral T>
+constexpr bigint_t::operator T() const noexcept
+{
+    using Unsigned = std::make_unsigned_t<T>;
+    const auto low = static_cast<Unsigned>(m_size != 0 ? limb_data()[0] : 0);
+    return static_cast<T>(m_negative ? static_cast<Unsigned>(Unsigned{0} - low) : low);
+}
+
+constexpr bigint_t::operator uint128_t() const noexcept
+{
+    const std::uint64_t* limbs = limb_data();
+    const uint128_t magnitude{m_size > 1 ? limbs[1] : 0, m_size > 0 ? limbs[0] : 0};
+    return m_negative ? uint128_t{} - magnitude : magnitude;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr bigint_t::operator WideInt<Bits, Signed>() const noexcept
+{
+    typename WideInt<Bits, Signed>::words_type words{};
+    std::copy_n(limb_data(), std::min(m_size, words.size()), words.begin());
+    const auto magnitude = WideInt<Bits, Signed>::from_words(words);
+    return m_negative ? -magnitude : magnitude;
+}
+
+constexpr bigint_t::operator bool() const noexcept { return m_size != 0; }
+
+constexpr std::string bigint_t::to_decimal() const
+{
+    const std::uint64_t* limbs = limb_data();
+    if (m_size <= 2)
+    {
+        char buffer[1 + max_decimal_length<uint128_t>]{};
+        char* out = buffer;
+        if (m_negative) *out++ = '-';
+        out = write_decimal(out, uint128_t{m_size > 1 ? limbs[1] : 0, m_size > 0 ? limbs[0] : 0});
+        return std::string(buffer, out);
+    }
+
+    // Divide nineteen digits off the bottom per pass, until the rest fits in 128 bits.
+    std::vector<std::uint64_t> rest(limbs, limbs + m_size);
+    std::vector<std::uint64_t> chunks;
+    chunks.reserve(64 * m_size / 63 + 1);
+    std::size_t size = m_size;
+    while (size > 2)
+    {
+        chunks.push_back(divide_ten_pow_19(rest.data(), size, rest.data()));
+        while (rest[size - 1] == 0) --size;
+    }
+
+    std::string result(static_cast<std::size_t>(m_negative) + max_decimal_length<uint128_t> + 19 * chunks.size(), '\0');
+    char* out = result.data();
+    if (m_negative) *out++ = '-';
+    out = write_decimal(out, uint128_t{size > 1 ? rest[1] : 0, rest[0]});
+    for (auto chunk = chunks.rbegin(); chunk != chunks.rend(); ++chunk) out = write_decimal_19_digits(out, *chunk);
+    result.resize(static_cast<std::size_t>(out - result.data()));
+    return result;
+}
+
+constexpr void bigint_t::multiply_add(std::uint64_t factor, std::uint64_t addend)
+{
+    std::uint64_t carry = addend;
+    std::uint64_t* limbs = limb_data();
+    for (std::size_t index = 0; index < m_size; ++index)
+    {
+        const uint128_t product = uint128_t::multiply(limbs[index], factor) + uint128_t{carry};
+        limbs[index] = product.low();
+        carry = product.high();
+    }
+    if (carry != 0) resize_limbs(m_size + 1)[m_size - 1] = carry;
+    normalize();
+}
+
+constexpr bigint_t bigint_t::divide(const bigint_t& dividend, const bigint_t& divisor, bigint_t& remainder)
+{
+    if (divisor.m_size == 0) throw std::domain_error("bigint_t division by zero");
+    const bool negative = dividend.m_negative != divisor.m_negative;
+    if (compare_limbs(dividend.limb_data(), dividend.m_size, divisor.limb_data(), divisor.m_size) < 0)
+    {
+        remainder = dividend;
+        return bigint_t{};
+    }
+
+    bigint_t quotient;
+    if (dividend.m_size <= 2)
+    {
+        // Both magnitudes fit in 128 bits.
+        uint128_t low_remainder;
+        const uint128_t low_quotient = uint128_t::divide(static_cast<uint128_t>(dividend.m_negative ? -dividend : dividend), static_cast<uint128_t>(divisor.m_negative ? -divisor : divisor), low_remainder);
+        quotient = bigint_t{low_quotient};
+        remainder = bigint_t{low_remainder};
+    }
+    else if (divisor.m_size == 1)
+    {
+        const std::uint64_t low_remainder = divide_limb(dividend.limb_data(), dividend.m_size, divisor.limb_data()[0], quotient.resize_limbs(dividend.m_size));
+        remainder = bigint_t{low_remainder};
+    }
+    else
+    {
+        std::vector<std::uint64_t> quotient_limbs(dividend.m_size - divisor.m_size + 1);
+        std::vector<std::uint64_t> remainder_limbs(divisor.m_size);
+        divide_limbs(dividend.limb_data(), dividend.m_size, divisor.limb_data(), divisor.m_size, quotient_limbs.data(), remainder_limbs.data());
+        quotient.assign_limbs(std::move(quotient_limbs), false);
+        remainder.assign_limbs(std::move(remainder_limbs), false);
+    }
+    quotient.m_negative = negative;
+    quotient.normalize();
+    remainder.m_negative = dividend.m_negative;
+    remainder.normalize();
+    return quotient;
+}
+
+constexpr bigint_t bigint_t::operator+(const bigint_t& other) const { return add_signed(*this, other, other.m_negative); }
+
+constexpr bigint_t bigint_t::operator-(const bigint_t& other) const { return add_signed(*this, other, !other.m_negative); }
+
+constexpr bigint_t bigint_t::operator*(const bigint_t& other) const
+{
+    bigint_t result;
+    if (m_size == 0 || other.m_size == 0) return result;
+    const std::size_t size = m_size + other.m_size;
+    if (size <= 4)
+    {
+        // Products of inline magnitudes are built on the stack, so one that fits stays inline.
+        std::array<std::uint64_t, 4> product{};
+        multiply_schoolbook(limb_data(), m_size, other.limb_data(), other.m_size, product.data());
+        return from_limbs(std::span<const std::uint64_t>{product.data(), size}, m_negative != other.m_negative);
+    }
+    std::vector<std::uint64_t> product(size);
+    multiply_limbs(limb_data(), m_size, other.limb_data(), other.m_size, product.data());
+    result.assign_limbs(std::move(product), m_negative != other.m_negative);
+    return result;
+}
+
+constexpr bigint_t bigint_t::operator/(const bigint_t& other) const
+{
+    bigint_t remainder;
+    return divide(*this, other, remainder);
+}
+
+constexpr bigint_t bigint_t::operator%(const bigint_t& other) const
+{
+    bigint_t remainder;
+    static_cast<void>(divide(*this, other, remainder));
+    return remainder;
+}
+
+constexpr bigint_t bigint_t::operator-() const
+{
+    bigint_t result = *this;
+    result.m_negative = m_size != 0 && !m_negative;
+    return result;
+}
+
+constexpr bigint_t bigint_t::operator<<(int shift) const
+{
+    if (m_size == 0 || shift <= 0) return shift < 0 ? *this >> -shift : *this;
+    const auto limb_shift = static_cast<std::size_t>(shift) / 64;
+    const int bit_shift = shift % 64;
+    bigint_t result;
+    std::uint64_t* out = result.resize_limbs(m_size + limb_shift + 1);
+    const std::uint64_t* limbs = limb_data();
+    for (std::size_t index = 0; index < m_size; ++index)
+    {
+        out[index + limb_shift] |= limbs[index] << bit_shift;
+        if (bit_shift != 0) out[index + limb_shift + 1] = limbs[index] >> (64 - bit_shift);
+    }
+    result.m_negative = m_negative;
+    result.normalize();
+    return result;
+}
+
+constexpr bigint_t bigint_t::operator>>(int shift) const
+{
+    if (m_size == 0 || shift <= 0) return shift < 0 ? *this << -shift : *this;
+    const auto limb_shift = static_cast<std::size_t>(shift) / 64;
+    const int bit_shift = shift % 64;
+    if (limb_shift >= m_size) return m_negative ? bigint_t{-1} : bigint_t{};
+
+    const std::uint64_t* limbs = limb_data();
+    // A negative value rounds down, i.e. its magnitude rounds up when any bit is shifted out.
+    bool inexact = bit_shift != 0 && (limbs[limb_shift] << (64 - bit_shift)) != 0;
+    for (std::size_t index = 0; index < limb_shift && !inexact; ++index) inexact = limbs[index] != 0;
+
+    bigint_t result;
+    std::uint64_t* out = result.resize_limbs(m_size - limb_shift);
+    for (std::size_t index = limb_shift; index < m_size; ++index)
+    {
+        const std::uint64_t above = bit_shift != 0 && index + 1 < m_size ? limbs[index + 1] << (64 - bit_shift) : 0;
+        out[index - limb_shift] = (limbs[index] >> bit_shift) | above;
+    }
+    result.m_negative = m_negative;
+    result.normalize();
+    if (m_negative && inexact) --result;
+    return result;
+}
+
+constexpr const std::uint64_t* bigint_t::limb_data() const noexcept { return m_size <= inline_limbs ? m_inline.data() : m_heap.data(); }
+
+constexpr std::uint64_t* bigint_t::limb_data() noexcept { return m_size <= inline_limbs ? m_inline.data() : m_heap.data(); }
+
+constexpr std::uint64_t* bigint_t::resize_limbs(std::size_t size)
+{
+    if (size <= inline_limbs)
+    {
+        if (m_size > inline_limbs) std::copy_n(m_heap.begin(), size, m_inline.begin());
+        std::fill(m_inline.begin() + static_cast<std::ptrdiff_t>(std::min(m_size, size)), m_inline.end(), 0);
+    }
+    else if (m_size <= inline_limbs)
+    {
+        m_heap.assign(m_inline.begin(), m_inline.begin() + static_cast<std::ptrdiff_t>(m_size));
+        m_heap.resize(size);
+    }
+    else
+    {
+        m_heap.resize(size);
+        std::fill(m_heap.begin() + static_cast<std::ptrdiff_t>(std::min(m_size, size)), m_heap.end(), 0);
+    }
+    m_size = size;
+    return limb_data();
+}
+
+constexpr void bigint_t::normalize() noexcept
+{
+    const std::uint64_t* limbs = limb_data();
+    std::size_t size = m_size;
+    while (size != 0 && limbs[size - 1] == 0) --size;
+    if (m_size > inline_limbs && size <= inline_limbs) std::copy_n(m_heap.begin(), size, m_inline.begin());
+    m_size = size;
+    if (m_size == 0) m_negative = false;
+}
+
+constexpr void bigint_t::assign_limbs(std::vector<std::uint64_t>&& limbs, bool negative)
+{
+    m_size = limbs.size();
+    if (m_size <= inline_limbs)
+        std::ranges::copy(limbs, m_inline.begin());
+    else
+        m_heap = std::move(limbs);
+    m_negative = negative;
+    normalize();
+}
+
+constexpr bigint_t bigint_t::add_signed(const bigint_t& lhs, const bigint_t& rhs, bool rhs_negative)
+{
+    const std::strong_ordering order = compare_limbs(lhs.limb_data(), lhs.m_size, rhs.limb_data(), rhs.m_size);
+    const bigint_t& larger = order < 0 ? rhs : lhs;
+    const bigint_t& smaller = order < 0 ? lhs : rhs;
+    bigint_t result;
+    std::uint64_t* out = result.resize_limbs(larger.m_size);
+    if (lhs.m_negative == rhs_negative)
+    {
+        result.m_negative = lhs.m_negative;
+        const std::uint64_t carry = add_limbs(larger.limb_data(), larger.m_size, smaller.limb_data(), smaller.m_size, out);
+        if (carry != 0) result.resize_limbs(larger.m_size + 1)[larger.m_size] = carry;
+    }
+    else
+    {
+        // The difference of the magnitudes takes the sign of the larger one.
+        result.m_negative = order < 0 ? rhs_negative : lhs.m_negative;
+        subtract_limbs(larger.limb_data(), larger.m_size, smaller.limb_data(), smaller.m_size, out);
+    }
+    result.normalize();
+    return result;
+}
+
+constexpr std::strong_ordering bigint_t::compare_limbs(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size) noexcept
+{
+    if (lhs_size != rhs_size) return lhs_size <=> rhs_size;
+    for (std::size_t index = lhs_size; index-- > 0;)
+        if (lhs[index] != rhs[index]) return lhs[index] <=> rhs[index];
+    return std::strong_ordering::equal;
+}
+
+constexpr std::uint64_t bigint_t::add_limbs(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size, std::uint64_t* out) noexcept
+{
+    unsigned char carry = 0;
+    std::size_t index = 0;
+    for (; index < rhs_size; ++index) carry = add_with_carry(carry, lhs[index], rhs[index], out[index]);
+    for (; index < lhs_size; ++index) carry = add_with_carry(carry, lhs[index], 0, out[index]);
+    return carry;
+}
+
+constexpr void bigint_t::subtract_limbs(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size, std::uint64_t* out) noexcept
+{
+    unsigned char borrow = 0;
+    std::size_t index = 0;
+    for (; index < rhs_size; ++index) borrow = subtract_with_borrow(borrow, lhs[index], rhs[index], out[index]);
+    for (; index < lhs_size; ++index) borrow = subtract_with_borrow(borrow, lhs[index], 0, out[index]);
+}
+
+constexpr void bigint_t::multiply_limbs(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size, std::uint64_t* out)
+{
+    if (lhs_size < rhs_size)
+    {
+        std::swap(lhs, rhs);
+        std::swap(lhs_size, rhs_size);
+    }
+    if (rhs_size < karatsuba_threshold) return multiply_schoolbook(lhs, lhs_size, rhs, rhs_size, out);
+    if (2 * rhs_size > lhs_size) return multiply_karatsuba(lhs, lhs_size, rhs, rhs_size, out);
+
+    // Unbalanced: multiply rhs by each rhs_size-limb block of lhs, and add the partial products in.
+    std::fill(out, out + lhs_size + rhs_size, 0);
+    std::vector<std::uint64_t> partial(2 * rhs_size);
+    for (std::size_t offset = 0; offset < lhs_size; offset += rhs_size)
+    {
+        const std::size_t block = std::min(rhs_size, lhs_size - offset);
+        multiply_limbs(lhs + offset, block, rhs, rhs_size, partial.data());
+        add_limbs(out + offset, lhs_size + rhs_size - offset, partial.data(), block + rhs_size, out + offset);
+    }
+}
+
+constexpr void bigint_t::multiply_schoolbook(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size, std::uint64_t* out) noexcept
+{
+    std::fill(out, out + lhs_size + rhs_size, 0);
+    for (std::size_t row = 0; row < rhs_size; ++row)
+    {
+        std::uint64_t carry = 0;
+        for (std::size_t column = 0; column < lhs_size; ++column)
+        {
+            const uint128_t product = uint128_t::multiply(lhs[column], rhs[row]) + uint128_t{out[row + column]} + uint128_t{carry};
+            out[row + column] = product.low();
+            carry = product.high();
+        }
+        out[row + lhs_size] = carry;
+    }
+}
+
+constexpr void bigint_t::multiply_karatsuba(const std::uint64_t* lhs, std::size_t lhs_size, const std::uint64_t* rhs, std::size_t rhs_size, std::uint64_t* out)
+{
+    // lhs = a1 B^h + a0 and rhs = b1 B^h + b0, so lhs * rhs = a1 b1 B^2h + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) B^h + a0 b0.
+    const std::size_t half = (lhs_size + 1) / 2;
+    const std::size_t size = lhs_size + rhs_size;
+    multiply_limbs(lhs, half, rhs, half, out);
+    multiply_limbs(lhs + half, lhs_size - half, rhs + half, rhs_size - half, out + 2 * half);
+
+    std::vector<std::uint64_t> lhs_sum(half + 1);
+    std::vector<std::uint64_t> rhs_sum(half + 1);
+    lhs_sum[half] = add_limbs(lhs, half, lhs + half, lhs_size - half, lhs_sum.data());
+    rhs_sum[half] = add_limbs(rhs, half, rhs + half, rhs_size - half, rhs_sum.data());
+    std::vector<std::uint64_t> middle(2 * half + 2);
+    multiply_limbs(lhs_sum.data(), half + 1, rhs_sum.data(), half + 1, middle.data());
+    subtract_limbs(middle.data(), middle.size(), out, 2 * half, middle.data());
+    subtract_limbs(middle.data(), middle.size(), out + 2 * half, size - 2 * half, middle.data());
+
+    // a0 b1 + a1 b0 < 2 B^lhs_size, so the middle term fits in the size - half limbs above B^h.
+    std::size_t middle_size = middle.size();
+    while (middle_size != 0 && middle[middle_size - 1] == 0) --middle_size;
+    add_limbs(out + half, size - half, middle.data(), middle_size, out + half);
+}
+
+constexpr std::uint64_t bigint_t::divide_limb(const std::uint64_t* dividend, std::size_t size, std::uint64_t divisor, std::uint64_t* quotient) noexcept
+{
+    std::uint64_t remainder = 0;
+    for (std::size_t index = size; index-- > 0;)
+    {
+        uint128_t limb_remainder;
+        quotient[index] = uint128_t::divide(uint128_t{remainder, dividend[index]}, uint128_t{divisor}, limb_remainder).low();
+        remainder = limb_remainder.low();
+    }
+    return remainder;
+}
+
+constexpr std::uint64_t bigint_t::divide_ten_pow_19(const std::uint64_t* dividend, std::size_t size, std::uint64_t* quotient) noexcept
+{
+    // 10^19 has its top bit set, so Moller and Granlund's 2/1 division applies as is: with the
+    // reciprocal v = floor((2^128 - 1) / d) - 2^64, each quotient limb costs one multiply and at most
+    // two corrections.
+    constexpr std::uint64_t divisor = 10000000000000000000ULL;
+    constexpr std::uint64_t reciprocal = [] {
+        uint128_t remainder;
+        return uint128_t::divide(~uint128_t{}, uint128_t{divisor}, remainder).low();
+    }();
+    std::uint64_t remainder = 0;
+    for (std::size_t index = size; index-- > 0;)
+    {
+        const uint128_t estimate = uint128_t::multiply(reciprocal, remainder) + uint128_t{remainder, dividend[index]};
+        std::uint64_t digit = estimate.high() + 1;
+        std::uint64_t rest = dividend[index] - digit * divisor;
+        if (rest > estimate.low())
+        {
+            --digit;
+            rest += divisor;
+        }
+        if (rest >= divisor)
+        {
+            ++digit;
+            rest -= divisor;
+        }
+        quotient[index] = digit;
+        remainder = rest;
+    }
+    return remainder;
+}
+
+constexpr void bigint_t::divide_limbs(const std::uint64_t* dividend, std::size_t dividend_size, const std::uint64_t* divisor, std::size_t divisor_size, std::uint64_t* quotient, std::uint64_t* remainder)
+{
+    // Normalize so the divisor's top bit is set, which makes each quotient digit estimate at most two too large.
+    const int shift = std::countl_zero(divisor[divisor_size - 1]);
+    std::vector<std::uint64_t> normalized_divisor(divisor_size);
+    std::vector<std::uint64_t> normalized_dividend(dividend_size + 1);
+    for (std::size_t index = divisor_size; index-- > 0;)
+    {
+        const std::uint64_t below = index == 0 || shift == 0 ? 0 : divisor[index - 1] >> (64 - shift);
+        normalized_divisor[index] = (divisor[index] << shift) | below;
+    }
+    normalized_dividend[dividend_size] = shift == 0 ? 0 : dividend[dividend_size - 1] >> (64 - shift);
+    for (std::size_t index = dividend_size; index-- > 0;)
+    {
+        const std::uint64_t below = index == 0 || shift == 0 ? 0 : dividend[index - 1] >> (64 - shift);
+        normalized_dividend[index] = (dividend[index] << shift) | below;
+    }
+
+    const std::uint64_t divisor_top = normalized_divisor[divisor_size - 1];
+    const std::uint64_t divisor_next = normalized_divisor[divisor_size - 2];
+    for (std::size_t digit = dividend_size - divisor_size + 1; digit-- > 0;)
+    {
+        // Estimate the digit from the top two limbs of the partial remainder, then correct it with the next limb.
+        const std::size_t top = digit + divisor_size;
+        uint128_t estimate_remainder;
+        uint128_t estimate = uint128_t::divide(uint128_t{normalized_dividend[top], normalized_dividend[top - 1]}, uint128_t{divisor_top}, estimate_remainder);
+        while (estimate.high() != 0 || uint128_t::multiply(estimate.low(), divisor_next) > uint128_t{estimate_remainder.low(), normalized_dividend[top - 2]})
+        {
+            --estimate;
+            estimate_remainder += uint128_t{divisor_top};
+            if (estimate_remainder.high() != 0) break;
+        }
+
+        // Subtract estimate * divisor from the partial remainder.
+        std::uint64_t product_carry = 0;
+        unsigned char borrow = 0;
+        for (std::size_t index = 0; index < divisor_size; ++index)
+        {
+            const uint128_t product = uint128_t::multiply(estimate.low(), normalized_divisor[index]) + uint128_t{product_carry};
+            product_carry = product.high();
+            borrow = subtract_with_borrow(borrow, normalized_dividend[digit + index], product.low(), normalized_dividend[digit + index]);
+        }
+        borrow = subtract_with_borrow(borrow, normalized_dividend[top], product_carry, normalized_dividend[top]);
+
+        // The estimate was still one too large in rare cases: add the divisor back.
+        std::uint64_t quotient_digit = estimate.low();
+        if (borrow != 0)
+        {
+            --quotient_digit;
+            unsigned char carry = 0;
+            for (std::size_t index = 0; index < divisor_size; ++index)
+                carry = add_with_carry(carry, normalized_dividend[digit + index], normalized_divisor[index], normalized_dividend[digit + index]);
+            normalized_dividend[top] += carry;
+        }
+        quotient[digit] = quotient_digit;
+    }
+
+    for (std::size_t index = 0; index < divisor_size; ++index)
+    {
+        const std::uint64_t above = shift == 0 ? 0 : normalized_dividend[index + 1] << (64 - shift);
+        remainder[index] = (normalized_dividend[index] >> shift) | above;
+    }
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+/**
+ * @brief std::numeric_limits for bigint_t, which is signed, exact and unbounded.
+ */
+template <>
+struct std::numeric_limits<Softloq::WHATWG::Infra::bigint_t>
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = true;
+    static constexpr bool is_exact = true;
+    static constexpr bool has_infinity = false;
+    static constexpr bool has_quiet_NaN = false;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr std::float_round_style round_style = std::round_toward_zero;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = false;
+    static constexpr bool is_modulo = false;
+    static constexpr int digits = 0;
+    static constexpr int digits10 = 0;
+    static constexpr int radix = 2;
+    static constexpr bool traps = true;
+};
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_BIGINT_BIGINT_T_HPP
@@ -0,0 +1,281 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the decimal formatting of integers for the WHATWG Infra library, shared by every Number width.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines write_decimal(), which writes the shortest decimal form of an integer, including uint128_t and WideInt.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DECIMAL_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DECIMAL_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Integral.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/uint128_t.hpp"
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Concept for the integer types write_decimal() accepts: the built-in integers other than bool, uint128_t and WideInt.
+ */
+template <typename T>
+concept DecimalInteger = (std::integral<T> && !std::same_as<T, bool>) || std::same_as<T, uint128_t> || WideInteger<T>;
+
+/**
+ * @brief The longest decimal form of a value of type T, including a minus sign.
+ */
+template <DecimalInteger T>
+inline constexpr std::size_t max_decimal_length = std::numeric_limits<T>::digits10 + 1 + std::numeric_limits<T>::is_signed;
+
+template <>
+inline constexpr std::size_t max_decimal_length<uint128_t> = 39;
+
+/**
+ * @brief Write the decimal form of an integer, with a leading '-' if it is negative and no leading zeros.
+ *
+ * Digits are produced two at a time from a table of the 100 digit pairs, front to back: the value
+ * is scaled once into 32.32 fixed point by a multiplication (no division), the integer part is the
+ * leading one or two digits, and each following pair is the integer part of the fraction times 100.
+ * 64-bit values are split into 8-digit pieces, and uint128_t and WideInt values into 19-digit
+ * chunks by division by 10^19.
+ *
+ * @param out Where to write, with room for max_decimal_length<T> characters.
+ * @param value The value to write.
+ * @return The end of the written characters.
+ */
+template <DecimalInteger T>
+constexpr char* write_decimal(char* out, T value) noexcept;
+
+/**
+ * @brief The two characters of every number from 00 to 99.
+ */
+inline constexpr std::array<char, 200> decimal_digit_pairs = [] {
+    std::array<char, 200> pairs{};
+    for (std::size_t value = 0; value < 100; ++value)
+    {
+        pairs[value * 2] = static_cast<char>('0' + value / 10);
+        pairs[value * 2 + 1] = static_cast<char>('0' + value % 10);
+    }
+    return pairs;
+}();
+
+/**
+ * @brief Write the two digits of a number below 100.
+ */
+constexpr char* write_decimal_pair(char* out, std::uint32_t value) noexcept
+{
+    out[0] = decimal_digit_pairs[value * 2];
+    out[1] = decimal_digit_pairs[value * 2 + 1];
+    return out + 2;
+}
+
+/**
+ * @brief Write a leading part of one or two digits and then Pairs digit pairs of a value below 100^(Pairs + 1).
+ *
+ * The value is scaled by ceil(2^(32 + shift) / 100^Pairs) into 32.32 fixed point and rounded up
+ * by one unit, which keeps it at or above the exact quotient with an error below 2 + value / 2^shift
+ * units. That stays under the 2^32 / 100^Pairs units that would turn a pair over, so every pair is
+ * exact. Up to three pairs a 64-bit product is precise enough; four need the 128-bit product.
+ */
+template <std::size_t Pairs>
+constexpr char* write_decimal_pairs(char* out, std::uint32_t value, bool two_leading_digits) noexcept
+{
+    std::uint64_t fixed = 0;
+    if constexpr (Pairs < 4)
+    {
+        constexpr int shift = 25;
+        constexpr std::uint64_t divisor = Pairs == 1 ? 100 : Pairs == 2 ? 10000 : 1000000;
+        constexpr std::uint64_t scale = ((std::uint64_t{1} << (32 + shift)) - 1) / divisor + 1;
+        fixed = ((value * scale) >> shift) + 1;
+    }
+    else
+    {
+        constexpr std::uint64_t scale = std::numeric_limits<std::uint64_t>::max() / 100000000 + 1;
+        fixed = (uint128_t::multiply(value, scale) >> 32).low() + 1;
+    }
+    const auto leading = static_cast<std::uint32_t>(fixed >> 32);
+    if (two_leading_digits)
+        out = write_decimal_pair(out, leading);
+    else
+        *out++ = static_cast<char>('0' + leading);
+    for (std::size_t pair = 0; pair < Pairs; ++pair)
+    {
+        fixed = 100 * (fixed & 0xFFFFFFFF);
+        out = write_decimal_pair(out, static_cast<std::uint32_t>(fixed >> 32));
+    }
+    return out;
+}
+
+/**
+ * @brief Write a 32-bit value without leading zeros.
+ */
+constexpr char* write_decimal_u32(char* out, std::uint32_t value) noexcept
+{
+    if (value < 100)
+    {
+        if (value >= 10) return write_decimal_pair(out, value);
+        *out++ = static_cast<char>('0' + value);
+        return out;
+    }
+    if (value < 10000) return write_decimal_pairs<1>(out, value, value >= 1000);
+    if (value < 1000000) return write_decimal_pairs<2>(out, value, value >= 100000);
+    if (value < 100000000) return write_decimal_pairs<3>(out, value, value >= 10000000);
+    return write_decimal_pairs<4>(out, value, value >= 1000000000);
+}
+
+/**
+ * @brief Write exactly eight digits of a value below 10^8, with leading zeros.
+ */
+constexpr char* write_decimal_8_digits(char* out, std::uint32_t value) noexcept
+{
+    return write_decimal_pairs<3>(out, value, true);
+}
+
+/**
+ * @brief Write a 64-bit value without leading zeros, in pieces of at most eight digits.
+ */
+constexpr char* write_decimal_u64(char* out, std::uint64_t value) noexcept
+{
+    if (value <= std::numeric_limits<std::uint32_t>::max()) return write_decimal_u32(out, static_cast<std::uint32_t>(value));
+    constexpr std::uint64_t ten_pow_8 = 100000000;
+    const auto low = static_cast<std::uint32_t>(value % ten_pow_8);
+    value /= ten_pow_8;
+    if (value < ten_pow_8)
+        out = write_decimal_u32(out, static_cast<std::uint32_t>(value));
+    else
+    {
+        out = write_decimal_u32(out, static_cast<std::uint32_t>(value / ten_pow_8));
+        out = write_decimal_8_digits(out, static_cast<std::uint32_t>(value % ten_pow_8));
+    }
+    return write_decimal_8_digits(out, low);
+}
+
+/**
+ * @brief Write exactly nineteen digits of a value below 10^19, with leading zeros.
+ */
+constexpr char* write_decimal_19_digits(char* out, std::uint64_t value) noexcept
+{
+    constexpr std::uint64_t ten_pow_8 = 100000000;
+    const auto low = static_cast<std::uint32_t>(value % ten_pow_8);
+    value /= ten_pow_8;
+    const auto middle = static_cast<std::uint32_t>(value % ten_pow_8);
+    const auto high = static_cast<std::uint32_t>(value / ten_pow_8);
+    *out++ = static_cast<char>('0' + high / 100);
+    out = write_decimal_pair(out, high % 100);
+    out = write_decimal_8_digits(out, middle);
+    return write_decimal_8_digits(out, low);
+}
+
+/**
+ * @brief Write a 128-bit value without leading zeros, in chunks of nineteen digits.
+ */
+constexpr char* write_decimal_u128(char* out, const uint128_t& value) noexcept
+{
+    if (value.high() == 0) return write_decimal_u64(out, value.low());
+    constexpr std::uint64_t ten_pow_19 = 10000000000000000000ULL;
+    uint128_t low;
+    const uint128_t upper = uint128_t::divide(value, uint128_t{ten_pow_19}, low);
+    if (upper.high() == 0)
+        out = write_decimal_u64(out, upper.low());
+    else
+    {
+        // 2^128 < 10^39, so at most one digit is left above the two chunks.
+        uint128_t middle;
+        const uint128_t top = uint128_t::divide(upper, uint128_t{ten_pow_19}, middle);
+        *out++ = static_cast<char>('0' + top.low());
+        out = write_decimal_19_digits(out, middle.low());
+    }
+    return write_decimal_19_digits(out, low.low());
+}
+
+/**
+ * @brief Write an unsigned WideInt value without leading zeros, in chunks of nineteen digits.
+ *
+ * Chunks are divided off the bottom one word at a time until the rest fits in 128 bits.
+ */
+template <std::size_t Bits>
+constexpr char* write_decimal_wide(char* out, WideInt<Bits, false> value) noexcept
+{
+    constexpr std::uint64_t ten_pow_19 = 10000000000000000000ULL;
+    // Each chunk divides the value by 10^19 > 2^63, so Bits / 63 chunks are always enough.
+    std::array<std::uint64_t, Bits / 63 + 1> chunks{};
+    std::size_t chunk_count = 0;
+    while (value >> 128) value = WideInt<Bits, false>::divide(value, ten_pow_19, chunks[chunk_count++]);
+    out = write_decimal_u128(out, static_cast<uint128_t>(value));
+    while (chunk_count != 0) out = write_decimal_19_digits(out, chunks[--chunk_count]);
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <DecimalInteger T>
+constexpr char* write_decimal(char* out, T value) noexcept
+{
+    if constexpr (std::same_as<T, uint128_t>)
+        return write_decimal_u128(out, value);
+    else if constexpr (WideInteger<T>)
+    {
+        using Unsigned = WideInt<T::bits, false>;
+        auto magnitude = Unsigned{value};
+        if (value.is_negative())
+        {
+            *out++ = '-';
+            magnitude = -magnitude;
+        }
+        return write_decimal_wide(out, magnitude);
+    }
+    else
+    {
+        using Unsigned = std::make_unsigned_t<T>;
+        auto magnitude = static_cast<Unsigned>(value);
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (value < 0)
+            {
+                *out++ = '-';
+                magnitude = static_cast<Unsigned>(Unsigned{0} - magnitude);
+            }
+        }
+        if constexpr (sizeof(T) <= sizeof(std::uint32_t))
+            return write_decimal_u32(out, magnitude);
+        else
+            return write_decimal_u64(out, magnitude);
+    }
+}
+
+/**
+ * @brief Output stream operator for uint128_t, writing its decimal form.
+ */
+inline std::ostream& operator<<(std::ostream& os, const uint128_t& value)
+{
+    char buffer[max_decimal_length<uint128_t>];
+    const char* end = write_decimal(buffer, value);
+    return os << std::string_view(buffer, static_cast<std::size_t>(end - buffer));
+}
+
+/**
+ * @brief Output stream operator for WideInt, writing its decimal form.
+ */
+template <std::size_t Bits, bool Signed>
+std::ostream& operator<<(std::ostream& os, const WideInt<Bits, Signed>& value)
+{
+    char buffer[max_decimal_length<WideInt<Bits, Signed>>];
+    const char* end = write_decimal(buffer, value);
+    return os << std::string_view(buffer, static_cast<std::size_t>(end - buffer));
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DECIMAL_HPP
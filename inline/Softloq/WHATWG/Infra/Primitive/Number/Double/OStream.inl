@@ -0,0 +1,28 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/Double/OStream.inl
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Output stream operator for the Double primitive type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file defines the output stream operator for the Double primitive type.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_OSTREAM_INL
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_OSTREAM_INL
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Double/Double.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Double/ShortestDecimal.hpp"
+#include <ostream>
+
+/**
+ * @brief Writes the value with write_number_string(), ignoring the stream's precision and float format flags.
+ */
+inline std::ostream& operator<<(std::ostream& os, const Softloq::WHATWG::Infra::Number<double>& value)
+{
+    char buffer[Softloq::WHATWG::Infra::max_number_string_length];
+    char* end = Softloq::WHATWG::Infra::write_number_string(buffer, value.get_value());
+    return os.write(buffer, end - buffer);
+}
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_OSTREAM_INL
@@ -0,0 +1,199 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/Double/ShortestDecimal.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the shortest round-trip decimal formatting of doubles for the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines shortest_decimal(), which finds the shortest decimal that reads back as a given double, and
+ * write_number_string(), which lays it out as ECMAScript's Number::toString does.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_SHORTESTDECIMAL_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_SHORTESTDECIMAL_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Double/PowersOfTen.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/uint128_t.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief A positive decimal significand * 10^exponent, the significand without trailing zeros.
+ */
+struct DecimalDouble
+{
+    std::uint64_t significand{0};
+    int exponent{0};
+
+    friend constexpr bool operator==(const DecimalDouble&, const DecimalDouble&) noexcept = default;
+};
+
+/**
+ * @brief The longest string write_number_string() writes: a sign, "0.", five zeros and seventeen digits.
+ */
+inline constexpr std::size_t max_number_string_length = 25;
+
+/**
+ * @brief Find the shortest decimal that reads back as a finite double, ignoring its sign.
+ *
+ * This is Giulietti's Schubfach algorithm: the value and the two ends of the interval that rounds
+ * to it are scaled by one 128-bit power of ten from double_powers_of_ten, rounding to odd so the
+ * comparisons stay exact, and the shorter of the one or two candidate significands inside the
+ * interval is picked. Of two equally short candidates, the one closer to the value wins, then the
+ * even one. Integers below 2^53 skip the scaling.
+ *
+ * @param value The value, which must be finite.
+ * @return The significand and exponent; {0, 0} for zero.
+ */
+[[nodiscard]] constexpr DecimalDouble shortest_decimal(double value) noexcept;
+
+/**
+ * @brief Write a double as ECMAScript's Number::toString(value) does, with the digits of shortest_decimal().
+ *
+ * NaN is written "NaN", the infinities "Infinity" and "-Infinity", and both zeros "0". Other values
+ * are written in positional notation when their decimal exponent is from -7 to 20, and as a
+ * significand with an "e+" or "e-" exponent otherwise.
+ *
+ * @param out Where to write, with room for max_number_string_length characters.
+ * @param value The value to write.
+ * @return The end of the written characters.
+ */
+constexpr char* write_number_string(char* out, double value) noexcept;
+
+/**
+ * @brief floor(g * cp / 2^128) for a 128-bit g, with the lowest bit set if the product had any bits below it.
+ */
+[[nodiscard]] constexpr std::uint64_t multiply_round_to_odd(const uint128_t& g, std::uint64_t cp) noexcept
+{
+    const uint128_t low = uint128_t::multiply(g.low(), cp);
+    const uint128_t high = uint128_t::multiply(g.high(), cp);
+    const std::uint64_t middle = high.low() + low.high();
+    const std::uint64_t top = high.high() + (middle < high.low() ? 1 : 0);
+    return top | (middle > 1 ? 1 : 0);
+}
+
+/**
+ * @brief Drop the trailing zeros of a significand into its exponent.
+ */
+[[nodiscard]] constexpr DecimalDouble remove_trailing_zeros(std::uint64_t significand, int exponent) noexcept
+{
+    while (significand % 10 == 0)
+    {
+        significand /= 10;
+        ++exponent;
+    }
+    return {significand, exponent};
+}
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+constexpr DecimalDouble shortest_decimal(double value) noexcept
+{
+    constexpr std::uint64_t hidden_bit = std::uint64_t{1} << 52;
+    const auto bits = std::bit_cast<std::uint64_t>(value);
+    const std::uint64_t fraction = bits & (hidden_bit - 1);
+    const auto biased_exponent = static_cast<int>((bits >> 52) & 0x7FF);
+    if (biased_exponent == 0 && fraction == 0) return {};
+
+    // value = c * 2^q.
+    std::uint64_t c = fraction;
+    int q = -1074;
+    if (biased_exponent != 0)
+    {
+        c |= hidden_bit;
+        q = biased_exponent - 1075;
+        if (q <= 0 && q > -53 && (c & ((std::uint64_t{1} << -q) - 1)) == 0) return remove_trailing_zeros(c >> -q, 0);
+    }
+
+    // The interval of reals that round to the value, in units of 2^(q - 2). Its lower half is
+    // narrower at a power of two, where the exponent below is one smaller.
+    const bool accept_bounds = (c & 1) == 0;
+    const bool lower_closer = fraction == 0 && biased_exponent > 1;
+    const std::uint64_t lower_bound = 4 * c - 2 + (lower_closer ? 1 : 0);
+    const std::uint64_t middle = 4 * c;
+    const std::uint64_t upper_bound = 4 * c + 2;
+
+    // k = floor(log10(2^q)), or floor(log10(3/4 * 2^q)) beside a power of two; the scaled values then have a few bits above the units.
+    const int k = (q * 1262611 - (lower_closer ? 524031 : 0)) >> 22;
+    const int h = q + ((-k * 1741647) >> 19) + 1;
+    const uint128_t g = double_powers_of_ten[static_cast<std::size_t>(-k - double_powers_of_ten_min)] + uint128_t{1};
+    const std::uint64_t scaled_lower = multiply_round_to_odd(g, lower_bound << h) + (accept_bounds ? 0 : 1);
+    const std::uint64_t scaled = multiply_round_to_odd(g, middle << h);
+    const std::uint64_t scaled_upper = multiply_round_to_odd(g, upper_bound << h) - (accept_bounds ? 0 : 1);
+
+    // One digit shorter, if exactly one of its two candidates is inside the interval.
+    const std::uint64_t s = scaled / 4;
+    if (s >= 10)
+    {
+        const std::uint64_t shorter = s / 10;
+        const bool down_inside = scaled_lower <= 40 * shorter;
+        const bool up_inside = 40 * shorter + 40 <= scaled_upper;
+        if (down_inside != up_inside) return remove_trailing_zeros(shorter + (up_inside ? 1 : 0), k + 1);
+    }
+
+    // Otherwise s or s + 1, whichever is inside or, if both are, closer to the value, ties to even.
+    const bool down_inside = scaled_lower <= 4 * s;
+    const bool up_inside = 4 * s + 4 <= scaled_upper;
+    if (down_inside != up_inside) return remove_trailing_zeros(s + (up_inside ? 1 : 0), k);
+    const std::uint64_t midpoint = 4 * s + 2;
+    const bool round_up = scaled > midpoint || (scaled == midpoint && (s & 1) != 0);
+    return remove_trailing_zeros(s + (round_up ? 1 : 0), k);
+}
+
+constexpr char* write_number_string(char* out, double value) noexcept
+{
+    constexpr auto write = [](char* to, const char* text, std::size_t length) { return std::copy_n(text, length, to); };
+    if (value != value) return write(out, "NaN", 3);
+    if (value == 0) return write(out, "0", 1);
+    if (value < 0)
+    {
+        *out++ = '-';
+        value = -value;
+    }
+    if (value == std::numeric_limits<double>::infinity()) return write(out, "Infinity", 8);
+
+    // value = s * 10^(n - k) with k digits in s.
+    const DecimalDouble decimal = shortest_decimal(value);
+    char digits[20]{};
+    const auto k = static_cast<int>(write_decimal_u64(digits, decimal.significand) - digits);
+    const int n = decimal.exponent + k;
+    if (k <= n && n <= 21)
+    {
+        out = write(out, digits, static_cast<std::size_t>(k));
+        return std::fill_n(out, n - k, '0');
+    }
+    if (0 < n && n <= 21)
+    {
+        out = write(out, digits, static_cast<std::size_t>(n));
+        *out++ = '.';
+        return write(out, digits + n, static_cast<std::size_t>(k - n));
+    }
+    if (-6 < n && n <= 0)
+    {
+        out = write(out, "0.", 2);
+        out = std::fill_n(out, -n, '0');
+        return write(out, digits, static_cast<std::size_t>(k));
+    }
+    *out++ = digits[0];
+    if (k > 1)
+    {
+        *out++ = '.';
+        out = write(out, digits + 1, static_cast<std::size_t>(k - 1));
+    }
+    *out++ = 'e';
+    *out++ = n - 1 >= 0 ? '+' : '-';
+    return write_decimal_u32(out, static_cast<std::uint32_t>(n - 1 >= 0 ? n - 1 : 1 - n));
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_DOUBLE_SHORTESTDECIMAL_HPP
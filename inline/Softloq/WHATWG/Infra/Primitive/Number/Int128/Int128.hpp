@@ -0,0 +1,33 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/Int128/Int128.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the Int128 type for the WHATWG Infra library, representing a 128-bit signed integer in the context of web APIs.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the Int128 type for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT128_INT128_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT128_INT128_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp"
+#include <cstdint>
+
+namespace Softloq::WHATWG::Infra
+{
+
+static_assert(IntegralConcept<int128_t>, "int128_t must be an integral type"); // Passes
+
+/**
+ * @brief Alias for a 128-bit signed integer Number.
+ */
+using Int128 = Number<int128_t>;
+
+} // namespace Softloq::WHATWG::Infra
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Int128/Formatter.tpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Int128/OStream.inl"
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_INT128_INT128_HPP
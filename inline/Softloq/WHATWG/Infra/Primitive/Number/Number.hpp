@@ -1,7 +1,7 @@
 /**
  * @file Softloq/WHATWG/Infra/Primitive/Number/Number.hpp
  * @author Softloq CEO - Brandon Foster (Paradox Gene)
- * @brief This header defines the Number type for the WHATWG Infra library, representing integer numeric values in the context of web APIs.
+ * @brief This header defines the Number type for the WHATWG Infra library, representing integer and floating-point numeric values in the context of web APIs.
  *
  * Copyright (c) 2026 Softloq. All rights reserved.
  * Softloq implementation of the WHATWG Infra library.
@@ -13,22 +13,41 @@
 
 #include "Softloq/WHATWG/Infra/Primitive/Primitive.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Number/Integral.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Overflow.hpp"
 
 namespace Softloq::WHATWG::Infra
 {
 
+template <Numeric T>
+class Number;
+
+/**
+ * @brief The result of a checked Number operation: the result wrapped modulo 2^N, and whether the exact result overflowed.
+ *
+ * @tparam T The integral type of the Number.
+ */
+template <Numeric T>
+struct OverflowResult
+{
+    Number<T> value;
+    bool overflow{false};
+};
+
 /**
- * @brief The Number type represents an integer numeric value in the context of web APIs.
+ * @brief The Number type represents a numeric value in the context of web APIs.
  *
- * The Number type is parameterized over any Integral type T, covering all signed
- * and unsigned integer widths used by the WHATWG Infra specification. It provides
+ * The Number type is parameterized over any Numeric type T, covering all signed
+ * and unsigned integer widths used by the WHATWG Infra specification and double
+ * for the IEEE 754 values of JSON and ECMAScript. It provides
  * value construction, mutation, arithmetic, compound assignment, increment/decrement,
- * ordering comparison, and conversion to the underlying integral type.
+ * ordering comparison, and conversion to the underlying integral type. For the fixed-width
+ * types, addition, subtraction and multiplication also come in checked, saturating and
+ * wrapping forms, which detect overflow with one flag test. Modulo is integral only.
  *
- * @tparam T An integral type (e.g. std::uint8_t, std::int32_t).
+ * @tparam T An integral type (e.g. std::uint8_t, std::int32_t), or double.
  */
-template <Integral T>
-class Number final : public Primitive
+template <Numeric T>
+class Number final : public Primitive<PrimitiveType::Number>
 {
 // Constructors and destructor
 public:
@@ -41,18 +60,6 @@ public:
 
     constexpr ~Number() noexcept = default;
 
-// Primitive interface
-public:
-    /**
-     * @brief Get the type of the primitive.
-     *
-     * @return The type of the primitive, which is PrimitiveType::Number.
-     */
-    [[nodiscard]] constexpr PrimitiveType get_type() const noexcept override
-    {
-        return PrimitiveType::Number;
-    }
-
 // Accessors
 public:
     /**
@@ -139,11 +146,131 @@ public:
      * @param other The Number to compute the remainder with.
      * @return A new Number holding the remainder.
      */
-    [[nodiscard]] constexpr Number operator%(const Number& other) const noexcept
+    [[nodiscard]] constexpr Number operator%(const Number& other) const noexcept requires Integral<T>
     {
         return Number{static_cast<T>(m_value % other.m_value)};
     }
 
+// Checked, saturating and wrapping arithmetic
+public:
+    /**
+     * @brief Checked addition.
+     *
+     * @param other The Number to add.
+     * @return The wrapped sum, and whether the exact sum does not fit in T.
+     */
+    [[nodiscard]] constexpr OverflowResult<T> checked_add(const Number& other) const noexcept requires FixedWidthInteger<T>
+    {
+        T result{};
+        const bool overflow = overflowing_add(m_value, other.m_value, result);
+        return {Number{result}, overflow};
+    }
+
+    /**
+     * @brief Checked subtraction.
+     *
+     * @param other The Number to subtract.
+     * @return The wrapped difference, and whether the exact difference does not fit in T.
+     */
+    [[nodiscard]] constexpr OverflowResult<T> checked_sub(const Number& other) const noexcept requires FixedWidthInteger<T>
+    {
+        T result{};
+        const bool overflow = overflowing_sub(m_value, other.m_value, result);
+        return {Number{result}, overflow};
+    }
+
+    /**
+     * @brief Checked multiplication.
+     *
+     * @param other The Number to multiply by.
+     * @return The wrapped product, and whether the exact product does not fit in T.
+     */
+    [[nodiscard]] constexpr OverflowResult<T> checked_mul(const Number& other) const noexcept requires FixedWidthInteger<T>
+    {
+        T result{};
+        const bool overflow = overflowing_mul(m_value, other.m_value, result);
+        return {Number{result}, overflow};
+    }
+
+    /**
+     * @brief Saturating addition.
+     *
+     * @param other The Number to add.
+     * @return A new Number holding the sum, clamped to the range of T.
+     */
+    [[nodiscard]] constexpr Number saturating_add(const Number& other) const noexcept requires FixedWidthInteger<T>
+    {
+        // A sum overflows upwards unless a negative operand took it below the minimum.
+        T result{};
+        if (overflowing_add(m_value, other.m_value, result)) return Number{saturation_bound<T>(!is_negative(other.m_value))};
+        return Number{result};
+    }
+
+    /**
+     * @brief Saturating subtraction.
+     *
+     * @param other The Number to subtract.
+     * @return A new Number holding the difference, clamped to the range of T.
+     */
+    [[nodiscard]] constexpr Number saturating_sub(const Number& other) const noexcept requires FixedWidthInteger<T>
+    {
+        T result{};
+        if (overflowing_sub(m_value, other.m_value, result)) return Number{saturation_bound<T>(is_negative(other.m_value))};
+        return Number{result};
+    }
+
+    /**
+     * @brief Saturating multiplication.
+     *
+     * @param other The Number to multiply by.
+     * @return A new Number holding the product, clamped to the range of T.
+     */
+    [[nodiscard]] constexpr Number saturating_mul(const Number& other) const noexcept requires FixedWidthInteger<T>
+    {
+        T result{};
+        if (overflowing_mul(m_value, other.m_value, result)) return Number{saturation_bound<T>(is_negative(m_value) == is_negative(other.m_value))};
+        return Number{result};
+    }
+
+    /**
+     * @brief Wrapping addition, defined for signed types too.
+     *
+     * @param other The Number to add.
+     * @return A new Number holding the sum modulo 2^N.
+     */
+    [[nodiscard]] constexpr Number wrapping_add(const Number& other) const noexcept requires FixedWidthInteger<T>
+    {
+        T result{};
+        static_cast<void>(overflowing_add(m_value, other.m_value, result));
+        return Number{result};
+    }
+
+    /**
+     * @brief Wrapping subtraction, defined for signed types too.
+     *
+     * @param other The Number to subtract.
+     * @return A new Number holding the difference modulo 2^N.
+     */
+    [[nodiscard]] constexpr Number wrapping_sub(const Number& other) const noexcept requires FixedWidthInteger<T>
+    {
+        T result{};
+        static_cast<void>(overflowing_sub(m_value, other.m_value, result));
+        return Number{result};
+    }
+
+    /**
+     * @brief Wrapping multiplication, defined for signed types too.
+     *
+     * @param other The Number to multiply by.
+     * @return A new Number holding the product modulo 2^N.
+     */
+    [[nodiscard]] constexpr Number wrapping_mul(const Number& other) const noexcept requires FixedWidthInteger<T>
+    {
+        T result{};
+        static_cast<void>(overflowing_mul(m_value, other.m_value, result));
+        return Number{result};
+    }
+
 // Compound assignment operators
 public:
     /**
@@ -200,7 +327,7 @@ public:
      * @param other The Number to compute the remainder with.
      * @return Reference to this instance after modulo.
      */
-    constexpr Number& operator%=(const Number& other) noexcept
+    constexpr Number& operator%=(const Number& other) noexcept requires Integral<T>
     {
         m_value %= other.m_value;
         return *this;
@@ -27,7 +27,7 @@ using UInt128 = Number<uint128_t>;
 
 } // namespace Softloq::WHATWG::Infra
 
-// #include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/Formatter.tpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/Formatter.tpp"
 #include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/OStream.inl"
 
 #endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT128_UINT128_HPP
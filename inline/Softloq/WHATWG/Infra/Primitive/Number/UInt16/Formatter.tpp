@@ -12,10 +12,14 @@
 #define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT16_FORMATTER_TPP
 
 #include "Softloq/WHATWG/Infra/Primitive/Number/UInt16/UInt16.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp"
+#include <algorithm>
 #include <format>
 
 /**
  * @brief Formatter specialization for UInt16 (Number<std::uint16_t>).
+ *
+ * Writes the value with write_decimal().
  */
 template <>
 struct std::formatter<Softloq::WHATWG::Infra::Number<std::uint16_t>>
@@ -24,7 +28,9 @@ struct std::formatter<Softloq::WHATWG::Infra::Number<std::uint16_t>>
 
     auto format(const Softloq::WHATWG::Infra::Number<std::uint16_t>& value, std::format_context& ctx) const
     {
-        return std::format_to(ctx.out(), "{}", value.get_value());
+        char buffer[Softloq::WHATWG::Infra::max_decimal_length<std::uint16_t>];
+        char* end = Softloq::WHATWG::Infra::write_decimal(buffer, value.get_value());
+        return std::copy(buffer, end, ctx.out());
     }
 };
 
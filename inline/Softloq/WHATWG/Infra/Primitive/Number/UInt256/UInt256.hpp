@@ -0,0 +1,33 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/UInt256/UInt256.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the UInt256 type for the WHATWG Infra library, representing a 256-bit unsigned integer in the context of web APIs.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the UInt256 type for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT256_UINT256_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT256_UINT256_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp"
+#include <cstdint>
+
+namespace Softloq::WHATWG::Infra
+{
+
+static_assert(IntegralConcept<uint256_t>, "uint256_t must be an integral type"); // Passes
+
+/**
+ * @brief Alias for a 256-bit unsigned integer Number.
+ */
+using UInt256 = Number<uint256_t>;
+
+} // namespace Softloq::WHATWG::Infra
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt256/Formatter.tpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt256/OStream.inl"
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT256_UINT256_HPP
@@ -0,0 +1,33 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/UInt512/UInt512.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the UInt512 type for the WHATWG Infra library, representing a 512-bit unsigned integer in the context of web APIs.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the UInt512 type for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT512_UINT512_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT512_UINT512_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Number.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp"
+#include <cstdint>
+
+namespace Softloq::WHATWG::Infra
+{
+
+static_assert(IntegralConcept<uint512_t>, "uint512_t must be an integral type"); // Passes
+
+/**
+ * @brief Alias for a 512-bit unsigned integer Number.
+ */
+using UInt512 = Number<uint512_t>;
+
+} // namespace Softloq::WHATWG::Infra
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt512/Formatter.tpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt512/OStream.inl"
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_UINT512_UINT512_HPP
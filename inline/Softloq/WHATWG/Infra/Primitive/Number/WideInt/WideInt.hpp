@@ -0,0 +1,809 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/WideInt/WideInt.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the WideInt type template, a signed or unsigned integer of any multiple of 64 bits from 128 up.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines WideInt<Bits, Signed>, the int128_t, int256_t, uint256_t, int512_t and uint512_t aliases, and their std::numeric_limits.
+ * Defining SOFTLOQ_WHATWG_INFRA_NO_ADDCARRY before inclusion forces the portable carry chains.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_WIDEINT_WIDEINT_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_WIDEINT_WIDEINT_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Integral.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/Number/UInt128/uint128_t.hpp"
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Detect the x86-64 add-with-carry and subtract-with-borrow intrinsics, which chain through the carry flag
+#if !defined(SOFTLOQ_WHATWG_INFRA_NO_ADDCARRY) && (defined(__x86_64__) || defined(_M_X64))
+    #define SOFTLOQ_WHATWG_INFRA_WIDEINT_ADDCARRY 1
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #else
+        #include <immintrin.h>
+    #endif
+#else
+    #define SOFTLOQ_WHATWG_INFRA_WIDEINT_ADDCARRY 0
+#endif
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Add two 64-bit words and a carry.
+ *
+ * @param carry The incoming carry, 0 or 1.
+ * @param lhs The first word.
+ * @param rhs The second word.
+ * @param sum Receives the low 64 bits of the sum.
+ * @return The outgoing carry, 0 or 1.
+ */
+[[nodiscard]] constexpr unsigned char add_with_carry(unsigned char carry, std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& sum) noexcept;
+
+/**
+ * @brief Subtract a 64-bit word and a borrow from another.
+ *
+ * @param borrow The incoming borrow, 0 or 1.
+ * @param lhs The minuend.
+ * @param rhs The subtrahend.
+ * @param difference Receives the low 64 bits of the difference.
+ * @return The outgoing borrow, 0 or 1.
+ */
+[[nodiscard]] constexpr unsigned char subtract_with_borrow(unsigned char borrow, std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& difference) noexcept;
+
+/**
+ * @brief The word arithmetic that WideInt uses where the carry intrinsics are missing.
+ *
+ * These are always available, so they can be checked against the intrinsics.
+ */
+namespace WideIntPortable
+{
+
+/**
+ * @brief Portable add_with_carry().
+ */
+[[nodiscard]] constexpr unsigned char add_with_carry(unsigned char carry, std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& sum) noexcept
+{
+    sum = lhs + rhs + carry;
+    return static_cast<unsigned char>(sum < lhs || (carry != 0 && sum == lhs));
+}
+
+/**
+ * @brief Portable subtract_with_borrow().
+ */
+[[nodiscard]] constexpr unsigned char subtract_with_borrow(unsigned char borrow, std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& difference) noexcept
+{
+    difference = lhs - rhs - borrow;
+    return static_cast<unsigned char>(lhs < rhs || (borrow != 0 && lhs == rhs));
+}
+
+} // namespace WideIntPortable
+
+/**
+ * @brief A two's complement integer of Bits bits, stored as 64-bit words, least significant first.
+ *
+ * Arithmetic wraps modulo 2^Bits like the built-in unsigned types, for the signed types too, so no
+ * operation has undefined behaviour other than dividing by zero. Addition and subtraction run one
+ * carry chain over the words, on the x86-64 carry intrinsics where they exist. Multiplication is
+ * schoolbook on 64x64 -> 128 products and computes only the Bits bits it keeps: about half the word
+ * products of the full product, which at these widths is fewer than Karatsuba needs. Division takes
+ * the uint128_t division when both operands fit in 128 bits, runs one 128 / 64 step per word for a
+ * one-word divisor, and uses Knuth's algorithm D on 64-bit digits otherwise. Signed division
+ * truncates towards zero. All operations are constexpr.
+ *
+ * @tparam Bits The width in bits, a multiple of 64 of at least 128.
+ * @tparam Signed Whether the value is signed.
+ */
+template <std::size_t Bits, bool Signed>
+class WideInt final
+{
+    static_assert(Bits >= 128 && Bits % 64 == 0, "WideInt is a multiple of 64 bits of at least 128 bits");
+
+public:
+    /**
+     * @brief The width in bits.
+     */
+    static constexpr std::size_t bits = Bits;
+
+    /**
+     * @brief Whether the value is signed.
+     */
+    static constexpr bool is_signed = Signed;
+
+    /**
+     * @brief The number of 64-bit words.
+     */
+    static constexpr std::size_t word_count = Bits / 64;
+
+    /**
+     * @brief The words of a value, least significant first.
+     */
+    using words_type = std::array<std::uint64_t, word_count>;
+
+// Constructors
+public:
+    constexpr WideInt() noexcept = default;
+
+    /**
+     * @brief Construct from a built-in integer, sign-extending a negative one.
+     *
+     * @param value The value.
+     */
+    template <std::integral T>
+        requires(!std::same_as<T, bool>)
+    constexpr WideInt(T value) noexcept;
+
+    /**
+     * @brief Construct from a uint128_t, which becomes the low two words.
+     *
+     * @param value The value.
+     */
+    constexpr WideInt(const uint128_t& value) noexcept;
+
+    /**
+     * @brief Convert from a WideInt of another width or signedness, truncating or extending by the source's sign.
+     *
+     * @param other The value.
+     */
+    template <std::size_t OtherBits, bool OtherSigned>
+        requires(OtherBits != Bits || OtherSigned != Signed)
+    constexpr explicit WideInt(const WideInt<OtherBits, OtherSigned>& other) noexcept;
+
+    /**
+     * @brief Construct from words, least significant first.
+     *
+     * @param words The words.
+     */
+    [[nodiscard]] static constexpr WideInt from_words(const words_type& words) noexcept;
+
+// Accessors
+public:
+    /**
+     * @brief Get the words, least significant first.
+     */
+    [[nodiscard]] constexpr const words_type& words() const noexcept;
+
+    /**
+     * @brief Get one word.
+     *
+     * @param index The index of the word, 0 for the least significant.
+     */
+    [[nodiscard]] constexpr std::uint64_t word(std::size_t index) const noexcept;
+
+    /**
+     * @brief Returns true if the value is below zero, which only a signed value can be.
+     */
+    [[nodiscard]] constexpr bool is_negative() const noexcept;
+
+    /**
+     * @brief Explicit conversion to a built-in integer, truncating like the built-in conversions.
+     */
+    template <std::integral T>
+        requires(!std::same_as<T, bool>)
+    [[nodiscard]] constexpr explicit operator T() const noexcept;
+
+    /**
+     * @brief Explicit conversion to the low 128 bits.
+     */
+    [[nodiscard]] constexpr explicit operator uint128_t() const noexcept;
+
+    /**
+     * @brief Returns true if the value is not zero.
+     */
+    [[nodiscard]] constexpr explicit operator bool() const noexcept;
+
+// Full-width arithmetic
+public:
+    /**
+     * @brief Multiply two unsigned values without losing the high half of the product.
+     *
+     * @param lhs The left operand.
+     * @param rhs The right operand.
+     * @param high Receives the high Bits bits of the product.
+     * @return The low Bits bits of the product.
+     */
+    [[nodiscard]] static constexpr WideInt multiply(const WideInt& lhs, const WideInt& rhs, WideInt& high) noexcept
+        requires(!Signed);
+
+    /**
+     * @brief Multiply an unsigned value by a word and add a word.
+     *
+     * @param value The value.
+     * @param factor The word to multiply by.
+     * @param addend The word to add.
+     * @param result Receives the low Bits bits of value * factor + addend.
+     * @return The word carried out of the top.
+     */
+    [[nodiscard]] static constexpr std::uint64_t multiply_add(const WideInt& value, std::uint64_t factor, std::uint64_t addend, WideInt& result) noexcept
+        requires(!Signed);
+
+    /**
+     * @brief Divide, producing the quotient and the remainder in one step.
+     *
+     * The quotient truncates towards zero, and the remainder takes the sign of the dividend.
+     *
+     * @param dividend The dividend.
+     * @param divisor The divisor, which must not be zero.
+     * @param remainder Receives dividend % divisor.
+     * @return dividend / divisor.
+     */
+    [[nodiscard]] static constexpr WideInt divide(const WideInt& dividend, const WideInt& divisor, WideInt& remainder) noexcept;
+
+    /**
+     * @brief Divide an unsigned value by a word, one 128 / 64 step per word.
+     *
+     * @param dividend The dividend.
+     * @param divisor The divisor, which must not be zero.
+     * @param remainder Receives dividend % divisor.
+     * @return dividend / divisor.
+     */
+    [[nodiscard]] static constexpr WideInt divide(const WideInt& dividend, std::uint64_t divisor, std::uint64_t& remainder) noexcept
+        requires(!Signed);
+
+// std::regular and std::totally_ordered requirements
+public:
+    friend constexpr bool operator==(const WideInt&, const WideInt&) noexcept = default;
+
+    friend constexpr std::strong_ordering operator<=>(const WideInt& lhs, const WideInt& rhs) noexcept
+    {
+        if constexpr (Signed)
+        {
+            const auto lhs_top = static_cast<std::int64_t>(lhs.m_words[word_count - 1]);
+            const auto rhs_top = static_cast<std::int64_t>(rhs.m_words[word_count - 1]);
+            if (lhs_top != rhs_top) return lhs_top <=> rhs_top;
+        }
+        for (std::size_t index = word_count; index-- > 0;)
+        {
+            if (lhs.m_words[index] != rhs.m_words[index]) return lhs.m_words[index] <=> rhs.m_words[index];
+        }
+        return std::strong_ordering::equal;
+    }
+
+// Arithmetic operator requirements
+public:
+    [[nodiscard]] constexpr WideInt operator+(const WideInt& other) const noexcept;
+    [[nodiscard]] constexpr WideInt operator-(const WideInt& other) const noexcept;
+    [[nodiscard]] constexpr WideInt operator*(const WideInt& other) const noexcept;
+    [[nodiscard]] constexpr WideInt operator/(const WideInt& other) const noexcept;
+    [[nodiscard]] constexpr WideInt operator%(const WideInt& other) const noexcept;
+    [[nodiscard]] constexpr WideInt operator-() const noexcept { return WideInt{} - *this; }
+
+    constexpr WideInt& operator+=(const WideInt& other) noexcept { *this = *this + other; return *this; }
+    constexpr WideInt& operator-=(const WideInt& other) noexcept { *this = *this - other; return *this; }
+    constexpr WideInt& operator*=(const WideInt& other) noexcept { *this = *this * other; return *this; }
+    constexpr WideInt& operator/=(const WideInt& other) noexcept { *this = *this / other; return *this; }
+    constexpr WideInt& operator%=(const WideInt& other) noexcept { *this = *this % other; return *this; }
+
+    constexpr WideInt& operator++() noexcept { *this += WideInt{1}; return *this; }
+    constexpr WideInt operator++(int) noexcept { WideInt copy = *this; ++(*this); return copy; }
+    constexpr WideInt& operator--() noexcept { *this -= WideInt{1}; return *this; }
+    constexpr WideInt operator--(int) noexcept { WideInt copy = *this; --(*this); return copy; }
+
+// Bitwise operators
+public:
+    [[nodiscard]] constexpr WideInt operator~() const noexcept;
+    [[nodiscard]] constexpr WideInt operator&(const WideInt& other) const noexcept;
+    [[nodiscard]] constexpr WideInt operator|(const WideInt& other) const noexcept;
+    [[nodiscard]] constexpr WideInt operator^(const WideInt& other) const noexcept;
+
+    constexpr WideInt& operator&=(const WideInt& other) noexcept { *this = *this & other; return *this; }
+    constexpr WideInt& operator|=(const WideInt& other) noexcept { *this = *this | other; return *this; }
+    constexpr WideInt& operator^=(const WideInt& other) noexcept { *this = *this ^ other; return *this; }
+
+    /**
+     * @brief Shift left. Shifts of Bits or more give zero.
+     */
+    [[nodiscard]] constexpr WideInt operator<<(int shift) const noexcept;
+
+    /**
+     * @brief Shift right, filling with the sign bit if signed. Shifts of Bits or more leave only the fill.
+     */
+    [[nodiscard]] constexpr WideInt operator>>(int shift) const noexcept;
+
+    constexpr WideInt& operator<<=(int shift) noexcept { *this = *this << shift; return *this; }
+    constexpr WideInt& operator>>=(int shift) noexcept { *this = *this >> shift; return *this; }
+
+private:
+    /**
+     * @brief The number of words up to the most significant nonzero one.
+     */
+    [[nodiscard]] constexpr std::size_t significant_words() const noexcept;
+
+    /**
+     * @brief Knuth's algorithm D for an unsigned dividend and a divisor of at least two significant words.
+     */
+    static constexpr WideInt divide_long(const WideInt& dividend, const WideInt& divisor, WideInt& remainder) noexcept;
+
+    /**
+     * @brief Divide unsigned values, dispatching to the cheapest method for their sizes.
+     */
+    static constexpr WideInt divide_unsigned(const WideInt& dividend, const WideInt& divisor, WideInt& remainder) noexcept;
+
+    words_type m_words{};
+};
+
+/**
+ * @brief A 128-bit signed integer.
+ */
+using int128_t = WideInt<128, true>;
+
+/**
+ * @brief A 256-bit signed integer.
+ */
+using int256_t = WideInt<256, true>;
+
+/**
+ * @brief A 256-bit unsigned integer.
+ */
+using uint256_t = WideInt<256, false>;
+
+/**
+ * @brief A 512-bit signed integer.
+ */
+using int512_t = WideInt<512, true>;
+
+/**
+ * @brief A 512-bit unsigned integer.
+ */
+using uint512_t = WideInt<512, false>;
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+constexpr unsigned char add_with_carry(unsigned char carry, std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& sum) noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_WIDEINT_ADDCARRY
+    if !consteval
+    {
+        unsigned long long result = 0;
+        carry = _addcarry_u64(carry, lhs, rhs, &result);
+        sum = result;
+        return carry;
+    }
+#endif
+    return WideIntPortable::add_with_carry(carry, lhs, rhs, sum);
+}
+
+constexpr unsigned char subtract_with_borrow(unsigned char borrow, std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& difference) noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_WIDEINT_ADDCARRY
+    if !consteval
+    {
+        unsigned long long result = 0;
+        borrow = _subborrow_u64(borrow, lhs, rhs, &result);
+        difference = result;
+        return borrow;
+    }
+#endif
+    return WideIntPortable::subtract_with_borrow(borrow, lhs, rhs, difference);
+}
+
+template <std::size_t Bits, bool Signed>
+template <std::integral T>
+    requires(!std::same_as<T, bool>)
+constexpr WideInt<Bits, Signed>::WideInt(T value) noexcept
+{
+    if constexpr (std::is_signed_v<T>)
+    {
+        m_words[0] = static_cast<std::uint64_t>(static_cast<std::int64_t>(value));
+        if (value < 0)
+            for (std::size_t index = 1; index < word_count; ++index) m_words[index] = ~std::uint64_t{0};
+    }
+    else
+        m_words[0] = static_cast<std::uint64_t>(value);
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed>::WideInt(const uint128_t& value) noexcept
+{
+    m_words[0] = value.low();
+    m_words[1] = value.high();
+}
+
+template <std::size_t Bits, bool Signed>
+template <std::size_t OtherBits, bool OtherSigned>
+    requires(OtherBits != Bits || OtherSigned != Signed)
+constexpr WideInt<Bits, Signed>::WideInt(const WideInt<OtherBits, OtherSigned>& other) noexcept
+{
+    const std::uint64_t fill = other.is_negative() ? ~std::uint64_t{0} : 0;
+    for (std::size_t index = 0; index < word_count; ++index) m_words[index] = index < other.word_count ? other.word(index) : fill;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::from_words(const words_type& words) noexcept
+{
+    WideInt result;
+    result.m_words = words;
+    return result;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr const typename WideInt<Bits, Signed>::words_type& WideInt<Bits, Signed>::words() const noexcept { return m_words; }
+
+template <std::size_t Bits, bool Signed>
+constexpr std::uint64_t WideInt<Bits, Signed>::word(std::size_t index) const noexcept { return m_words[index]; }
+
+template <std::size_t Bits, bool Signed>
+constexpr bool WideInt<Bits, Signed>::is_negative() const noexcept
+{
+    if constexpr (Signed)
+        return (m_words[word_count - 1] >> 63) != 0;
+    else
+        return false;
+}
+
+template <std::size_t Bits, bool Signed>
+template <std::integral T>
+    requires(!std::same_as<T, bool>)
+constexpr WideInt<Bits, Signed>::operator T() const noexcept
+{
+    return static_cast<T>(m_words[0]);
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed>::operator uint128_t() const noexcept { return uint128_t{m_words[1], m_words[0]}; }
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed>::operator bool() const noexcept
+{
+    std::uint64_t any = 0;
+    for (const std::uint64_t word : m_words) any |= word;
+    return any != 0;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::multiply(const WideInt& lhs, const WideInt& rhs, WideInt& high) noexcept
+    requires(!Signed)
+{
+    std::array<std::uint64_t, word_count * 2> product{};
+    for (std::size_t row = 0; row < word_count; ++row)
+    {
+        if (lhs.m_words[row] == 0) continue;
+        std::uint64_t carry = 0;
+        for (std::size_t column = 0; column < word_count; ++column)
+        {
+            // (2^64 - 1)^2 + 2 * (2^64 - 1) = 2^128 - 1, so the partial sum cannot overflow.
+            const uint128_t partial = uint128_t::multiply(lhs.m_words[row], rhs.m_words[column]) + uint128_t{product[row + column]} + uint128_t{carry};
+            product[row + column] = partial.low();
+            carry = partial.high();
+        }
+        product[row + word_count] = carry;
+    }
+    WideInt low;
+    for (std::size_t index = 0; index < word_count; ++index)
+    {
+        low.m_words[index] = product[index];
+        high.m_words[index] = product[index + word_count];
+    }
+    return low;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr std::uint64_t WideInt<Bits, Signed>::multiply_add(const WideInt& value, std::uint64_t factor, std::uint64_t addend, WideInt& result) noexcept
+    requires(!Signed)
+{
+    std::uint64_t carry = addend;
+    for (std::size_t index = 0; index < word_count; ++index)
+    {
+        const uint128_t partial = uint128_t::multiply(value.m_words[index], factor) + uint128_t{carry};
+        result.m_words[index] = partial.low();
+        carry = partial.high();
+    }
+    return carry;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::divide(const WideInt& dividend, const WideInt& divisor, WideInt& remainder) noexcept
+{
+    if constexpr (Signed)
+    {
+        using Unsigned = WideInt<Bits, false>;
+        const bool dividend_negative = dividend.is_negative();
+        const bool divisor_negative = divisor.is_negative();
+        const Unsigned numerator = dividend_negative ? -Unsigned{dividend} : Unsigned{dividend};
+        const Unsigned denominator = divisor_negative ? -Unsigned{divisor} : Unsigned{divisor};
+        Unsigned magnitude_remainder;
+        const Unsigned quotient = Unsigned::divide(numerator, denominator, magnitude_remainder);
+        remainder = WideInt{dividend_negative ? -magnitude_remainder : magnitude_remainder};
+        return WideInt{dividend_negative != divisor_negative ? -quotient : quotient};
+    }
+    else
+        return divide_unsigned(dividend, divisor, remainder);
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::divide(const WideInt& dividend, std::uint64_t divisor, std::uint64_t& remainder) noexcept
+    requires(!Signed)
+{
+    WideInt quotient;
+    std::uint64_t carry = 0;
+    for (std::size_t index = dividend.significant_words(); index-- > 0;)
+    {
+        // The carried remainder is below the divisor, so each quotient word fits in 64 bits.
+        uint128_t word_remainder;
+        quotient.m_words[index] = uint128_t::divide(uint128_t{carry, dividend.m_words[index]}, uint128_t{divisor}, word_remainder).low();
+        carry = word_remainder.low();
+    }
+    remainder = carry;
+    return quotient;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr std::size_t WideInt<Bits, Signed>::significant_words() const noexcept
+{
+    std::size_t count = word_count;
+    while (count != 0 && m_words[count - 1] == 0) --count;
+    return count;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::divide_unsigned(const WideInt& dividend, const WideInt& divisor, WideInt& remainder) noexcept
+{
+    const std::size_t divisor_words = divisor.significant_words();
+    const std::size_t dividend_words = dividend.significant_words();
+    if (dividend_words < divisor_words || (dividend_words == divisor_words && dividend < divisor))
+    {
+        remainder = dividend;
+        return WideInt{};
+    }
+    if (dividend_words <= 2)
+    {
+        uint128_t narrow_remainder;
+        const uint128_t quotient = uint128_t::divide(static_cast<uint128_t>(dividend), static_cast<uint128_t>(divisor), narrow_remainder);
+        remainder = WideInt{narrow_remainder};
+        return WideInt{quotient};
+    }
+    if (divisor_words == 1)
+    {
+        std::uint64_t word_remainder = 0;
+        const WideInt quotient = WideInt<Bits, false>::divide(dividend, divisor.m_words[0], word_remainder);
+        remainder = WideInt{word_remainder};
+        return quotient;
+    }
+    return divide_long(dividend, divisor, remainder);
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::divide_long(const WideInt& dividend, const WideInt& divisor, WideInt& remainder) noexcept
+{
+    const std::size_t divisor_words = divisor.significant_words();
+    const std::size_t dividend_words = dividend.significant_words();
+
+    // Normalize so the divisor's top bit is set, which makes each quotient digit estimate at most two too large.
+    const int shift = std::countl_zero(divisor.m_words[divisor_words - 1]);
+    std::array<std::uint64_t, word_count> normalized_divisor{};
+    std::array<std::uint64_t, word_count + 1> normalized_dividend{};
+    for (std::size_t index = divisor_words; index-- > 0;)
+    {
+        const std::uint64_t below = index == 0 || shift == 0 ? 0 : divisor.m_words[index - 1] >> (64 - shift);
+        normalized_divisor[index] = (divisor.m_words[index] << shift) | below;
+    }
+    normalized_dividend[dividend_words] = shift == 0 ? 0 : dividend.m_words[dividend_words - 1] >> (64 - shift);
+    for (std::size_t index = dividend_words; index-- > 0;)
+    {
+        const std::uint64_t below = index == 0 || shift == 0 ? 0 : dividend.m_words[index - 1] >> (64 - shift);
+        normalized_dividend[index] = (dividend.m_words[index] << shift) | below;
+    }
+
+    const std::uint64_t divisor_top = normalized_divisor[divisor_words - 1];
+    const std::uint64_t divisor_next = normalized_divisor[divisor_words - 2];
+    WideInt quotient;
+    for (std::size_t digit = dividend_words - divisor_words + 1; digit-- > 0;)
+    {
+        // Estimate the digit from the top two words of the partial remainder, then correct it with the next word.
+        const std::size_t top = digit + divisor_words;
+        uint128_t estimate_remainder;
+        uint128_t estimate = uint128_t::divide(uint128_t{normalized_dividend[top], normalized_dividend[top - 1]}, uint128_t{divisor_top}, estimate_remainder);
+        while (estimate.high() != 0 || uint128_t::multiply(estimate.low(), divisor_next) > uint128_t{estimate_remainder.low(), normalized_dividend[top - 2]})
+        {
+            --estimate;
+            estimate_remainder += uint128_t{divisor_top};
+            if (estimate_remainder.high() != 0) break;
+        }
+
+        // Subtract estimate * divisor from the partial remainder.
+        std::uint64_t product_carry = 0;
+        unsigned char borrow = 0;
+        for (std::size_t index = 0; index < divisor_words; ++index)
+        {
+            const uint128_t product = uint128_t::multiply(estimate.low(), normalized_divisor[index]) + uint128_t{product_carry};
+            product_carry = product.high();
+            borrow = subtract_with_borrow(borrow, normalized_dividend[digit + index], product.low(), normalized_dividend[digit + index]);
+        }
+        borrow = subtract_with_borrow(borrow, normalized_dividend[top], product_carry, normalized_dividend[top]);
+
+        // The estimate was still one too large in rare cases: add the divisor back.
+        std::uint64_t quotient_digit = estimate.low();
+        if (borrow != 0)
+        {
+            --quotient_digit;
+            unsigned char carry = 0;
+            for (std::size_t index = 0; index < divisor_words; ++index)
+                carry = add_with_carry(carry, normalized_dividend[digit + index], normalized_divisor[index], normalized_dividend[digit + index]);
+            normalized_dividend[top] += carry;
+        }
+        quotient.m_words[digit] = quotient_digit;
+    }
+
+    remainder = WideInt{};
+    for (std::size_t index = 0; index < divisor_words; ++index)
+    {
+        const std::uint64_t above = shift == 0 ? 0 : normalized_dividend[index + 1] << (64 - shift);
+        remainder.m_words[index] = (normalized_dividend[index] >> shift) | above;
+    }
+    return quotient;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::operator+(const WideInt& other) const noexcept
+{
+    WideInt result;
+    unsigned char carry = 0;
+    for (std::size_t index = 0; index < word_count; ++index) carry = add_with_carry(carry, m_words[index], other.m_words[index], result.m_words[index]);
+    return result;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::operator-(const WideInt& other) const noexcept
+{
+    WideInt result;
+    unsigned char borrow = 0;
+    for (std::size_t index = 0; index < word_count; ++index) borrow = subtract_with_borrow(borrow, m_words[index], other.m_words[index], result.m_words[index]);
+    return result;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::operator*(const WideInt& other) const noexcept
+{
+    // Only the products of words whose indices sum below word_count reach the kept bits.
+    WideInt result;
+    for (std::size_t row = 0; row < word_count; ++row)
+    {
+        if (m_words[row] == 0) continue;
+        std::uint64_t carry = 0;
+        for (std::size_t column = 0; row + column < word_count; ++column)
+        {
+            const uint128_t partial = uint128_t::multiply(m_words[row], other.m_words[column]) + uint128_t{result.m_words[row + column]} + uint128_t{carry};
+            result.m_words[row + column] = partial.low();
+            carry = partial.high();
+        }
+    }
+    return result;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::operator/(const WideInt& other) const noexcept
+{
+    WideInt remainder;
+    return divide(*this, other, remainder);
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::operator%(const WideInt& other) const noexcept
+{
+    WideInt remainder;
+    static_cast<void>(divide(*this, other, remainder));
+    return remainder;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::operator~() const noexcept
+{
+    WideInt result;
+    for (std::size_t index = 0; index < word_count; ++index) result.m_words[index] = ~m_words[index];
+    return result;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::operator&(const WideInt& other) const noexcept
+{
+    WideInt result;
+    for (std::size_t index = 0; index < word_count; ++index) result.m_words[index] = m_words[index] & other.m_words[index];
+    return result;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::operator|(const WideInt& other) const noexcept
+{
+    WideInt result;
+    for (std::size_t index = 0; index < word_count; ++index) result.m_words[index] = m_words[index] | other.m_words[index];
+    return result;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::operator^(const WideInt& other) const noexcept
+{
+    WideInt result;
+    for (std::size_t index = 0; index < word_count; ++index) result.m_words[index] = m_words[index] ^ other.m_words[index];
+    return result;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::operator<<(int shift) const noexcept
+{
+    WideInt result;
+    if (shift >= static_cast<int>(Bits)) return result;
+    const auto word_shift = static_cast<std::size_t>(shift / 64);
+    const int bit_shift = shift % 64;
+    for (std::size_t index = word_count; index-- > word_shift;)
+    {
+        const std::size_t source = index - word_shift;
+        const std::uint64_t below = bit_shift == 0 || source == 0 ? 0 : m_words[source - 1] >> (64 - bit_shift);
+        result.m_words[index] = (m_words[source] << bit_shift) | below;
+    }
+    return result;
+}
+
+template <std::size_t Bits, bool Signed>
+constexpr WideInt<Bits, Signed> WideInt<Bits, Signed>::operator>>(int shift) const noexcept
+{
+    const std::uint64_t fill = is_negative() ? ~std::uint64_t{0} : 0;
+    WideInt result;
+    result.m_words.fill(fill);
+    if (shift >= static_cast<int>(Bits)) return result;
+    const auto word_shift = static_cast<std::size_t>(shift / 64);
+    const int bit_shift = shift % 64;
+    for (std::size_t index = 0; index + word_shift < word_count; ++index)
+    {
+        const std::size_t source = index + word_shift;
+        const std::uint64_t above = source + 1 < word_count ? m_words[source + 1] : fill;
+        result.m_words[index] = bit_shift == 0 ? m_words[source] : (m_words[source] >> bit_shift) | (above << (64 - bit_shift));
+    }
+    return result;
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+/**
+ * @brief std::numeric_limits for WideInt, as for the built-in integers of the same width and signedness.
+ */
+template <std::size_t Bits, bool Signed>
+struct std::numeric_limits<Softloq::WHATWG::Infra::WideInt<Bits, Signed>>
+{
+    using type = Softloq::WHATWG::Infra::WideInt<Bits, Signed>;
+
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = Signed;
+    static constexpr bool is_integer = true;
+    static constexpr bool is_exact = true;
+    static constexpr bool has_infinity = false;
+    static constexpr bool has_quiet_NaN = false;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr std::float_round_style round_style = std::round_toward_zero;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = !Signed;
+    static constexpr int digits = static_cast<int>(Bits) - Signed;
+    static constexpr int digits10 = digits * 643 / 2136;
+    static constexpr int max_digits10 = 0;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = 0;
+    static constexpr int min_exponent10 = 0;
+    static constexpr int max_exponent = 0;
+    static constexpr int max_exponent10 = 0;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static constexpr type min() noexcept { return Signed ? type{1} << (static_cast<int>(Bits) - 1) : type{}; }
+    static constexpr type lowest() noexcept { return min(); }
+    static constexpr type max() noexcept { return ~min(); }
+    static constexpr type epsilon() noexcept { return type{}; }
+    static constexpr type round_error() noexcept { return type{}; }
+    static constexpr type infinity() noexcept { return type{}; }
+    static constexpr type quiet_NaN() noexcept { return type{}; }
+    static constexpr type signaling_NaN() noexcept { return type{}; }
+    static constexpr type denorm_min() noexcept { return type{}; }
+};
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp"
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_NUMBER_WIDEINT_WIDEINT_HPP
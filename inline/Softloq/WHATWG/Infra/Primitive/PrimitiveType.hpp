@@ -29,6 +29,7 @@ enum class PrimitiveType
     ByteSequence,
     CodePoint,
     CodeUnit,
+    String,
     Number
 };
 
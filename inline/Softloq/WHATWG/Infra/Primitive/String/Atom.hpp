@@ -0,0 +1,360 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/Atom.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the Atom type for the WHATWG Infra library, an interned immutable String compared by identity.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the Atom type and its global, thread-safe atom table.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_ATOM_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_ATOM_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/StaticAtoms.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief An interned, immutable String.
+ *
+ * Every Atom with the same code units refers to the same entry of a global atom table, so atoms are
+ * compared by pointer and hashed by a value computed once when the entry is created. Element names,
+ * attribute names and namespace URIs that repeat across a document are therefore compared in O(1)
+ * instead of code unit by code unit.
+ *
+ * The common vocabulary is pre-seeded as StaticAtom entries that are never freed and are found
+ * through a compile-time hash table without taking the table lock. Other atoms are reference
+ * counted; an entry whose last Atom is destroyed stays in the table until the next sweep, which the
+ * next intern runs once enough entries have become unused, or collect_unused() runs on demand.
+ * Destroying an Atom never locks the table. The table is safe to use from several threads.
+ *
+ * The default-constructed Atom is the empty string.
+ */
+class Atom final
+{
+public:
+    struct Entry;
+
+// Constructors and destructor
+public:
+    inline Atom() noexcept;
+
+    /**
+     * @brief Intern a String.
+     *
+     * @param value The String to intern.
+     */
+    inline explicit Atom(const String& value);
+
+    /**
+     * @brief Intern UTF-16 code units.
+     *
+     * @param value The code units to intern.
+     */
+    inline explicit Atom(std::u16string_view value);
+
+    /**
+     * @brief Get a static atom. This never looks up the table.
+     *
+     * @param value The static atom.
+     */
+    inline Atom(StaticAtom value);
+
+    inline Atom(const Atom& other) noexcept;
+    inline Atom(Atom&& other) noexcept;
+    inline ~Atom() noexcept;
+
+    inline Atom& operator=(const Atom& other) noexcept;
+    inline Atom& operator=(Atom&& other) noexcept;
+
+// Accessors
+public:
+    /**
+     * @brief Get the interned String.
+     *
+     * @return The String, which lives as long as the atom's table entry.
+     */
+    [[nodiscard]] inline const String& string() const noexcept;
+
+    /**
+     * @brief Get the hash of the atom, equal to the hash() of its String.
+     *
+     * @return The precomputed hash.
+     */
+    [[nodiscard]] inline std::size_t hash() const noexcept;
+
+    /**
+     * @brief Returns true if the atom is one of the pre-seeded StaticAtom entries or the empty string.
+     */
+    [[nodiscard]] inline bool is_static() const noexcept;
+
+// Atom table
+public:
+    /**
+     * @brief Remove the entries of the atom table that no Atom refers to any more.
+     *
+     * @return The number of entries removed.
+     */
+    static inline std::size_t collect_unused();
+
+    /**
+     * @brief Get the number of reference-counted entries in the atom table, including unused ones not yet collected.
+     *
+     * @return The number of dynamic entries.
+     */
+    [[nodiscard]] static inline std::size_t dynamic_count();
+
+// Operators
+public:
+    /**
+     * @brief Equality comparison: true if both atoms refer to the same table entry, i.e. hold the same code units.
+     *
+     * @param other The Atom to compare against.
+     */
+    [[nodiscard]] bool operator==(const Atom& other) const noexcept { return m_entry == other.m_entry; }
+
+    /**
+     * @brief Inequality comparison.
+     *
+     * @param other The Atom to compare against.
+     */
+    [[nodiscard]] bool operator!=(const Atom& other) const noexcept { return m_entry != other.m_entry; }
+
+private:
+    /**
+     * @brief Find or create the table entry for the given code units and take a reference to it.
+     */
+    template <typename Unit>
+    static inline const Entry* intern(std::span<const Unit> code_units);
+
+    static inline void retain(const Entry* entry) noexcept;
+    static inline void release(const Entry* entry) noexcept;
+
+    /**
+     * @brief The reference-counted entries of the atom table, keyed by hash.
+     */
+    struct Table;
+
+    /**
+     * @brief Get the atom table. It is never destroyed, so atoms with static storage duration stay valid at exit.
+     */
+    static inline Table& table();
+
+    /**
+     * @brief Remove the entries no Atom refers to any more. The table lock must be held.
+     */
+    static inline std::size_t sweep(Table& table);
+
+    /**
+     * @brief Get the entries of the static atoms, created on first use. They are never destroyed.
+     */
+    static inline const std::array<Entry, static_atom_count>& static_entries();
+
+    /**
+     * @brief The number of entries that must become unused before the next intern sweeps the table.
+     */
+    static constexpr std::size_t sweep_threshold = 1024;
+
+    const Entry* m_entry;
+};
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief An entry of the atom table.
+ */
+struct Atom::Entry
+{
+    String value;
+    std::size_t hash = 0;
+    mutable std::atomic<std::size_t> references{0};
+    bool is_static = false;
+};
+
+/**
+ * @brief The reference-counted entries of the atom table, keyed by hash.
+ */
+struct Atom::Table
+{
+    std::mutex mutex;
+    std::unordered_multimap<std::size_t, std::unique_ptr<Entry>> entries;
+    std::atomic<std::size_t> unused{0};
+};
+
+inline Atom::Table& Atom::table()
+{
+    static Table* const table = new Table;
+    return *table;
+}
+
+inline const std::array<Atom::Entry, static_atom_count>& Atom::static_entries()
+{
+    static const std::array<Entry, static_atom_count>* const entries = []
+    {
+        auto* result = new std::array<Entry, static_atom_count>;
+        for (std::size_t index = 0; index < static_atom_count; ++index)
+        {
+            Entry& entry = (*result)[index];
+            entry.value = String{static_atom_texts[index]};
+            entry.hash = hash_code_units(std::span<const char16_t>{static_atom_texts[index]});
+            entry.is_static = true;
+        }
+        return result;
+    }();
+    return *entries;
+}
+
+template <typename Unit>
+inline const Atom::Entry* Atom::intern(std::span<const Unit> code_units)
+{
+    if (code_units.empty()) return nullptr;
+    const std::size_t hash = hash_code_units(code_units);
+    if (const std::size_t index = find_static_atom(code_units, hash); index < static_atom_count) return &static_entries()[index];
+
+    Table& table = Atom::table();
+    std::lock_guard lock{table.mutex};
+    // Releases only count unused entries, so that destroying an Atom never locks; the sweep happens here.
+    if (table.unused.load(std::memory_order_relaxed) >= sweep_threshold) sweep(table);
+    const auto [first, last] = table.entries.equal_range(hash);
+    for (auto it = first; it != last; ++it)
+    {
+        Entry& entry = *it->second;
+        if (entry.value.visit([code_units](auto existing) { return std::ranges::equal(existing, code_units); }))
+        {
+            // Taking a reference under the lock lets a sweep never free an entry that is being revived.
+            entry.references.fetch_add(1, std::memory_order_relaxed);
+            return &entry;
+        }
+    }
+
+    auto entry = std::make_unique<Entry>();
+    if constexpr (std::is_same_v<Unit, std::uint8_t>)
+        entry->value = String::from_latin1(code_units);
+    else
+        entry->value = String{std::u16string_view{code_units.data(), code_units.size()}};
+    entry->hash = hash;
+    entry->references.store(1, std::memory_order_relaxed);
+    const Entry* result = entry.get();
+    table.entries.emplace(hash, std::move(entry));
+    return result;
+}
+
+inline void Atom::retain(const Entry* entry) noexcept
+{
+    if (entry && !entry->is_static) entry->references.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void Atom::release(const Entry* entry) noexcept
+{
+    if (!entry || entry->is_static) return;
+    if (entry->references.fetch_sub(1, std::memory_order_acq_rel) == 1) table().unused.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline Atom::Atom() noexcept
+    : m_entry{nullptr}
+{
+}
+
+inline Atom::Atom(const String& value)
+    : m_entry{value.visit([](auto code_units) { return intern(code_units); })}
+{
+}
+
+inline Atom::Atom(std::u16string_view value)
+    : m_entry{intern(std::span<const char16_t>{value})}
+{
+}
+
+inline Atom::Atom(StaticAtom value)
+    : m_entry{&static_entries()[static_cast<std::size_t>(value)]}
+{
+}
+
+inline Atom::Atom(const Atom& other) noexcept
+    : m_entry{other.m_entry}
+{
+    retain(m_entry);
+}
+
+inline Atom::Atom(Atom&& other) noexcept
+    : m_entry{std::exchange(other.m_entry, nullptr)}
+{
+}
+
+inline Atom::~Atom() noexcept { release(m_entry); }
+
+inline Atom& Atom::operator=(const Atom& other) noexcept
+{
+    retain(other.m_entry);
+    release(std::exchange(m_entry, other.m_entry));
+    return *this;
+}
+
+inline Atom& Atom::operator=(Atom&& other) noexcept
+{
+    if (this != &other) release(std::exchange(m_entry, std::exchange(other.m_entry, nullptr)));
+    return *this;
+}
+
+inline const String& Atom::string() const noexcept
+{
+    static const String empty;
+    return m_entry ? m_entry->value : empty;
+}
+
+inline std::size_t Atom::hash() const noexcept
+{
+    return m_entry ? m_entry->hash : hash_code_units(std::span<const char16_t>{});
+}
+
+inline bool Atom::is_static() const noexcept { return !m_entry || m_entry->is_static; }
+
+inline std::size_t Atom::collect_unused()
+{
+    Table& table = Atom::table();
+    std::lock_guard lock{table.mutex};
+    return sweep(table);
+}
+
+inline std::size_t Atom::sweep(Table& table)
+{
+    table.unused.store(0, std::memory_order_relaxed);
+    return std::erase_if(table.entries, [](const auto& item) { return item.second->references.load(std::memory_order_acquire) == 0; });
+}
+
+inline std::size_t Atom::dynamic_count()
+{
+    Table& table = Atom::table();
+    std::lock_guard lock{table.mutex};
+    return table.entries.size();
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+/**
+ * @brief Hash specialization for the Atom type, returning its precomputed hash.
+ */
+template <>
+struct std::hash<Softloq::WHATWG::Infra::Atom>
+{
+    inline std::size_t operator()(const Softloq::WHATWG::Infra::Atom& value) const noexcept { return value.hash(); }
+};
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_ATOM_HPP
@@ -0,0 +1,25 @@
+/**
+ * @file inline/Softloq/WHATWG/Infra/Primitive/String/OStream.inl
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This file defines the output stream operator for the String primitive type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file defines the output stream operator for the String primitive type, allowing it to be
+ * printed to output streams. When the String primitive is printed, it will be written as UTF-8
+ * text, with lone surrogates replaced by U+FFFD.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_OSTREAM_INL
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_OSTREAM_INL
+
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include <format>
+#include <ostream>
+
+inline std::ostream& operator<<(std::ostream& os, const Softloq::WHATWG::Infra::String& value)
+{
+    return os << std::format("{}", value);
+}
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_OSTREAM_INL
@@ -0,0 +1,1305 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/String.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the String type for the WHATWG Infra library, representing a sequence of UTF-16 code units in the context of web APIs.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the String type for the WHATWG Infra library.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRING_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRING_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Primitive.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/CodePoint/CodePoint.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/CodeUnit/CodeUnit.hpp"
+#include "Softloq/WHATWG/Infra/SIMD/ClassScan.hpp"
+#include "Softloq/WHATWG/Infra/SIMD/Mismatch.hpp"
+#include <algorithm>
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief Thresholds that decide when concatenating Strings builds a rope instead of copying.
+ */
+struct StringRopeThresholds
+{
+    /**
+     * @brief Concatenations shorter than this many code units are copied into a flat String.
+     */
+    std::size_t min_length = 256;
+
+    /**
+     * @brief Concatenations that would make a rope deeper than this are flattened instead.
+     */
+    std::size_t max_depth = 512;
+};
+
+/**
+ * @brief Thresholds that decide when a substring shares its String's buffer instead of copying.
+ */
+struct StringSliceThresholds
+{
+    /**
+     * @brief Substrings shorter than this many code units are copied, which is cheaper than sharing.
+     */
+    std::size_t min_length = 32;
+
+    /**
+     * @brief A substring is copied instead of shared if the buffer it would keep alive is more than this many times its length.
+     *
+     * 0 copies every substring.
+     */
+    std::size_t max_waste_ratio = 16;
+};
+
+/**
+ * @brief Hash a sequence of code units with 64-bit FNV-1a, reduced to std::size_t.
+ *
+ * Each code unit is hashed as its 16-bit value, so 8-bit and UTF-16 storage of the same code units
+ * hash equal.
+ *
+ * @param code_units The code units to hash.
+ * @return The hash.
+ */
+template <typename Unit>
+[[nodiscard]] constexpr std::size_t hash_code_units(std::span<const Unit> code_units) noexcept;
+
+/**
+ * @brief The String type represents a sequence of UTF-16 code units in the context of web APIs.
+ *
+ * The String type represents a sequence of zero or more 16-bit unsigned integers (code units), as
+ * defined by the WHATWG Infra specification. Most strings on the web are ASCII or Latin-1, so a
+ * String stores one byte per code unit whenever every code unit is at most 0x00FF (the 8-bit, or
+ * Latin-1, representation) and widens to two bytes per code unit only when a larger code unit is
+ * stored. The representation never changes the value: an 8-bit String and a UTF-16 String holding
+ * the same code units compare equal.
+ *
+ * The visit() member hands the storage to byte- or code-unit-level algorithms as a
+ * std::span<const std::uint8_t> or std::span<const char16_t>, so the vectorized operations run on
+ * narrow strings directly.
+ *
+ * Concatenating long Strings with concat() or operator+ builds a rope: a shared tree node that
+ * refers to both operands instead of copying them. The first access to the code units of a rope
+ * flattens it into a buffer cached in the tree node. Flattening is synchronized, so a rope can be
+ * read from several threads like any other String.
+ *
+ * The hash, whether the String is ASCII or a scalar value string, and its length in code points are
+ * computed on first use and cached in the String until it is mutated, so repeated checks on
+ * immutable Strings such as dictionary keys and atoms cost O(1). The cache is updated atomically,
+ * so it may be filled from several threads reading the same String.
+ *
+ * A code unit substring of a long String is a slice: it refers to a window of the parent's buffer,
+ * which is immutable and kept alive by an atomic reference count, instead of copying the code
+ * units. Slices that would keep a much larger buffer alive are copied out instead. Mutating a slice
+ * first copies its window into a buffer of its own.
+ *
+ * Code point access on a long UTF-16 String with surrogate pairs uses a sparse index built on first
+ * use, which records the code unit offset of every code_point_index_stride-th code point. Mapping
+ * between code point and code unit offsets then walks at most one stride instead of the whole
+ * String.
+ */
+class String final : public Primitive<PrimitiveType::String>
+{
+public:
+    using Latin1Buffer = std::vector<std::uint8_t>;
+    using UTF16Buffer = std::vector<char16_t>;
+    struct RopeNode;
+    using RopeBuffer = std::shared_ptr<const RopeNode>;
+
+    /**
+     * @brief A window of code units in a buffer shared with other Strings.
+     */
+    struct SliceBuffer
+    {
+        /**
+         * @brief The owner of the shared buffer, which the slice keeps alive.
+         */
+        std::shared_ptr<const void> owner;
+
+        /**
+         * @brief The first code unit of the window: a std::uint8_t if is_8bit, a char16_t otherwise.
+         */
+        const void* data = nullptr;
+
+        /**
+         * @brief The number of code units in the window.
+         */
+        std::size_t length = 0;
+
+        /**
+         * @brief The number of code units in the whole shared buffer.
+         */
+        std::size_t owner_length = 0;
+
+        bool is_8bit = true;
+    };
+    struct CodePointIndex;
+
+    /**
+     * @brief The number of code points between two entries of the code point index.
+     */
+    static constexpr std::size_t code_point_index_stride = 64;
+
+    /**
+     * @brief UTF-16 Strings shorter than this many code units map code point offsets without an index.
+     */
+    static constexpr std::size_t code_point_index_min_length = 256;
+
+// Constructors and destructor
+public:
+    constexpr String() noexcept;
+
+    /**
+     * @brief Construct a String from UTF-16 code units, using the 8-bit representation when they all fit.
+     *
+     * @param code_units The code units of the string. Lone surrogates are kept as they are.
+     */
+    constexpr explicit String(std::u16string_view code_units);
+
+    /**
+     * @brief Construct a String from code points, encoding supplementary code points as surrogate pairs.
+     *
+     * @param code_points The code points of the string.
+     */
+    constexpr explicit String(std::u32string_view code_points);
+
+    constexpr String(const String& other);
+    constexpr String(String&& other) noexcept;
+    constexpr ~String() noexcept;
+
+    constexpr String& operator=(const String& other);
+    constexpr String& operator=(String&& other) noexcept;
+
+    /**
+     * @brief Construct an 8-bit String whose code units are the given Latin-1 bytes.
+     *
+     * @param bytes The bytes, each becoming the code unit of equal value.
+     * @return The String.
+     */
+    [[nodiscard]] static constexpr String from_latin1(std::span<const std::uint8_t> bytes);
+
+    /**
+     * @brief Construct an 8-bit String whose code units are the given Latin-1 characters.
+     *
+     * @param bytes The characters, each read as an unsigned byte becoming the code unit of equal value.
+     * @return The String.
+     */
+    [[nodiscard]] static constexpr String from_latin1(std::string_view bytes);
+
+    /**
+     * @brief Construct an 8-bit String that takes ownership of a buffer of code units without copying it.
+     *
+     * @param code_units The code units, one byte each.
+     * @return The String.
+     */
+    [[nodiscard]] static constexpr String from_buffer(Latin1Buffer&& code_units) noexcept;
+
+    /**
+     * @brief Construct a UTF-16 String that takes ownership of a buffer of code units without copying it.
+     *
+     * The buffer is kept in the UTF-16 representation even if every code unit would fit in 8 bits;
+     * call try_narrow() to switch.
+     *
+     * @param code_units The code units.
+     * @return The String.
+     */
+    [[nodiscard]] static constexpr String from_buffer(UTF16Buffer&& code_units) noexcept;
+
+    /**
+     * @brief Concatenate two Strings, building a rope when the result is long enough.
+     *
+     * The result is a rope referring to both operands if it has at least thresholds.min_length code
+     * units and the rope would be at most thresholds.max_depth deep; otherwise the code units are
+     * copied into a flat String. Concatenating ropes only copies their shared tree nodes, so
+     * repeatedly concatenating fragments is linear rather than quadratic.
+     *
+     * @param lhs The first String.
+     * @param rhs The second String.
+     * @param thresholds The rope thresholds.
+     * @return The concatenation of lhs and rhs.
+     */
+    [[nodiscard]] static constexpr String concat(String lhs, String rhs, const StringRopeThresholds& thresholds = {});
+
+// Representation
+public:
+    /**
+     * @brief Returns true if the String uses the 8-bit (Latin-1) representation.
+     */
+    [[nodiscard]] constexpr bool is_8bit() const noexcept;
+
+    /**
+     * @brief Returns true if the String is a rope that has not been flattened yet.
+     */
+    [[nodiscard]] constexpr bool is_rope() const noexcept;
+
+    /**
+     * @brief Returns true if the String is a slice sharing another String's buffer.
+     */
+    [[nodiscard]] constexpr bool is_slice() const noexcept;
+
+    /**
+     * @brief Replace a rope or a slice with a flat buffer of its own holding the same code units. Does nothing if the String is already flat.
+     */
+    constexpr void flatten();
+
+    /**
+     * @brief Get the code units of an 8-bit String, flattening it first if it is a rope.
+     *
+     * @return The code units, one byte each; empty if the String is not 8-bit.
+     */
+    [[nodiscard]] constexpr std::span<const std::uint8_t> latin1_span() const;
+
+    /**
+     * @brief Get the code units of a UTF-16 String, flattening it first if it is a rope.
+     *
+     * @return The code units; empty if the String is 8-bit.
+     */
+    [[nodiscard]] constexpr std::span<const char16_t> utf16_span() const;
+
+    /**
+     * @brief Switch to the UTF-16 representation. The code units are unchanged.
+     */
+    constexpr void widen();
+
+    /**
+     * @brief Switch to the 8-bit representation if every code unit is at most 0x00FF.
+     *
+     * @return true if the String is 8-bit afterwards.
+     */
+    constexpr bool try_narrow();
+
+    /**
+     * @brief Call a visitor with the storage of the String, flattening it first if it is a rope.
+     *
+     * The visitor is called with a std::span<const std::uint8_t> for an 8-bit String and a
+     * std::span<const char16_t> otherwise, and must return the same type for both.
+     *
+     * @param visitor The callable to invoke.
+     * @return The visitor's result.
+     */
+    template <typename F>
+    constexpr decltype(auto) visit(F&& visitor) const;
+
+// Container interface
+public:
+    /**
+     * @brief Get the length of the String in code units.
+     *
+     * @return The number of code units.
+     */
+    [[nodiscard]] constexpr std::size_t size() const noexcept;
+
+    /**
+     * @brief Returns true if the String contains no code units.
+     */
+    [[nodiscard]] constexpr bool is_empty() const noexcept;
+
+    /**
+     * @brief Access a code unit by index without bounds checking, flattening a rope first.
+     *
+     * @param index The index of the code unit.
+     * @return The code unit at the given index.
+     */
+    [[nodiscard]] constexpr CodeUnit operator[](std::size_t index) const;
+
+    /**
+     * @brief Access a code unit by index with bounds checking.
+     *
+     * @param index The index of the code unit.
+     * @return The code unit at the given index.
+     * @throws std::out_of_range if index is out of bounds.
+     */
+    [[nodiscard]] constexpr CodeUnit at(std::size_t index) const;
+
+    /**
+     * @brief Append a code unit, widening the String if it does not fit in 8 bits.
+     *
+     * @param code_unit The code unit to append.
+     */
+    constexpr void push_back(CodeUnit code_unit);
+
+    /**
+     * @brief Append the code units of another String, widening this String only if the other is not 8-bit.
+     *
+     * A flat String grows its buffer in place. A rope String is extended with concat() instead.
+     *
+     * @param other The String to append.
+     */
+    constexpr void append(const String& other);
+
+    /**
+     * @brief Remove all code units. The String becomes 8-bit.
+     */
+    constexpr void clear() noexcept;
+
+    /**
+     * @brief Get the code unit substring from start with the given length.
+     *
+     * As defined by the WHATWG Infra specification: the code units of the String from index start,
+     * length of them. A substring of at least thresholds.min_length code units is a slice sharing
+     * this String's buffer, unless the buffer is more than thresholds.max_waste_ratio times longer
+     * than the substring; then, like shorter substrings, it is copied.
+     *
+     * A flat String first moves its buffer into shared storage, without copying it, so that this
+     * String and its slices share it. Because that changes the storage, this overload is not const;
+     * the const overload shares only a buffer that is already shared (a slice or a rope) and copies
+     * otherwise.
+     *
+     * @param start The index of the first code unit.
+     * @param length The number of code units.
+     * @param thresholds The slice thresholds.
+     * @return The substring.
+     * @throws std::out_of_range if start + length is greater than size().
+     */
+    [[nodiscard]] constexpr String code_unit_substring(std::size_t start, std::size_t length, const StringSliceThresholds& thresholds = {});
+
+    /**
+     * @brief Get the code unit substring from start with the given length, sharing the buffer only if it is already shared.
+     *
+     * @see code_unit_substring(std::size_t, std::size_t, const StringSliceThresholds&)
+     */
+    [[nodiscard]] constexpr String code_unit_substring(std::size_t start, std::size_t length, const StringSliceThresholds& thresholds = {}) const;
+
+// Conversion
+public:
+    /**
+     * @brief Get a copy of the code units as a std::u16string.
+     *
+     * @return The code units of the String.
+     */
+    [[nodiscard]] constexpr std::u16string to_utf16() const;
+
+    /**
+     * @brief Hash the code units of the String, independent of its representation.
+     *
+     * @return The hash_code_units() of the code units.
+     */
+    [[nodiscard]] constexpr std::size_t hash() const;
+
+// Cached properties
+public:
+    /**
+     * @brief Returns true if every code unit is an ASCII code point (at most 0x007F).
+     */
+    [[nodiscard]] constexpr bool is_ascii() const;
+
+    /**
+     * @brief Returns true if the String is a scalar value string, i.e. contains no lone surrogates.
+     */
+    [[nodiscard]] constexpr bool is_scalar_value_string() const;
+
+    /**
+     * @brief Get the length of the String in code points, counting a surrogate pair as one code point and a lone surrogate as one.
+     *
+     * @return The number of code points.
+     */
+    [[nodiscard]] constexpr std::size_t code_point_length() const;
+
+// Code points
+public:
+    /**
+     * @brief Get the code point at a code point index, decoding surrogate pairs.
+     *
+     * A lone surrogate is its own code point. For long UTF-16 Strings this uses the code point index.
+     *
+     * @param index The index of the code point.
+     * @return The code point.
+     * @throws std::out_of_range if index is not less than code_point_length().
+     */
+    [[nodiscard]] constexpr CodePoint code_point_at(std::size_t index) const;
+
+    /**
+     * @brief Get the code unit offset at which a code point starts.
+     *
+     * @param code_point_offset The index of the code point; code_point_length() maps to size().
+     * @return The offset of its first code unit.
+     * @throws std::out_of_range if code_point_offset is greater than code_point_length().
+     */
+    [[nodiscard]] constexpr std::size_t code_unit_offset(std::size_t code_point_offset) const;
+
+    /**
+     * @brief Get the index of the code point that contains a code unit.
+     *
+     * The trailing surrogate of a pair belongs to the code point of the pair.
+     *
+     * @param code_unit_offset The offset of the code unit; size() maps to code_point_length().
+     * @return The index of the code point.
+     * @throws std::out_of_range if code_unit_offset is greater than size().
+     */
+    [[nodiscard]] constexpr std::size_t code_point_offset(std::size_t code_unit_offset) const;
+
+// Operators
+public:
+    /**
+     * @brief Equality comparison: true if both Strings hold the same code units, whatever their representations.
+     *
+     * @param other The String to compare against.
+     */
+    [[nodiscard]] constexpr bool operator==(const String& other) const;
+
+    /**
+     * @brief Inequality comparison.
+     *
+     * @param other The String to compare against.
+     */
+    [[nodiscard]] constexpr bool operator!=(const String& other) const;
+
+    /**
+     * @brief Three-way comparison by the WHATWG Infra code unit less than ordering.
+     *
+     * The Strings are compared code unit by code unit; at the first difference, the String with the
+     * smaller code unit is less, and if one String is a prefix of the other, the shorter is less.
+     * The common prefix is skipped sixteen bytes at a time, also when one String is 8-bit and the
+     * other UTF-16.
+     *
+     * @param other The String to compare against.
+     * @return The ordering of this String relative to other.
+     */
+    [[nodiscard]] constexpr std::strong_ordering operator<=>(const String& other) const;
+
+private:
+    /**
+     * @brief Get the depth of the rope, or 0 if the String is flat.
+     */
+    [[nodiscard]] constexpr std::size_t rope_depth() const noexcept;
+
+    /**
+     * @brief Move a flat buffer into shared storage, turning the String into a slice of all of it.
+     */
+    constexpr void share();
+
+    /**
+     * @brief The bits of m_properties telling which cached properties are known, and their boolean values.
+     */
+    enum PropertyBits : std::uint32_t
+    {
+        HashKnown = 1u << 0,
+        ScanKnown = 1u << 1,
+        ASCIIBit = 1u << 2,
+        ScalarValueBit = 1u << 3,
+    };
+
+    /**
+     * @brief Scan the code units for the ASCII, scalar value string and code point length properties.
+     *
+     * @param code_point_length Receives the length in code points.
+     * @return The property bits found, including ScanKnown.
+     */
+    constexpr std::uint32_t compute_properties(std::size_t& code_point_length) const;
+
+    /**
+     * @brief Get the property bits, scanning the code units first unless the scan is cached.
+     *
+     * @return The property bits after the scan.
+     */
+    constexpr std::uint32_t scan_properties() const;
+
+    /**
+     * @brief Returns true if the hashes of both Strings are cached and differ, so the Strings cannot be equal.
+     */
+    [[nodiscard]] constexpr bool hashes_differ(const String& other) const noexcept;
+
+    /**
+     * @brief Copy the cached properties of another String holding the same code units.
+     */
+    constexpr void copy_properties(const String& other) noexcept;
+
+    /**
+     * @brief Forget the cached properties and the code point index after the code units changed.
+     */
+    constexpr void invalidate_properties() noexcept;
+
+    /**
+     * @brief Take over the code point index of a String being moved from.
+     */
+    constexpr void take_code_point_index(String& other) noexcept;
+
+    /**
+     * @brief Get the code point index of a UTF-16 String, building it on first use.
+     */
+    const CodePointIndex& code_point_index() const;
+
+    /**
+     * @brief Returns true if every code unit is at most 0x00FF.
+     */
+    [[nodiscard]] static constexpr bool fits_latin1(std::span<const char16_t> code_units) noexcept;
+
+    /**
+     * @brief Returns the length of the longest prefix of the code units that all satisfy a code point class.
+     */
+    template <typename Unit>
+    [[nodiscard]] static constexpr std::size_t class_prefix_length(std::span<const Unit> code_units, std::span<const CodePointRange> ranges, bool inverted) noexcept;
+
+    /**
+     * @brief Compares two runs of code units by code unit less than.
+     */
+    template <typename L, typename R>
+    [[nodiscard]] static constexpr std::strong_ordering compare_code_units(std::span<const L> lhs, std::span<const R> rhs) noexcept;
+
+    /**
+     * @brief Returns the offset reached by advancing over a number of code points, a surrogate pair counting as one.
+     */
+    [[nodiscard]] static constexpr std::size_t advance_code_points(std::span<const char16_t> code_units, std::size_t offset, std::size_t count) noexcept;
+
+    /**
+     * @brief Returns true if a slice of length code units would waste its buffer: owner_length > length * max_waste_ratio, without overflowing.
+     */
+    [[nodiscard]] static constexpr bool wastes_buffer(std::size_t owner_length, std::size_t length, std::size_t max_waste_ratio) noexcept;
+
+    std::variant<Latin1Buffer, UTF16Buffer, RopeBuffer, SliceBuffer> m_units;
+    mutable std::atomic<std::uint32_t> m_properties{0};
+    mutable std::atomic<std::size_t> m_hash{0};
+    mutable std::atomic<std::size_t> m_code_point_length{0};
+    mutable std::atomic<const CodePointIndex*> m_code_point_index{nullptr};
+};
+
+/**
+ * @brief Concatenate two Strings with the default rope thresholds.
+ *
+ * @param lhs The first String.
+ * @param rhs The second String.
+ * @return The concatenation of lhs and rhs.
+ * @see String::concat
+ */
+[[nodiscard]] constexpr String operator+(String lhs, const String& rhs);
+
+/**
+ * @brief The code point index of a UTF-16 String.
+ */
+struct String::CodePointIndex
+{
+    /**
+     * @brief The code unit offset of code point i * code_point_index_stride, for each i.
+     */
+    std::vector<std::size_t> unit_offsets;
+};
+
+/**
+ * @brief An inner node of a rope: the concatenation of two Strings.
+ */
+struct String::RopeNode
+{
+    String left;
+    String right;
+    std::size_t length;
+    std::size_t depth;
+    bool is_8bit;
+    mutable std::once_flag flattened;
+    mutable std::variant<Latin1Buffer, UTF16Buffer> flat;
+
+    /**
+     * @brief Concatenate the leaves of the tree into a flat buffer on first use and return it.
+     */
+    const std::variant<Latin1Buffer, UTF16Buffer>& flat_units() const;
+};
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <typename Unit>
+constexpr std::size_t hash_code_units(std::span<const Unit> code_units) noexcept
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (const Unit unit : code_units)
+    {
+        hash ^= static_cast<std::uint16_t>(unit);
+        hash *= 0x100000001B3ull;
+    }
+    return static_cast<std::size_t>(hash);
+}
+
+template <typename F>
+constexpr decltype(auto) String::visit(F&& visitor) const
+{
+    if (is_8bit()) return std::forward<F>(visitor)(latin1_span());
+    return std::forward<F>(visitor)(utf16_span());
+}
+
+constexpr bool String::fits_latin1(std::span<const char16_t> code_units) noexcept
+{
+    if !consteval
+    {
+        constexpr CodePointRange latin1_range[1]{{0x0000, 0x00FF}};
+        return SIMD::class_prefix_length(code_units.data(), code_units.size(), latin1_range, false) == code_units.size();
+    }
+    return std::ranges::all_of(code_units, [](char16_t unit) { return unit <= 0xFF; });
+}
+
+template <typename Unit>
+constexpr std::size_t String::class_prefix_length(std::span<const Unit> code_units, std::span<const CodePointRange> ranges, bool inverted) noexcept
+{
+    if !consteval
+    {
+        return SIMD::class_prefix_length(code_units.data(), code_units.size(), ranges, inverted);
+    }
+    std::size_t length = 0;
+    while (length < code_units.size() && SIMD::unit_in_class(code_units[length], ranges, inverted)) ++length;
+    return length;
+}
+
+template <typename L, typename R>
+constexpr std::strong_ordering String::compare_code_units(std::span<const L> lhs, std::span<const R> rhs) noexcept
+{
+    const std::size_t common = std::min(lhs.size(), rhs.size());
+    std::size_t index = 0;
+    if !consteval
+    {
+        index = SIMD::mismatch(lhs.data(), rhs.data(), common);
+    }
+    else
+    {
+        while (index < common && lhs[index] == rhs[index]) ++index;
+    }
+    if (index < common) return static_cast<char16_t>(lhs[index]) <=> static_cast<char16_t>(rhs[index]);
+    return lhs.size() <=> rhs.size();
+}
+
+constexpr std::size_t String::advance_code_points(std::span<const char16_t> code_units, std::size_t offset, std::size_t count) noexcept
+{
+    for (; count > 0 && offset < code_units.size(); --count)
+    {
+        const char16_t unit = code_units[offset++];
+        if (unit >= 0xD800 && unit <= 0xDBFF && offset < code_units.size() && code_units[offset] >= 0xDC00 && code_units[offset] <= 0xDFFF) ++offset;
+    }
+    return offset;
+}
+
+constexpr bool String::wastes_buffer(std::size_t owner_length, std::size_t length, std::size_t max_waste_ratio) noexcept
+{
+    return owner_length != 0 && (max_waste_ratio == 0 || (owner_length - 1) / max_waste_ratio >= length);
+}
+
+inline const std::variant<String::Latin1Buffer, String::UTF16Buffer>& String::RopeNode::flat_units() const
+{
+    std::call_once(flattened, [this]
+    {
+        // Walk the tree with an explicit stack and copy the flat leaves in order.
+        std::vector<const String*> leaves;
+        std::vector<const String*> pending{&right, &left};
+        while (!pending.empty())
+        {
+            const String* node = pending.back();
+            pending.pop_back();
+            if (const auto* inner = std::get_if<RopeBuffer>(&node->m_units))
+            {
+                pending.push_back(&(*inner)->right);
+                pending.push_back(&(*inner)->left);
+            }
+            else
+                leaves.push_back(node);
+        }
+
+        const auto fill = [&leaves, this](auto& units)
+        {
+            units.reserve(length);
+            for (const String* leaf : leaves)
+                leaf->visit([&units](auto source) { units.insert(units.end(), source.begin(), source.end()); });
+        };
+        if (is_8bit)
+            fill(flat.emplace<Latin1Buffer>());
+        else
+            fill(flat.emplace<UTF16Buffer>());
+    });
+    return flat;
+}
+
+constexpr String::String() noexcept = default;
+
+constexpr String::String(std::u16string_view code_units)
+{
+    if (fits_latin1(code_units))
+        m_units.emplace<Latin1Buffer>(code_units.begin(), code_units.end());
+    else
+        m_units.emplace<UTF16Buffer>(code_units.begin(), code_units.end());
+}
+
+constexpr String::String(std::u32string_view code_points)
+{
+    const bool narrow = std::ranges::all_of(code_points, [](char32_t value) { return value <= 0xFF; });
+    if (narrow)
+    {
+        m_units.emplace<Latin1Buffer>(code_points.begin(), code_points.end());
+        return;
+    }
+    auto& units = m_units.emplace<UTF16Buffer>();
+    units.reserve(code_points.size());
+    for (char32_t value : code_points)
+    {
+        if (value >= 0x10000)
+        {
+            value -= 0x10000;
+            units.push_back(static_cast<char16_t>(0xD800 + (value >> 10)));
+            units.push_back(static_cast<char16_t>(0xDC00 + (value & 0x3FF)));
+        }
+        else
+            units.push_back(static_cast<char16_t>(value));
+    }
+}
+
+constexpr String::String(const String& other)
+    : m_units{other.m_units}
+{
+    copy_properties(other);
+}
+
+constexpr String::String(String&& other) noexcept
+    : m_units{std::exchange(other.m_units, {})}
+{
+    copy_properties(other);
+    take_code_point_index(other);
+    other.invalidate_properties();
+}
+
+constexpr String::~String() noexcept { invalidate_properties(); }
+
+constexpr String& String::operator=(const String& other)
+{
+    if (this == &other) return *this;
+    invalidate_properties();
+    m_units = other.m_units;
+    copy_properties(other);
+    return *this;
+}
+
+constexpr String& String::operator=(String&& other) noexcept
+{
+    if (this == &other) return *this;
+    invalidate_properties();
+    m_units = std::exchange(other.m_units, {});
+    copy_properties(other);
+    take_code_point_index(other);
+    other.invalidate_properties();
+    return *this;
+}
+
+constexpr String String::from_latin1(std::span<const std::uint8_t> bytes)
+{
+    String result;
+    result.m_units.emplace<Latin1Buffer>(bytes.begin(), bytes.end());
+    return result;
+}
+
+constexpr String String::from_latin1(std::string_view bytes)
+{
+    String result;
+    auto& units = result.m_units.emplace<Latin1Buffer>(bytes.size());
+    std::ranges::transform(bytes, units.begin(), [](char c) { return static_cast<std::uint8_t>(c); });
+    return result;
+}
+
+constexpr String String::from_buffer(Latin1Buffer&& code_units) noexcept
+{
+    String result;
+    result.m_units.emplace<Latin1Buffer>(std::move(code_units));
+    return result;
+}
+
+constexpr String String::from_buffer(UTF16Buffer&& code_units) noexcept
+{
+    String result;
+    result.m_units.emplace<UTF16Buffer>(std::move(code_units));
+    return result;
+}
+
+constexpr String String::concat(String lhs, String rhs, const StringRopeThresholds& thresholds)
+{
+    if (rhs.is_empty()) return lhs;
+    if (lhs.is_empty()) return rhs;
+    const std::size_t length = lhs.size() + rhs.size();
+    const std::size_t depth = std::max(lhs.rope_depth(), rhs.rope_depth()) + 1;
+    if (length < thresholds.min_length || depth > thresholds.max_depth)
+    {
+        lhs.flatten();
+        lhs.append(rhs);
+        return lhs;
+    }
+    if !consteval
+    {
+        const bool is_8bit = lhs.is_8bit() && rhs.is_8bit();
+        String result;
+        result.m_units = std::make_shared<const RopeNode>(std::move(lhs), std::move(rhs), length, depth, is_8bit);
+        return result;
+    }
+    // std::shared_ptr is not constexpr, so constant evaluation always concatenates flat.
+    lhs.append(rhs);
+    return lhs;
+}
+
+constexpr String operator+(String lhs, const String& rhs)
+{
+    return String::concat(std::move(lhs), rhs);
+}
+
+constexpr bool String::is_8bit() const noexcept
+{
+    if (const auto* rope = std::get_if<RopeBuffer>(&m_units)) return (*rope)->is_8bit;
+    if (const auto* slice = std::get_if<SliceBuffer>(&m_units)) return slice->is_8bit;
+    return std::holds_alternative<Latin1Buffer>(m_units);
+}
+
+constexpr bool String::is_rope() const noexcept { return std::holds_alternative<RopeBuffer>(m_units); }
+
+constexpr bool String::is_slice() const noexcept { return std::holds_alternative<SliceBuffer>(m_units); }
+
+constexpr std::size_t String::rope_depth() const noexcept
+{
+    if (const auto* rope = std::get_if<RopeBuffer>(&m_units)) return (*rope)->depth;
+    return 0;
+}
+
+constexpr void String::flatten()
+{
+    if (const auto* slice = std::get_if<SliceBuffer>(&m_units))
+    {
+        // Copy the window out, releasing this String's share of the buffer.
+        if (slice->is_8bit)
+        {
+            const auto* units = static_cast<const std::uint8_t*>(slice->data);
+            m_units = Latin1Buffer(units, units + slice->length);
+        }
+        else
+        {
+            const auto* units = static_cast<const char16_t*>(slice->data);
+            m_units = UTF16Buffer(units, units + slice->length);
+        }
+        return;
+    }
+    const auto* rope = std::get_if<RopeBuffer>(&m_units);
+    if (!rope) return;
+    const RopeNode& node = **rope;
+    node.flat_units();
+    // The last owner of the node can take its buffer instead of copying it.
+    auto units = rope->use_count() == 1 ? std::move(node.flat) : node.flat;
+    if (auto* latin1 = std::get_if<Latin1Buffer>(&units))
+        m_units = std::move(*latin1);
+    else
+        m_units = std::move(std::get<UTF16Buffer>(units));
+}
+
+constexpr std::span<const std::uint8_t> String::latin1_span() const
+{
+    if (const auto* latin1 = std::get_if<Latin1Buffer>(&m_units)) return *latin1;
+    if (const auto* slice = std::get_if<SliceBuffer>(&m_units); slice && slice->is_8bit) return {static_cast<const std::uint8_t*>(slice->data), slice->length};
+    if (const auto* rope = std::get_if<RopeBuffer>(&m_units))
+        if (const auto* latin1 = std::get_if<Latin1Buffer>(&(*rope)->flat_units())) return *latin1;
+    return {};
+}
+
+constexpr std::span<const char16_t> String::utf16_span() const
+{
+    if (const auto* utf16 = std::get_if<UTF16Buffer>(&m_units)) return *utf16;
+    if (const auto* slice = std::get_if<SliceBuffer>(&m_units); slice && !slice->is_8bit) return {static_cast<const char16_t*>(slice->data), slice->length};
+    if (const auto* rope = std::get_if<RopeBuffer>(&m_units))
+        if (const auto* utf16 = std::get_if<UTF16Buffer>(&(*rope)->flat_units())) return *utf16;
+    return {};
+}
+
+constexpr void String::widen()
+{
+    flatten();
+    if (const auto* latin1 = std::get_if<Latin1Buffer>(&m_units))
+    {
+        UTF16Buffer units(latin1->begin(), latin1->end());
+        m_units = std::move(units);
+    }
+}
+
+constexpr bool String::try_narrow()
+{
+    flatten();
+    if (const auto* utf16 = std::get_if<UTF16Buffer>(&m_units))
+    {
+        if (!fits_latin1(*utf16)) return false;
+        Latin1Buffer units(utf16->size());
+        std::ranges::transform(*utf16, units.begin(), [](char16_t unit) { return static_cast<std::uint8_t>(unit); });
+        m_units = std::move(units);
+    }
+    return true;
+}
+
+constexpr std::size_t String::size() const noexcept
+{
+    if (const auto* rope = std::get_if<RopeBuffer>(&m_units)) return (*rope)->length;
+    if (const auto* slice = std::get_if<SliceBuffer>(&m_units)) return slice->length;
+    if (const auto* latin1 = std::get_if<Latin1Buffer>(&m_units)) return latin1->size();
+    return std::get<UTF16Buffer>(m_units).size();
+}
+
+constexpr bool String::is_empty() const noexcept { return size() == 0; }
+
+constexpr CodeUnit String::operator[](std::size_t index) const
+{
+    return visit([index](auto units) { return CodeUnit{static_cast<std::uint16_t>(units[index])}; });
+}
+
+constexpr CodeUnit String::at(std::size_t index) const
+{
+    if (index >= size()) throw std::out_of_range("String::at: index out of range");
+    return (*this)[index];
+}
+
+constexpr void String::push_back(CodeUnit code_unit)
+{
+    flatten();
+    const std::uint16_t value = code_unit.get_value();
+    invalidate_properties();
+    if (auto* latin1 = std::get_if<Latin1Buffer>(&m_units); latin1 && value <= 0xFF)
+    {
+        latin1->push_back(static_cast<std::uint8_t>(value));
+        return;
+    }
+    widen();
+    std::get<UTF16Buffer>(m_units).push_back(static_cast<char16_t>(value));
+}
+
+constexpr void String::append(const String& other)
+{
+    if (is_rope())
+    {
+        // Copy other first: it may be *this, and concat's arguments may be initialized in either order.
+        String tail{other};
+        *this = concat(std::move(*this), std::move(tail));
+        return;
+    }
+    flatten();
+    invalidate_properties();
+    if (&other == this)
+    {
+        // Inserting a range of the buffer being grown breaks vector::insert, so resize and copy the old prefix instead.
+        const std::size_t length = size();
+        if (auto* latin1 = std::get_if<Latin1Buffer>(&m_units))
+        {
+            latin1->resize(length * 2);
+            std::copy_n(latin1->begin(), length, latin1->begin() + static_cast<std::ptrdiff_t>(length));
+        }
+        else
+        {
+            auto& units = std::get<UTF16Buffer>(m_units);
+            units.resize(length * 2);
+            std::copy_n(units.begin(), length, units.begin() + static_cast<std::ptrdiff_t>(length));
+        }
+        return;
+    }
+    if (auto* latin1 = std::get_if<Latin1Buffer>(&m_units); latin1 && other.is_8bit())
+    {
+        const auto source = other.latin1_span();
+        latin1->insert(latin1->end(), source.begin(), source.end());
+        return;
+    }
+    widen();
+    auto& units = std::get<UTF16Buffer>(m_units);
+    other.visit([&units](auto source) { units.insert(units.end(), source.begin(), source.end()); });
+}
+
+constexpr void String::clear() noexcept
+{
+    m_units.emplace<Latin1Buffer>();
+    invalidate_properties();
+}
+
+constexpr String String::code_unit_substring(std::size_t start, std::size_t length, const StringSliceThresholds& thresholds)
+{
+    if (std::holds_alternative<Latin1Buffer>(m_units) || std::holds_alternative<UTF16Buffer>(m_units))
+    {
+        // Sharing is only worth it for a substring that the const overload would slice.
+        if (start <= size() && length <= size() - start && length >= thresholds.min_length && !wastes_buffer(size(), length, thresholds.max_waste_ratio)) share();
+    }
+    return std::as_const(*this).code_unit_substring(start, length, thresholds);
+}
+
+constexpr String String::code_unit_substring(std::size_t start, std::size_t length, const StringSliceThresholds& thresholds) const
+{
+    if (start > size() || length > size() - start) throw std::out_of_range("String::code_unit_substring: range out of bounds");
+    String result;
+    const auto* slice = std::get_if<SliceBuffer>(&m_units);
+    const auto* rope = std::get_if<RopeBuffer>(&m_units);
+    const std::size_t owner_length = slice ? slice->owner_length : size();
+    if ((!slice && !rope) || length < thresholds.min_length || wastes_buffer(owner_length, length, thresholds.max_waste_ratio))
+    {
+        if (is_8bit())
+            result.m_units.emplace<Latin1Buffer>(latin1_span().subspan(start, length).begin(), latin1_span().subspan(start, length).end());
+        else
+            result = String{std::u16string_view{utf16_span().data() + start, length}};
+        return result;
+    }
+
+    SliceBuffer window;
+    if (slice)
+        window = *slice;
+    else
+    {
+        // A rope's flat buffer lives in its tree node, so the slice keeps the node alive.
+        window.owner = *rope;
+        window.owner_length = size();
+        window.is_8bit = is_8bit();
+        window.data = window.is_8bit ? static_cast<const void*>(latin1_span().data()) : static_cast<const void*>(utf16_span().data());
+    }
+    window.data = static_cast<const std::uint8_t*>(window.data) + start * (window.is_8bit ? 1 : 2);
+    window.length = length;
+    result.m_units = std::move(window);
+    return result;
+}
+
+constexpr void String::share()
+{
+    // std::shared_ptr is not constexpr, so constant evaluation never shares and always copies.
+    if consteval
+    {
+        return;
+    }
+    const auto share_buffer = [this](auto&& units, bool is_8bit)
+    {
+        using Buffer = std::remove_cvref_t<decltype(units)>;
+        auto owner = std::make_shared<const Buffer>(std::move(units));
+        const void* data = owner->data();
+        const std::size_t length = owner->size();
+        m_units = SliceBuffer{std::move(owner), data, length, length, is_8bit};
+    };
+    if (auto* latin1 = std::get_if<Latin1Buffer>(&m_units))
+        share_buffer(std::move(*latin1), true);
+    else if (auto* utf16 = std::get_if<UTF16Buffer>(&m_units))
+        share_buffer(std::move(*utf16), false);
+}
+
+constexpr std::u16string String::to_utf16() const
+{
+    return visit([](auto units) { return std::u16string(units.begin(), units.end()); });
+}
+
+constexpr std::size_t String::hash() const
+{
+    if consteval
+    {
+        return visit([](auto units) { return hash_code_units(units); });
+    }
+    if (m_properties.load(std::memory_order_acquire) & HashKnown) return m_hash.load(std::memory_order_relaxed);
+    const std::size_t hash = visit([](auto units) { return hash_code_units(units); });
+    m_hash.store(hash, std::memory_order_relaxed);
+    m_properties.fetch_or(HashKnown, std::memory_order_release);
+    return hash;
+}
+
+constexpr bool String::is_ascii() const { return scan_properties() & ASCIIBit; }
+
+constexpr bool String::is_scalar_value_string() const { return scan_properties() & ScalarValueBit; }
+
+constexpr std::size_t String::code_point_length() const
+{
+    if consteval
+    {
+        std::size_t length = 0;
+        (void)compute_properties(length);
+        return length;
+    }
+    scan_properties();
+    return m_code_point_length.load(std::memory_order_relaxed);
+}
+
+constexpr std::uint32_t String::compute_properties(std::size_t& code_point_length) const
+{
+    constexpr CodePointRange ascii_range[1]{{0x0000, 0x007F}};
+    constexpr CodePointRange surrogate_range[1]{{0xD800, 0xDFFF}};
+    std::uint32_t bits = ScanKnown;
+    std::size_t length = size();
+    if (is_8bit())
+    {
+        const auto units = latin1_span();
+        bits |= ScalarValueBit;
+        if (class_prefix_length(units, ascii_range, false) == units.size()) bits |= ASCIIBit;
+    }
+    else
+    {
+        const auto units = utf16_span();
+        if (class_prefix_length(units, ascii_range, false) == units.size()) bits |= ASCIIBit;
+        bool scalar = true;
+        // Everything before the first surrogate is one code point per code unit.
+        for (std::size_t index = class_prefix_length(units, surrogate_range, true); index < units.size(); ++index)
+        {
+            const char16_t unit = units[index];
+            if (unit < 0xD800 || unit > 0xDFFF) continue;
+            if (unit <= 0xDBFF && index + 1 < units.size() && units[index + 1] >= 0xDC00 && units[index + 1] <= 0xDFFF)
+            {
+                --length;
+                ++index;
+            }
+            else
+                scalar = false;
+        }
+        if (scalar) bits |= ScalarValueBit;
+    }
+    code_point_length = length;
+    return bits;
+}
+
+constexpr std::uint32_t String::scan_properties() const
+{
+    if consteval
+    {
+        std::size_t length = 0;
+        return compute_properties(length);
+    }
+    if (const std::uint32_t known = m_properties.load(std::memory_order_acquire); known & ScanKnown) return known;
+    std::size_t length = 0;
+    const std::uint32_t bits = compute_properties(length);
+    m_code_point_length.store(length, std::memory_order_relaxed);
+    return m_properties.fetch_or(bits, std::memory_order_release) | bits;
+}
+
+constexpr bool String::hashes_differ(const String& other) const noexcept
+{
+    if consteval
+    {
+        return false;
+    }
+    const std::uint32_t known = m_properties.load(std::memory_order_acquire) & other.m_properties.load(std::memory_order_acquire);
+    return (known & HashKnown) && m_hash.load(std::memory_order_relaxed) != other.m_hash.load(std::memory_order_relaxed);
+}
+
+constexpr void String::copy_properties(const String& other) noexcept
+{
+    if !consteval
+    {
+        const std::uint32_t known = other.m_properties.load(std::memory_order_acquire);
+        m_hash.store(other.m_hash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_code_point_length.store(other.m_code_point_length.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_properties.store(known, std::memory_order_release);
+    }
+}
+
+constexpr void String::invalidate_properties() noexcept
+{
+    if !consteval
+    {
+        m_properties.store(0, std::memory_order_relaxed);
+        delete m_code_point_index.exchange(nullptr, std::memory_order_acquire);
+    }
+}
+
+constexpr void String::take_code_point_index(String& other) noexcept
+{
+    if !consteval
+    {
+        m_code_point_index.store(other.m_code_point_index.exchange(nullptr, std::memory_order_acquire), std::memory_order_release);
+    }
+}
+
+inline const String::CodePointIndex& String::code_point_index() const
+{
+    if (const CodePointIndex* index = m_code_point_index.load(std::memory_order_acquire)) return *index;
+    auto built = std::make_unique<CodePointIndex>();
+    const auto units = utf16_span();
+    built->unit_offsets.reserve(code_point_length() / code_point_index_stride + 1);
+    for (std::size_t offset = 0; offset < units.size(); offset = advance_code_points(units, offset, code_point_index_stride))
+        built->unit_offsets.push_back(offset);
+    // Threads racing to build the index agree on the first one published.
+    const CodePointIndex* expected = nullptr;
+    if (m_code_point_index.compare_exchange_strong(expected, built.get(), std::memory_order_acq_rel, std::memory_order_acquire)) return *built.release();
+    return *expected;
+}
+
+constexpr CodePoint String::code_point_at(std::size_t index) const
+{
+    if (index >= code_point_length()) throw std::out_of_range("String::code_point_at: index out of range");
+    if (is_8bit()) return CodePoint{latin1_span()[index]};
+    const auto units = utf16_span();
+    const std::size_t offset = code_unit_offset(index);
+    const char32_t unit = units[offset];
+    if (unit >= 0xD800 && unit <= 0xDBFF && offset + 1 < units.size() && units[offset + 1] >= 0xDC00 && units[offset + 1] <= 0xDFFF)
+        return CodePoint{0x10000 + ((unit - 0xD800) << 10) + (units[offset + 1] - 0xDC00)};
+    return CodePoint{unit};
+}
+
+constexpr std::size_t String::code_unit_offset(std::size_t code_point_offset) const
+{
+    const std::size_t length = code_point_length();
+    if (code_point_offset > length) throw std::out_of_range("String::code_unit_offset: offset out of range");
+    // Without surrogate pairs every code point is one code unit.
+    if (length == size()) return code_point_offset;
+    if (code_point_offset == length) return size();
+    const auto units = utf16_span();
+    if (std::is_constant_evaluated() || units.size() < code_point_index_min_length) return advance_code_points(units, 0, code_point_offset);
+    const CodePointIndex& index = code_point_index();
+    return advance_code_points(units, index.unit_offsets[code_point_offset / code_point_index_stride], code_point_offset % code_point_index_stride);
+}
+
+constexpr std::size_t String::code_point_offset(std::size_t code_unit_offset) const
+{
+    if (code_unit_offset > size()) throw std::out_of_range("String::code_point_offset: offset out of range");
+    if (code_point_length() == size()) return code_unit_offset;
+    const auto units = utf16_span();
+    std::size_t code_point = 0;
+    std::size_t offset = 0;
+    if (!std::is_constant_evaluated() && units.size() >= code_point_index_min_length)
+    {
+        // Start from the last indexed code point at or before the code unit.
+        const auto& unit_offsets = code_point_index().unit_offsets;
+        const std::size_t entry = static_cast<std::size_t>(std::ranges::upper_bound(unit_offsets, code_unit_offset) - unit_offsets.begin()) - 1;
+        code_point = entry * code_point_index_stride;
+        offset = unit_offsets[entry];
+    }
+    while (offset < code_unit_offset)
+    {
+        const std::size_t next = advance_code_points(units, offset, 1);
+        if (next > code_unit_offset) break;
+        offset = next;
+        ++code_point;
+    }
+    return code_point;
+}
+
+constexpr bool String::operator==(const String& other) const
+{
+    if (size() != other.size() || hashes_differ(other)) return false;
+    return visit([&other](auto lhs)
+    {
+        return other.visit([lhs](auto rhs) { return std::ranges::equal(lhs, rhs); });
+    });
+}
+
+constexpr bool String::operator!=(const String& other) const
+{
+    return !(*this == other);
+}
+
+constexpr std::strong_ordering String::operator<=>(const String& other) const
+{
+    return visit([&other](auto lhs)
+    {
+        return other.visit([lhs](auto rhs) { return compare_code_units(lhs, rhs); });
+    });
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+/**
+ * @brief Hash specialization for the String primitive type, so it can key unordered containers.
+ */
+template <>
+struct std::hash<Softloq::WHATWG::Infra::String>
+{
+    inline std::size_t operator()(const Softloq::WHATWG::Infra::String& value) const { return value.hash(); }
+};
+
+#include "Softloq/WHATWG/Infra/Primitive/String/Formatter.tpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/OStream.inl"
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRING_HPP
@@ -0,0 +1,514 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/StringBuilder.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the StringBuilder type for the WHATWG Infra library, which builds a String from pieces without repeated reallocation.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the StringBuilder type.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRINGBUILDER_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRINGBUILDER_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/CodePoint/CodePoint.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/CodeUnit/CodeUnit.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include "Softloq/WHATWG/Infra/SIMD/ClassScan.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief The StringBuilder type builds a String by appending pieces to one growing buffer.
+ *
+ * Short results are built in storage inside the builder and only allocate when released. Longer
+ * results grow a heap buffer in the representation the String will use: 8-bit while every
+ * appended code unit fits in a byte, UTF-16 once one does not. reserve() allocates exactly the
+ * requested capacity, so a caller that knows the final length allocates once. release() moves
+ * the heap buffer into the String without copying it.
+ *
+ * Appending whole sequences of code units, code points, Latin-1 or UTF-8 costs one call per
+ * sequence rather than one per element.
+ */
+class StringBuilder final
+{
+public:
+    /**
+     * @brief The number of 8-bit code units stored inside the builder before it allocates.
+     */
+    static constexpr std::size_t inline_capacity = 64;
+
+// Constructors and destructor
+public:
+    constexpr StringBuilder() noexcept = default;
+
+    /**
+     * @brief Construct a builder with room for the given number of code units.
+     *
+     * @param capacity The number of code units to reserve.
+     */
+    constexpr explicit StringBuilder(std::size_t capacity);
+
+// Capacity
+public:
+    /**
+     * @brief Get the number of code units appended so far.
+     *
+     * @return The number of code units.
+     */
+    [[nodiscard]] constexpr std::size_t size() const noexcept;
+
+    /**
+     * @brief Returns true if nothing has been appended.
+     */
+    [[nodiscard]] constexpr bool is_empty() const noexcept;
+
+    /**
+     * @brief Get the number of code units the builder can hold without reallocating.
+     *
+     * @return The capacity in code units.
+     */
+    [[nodiscard]] constexpr std::size_t capacity() const noexcept;
+
+    /**
+     * @brief Returns true if every code unit appended so far fits in 8 bits.
+     */
+    [[nodiscard]] constexpr bool is_8bit() const noexcept;
+
+    /**
+     * @brief Make room for exactly the given total number of code units. Does nothing if the capacity is already enough.
+     *
+     * @param capacity The total number of code units to make room for.
+     */
+    constexpr void reserve(std::size_t capacity);
+
+// Appending
+public:
+    /**
+     * @brief Append a code unit.
+     *
+     * @param code_unit The code unit to append.
+     */
+    constexpr void append(CodeUnit code_unit);
+
+    /**
+     * @brief Append a code point, as a surrogate pair if it is supplementary.
+     *
+     * @param code_point The code point to append.
+     */
+    constexpr void append(CodePoint code_point);
+
+    /**
+     * @brief Append the code units of a String.
+     *
+     * @param value The String to append.
+     */
+    constexpr void append(const String& value);
+
+    /**
+     * @brief Append UTF-16 code units. Lone surrogates are kept as they are.
+     *
+     * @param code_units The code units to append.
+     */
+    constexpr void append_code_units(std::u16string_view code_units);
+
+    /**
+     * @brief Append code points, encoding supplementary code points as surrogate pairs.
+     *
+     * @param code_points The code points to append.
+     */
+    constexpr void append_code_points(std::u32string_view code_points);
+
+    /**
+     * @brief Append Latin-1 bytes, each becoming the code unit of equal value.
+     *
+     * @param bytes The bytes to append.
+     */
+    constexpr void append_latin1(std::span<const std::uint8_t> bytes);
+
+    /**
+     * @brief Append Latin-1 characters, each read as an unsigned byte becoming the code unit of equal value.
+     *
+     * @param bytes The characters to append.
+     */
+    constexpr void append_latin1(std::string_view bytes);
+
+    /**
+     * @brief Append UTF-8 text, decoded as by the WHATWG Encoding specification's UTF-8 decode.
+     *
+     * Each maximal ill-formed subsequence is replaced by U+FFFD REPLACEMENT CHARACTER. A leading
+     * byte order mark is not removed.
+     *
+     * @param bytes The UTF-8 bytes to append.
+     */
+    constexpr void append_utf8(std::string_view bytes);
+
+// Finalization
+public:
+    /**
+     * @brief Move the built code units into a String and empty the builder.
+     *
+     * A heap buffer is handed to the String without copying. Code units still in the inline
+     * storage are copied into a buffer of exactly their size.
+     *
+     * @return The built String.
+     */
+    [[nodiscard]] constexpr String release();
+
+    /**
+     * @brief Remove all code units. Heap buffers keep their capacity for the next build.
+     */
+    constexpr void clear() noexcept;
+
+private:
+    /**
+     * @brief Where the code units are stored.
+     */
+    enum class Storage : std::uint8_t
+    {
+        Inline,
+        Latin1,
+        UTF16,
+    };
+
+    /**
+     * @brief Append a code unit to the current storage, widening it if needed.
+     */
+    constexpr void push_code_unit(char16_t code_unit);
+
+    /**
+     * @brief Append a code point, as a surrogate pair if it is supplementary.
+     */
+    constexpr void push_code_point(char32_t code_point);
+
+    /**
+     * @brief Make room for additional code units, moving the inline code units to the heap if they no longer fit.
+     */
+    constexpr void grow_8bit(std::size_t additional);
+
+    /**
+     * @brief Switch to UTF-16 storage with room for additional code units.
+     */
+    constexpr void widen(std::size_t additional);
+
+    /**
+     * @brief Get the capacity to grow to so that additional code units fit, at least doubling the current one.
+     */
+    [[nodiscard]] constexpr std::size_t grown_capacity(std::size_t additional) const noexcept;
+
+    /**
+     * @brief Returns the length of the longest prefix of the code units that all satisfy a code point class.
+     */
+    template <typename Unit>
+    [[nodiscard]] static constexpr std::size_t class_prefix_length(std::span<const Unit> code_units, std::span<const CodePointRange> ranges) noexcept;
+
+    std::array<std::uint8_t, inline_capacity> m_inline{};
+    std::size_t m_inline_size = 0;
+    String::Latin1Buffer m_latin1;
+    String::UTF16Buffer m_utf16;
+    Storage m_storage = Storage::Inline;
+};
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+template <typename Unit>
+constexpr std::size_t StringBuilder::class_prefix_length(std::span<const Unit> code_units, std::span<const CodePointRange> ranges) noexcept
+{
+    if !consteval
+    {
+        return SIMD::class_prefix_length(code_units.data(), code_units.size(), ranges, false);
+    }
+    std::size_t length = 0;
+    while (length < code_units.size() && SIMD::unit_in_class(code_units[length], ranges, false)) ++length;
+    return length;
+}
+
+constexpr StringBuilder::StringBuilder(std::size_t capacity)
+{
+    reserve(capacity);
+}
+
+constexpr std::size_t StringBuilder::size() const noexcept
+{
+    switch (m_storage)
+    {
+    case Storage::Inline: return m_inline_size;
+    case Storage::Latin1: return m_latin1.size();
+    default: return m_utf16.size();
+    }
+}
+
+constexpr bool StringBuilder::is_empty() const noexcept { return size() == 0; }
+
+constexpr std::size_t StringBuilder::capacity() const noexcept
+{
+    switch (m_storage)
+    {
+    case Storage::Inline: return inline_capacity;
+    case Storage::Latin1: return m_latin1.capacity();
+    default: return m_utf16.capacity();
+    }
+}
+
+constexpr bool StringBuilder::is_8bit() const noexcept { return m_storage != Storage::UTF16; }
+
+constexpr void StringBuilder::reserve(std::size_t capacity)
+{
+    switch (m_storage)
+    {
+    case Storage::Inline:
+        if (capacity <= inline_capacity) return;
+        m_latin1.clear();
+        m_latin1.reserve(capacity);
+        m_latin1.insert(m_latin1.end(), m_inline.begin(), m_inline.begin() + static_cast<std::ptrdiff_t>(m_inline_size));
+        m_storage = Storage::Latin1;
+        return;
+    case Storage::Latin1: m_latin1.reserve(capacity); return;
+    default: m_utf16.reserve(capacity); return;
+    }
+}
+
+constexpr std::size_t StringBuilder::grown_capacity(std::size_t additional) const noexcept
+{
+    return std::max(size() + additional, 2 * capacity());
+}
+
+constexpr void StringBuilder::grow_8bit(std::size_t additional)
+{
+    if (size() + additional <= capacity()) return;
+    reserve(grown_capacity(additional));
+}
+
+constexpr void StringBuilder::widen(std::size_t additional)
+{
+    if (m_storage == Storage::UTF16) return;
+    const std::span<const std::uint8_t> units = m_storage == Storage::Inline
+        ? std::span<const std::uint8_t>{m_inline.data(), m_inline_size}
+        : std::span<const std::uint8_t>{m_latin1};
+    m_utf16.clear();
+    m_utf16.reserve(std::max(capacity(), units.size() + additional));
+    m_utf16.insert(m_utf16.end(), units.begin(), units.end());
+    m_latin1.clear();
+    m_inline_size = 0;
+    m_storage = Storage::UTF16;
+}
+
+constexpr void StringBuilder::push_code_unit(char16_t code_unit)
+{
+    if (m_storage == Storage::UTF16)
+    {
+        m_utf16.push_back(code_unit);
+        return;
+    }
+    if (code_unit > 0xFF)
+    {
+        widen(1);
+        m_utf16.push_back(code_unit);
+        return;
+    }
+    grow_8bit(1);
+    if (m_storage == Storage::Inline)
+        m_inline[m_inline_size++] = static_cast<std::uint8_t>(code_unit);
+    else
+        m_latin1.push_back(static_cast<std::uint8_t>(code_unit));
+}
+
+constexpr void StringBuilder::push_code_point(char32_t code_point)
+{
+    if (code_point < 0x10000)
+    {
+        push_code_unit(static_cast<char16_t>(code_point));
+        return;
+    }
+    widen(2);
+    code_point -= 0x10000;
+    m_utf16.push_back(static_cast<char16_t>(0xD800 + (code_point >> 10)));
+    m_utf16.push_back(static_cast<char16_t>(0xDC00 + (code_point & 0x3FF)));
+}
+
+constexpr void StringBuilder::append(CodeUnit code_unit) { push_code_unit(static_cast<char16_t>(code_unit.get_value())); }
+
+constexpr void StringBuilder::append(CodePoint code_point) { push_code_point(code_point.get_value()); }
+
+constexpr void StringBuilder::append(const String& value)
+{
+    if (value.is_8bit())
+        append_latin1(value.latin1_span());
+    else
+        append_code_units(std::u16string_view{value.utf16_span().data(), value.size()});
+}
+
+constexpr void StringBuilder::append_code_units(std::u16string_view code_units)
+{
+    constexpr CodePointRange latin1_range[1]{{0x0000, 0x00FF}};
+    if (m_storage != Storage::UTF16 && class_prefix_length(std::span<const char16_t>{code_units}, latin1_range) == code_units.size())
+    {
+        grow_8bit(code_units.size());
+        if (m_storage == Storage::Inline)
+        {
+            std::ranges::transform(code_units, m_inline.begin() + static_cast<std::ptrdiff_t>(m_inline_size), [](char16_t unit) { return static_cast<std::uint8_t>(unit); });
+            m_inline_size += code_units.size();
+        }
+        else
+            std::ranges::transform(code_units, std::back_inserter(m_latin1), [](char16_t unit) { return static_cast<std::uint8_t>(unit); });
+        return;
+    }
+    widen(code_units.size());
+    m_utf16.insert(m_utf16.end(), code_units.begin(), code_units.end());
+}
+
+constexpr void StringBuilder::append_code_points(std::u32string_view code_points)
+{
+    if (m_storage != Storage::UTF16 && std::ranges::all_of(code_points, [](char32_t value) { return value <= 0xFF; }))
+    {
+        grow_8bit(code_points.size());
+        for (const char32_t value : code_points) push_code_unit(static_cast<char16_t>(value));
+        return;
+    }
+    widen(code_points.size());
+    for (const char32_t value : code_points) push_code_point(value);
+}
+
+constexpr void StringBuilder::append_latin1(std::span<const std::uint8_t> bytes)
+{
+    if (m_storage == Storage::UTF16)
+    {
+        m_utf16.insert(m_utf16.end(), bytes.begin(), bytes.end());
+        return;
+    }
+    grow_8bit(bytes.size());
+    if (m_storage == Storage::Inline)
+    {
+        std::ranges::copy(bytes, m_inline.begin() + static_cast<std::ptrdiff_t>(m_inline_size));
+        m_inline_size += bytes.size();
+    }
+    else
+        m_latin1.insert(m_latin1.end(), bytes.begin(), bytes.end());
+}
+
+constexpr void StringBuilder::append_latin1(std::string_view bytes)
+{
+    if consteval
+    {
+        for (const char c : bytes) push_code_unit(static_cast<std::uint8_t>(c));
+        return;
+    }
+    append_latin1(std::span<const std::uint8_t>{reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size()});
+}
+
+constexpr void StringBuilder::append_utf8(std::string_view bytes)
+{
+    constexpr CodePointRange ascii_range[1]{{0x0000, 0x007F}};
+    std::span<const std::uint8_t> data;
+    std::vector<std::uint8_t> copy;
+    if consteval
+    {
+        // reinterpret_cast is not allowed in constant evaluation, so the bytes are copied instead.
+        copy.resize(bytes.size());
+        std::ranges::transform(bytes, copy.begin(), [](char c) { return static_cast<std::uint8_t>(c); });
+        data = copy;
+    }
+    else
+    {
+        data = {reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size()};
+    }
+    char32_t code_point = 0;
+    std::size_t bytes_needed = 0;
+    std::size_t bytes_seen = 0;
+    std::uint8_t lower_boundary = 0x80;
+    std::uint8_t upper_boundary = 0xBF;
+    std::size_t index = 0;
+    while (index < data.size())
+    {
+        if (bytes_needed == 0)
+        {
+            // UTF-8 encodes ASCII as itself, so runs of it are appended in bulk.
+            const std::size_t ascii = class_prefix_length(data.subspan(index), ascii_range);
+            append_latin1(data.subspan(index, ascii));
+            index += ascii;
+            if (index == data.size()) break;
+            const std::uint8_t byte = data[index++];
+            if (byte >= 0xC2 && byte <= 0xDF)
+            {
+                bytes_needed = 1;
+                code_point = byte & 0x1F;
+            }
+            else if (byte >= 0xE0 && byte <= 0xEF)
+            {
+                if (byte == 0xE0) lower_boundary = 0xA0;
+                if (byte == 0xED) upper_boundary = 0x9F;
+                bytes_needed = 2;
+                code_point = byte & 0x0F;
+            }
+            else if (byte >= 0xF0 && byte <= 0xF4)
+            {
+                if (byte == 0xF0) lower_boundary = 0x90;
+                if (byte == 0xF4) upper_boundary = 0x8F;
+                bytes_needed = 3;
+                code_point = byte & 0x07;
+            }
+            else
+                push_code_unit(0xFFFD);
+            continue;
+        }
+        const std::uint8_t byte = data[index];
+        if (byte < lower_boundary || byte > upper_boundary)
+        {
+            // The byte is not consumed: it may start the next sequence.
+            code_point = 0;
+            bytes_needed = 0;
+            bytes_seen = 0;
+            lower_boundary = 0x80;
+            upper_boundary = 0xBF;
+            push_code_unit(0xFFFD);
+            continue;
+        }
+        ++index;
+        lower_boundary = 0x80;
+        upper_boundary = 0xBF;
+        code_point = (code_point << 6) | (byte & 0x3F);
+        if (++bytes_seen != bytes_needed) continue;
+        push_code_point(code_point);
+        code_point = 0;
+        bytes_needed = 0;
+        bytes_seen = 0;
+    }
+    if (bytes_needed != 0) push_code_unit(0xFFFD);
+}
+
+constexpr String StringBuilder::release()
+{
+    String result;
+    switch (m_storage)
+    {
+    case Storage::Inline: result = String::from_latin1(std::span<const std::uint8_t>{m_inline.data(), m_inline_size}); break;
+    case Storage::Latin1: result = String::from_buffer(std::exchange(m_latin1, {})); break;
+    default: result = String::from_buffer(std::exchange(m_utf16, {})); break;
+    }
+    m_inline_size = 0;
+    m_storage = Storage::Inline;
+    return result;
+}
+
+constexpr void StringBuilder::clear() noexcept
+{
+    m_inline_size = 0;
+    m_latin1.clear();
+    m_utf16.clear();
+    m_storage = Storage::Inline;
+}
+
+} // namespace Softloq::WHATWG::Infra
+
+#endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_STRINGBUILDER_HPP
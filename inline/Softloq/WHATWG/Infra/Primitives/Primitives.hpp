@@ -11,12 +11,16 @@
 #ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVES_PRIMITIVES_HPP
 #define SOFTLOQ_WHATWG_INFRA_PRIMITIVES_PRIMITIVES_HPP
 
+#include "Softloq/WHATWG/Infra/Primitive/PrimitiveRef.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Null/Null.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Boolean/Boolean.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Byte/Byte.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/ByteSequence/ByteSequence.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/CodePoint/CodePoint.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/CodeUnit/CodeUnit.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/String.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/Atom.hpp"
+#include "Softloq/WHATWG/Infra/Primitive/String/IsomorphicStringView.hpp"
 #include "Softloq/WHATWG/Infra/Primitive/Numbers/Numbers.hpp"
 
 #endif // SOFTLOQ_WHATWG_INFRA_PRIMITIVES_PRIMITIVES_HPP
@@ -0,0 +1,126 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/ByteSwap.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the vectorized byte-swapping kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the kernels that copy a run of integers while reversing the byte order of each.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_SIMD_BYTESWAP_HPP
+#define SOFTLOQ_WHATWG_INFRA_SIMD_BYTESWAP_HPP
+
+#include "Softloq/WHATWG/Infra/SIMD/Target.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+/**
+ * @brief Concept for the integer widths, in bytes, the vectorized byte-swapping kernel is built for.
+ */
+template <std::size_t Width>
+concept ByteSwapWidth = Width == 2 || Width == 4 || Width == 8;
+
+/**
+ * @brief The byte-swapping kernel one integer at a time, for integers of any width.
+ *
+ * This finishes the runs the vectorized kernel leaves over, and serves the widths it is not built
+ * for, such as uint128_t and WideInt.
+ */
+namespace ByteSwapPortable
+{
+
+/**
+ * @brief Portable byte_swap().
+ */
+template <std::size_t Width>
+constexpr void byte_swap(const std::uint8_t* source, std::size_t count, std::uint8_t* destination) noexcept
+{
+    for (std::size_t index = 0; index < count; ++index, source += Width, destination += Width)
+    {
+        if constexpr (ByteSwapWidth<Width>)
+        {
+            if !consteval
+            {
+                using Word = std::conditional_t<Width == 2, std::uint16_t, std::conditional_t<Width == 4, std::uint32_t, std::uint64_t>>;
+                Word word;
+                std::memcpy(&word, source, Width);
+                word = std::byteswap(word);
+                std::memcpy(destination, &word, Width);
+                continue;
+            }
+        }
+        // Swap pairs from both ends, so a run swapped in place reads each byte before it is overwritten.
+        for (std::size_t low = 0; low < Width / 2; ++low)
+        {
+            const std::uint8_t first = source[low];
+            destination[low] = source[Width - 1 - low];
+            destination[Width - 1 - low] = first;
+        }
+        if constexpr (Width % 2 == 1) destination[Width / 2] = source[Width / 2];
+    }
+}
+
+} // namespace ByteSwapPortable
+
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+/**
+ * @brief Returns a vector with the byte order of each lane of Width bytes reversed.
+ *
+ * SSE2 has no byte shuffle, so wider lanes first reverse their 16-bit halves with the 16-bit
+ * shuffles, and then every lane swaps the two bytes of each half with shifts.
+ */
+template <std::size_t Width>
+inline __m128i swap_lanes(__m128i vector) noexcept
+{
+    if constexpr (Width == 4)
+        vector = _mm_shufflehi_epi16(_mm_shufflelo_epi16(vector, 0xB1), 0xB1);
+    else if constexpr (Width == 8)
+        vector = _mm_shufflehi_epi16(_mm_shufflelo_epi16(vector, 0x1B), 0x1B);
+    return _mm_or_si128(_mm_slli_epi16(vector, 8), _mm_srli_epi16(vector, 8));
+}
+#endif
+
+/**
+ * @brief Copy a run of integers of Width bytes each, reversing the byte order of every integer.
+ *
+ * Sixteen bytes are swapped at a time. The source and destination may be the same run, but must
+ * not otherwise overlap.
+ *
+ * @param source The integers to copy, as bytes.
+ * @param count The number of integers.
+ * @param destination Where to write count * Width bytes.
+ */
+template <std::size_t Width>
+    requires ByteSwapWidth<Width>
+inline void byte_swap(const std::uint8_t* source, std::size_t count, std::uint8_t* destination) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    const std::size_t size = count * Width;
+    for (; index + 32 <= size; index += 32)
+    {
+        const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+        const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index + 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), swap_lanes<Width>(first));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index + 16), swap_lanes<Width>(second));
+    }
+    if (index + 16 <= size)
+    {
+        const __m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), swap_lanes<Width>(vector));
+        index += 16;
+    }
+#endif
+    ByteSwapPortable::byte_swap<Width>(source + index, count - index / Width, destination + index);
+}
+
+} // namespace Softloq::WHATWG::Infra::SIMD
+
+#endif // SOFTLOQ_WHATWG_INFRA_SIMD_BYTESWAP_HPP
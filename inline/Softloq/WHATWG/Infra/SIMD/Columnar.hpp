@@ -0,0 +1,599 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/Columnar.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the vectorized columnar integer kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the kernels that sum, bound, scan, compare and filter contiguous runs of integers.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_HPP
+#define SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_HPP
+
+#include "Softloq/WHATWG/Infra/Primitive/Number/Overflow.hpp"
+#include "Softloq/WHATWG/Infra/SIMD/Target.hpp"
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+/**
+ * @brief Concept for the integer types the vectorized columnar kernels are built for: the eight fixed-width integers.
+ */
+template <typename T>
+concept ColumnElement =
+    std::same_as<T, std::int8_t> || std::same_as<T, std::int16_t> || std::same_as<T, std::int32_t> || std::same_as<T, std::int64_t>
+    || std::same_as<T, std::uint8_t> || std::same_as<T, std::uint16_t> || std::same_as<T, std::uint32_t> || std::same_as<T, std::uint64_t>;
+
+/**
+ * @brief The type a column of T is summed in: 64 bits of the same signedness, or T itself for uint128_t and WideInt.
+ */
+template <FixedWidthInteger T>
+using ColumnSum = std::conditional_t<std::same_as<T, uint128_t> || WideInteger<T>, T,
+                                     std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+
+/**
+ * @brief The comparison a column is tested against a value with.
+ */
+enum class Comparison : std::uint8_t
+{
+    Equal,
+    NotEqual,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual
+};
+
+/**
+ * @brief The columnar kernels one element at a time, for every fixed-width integer.
+ *
+ * These finish the runs the vectorized kernels leave over, and serve the types those kernels are
+ * not built for. Sums are computed on unsigned types, which wrap without undefined behaviour.
+ */
+namespace ColumnPortable
+{
+
+/**
+ * @brief Portable column_sum().
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr ColumnSum<T> sum(const T* data, std::size_t size) noexcept
+{
+    if constexpr (std::same_as<T, uint128_t> || WideInteger<T>)
+    {
+        T total{};
+        for (std::size_t index = 0; index < size; ++index) total += data[index];
+        return total;
+    }
+    else
+    {
+        std::uint64_t total = 0;
+        for (std::size_t index = 0; index < size; ++index) total += static_cast<std::uint64_t>(static_cast<ColumnSum<T>>(data[index]));
+        return static_cast<ColumnSum<T>>(total);
+    }
+}
+
+/**
+ * @brief Portable column_min().
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr T min(const T* data, std::size_t size) noexcept
+{
+    T result = data[0];
+    for (std::size_t index = 1; index < size; ++index) result = std::min(result, data[index]);
+    return result;
+}
+
+/**
+ * @brief Portable column_max().
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr T max(const T* data, std::size_t size) noexcept
+{
+    T result = data[0];
+    for (std::size_t index = 1; index < size; ++index) result = std::max(result, data[index]);
+    return result;
+}
+
+/**
+ * @brief Portable column_prefix_sum(), continuing from a running sum.
+ *
+ * @return The last sum written, or total if size is zero.
+ */
+template <FixedWidthInteger T>
+constexpr T prefix_sum(const T* data, std::size_t size, T* out, T total = T{}) noexcept
+{
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        static_cast<void>(overflowing_add(total, data[index], total));
+        out[index] = total;
+    }
+    return total;
+}
+
+/**
+ * @brief Calls apply with the predicate that tests an integer against value, one lambda type per comparison.
+ *
+ * Each comparison gets its own loop in apply, so the loop bodies stay branch-free.
+ */
+template <FixedWidthInteger T, typename Apply>
+constexpr std::size_t with_comparison(Comparison comparison, T value, Apply apply) noexcept
+{
+    switch (comparison)
+    {
+    case Comparison::Equal: return apply([value](T element) { return element == value; });
+    case Comparison::NotEqual: return apply([value](T element) { return element != value; });
+    case Comparison::Less: return apply([value](T element) { return element < value; });
+    case Comparison::LessEqual: return apply([value](T element) { return element <= value; });
+    case Comparison::Greater: return apply([value](T element) { return element > value; });
+    case Comparison::GreaterEqual: return apply([value](T element) { return element >= value; });
+    }
+    return 0;
+}
+
+/**
+ * @brief Portable column_compare().
+ */
+template <FixedWidthInteger T>
+constexpr std::size_t compare(const T* data, std::size_t size, Comparison comparison, T value, std::uint8_t* mask) noexcept
+{
+    return with_comparison(comparison, value, [&](auto holds) {
+        std::size_t count = 0;
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            const bool result = holds(data[index]);
+            mask[index] = result;
+            count += result;
+        }
+        return count;
+    });
+}
+
+/**
+ * @brief Portable column_count().
+ */
+template <FixedWidthInteger T>
+[[nodiscard]] constexpr std::size_t count(const T* data, std::size_t size, Comparison comparison, T value) noexcept
+{
+    return with_comparison(comparison, value, [&](auto holds) {
+        std::size_t count = 0;
+        for (std::size_t index = 0; index < size; ++index) count += holds(data[index]);
+        return count;
+    });
+}
+
+/**
+ * @brief Portable column_filter().
+ */
+template <FixedWidthInteger T>
+constexpr std::size_t filter(const T* data, std::size_t size, const std::uint8_t* mask, T* out) noexcept
+{
+    std::size_t count = 0;
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        // Write unconditionally and advance only past kept integers, which never writes beyond index.
+        out[count] = data[index];
+        count += mask[index] != 0;
+    }
+    return count;
+}
+
+} // namespace ColumnPortable
+
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+/**
+ * @brief Returns a vector with every lane set to value.
+ */
+template <ColumnElement T>
+inline __m128i splat(T value) noexcept
+{
+    if constexpr (sizeof(T) == 1) return _mm_set1_epi8(static_cast<char>(value));
+    else if constexpr (sizeof(T) == 2) return _mm_set1_epi16(static_cast<short>(value));
+    else if constexpr (sizeof(T) == 4) return _mm_set1_epi32(static_cast<int>(value));
+    else return _mm_set1_epi64x(static_cast<long long>(value));
+}
+
+/**
+ * @brief Returns the lane-wise sum of two vectors, wrapping modulo 2^N.
+ */
+template <ColumnElement T>
+inline __m128i add_lanes(__m128i lhs, __m128i rhs) noexcept
+{
+    if constexpr (sizeof(T) == 1) return _mm_add_epi8(lhs, rhs);
+    else if constexpr (sizeof(T) == 2) return _mm_add_epi16(lhs, rhs);
+    else if constexpr (sizeof(T) == 4) return _mm_add_epi32(lhs, rhs);
+    else return _mm_add_epi64(lhs, rhs);
+}
+
+/**
+ * @brief The bias that maps T onto the lane type SSE2 orders: unsigned for 8-bit lanes, signed for 16-bit and 32-bit lanes.
+ *
+ * Flipping the sign bit maps a signed order onto the unsigned one and back, so one instruction
+ * serves both signednesses.
+ */
+template <ColumnElement T>
+inline T order_bias() noexcept
+{
+    constexpr bool flip = sizeof(T) == 1 ? std::is_signed_v<T> : std::is_unsigned_v<T>;
+    return flip ? static_cast<T>(std::make_unsigned_t<T>{1} << (8 * sizeof(T) - 1)) : T{};
+}
+
+/**
+ * @brief Returns the lane-wise least or greatest of two biased vectors of 8-bit, 16-bit or 32-bit lanes.
+ */
+template <ColumnElement T, bool Greatest>
+inline __m128i pick_lanes(__m128i lhs, __m128i rhs) noexcept
+{
+    if constexpr (sizeof(T) == 1) return Greatest ? _mm_max_epu8(lhs, rhs) : _mm_min_epu8(lhs, rhs);
+    else if constexpr (sizeof(T) == 2) return Greatest ? _mm_max_epi16(lhs, rhs) : _mm_min_epi16(lhs, rhs);
+    else
+    {
+        const __m128i greater = _mm_cmpgt_epi32(lhs, rhs);
+        const __m128i keep_lhs = Greatest ? greater : _mm_xor_si128(greater, _mm_set1_epi32(-1));
+        return _mm_or_si128(_mm_and_si128(keep_lhs, lhs), _mm_andnot_si128(keep_lhs, rhs));
+    }
+}
+
+/**
+ * @brief Returns the lane-wise signed comparison lhs > rhs of two biased vectors of 8-bit, 16-bit or 32-bit lanes.
+ */
+template <ColumnElement T>
+inline __m128i greater_lanes(__m128i lhs, __m128i rhs) noexcept
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        // 8-bit lanes are biased to unsigned order; flip them back to signed for the signed compare.
+        const __m128i flip = _mm_set1_epi8(static_cast<char>(0x80));
+        return _mm_cmpgt_epi8(_mm_xor_si128(lhs, flip), _mm_xor_si128(rhs, flip));
+    }
+    else if constexpr (sizeof(T) == 2) return _mm_cmpgt_epi16(lhs, rhs);
+    else return _mm_cmpgt_epi32(lhs, rhs);
+}
+
+/**
+ * @brief Returns the lane-wise equality of two vectors of 8-bit, 16-bit or 32-bit lanes.
+ */
+template <ColumnElement T>
+inline __m128i equal_lanes(__m128i lhs, __m128i rhs) noexcept
+{
+    if constexpr (sizeof(T) == 1) return _mm_cmpeq_epi8(lhs, rhs);
+    else if constexpr (sizeof(T) == 2) return _mm_cmpeq_epi16(lhs, rhs);
+    else return _mm_cmpeq_epi32(lhs, rhs);
+}
+
+/**
+ * @brief Returns the inclusive prefix sums of the lanes of a vector.
+ */
+template <ColumnElement T>
+inline __m128i scan_lanes(__m128i lanes) noexcept
+{
+    lanes = add_lanes<T>(lanes, _mm_slli_si128(lanes, sizeof(T)));
+    if constexpr (sizeof(T) <= 4) lanes = add_lanes<T>(lanes, _mm_slli_si128(lanes, 2 * sizeof(T)));
+    if constexpr (sizeof(T) <= 2) lanes = add_lanes<T>(lanes, _mm_slli_si128(lanes, 4 * sizeof(T)));
+    if constexpr (sizeof(T) == 1) lanes = add_lanes<T>(lanes, _mm_slli_si128(lanes, 8));
+    return lanes;
+}
+
+/**
+ * @brief Returns a vector with every lane set to the last lane of a vector.
+ */
+template <ColumnElement T>
+inline __m128i broadcast_last_lane(__m128i lanes) noexcept
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        const __m128i pairs = _mm_shufflehi_epi16(_mm_unpackhi_epi8(lanes, lanes), 0xFF);
+        return _mm_unpackhi_epi64(pairs, pairs);
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        const __m128i high = _mm_shufflehi_epi16(lanes, 0xFF);
+        return _mm_unpackhi_epi64(high, high);
+    }
+    else if constexpr (sizeof(T) == 4) return _mm_shuffle_epi32(lanes, 0xFF);
+    else return _mm_shuffle_epi32(lanes, 0xEE);
+}
+
+/**
+ * @brief Returns the two 64-bit lanes of a vector added together.
+ */
+inline std::uint64_t add_halves(__m128i lanes) noexcept
+{
+    std::uint64_t halves[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(halves), lanes);
+    return halves[0] + halves[1];
+}
+
+/**
+ * @brief Returns the sum of the 32-bit lanes of a vector, each sign-extended to 64 bits.
+ */
+inline std::uint64_t add_signed_quarters(__m128i lanes) noexcept
+{
+    const __m128i sign = _mm_srai_epi32(lanes, 31);
+    return add_halves(_mm_add_epi64(_mm_unpacklo_epi32(lanes, sign), _mm_unpackhi_epi32(lanes, sign)));
+}
+#endif
+
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+/**
+ * @brief Compares the integers of a run sixteen at a time, writing their mask bytes unless mask is null.
+ *
+ * @param index Receives the number of integers compared, a multiple of sixteen.
+ * @return The number of compared integers for which the comparison holds.
+ */
+template <ColumnElement T>
+inline std::size_t compare_sixteens(const T* data, std::size_t size, Comparison comparison, T value, std::uint8_t* mask, std::size_t& index) noexcept
+{
+    std::size_t count = 0;
+    index = 0;
+    if constexpr (sizeof(T) <= 4)
+    {
+        // Every comparison is equality, less or greater, possibly negated.
+        const bool negate = comparison == Comparison::NotEqual || comparison == Comparison::LessEqual || comparison == Comparison::GreaterEqual;
+        const __m128i flip = negate ? _mm_set1_epi8(-1) : _mm_setzero_si128();
+        const __m128i bias = splat(order_bias<T>());
+        const __m128i target = _mm_xor_si128(splat(value), bias);
+        const auto compare_lanes = [&](const T* lanes) {
+            const __m128i elements = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes)), bias);
+            switch (comparison)
+            {
+            case Comparison::Equal:
+            case Comparison::NotEqual: return equal_lanes<T>(elements, target);
+            case Comparison::Less:
+            case Comparison::GreaterEqual: return greater_lanes<T>(target, elements);
+            default: return greater_lanes<T>(elements, target);
+            }
+        };
+        constexpr std::size_t lanes = 16 / sizeof(T);
+        for (; index + 16 <= size; index += 16)
+        {
+            // Narrow the lane masks of sixteen integers to sixteen bytes; saturation keeps 0 and -1.
+            __m128i bytes;
+            if constexpr (sizeof(T) == 1) bytes = compare_lanes(data + index);
+            else if constexpr (sizeof(T) == 2) bytes = _mm_packs_epi16(compare_lanes(data + index), compare_lanes(data + index + lanes));
+            else
+            {
+                const __m128i low = _mm_packs_epi32(compare_lanes(data + index), compare_lanes(data + index + lanes));
+                const __m128i high = _mm_packs_epi32(compare_lanes(data + index + 2 * lanes), compare_lanes(data + index + 3 * lanes));
+                bytes = _mm_packs_epi16(low, high);
+            }
+            bytes = _mm_xor_si128(bytes, flip);
+            if (mask != nullptr) _mm_storeu_si128(reinterpret_cast<__m128i*>(mask + index), _mm_and_si128(bytes, _mm_set1_epi8(1)));
+            count += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(_mm_movemask_epi8(bytes))));
+        }
+    }
+    return count;
+}
+#endif
+
+/**
+ * @brief Returns the least or greatest of a nonempty run of integers.
+ */
+template <ColumnElement T, bool Greatest>
+inline T column_extreme(const T* data, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+    T result = data[0];
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if constexpr (sizeof(T) <= 4)
+    {
+        constexpr std::size_t lanes = 16 / sizeof(T);
+        if (size >= lanes)
+        {
+            const __m128i bias = splat(order_bias<T>());
+            __m128i best = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), bias);
+            for (index = lanes; index + lanes <= size; index += lanes)
+                best = pick_lanes<T, Greatest>(best, _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index)), bias));
+            T candidates[lanes];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(candidates), _mm_xor_si128(best, bias));
+            result = Greatest ? ColumnPortable::max(candidates, lanes) : ColumnPortable::min(candidates, lanes);
+        }
+    }
+#endif
+    for (; index < size; ++index) result = Greatest ? std::max(result, data[index]) : std::min(result, data[index]);
+    return result;
+}
+
+/**
+ * @brief Returns the sum of a run of integers, wrapping modulo 2^64.
+ *
+ * Runs of 8-bit, 16-bit and 32-bit integers are widened sixteen bytes at a time, so the sum only
+ * wraps once it leaves the 64-bit range.
+ *
+ * @param data The integers to sum.
+ * @param size The number of integers.
+ */
+template <ColumnElement T>
+[[nodiscard]] inline ColumnSum<T> column_sum(const T* data, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+    std::uint64_t total = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if constexpr (sizeof(T) == 1)
+    {
+        // Sum sixteen bytes into two 64-bit lanes against zero; signed bytes are biased to unsigned first.
+        const __m128i bias = splat(order_bias<T>());
+        const __m128i zero = _mm_setzero_si128();
+        __m128i lanes = zero;
+        for (; index + 16 <= size; index += 16)
+            lanes = _mm_add_epi64(lanes, _mm_sad_epu8(_mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index)), bias), zero));
+        total = add_halves(lanes);
+        if constexpr (std::is_signed_v<T>) total -= 128 * index;
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        // Add neighbouring pairs into 32-bit lanes, which hold at least 16384 iterations of pairs
+        // before they can overflow; unsigned halves are biased to signed first.
+        const __m128i bias = splat(order_bias<T>());
+        const __m128i ones = _mm_set1_epi16(1);
+        while (index + 8 <= size)
+        {
+            __m128i lanes = _mm_setzero_si128();
+            const std::size_t block_end = index + std::min<std::size_t>((size - index) / 8, 16384) * 8;
+            for (; index < block_end; index += 8)
+                lanes = _mm_add_epi32(lanes, _mm_madd_epi16(_mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index)), bias), ones));
+            total += add_signed_quarters(lanes);
+        }
+        if constexpr (std::is_unsigned_v<T>) total += 32768 * index;
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        // Widen each 32-bit lane to 64 bits, with copies of its sign bit or with zeros.
+        const __m128i zero = _mm_setzero_si128();
+        __m128i lanes = zero;
+        for (; index + 4 <= size; index += 4)
+        {
+            const __m128i quarters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+            const __m128i high = std::is_signed_v<T> ? _mm_srai_epi32(quarters, 31) : zero;
+            lanes = _mm_add_epi64(lanes, _mm_add_epi64(_mm_unpacklo_epi32(quarters, high), _mm_unpackhi_epi32(quarters, high)));
+        }
+        total = add_halves(lanes);
+    }
+    else
+    {
+        __m128i lanes = _mm_setzero_si128();
+        for (; index + 2 <= size; index += 2) lanes = _mm_add_epi64(lanes, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index)));
+        total = add_halves(lanes);
+    }
+#endif
+    return static_cast<ColumnSum<T>>(total + static_cast<std::uint64_t>(ColumnPortable::sum(data + index, size - index)));
+}
+
+/**
+ * @brief Returns the least of a nonempty run of integers.
+ *
+ * @param data The integers, at least one.
+ * @param size The number of integers, which must not be zero.
+ */
+template <ColumnElement T>
+[[nodiscard]] inline T column_min(const T* data, std::size_t size) noexcept
+{
+    return column_extreme<T, false>(data, size);
+}
+
+/**
+ * @brief Returns the greatest of a nonempty run of integers.
+ *
+ * @see column_min()
+ */
+template <ColumnElement T>
+[[nodiscard]] inline T column_max(const T* data, std::size_t size) noexcept
+{
+    return column_extreme<T, true>(data, size);
+}
+
+/**
+ * @brief Writes the inclusive prefix sums of a run of integers, wrapping modulo 2^N.
+ *
+ * Each group of sixteen bytes is scanned in registers with shifted additions, then offset by the
+ * last sum of the group before it.
+ *
+ * @param data The integers to scan.
+ * @param size The number of integers.
+ * @param out Receives the size sums; may be data.
+ */
+template <ColumnElement T>
+inline void column_prefix_sum(const T* data, std::size_t size, T* out) noexcept
+{
+    std::size_t index = 0;
+    T total{};
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    constexpr std::size_t lanes = 16 / sizeof(T);
+    if (size >= lanes)
+    {
+        __m128i carry = _mm_setzero_si128();
+        for (; index + lanes <= size; index += lanes)
+        {
+            const __m128i sums = add_lanes<T>(scan_lanes<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index))), carry);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index), sums);
+            carry = broadcast_last_lane<T>(sums);
+        }
+        total = out[index - 1];
+    }
+#endif
+    ColumnPortable::prefix_sum(data + index, size - index, out + index, total);
+}
+
+/**
+ * @brief Compares every integer of a run against a value.
+ *
+ * @param data The integers to compare.
+ * @param size The number of integers.
+ * @param comparison How each integer is compared, as the left operand.
+ * @param value The right operand of every comparison.
+ * @param mask Receives size bytes, 1 where the comparison holds and 0 elsewhere.
+ * @return The number of integers for which the comparison holds.
+ */
+template <ColumnElement T>
+inline std::size_t column_compare(const T* data, std::size_t size, Comparison comparison, T value, std::uint8_t* mask) noexcept
+{
+    std::size_t index = 0;
+    std::size_t count = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    count = compare_sixteens(data, size, comparison, value, mask, index);
+#endif
+    return count + ColumnPortable::compare(data + index, size - index, comparison, value, mask + index);
+}
+
+/**
+ * @brief Counts the integers of a run for which a comparison against a value holds, without writing a mask.
+ *
+ * @see column_compare()
+ */
+template <ColumnElement T>
+[[nodiscard]] inline std::size_t column_count(const T* data, std::size_t size, Comparison comparison, T value) noexcept
+{
+    std::size_t index = 0;
+    std::size_t count = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    count = compare_sixteens(data, size, comparison, value, static_cast<std::uint8_t*>(nullptr), index);
+#endif
+    return count + ColumnPortable::count(data + index, size - index, comparison, value);
+}
+
+/**
+ * @brief Copies the integers of a run whose mask byte is nonzero, in order.
+ *
+ * Sixteen mask bytes are tested at a time, so runs the mask keeps or drops whole are copied or
+ * skipped without looking at each byte.
+ *
+ * @param data The integers to filter.
+ * @param size The number of integers.
+ * @param mask The size mask bytes.
+ * @param out Receives the kept integers; must have room for size integers.
+ * @return The number of integers kept.
+ */
+template <ColumnElement T>
+inline std::size_t column_filter(const T* data, std::size_t size, const std::uint8_t* mask, T* out) noexcept
+{
+    std::size_t index = 0;
+    std::size_t count = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; index + 16 <= size; index += 16)
+    {
+        const unsigned dropped = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mask + index)), zero)));
+        if (dropped == 0xFFFFu) continue;
+        if (dropped == 0)
+        {
+            std::memcpy(out + count, data + index, 16 * sizeof(T));
+            count += 16;
+            continue;
+        }
+        count += ColumnPortable::filter(data + index, 16, mask + index, out + count);
+    }
+#endif
+    return count + ColumnPortable::filter(data + index, size - index, mask + index, out + count);
+}
+
+} // namespace Softloq::WHATWG::Infra::SIMD
+
+#endif // SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_HPP
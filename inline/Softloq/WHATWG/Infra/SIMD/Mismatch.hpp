@@ -0,0 +1,106 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/Mismatch.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header defines the vectorized mismatch-finding kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header defines the kernels that find the first differing unit of two runs of code units.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_SIMD_MISMATCH_HPP
+#define SOFTLOQ_WHATWG_INFRA_SIMD_MISMATCH_HPP
+
+#include "Softloq/WHATWG/Infra/SIMD/Target.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+/**
+ * @brief Returns the index of the first unit at which two runs differ.
+ *
+ * Sixteen bytes of each run are compared at a time.
+ *
+ * @param lhs The first run of units.
+ * @param rhs The second run of units.
+ * @param size The number of units in each run.
+ * @return The index of the first differing unit, or size if the runs are equal.
+ */
+[[nodiscard]] inline std::size_t mismatch(const std::uint8_t* lhs, const std::uint8_t* rhs, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    for (; index + 16 <= size; index += 16)
+    {
+        const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index));
+        const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+        const unsigned differ = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(left, right))) & 0xFFFFu;
+        if (differ != 0) return index + static_cast<std::size_t>(std::countr_zero(differ));
+    }
+#endif
+    while (index < size && lhs[index] == rhs[index]) ++index;
+    return index;
+}
+
+/**
+ * @brief Returns the index of the first UTF-16 code unit at which two runs differ.
+ *
+ * @see mismatch(const std::uint8_t*, const std::uint8_t*, std::size_t)
+ */
+[[nodiscard]] inline std::size_t mismatch(const char16_t* lhs, const char16_t* rhs, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    for (; index + 8 <= size; index += 8)
+    {
+        const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index));
+        const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+        const unsigned differ = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(left, right))) & 0xFFFFu;
+        // Each 16-bit lane sets two mask bits.
+        if (differ != 0) return index + static_cast<std::size_t>(std::countr_zero(differ)) / 2;
+    }
+#endif
+    while (index < size && lhs[index] == rhs[index]) ++index;
+    return index;
+}
+
+/**
+ * @brief Returns the index of the first code unit at which a run of 8-bit code units and a run of UTF-16 code units differ.
+ *
+ * The 8-bit code units are zero-extended to 16 bits before they are compared.
+ *
+ * @see mismatch(const std::uint8_t*, const std::uint8_t*, std::size_t)
+ */
+[[nodiscard]] inline std::size_t mismatch(const std::uint8_t* lhs, const char16_t* rhs, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; index + 8 <= size; index += 8)
+    {
+        const __m128i left = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(lhs + index)), zero);
+        const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+        const unsigned differ = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(left, right))) & 0xFFFFu;
+        if (differ != 0) return index + static_cast<std::size_t>(std::countr_zero(differ)) / 2;
+    }
+#endif
+    while (index < size && lhs[index] == rhs[index]) ++index;
+    return index;
+}
+
+/**
+ * @brief Returns the index of the first code unit at which a run of UTF-16 code units and a run of 8-bit code units differ.
+ *
+ * @see mismatch(const std::uint8_t*, const char16_t*, std::size_t)
+ */
+[[nodiscard]] inline std::size_t mismatch(const char16_t* lhs, const std::uint8_t* rhs, std::size_t size) noexcept
+{
+    return mismatch(rhs, lhs, size);
+}
+
+} // namespace Softloq::WHATWG::Infra::SIMD
+
+#endif // SOFTLOQ_WHATWG_INFRA_SIMD_MISMATCH_HPP
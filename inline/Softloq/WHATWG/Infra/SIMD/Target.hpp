@@ -0,0 +1,24 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/Target.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This header detects the SIMD instruction set available to the vectorized kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header detects the SIMD instruction set available to the vectorized kernels of the WHATWG Infra library.
+ * Defining SOFTLOQ_WHATWG_INFRA_NO_SIMD before inclusion forces the portable scalar kernels.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_SIMD_TARGET_HPP
+#define SOFTLOQ_WHATWG_INFRA_SIMD_TARGET_HPP
+
+// Detect SSE2, which is part of the x86-64 baseline and therefore needs no extra compiler flags
+#if !defined(SOFTLOQ_WHATWG_INFRA_NO_SIMD) \
+    && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define SOFTLOQ_WHATWG_INFRA_SIMD_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define SOFTLOQ_WHATWG_INFRA_SIMD_SSE2 0
+#endif
+
+#endif // SOFTLOQ_WHATWG_INFRA_SIMD_TARGET_HPP
@@ -14,20 +14,11 @@
 namespace Softloq::WHATWG::Infra
 {
 
-Boolean::Boolean() noexcept = default;
-
 Boolean::Boolean(bool value) noexcept
     : m_value{value}
 {
 }
 
-Boolean::~Boolean() noexcept = default;
-
-PrimitiveType Boolean::get_type() const noexcept
-{
-    return PrimitiveType::Boolean;
-}
-
 bool Boolean::get_value() const noexcept
 {
     return m_value;
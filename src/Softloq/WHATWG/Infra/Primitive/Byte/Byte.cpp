@@ -14,25 +14,11 @@
 namespace Softloq::WHATWG::Infra
 {
 
-Byte::Byte() noexcept = default;
-
-Byte::Byte(const Byte& other) noexcept
-    : m_value{other.m_value}
-{
-}
-
 Byte::Byte(std::uint8_t value) noexcept
     : m_value{value}
 {
 }
 
-Byte::~Byte() noexcept = default;
-
-PrimitiveType Byte::get_type() const noexcept
-{
-    return PrimitiveType::Byte;
-}
-
 std::uint8_t Byte::get_value() const noexcept
 {
     return m_value;
@@ -10,6 +10,9 @@
 
 #include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
 #include <Softloq/WHATWG/Infra/Primitive/ByteSequence/ByteSequence.hpp>
+#include <algorithm>
+#include <span>
+#include <utility>
 
 namespace Softloq::WHATWG::Infra
 {
@@ -30,8 +33,6 @@ ByteSequence::ByteSequence(std::initializer_list<std::uint8_t> bytes) noexcept
 
 ByteSequence::~ByteSequence() noexcept = default;
 
-PrimitiveType ByteSequence::get_type() const noexcept { return PrimitiveType::ByteSequence; }
-
 std::size_t ByteSequence::size() const noexcept { return m_bytes.size(); }
 
 bool ByteSequence::is_empty() const noexcept { return m_bytes.empty(); }
@@ -48,6 +49,8 @@ void ByteSequence::push_back(Byte byte) { m_bytes.push_back(byte); }
 
 void ByteSequence::clear() noexcept { m_bytes.clear(); }
 
+void ByteSequence::resize(std::size_t size) { m_bytes.resize(size); }
+
 std::vector<Byte>::iterator ByteSequence::begin() noexcept { return m_bytes.begin(); }
 
 std::vector<Byte>::iterator ByteSequence::end() noexcept { return m_bytes.end(); }
@@ -101,4 +104,11 @@ bool ByteSequence::starts_with(const ByteSequence& other) const noexcept
     return true;
 }
 
+String ByteSequence::isomorphic_decode() const
+{
+    String::Latin1Buffer bytes(m_bytes.size());
+    std::ranges::transform(m_bytes, bytes.begin(), [](const Byte& byte) { return byte.get_value(); });
+    return String::from_buffer(std::move(bytes));
+}
+
 } // namespace Softloq::WHATWG::Infra
@@ -14,17 +14,11 @@
 namespace Softloq::WHATWG::Infra
 {
 
-CodePoint::CodePoint() noexcept = default;
-
 CodePoint::CodePoint(char32_t value) noexcept
     : m_value{value}
 {
 }
 
-CodePoint::~CodePoint() noexcept = default;
-
-PrimitiveType CodePoint::get_type() const noexcept { return PrimitiveType::CodePoint; }
-
 char32_t CodePoint::get_value() const noexcept { return m_value; }
 
 void CodePoint::set_value(char32_t value) noexcept { m_value = value; }
@@ -14,17 +14,11 @@
 namespace Softloq::WHATWG::Infra
 {
 
-CodeUnit::CodeUnit() noexcept = default;
-
 CodeUnit::CodeUnit(std::uint16_t value) noexcept
     : m_value{value}
 {
 }
 
-CodeUnit::~CodeUnit() noexcept = default;
-
-PrimitiveType CodeUnit::get_type() const noexcept { return PrimitiveType::CodeUnit; }
-
 std::uint16_t CodeUnit::get_value() const noexcept { return m_value; }
 
 void CodeUnit::set_value(std::uint16_t value) noexcept { m_value = value; }
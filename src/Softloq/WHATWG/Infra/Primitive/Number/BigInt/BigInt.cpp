@@ -0,0 +1,21 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/BigInt/BigInt.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This file provides the explicit instantiation of Number<bigint_t> for the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the explicit instantiation of Number<bigint_t>, pre-compiling it
+ * into the library binary and suppressing redundant per-TU instantiation for consumers
+ * that include BigInt.hpp.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/Primitive/Number/BigInt/BigInt.hpp>
+
+namespace Softloq::WHATWG::Infra
+{
+
+template class Number<bigint_t>;
+
+} // namespace Softloq::WHATWG::Infra
@@ -0,0 +1,21 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/Number/UInt256/UInt256.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This file provides the explicit instantiation of Number<uint256_t> for the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the explicit instantiation of Number<uint256_t>, pre-compiling it
+ * into the library binary and suppressing redundant per-TU instantiation for consumers
+ * that include UInt256.hpp.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/Primitive/Number/UInt256/UInt256.hpp>
+
+namespace Softloq::WHATWG::Infra
+{
+
+template class Number<uint256_t>;
+
+} // namespace Softloq::WHATWG::Infra
@@ -0,0 +1,213 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/Atom.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This implements the Atom type for the WHATWG Infra library, an interned immutable String compared by identity.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the implementation of the Atom type and its global atom table.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/Primitive/String/Atom.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace Softloq::WHATWG::Infra
+{
+
+/**
+ * @brief An entry of the atom table.
+ */
+struct Atom::Entry
+{
+    String value;
+    std::size_t hash = 0;
+    mutable std::atomic<std::size_t> references{0};
+    bool is_static = false;
+};
+
+namespace
+{
+
+/**
+ * @brief The number of entries that must become unused before the next intern sweeps the table.
+ */
+constexpr std::size_t sweep_threshold = 1024;
+
+/**
+ * @brief The reference-counted entries of the atom table, keyed by hash.
+ */
+struct AtomTable
+{
+    std::mutex mutex;
+    std::unordered_multimap<std::size_t, std::unique_ptr<Atom::Entry>> entries;
+    std::atomic<std::size_t> unused{0};
+};
+
+/**
+ * @brief Get the atom table. It is never destroyed, so atoms with static storage duration stay valid at exit.
+ */
+AtomTable& atom_table()
+{
+    static AtomTable* const table = new AtomTable;
+    return *table;
+}
+
+/**
+ * @brief Remove the entries no Atom refers to any more. The table lock must be held.
+ */
+std::size_t sweep(AtomTable& table)
+{
+    table.unused.store(0, std::memory_order_relaxed);
+    return std::erase_if(table.entries, [](const auto& item) { return item.second->references.load(std::memory_order_acquire) == 0; });
+}
+
+/**
+ * @brief Get the entries of the static atoms, created on first use. They are never destroyed.
+ */
+const std::array<Atom::Entry, static_atom_count>& static_entries()
+{
+    static const std::array<Atom::Entry, static_atom_count>* const entries = []
+    {
+        auto* result = new std::array<Atom::Entry, static_atom_count>;
+        for (std::size_t index = 0; index < static_atom_count; ++index)
+        {
+            Atom::Entry& entry = (*result)[index];
+            entry.value = String{static_atom_texts[index]};
+            entry.hash = hash_code_units(std::span<const char16_t>{static_atom_texts[index]});
+            entry.is_static = true;
+        }
+        return result;
+    }();
+    return *entries;
+}
+
+} // namespace
+
+template <typename Unit>
+const Atom::Entry* Atom::intern(std::span<const Unit> code_units)
+{
+    if (code_units.empty()) return nullptr;
+    const std::size_t hash = hash_code_units(code_units);
+    if (const std::size_t index = find_static_atom(code_units, hash); index < static_atom_count) return &static_entries()[index];
+
+    AtomTable& table = atom_table();
+    std::lock_guard lock{table.mutex};
+    // Releases only count unused entries, so that destroying an Atom never locks; the sweep happens here.
+    if (table.unused.load(std::memory_order_relaxed) >= sweep_threshold) sweep(table);
+    const auto [first, last] = table.entries.equal_range(hash);
+    for (auto it = first; it != last; ++it)
+    {
+        Entry& entry = *it->second;
+        if (entry.value.visit([code_units](auto existing) { return std::ranges::equal(existing, code_units); }))
+        {
+            // Taking a reference under the lock lets a sweep never free an entry that is being revived.
+            entry.references.fetch_add(1, std::memory_order_relaxed);
+            return &entry;
+        }
+    }
+
+    auto entry = std::make_unique<Entry>();
+    if constexpr (std::is_same_v<Unit, std::uint8_t>)
+        entry->value = String::from_latin1(code_units);
+    else
+        entry->value = String{std::u16string_view{code_units.data(), code_units.size()}};
+    entry->hash = hash;
+    entry->references.store(1, std::memory_order_relaxed);
+    const Entry* result = entry.get();
+    table.entries.emplace(hash, std::move(entry));
+    return result;
+}
+
+void Atom::retain(const Entry* entry) noexcept
+{
+    if (entry && !entry->is_static) entry->references.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Atom::release(const Entry* entry) noexcept
+{
+    if (!entry || entry->is_static) return;
+    if (entry->references.fetch_sub(1, std::memory_order_acq_rel) == 1) atom_table().unused.fetch_add(1, std::memory_order_relaxed);
+}
+
+Atom::Atom() noexcept
+    : m_entry{nullptr}
+{
+}
+
+Atom::Atom(const String& value)
+    : m_entry{value.visit([](auto code_units) { return intern(code_units); })}
+{
+}
+
+Atom::Atom(std::u16string_view value)
+    : m_entry{intern(std::span<const char16_t>{value})}
+{
+}
+
+Atom::Atom(StaticAtom value)
+    : m_entry{&static_entries()[static_cast<std::size_t>(value)]}
+{
+}
+
+Atom::Atom(const Atom& other) noexcept
+    : m_entry{other.m_entry}
+{
+    retain(m_entry);
+}
+
+Atom::Atom(Atom&& other) noexcept
+    : m_entry{std::exchange(other.m_entry, nullptr)}
+{
+}
+
+Atom::~Atom() noexcept { release(m_entry); }
+
+Atom& Atom::operator=(const Atom& other) noexcept
+{
+    retain(other.m_entry);
+    release(std::exchange(m_entry, other.m_entry));
+    return *this;
+}
+
+Atom& Atom::operator=(Atom&& other) noexcept
+{
+    if (this != &other) release(std::exchange(m_entry, std::exchange(other.m_entry, nullptr)));
+    return *this;
+}
+
+const String& Atom::string() const noexcept
+{
+    static const String empty;
+    return m_entry ? m_entry->value : empty;
+}
+
+std::size_t Atom::hash() const noexcept
+{
+    return m_entry ? m_entry->hash : hash_code_units(std::span<const char16_t>{});
+}
+
+bool Atom::is_static() const noexcept { return !m_entry || m_entry->is_static; }
+
+std::size_t Atom::collect_unused()
+{
+    AtomTable& table = atom_table();
+    std::lock_guard lock{table.mutex};
+    return sweep(table);
+}
+
+std::size_t Atom::dynamic_count()
+{
+    AtomTable& table = atom_table();
+    std::lock_guard lock{table.mutex};
+    return table.entries.size();
+}
+
+} // namespace Softloq::WHATWG::Infra
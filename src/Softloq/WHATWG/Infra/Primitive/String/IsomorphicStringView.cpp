@@ -0,0 +1,103 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/IsomorphicStringView.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This implements the IsomorphicStringView type for the WHATWG Infra library, a lazily isomorphic-decoded view of a byte sequence.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the implementation of the IsomorphicStringView type.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/Primitive/String/IsomorphicStringView.hpp>
+#include <span>
+#include <stdexcept>
+
+namespace Softloq::WHATWG::Infra
+{
+
+namespace
+{
+
+/**
+ * @brief Returns true if the bytes starting at an offset have the values of the given code units.
+ */
+template <typename Unit>
+bool bytes_match_units(const ByteSequence& bytes, std::size_t offset, std::span<const Unit> code_units) noexcept
+{
+    for (std::size_t index = 0; index < code_units.size(); ++index)
+        if (bytes[offset + index].get_value() != code_units[index]) return false;
+    return true;
+}
+
+} // namespace
+
+IsomorphicStringView::IsomorphicStringView(const ByteSequence& bytes) noexcept
+    : m_bytes{&bytes}
+{
+}
+
+std::size_t IsomorphicStringView::size() const noexcept { return m_bytes->size(); }
+
+bool IsomorphicStringView::is_empty() const noexcept { return m_bytes->is_empty(); }
+
+CodeUnit IsomorphicStringView::operator[](std::size_t index) const noexcept
+{
+    return CodeUnit{(*m_bytes)[index].get_value()};
+}
+
+CodeUnit IsomorphicStringView::at(std::size_t index) const
+{
+    if (index >= size()) throw std::out_of_range("IsomorphicStringView::at: index out of range");
+    return (*this)[index];
+}
+
+bool IsomorphicStringView::starts_with(const String& prefix) const
+{
+    if (prefix.size() > size()) return false;
+    return prefix.visit([this](auto code_units) { return bytes_match_units(*m_bytes, 0, code_units); });
+}
+
+std::size_t IsomorphicStringView::find(CodeUnit code_unit, std::size_t position) const noexcept
+{
+    const std::uint16_t value = code_unit.get_value();
+    if (value > 0xFF) return npos;
+    for (std::size_t index = position; index < size(); ++index)
+        if ((*m_bytes)[index].get_value() == value) return index;
+    return npos;
+}
+
+std::size_t IsomorphicStringView::find(const String& needle, std::size_t position) const
+{
+    const std::size_t length = needle.size();
+    if (position > size() || length > size() - position) return npos;
+    return needle.visit([this, position, length](auto code_units)
+    {
+        for (std::size_t index = position; index + length <= size(); ++index)
+            if (bytes_match_units(*m_bytes, index, code_units)) return index;
+        return npos;
+    });
+}
+
+String IsomorphicStringView::to_string() const
+{
+    return m_bytes->isomorphic_decode();
+}
+
+bool IsomorphicStringView::operator==(const IsomorphicStringView& other) const noexcept
+{
+    return *m_bytes == *other.m_bytes;
+}
+
+bool IsomorphicStringView::operator==(const String& other) const
+{
+    if (other.size() != size()) return false;
+    return other.visit([this](auto code_units) { return bytes_match_units(*m_bytes, 0, code_units); });
+}
+
+bool IsomorphicStringView::operator==(std::u16string_view other) const noexcept
+{
+    return other.size() == size() && bytes_match_units(*m_bytes, 0, std::span<const char16_t>{other});
+}
+
+} // namespace Softloq::WHATWG::Infra
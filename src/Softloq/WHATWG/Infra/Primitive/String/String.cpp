@@ -0,0 +1,664 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/String.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This implements the String type for the WHATWG Infra library, representing a sequence of UTF-16 code units in the context of web APIs.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the implementation of the String primitive type.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/Primitive/String/String.hpp>
+#include <Softloq/WHATWG/Infra/SIMD/ClassScan.hpp>
+#include <Softloq/WHATWG/Infra/SIMD/Mismatch.hpp>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Softloq::WHATWG::Infra
+{
+
+namespace
+{
+
+constexpr CodePointRange latin1_range[1]{{0x0000, 0x00FF}};
+constexpr CodePointRange ascii_range[1]{{0x0000, 0x007F}};
+constexpr CodePointRange surrogate_range[1]{{0xD800, 0xDFFF}};
+
+/**
+ * @brief Returns true if every code unit is at most 0x00FF.
+ */
+bool fits_latin1(std::span<const char16_t> code_units) noexcept
+{
+    return SIMD::class_prefix_length(code_units.data(), code_units.size(), latin1_range, false) == code_units.size();
+}
+
+/**
+ * @brief Returns the offset reached by advancing over a number of code points, a surrogate pair counting as one.
+ */
+std::size_t advance_code_points(std::span<const char16_t> code_units, std::size_t offset, std::size_t count) noexcept
+{
+    for (; count > 0 && offset < code_units.size(); --count)
+    {
+        const char16_t unit = code_units[offset++];
+        if (unit >= 0xD800 && unit <= 0xDBFF && offset < code_units.size() && code_units[offset] >= 0xDC00 && code_units[offset] <= 0xDFFF) ++offset;
+    }
+    return offset;
+}
+
+/**
+ * @brief Returns true if a slice of length code units would waste its buffer: owner_length > length * max_waste_ratio, without overflowing.
+ */
+bool wastes_buffer(std::size_t owner_length, std::size_t length, std::size_t max_waste_ratio) noexcept
+{
+    return owner_length != 0 && (max_waste_ratio == 0 || (owner_length - 1) / max_waste_ratio >= length);
+}
+
+/**
+ * @brief Compares two runs of code units by code unit less than.
+ */
+template <typename L, typename R>
+std::strong_ordering compare_code_units(std::span<const L> lhs, std::span<const R> rhs) noexcept
+{
+    const std::size_t common = std::min(lhs.size(), rhs.size());
+    const std::size_t index = SIMD::mismatch(lhs.data(), rhs.data(), common);
+    if (index < common) return static_cast<char16_t>(lhs[index]) <=> static_cast<char16_t>(rhs[index]);
+    return lhs.size() <=> rhs.size();
+}
+
+} // namespace
+
+/**
+ * @brief The code point index of a UTF-16 String.
+ */
+struct String::CodePointIndex
+{
+    /**
+     * @brief The code unit offset of code point i * code_point_index_stride, for each i.
+     */
+    std::vector<std::size_t> unit_offsets;
+};
+
+/**
+ * @brief An inner node of a rope: the concatenation of two Strings.
+ */
+struct String::RopeNode
+{
+    String left;
+    String right;
+    std::size_t length;
+    std::size_t depth;
+    bool is_8bit;
+    mutable std::once_flag flattened;
+    mutable std::variant<Latin1Buffer, UTF16Buffer> flat;
+
+    /**
+     * @brief Concatenate the leaves of the tree into a flat buffer on first use and return it.
+     */
+    const std::variant<Latin1Buffer, UTF16Buffer>& flat_units() const;
+};
+
+const std::variant<String::Latin1Buffer, String::UTF16Buffer>& String::RopeNode::flat_units() const
+{
+    std::call_once(flattened, [this]
+    {
+        // Walk the tree with an explicit stack and copy the flat leaves in order.
+        std::vector<const String*> leaves;
+        std::vector<const String*> pending{&right, &left};
+        while (!pending.empty())
+        {
+            const String* node = pending.back();
+            pending.pop_back();
+            if (const auto* inner = std::get_if<RopeBuffer>(&node->m_units))
+            {
+                pending.push_back(&(*inner)->right);
+                pending.push_back(&(*inner)->left);
+            }
+            else
+                leaves.push_back(node);
+        }
+
+        const auto fill = [&leaves, this](auto& units)
+        {
+            units.reserve(length);
+            for (const String* leaf : leaves)
+                leaf->visit([&units](auto source) { units.insert(units.end(), source.begin(), source.end()); });
+        };
+        if (is_8bit)
+            fill(flat.emplace<Latin1Buffer>());
+        else
+            fill(flat.emplace<UTF16Buffer>());
+    });
+    return flat;
+}
+
+String::String() noexcept = default;
+
+String::String(std::u16string_view code_units)
+{
+    if (fits_latin1(code_units))
+        m_units.emplace<Latin1Buffer>(code_units.begin(), code_units.end());
+    else
+        m_units.emplace<UTF16Buffer>(code_units.begin(), code_units.end());
+}
+
+String::String(std::u32string_view code_points)
+{
+    const bool narrow = std::ranges::all_of(code_points, [](char32_t value) { return value <= 0xFF; });
+    if (narrow)
+    {
+        m_units.emplace<Latin1Buffer>(code_points.begin(), code_points.end());
+        return;
+    }
+    auto& units = m_units.emplace<UTF16Buffer>();
+    units.reserve(code_points.size());
+    for (char32_t value : code_points)
+    {
+        if (value >= 0x10000)
+        {
+            value -= 0x10000;
+            units.push_back(static_cast<char16_t>(0xD800 + (value >> 10)));
+            units.push_back(static_cast<char16_t>(0xDC00 + (value & 0x3FF)));
+        }
+        else
+            units.push_back(static_cast<char16_t>(value));
+    }
+}
+
+String::String(const String& other)
+    : m_units{other.m_units}
+{
+    copy_properties(other);
+}
+
+String::String(String&& other) noexcept
+    : m_units{std::exchange(other.m_units, {})}
+{
+    copy_properties(other);
+    take_code_point_index(other);
+    other.invalidate_properties();
+}
+
+String::~String() noexcept { invalidate_properties(); }
+
+String& String::operator=(const String& other)
+{
+    if (this == &other) return *this;
+    invalidate_properties();
+    m_units = other.m_units;
+    copy_properties(other);
+    return *this;
+}
+
+String& String::operator=(String&& other) noexcept
+{
+    if (this == &other) return *this;
+    invalidate_properties();
+    m_units = std::exchange(other.m_units, {});
+    copy_properties(other);
+    take_code_point_index(other);
+    other.invalidate_properties();
+    return *this;
+}
+
+String String::from_latin1(std::span<const std::uint8_t> bytes)
+{
+    String result;
+    result.m_units.emplace<Latin1Buffer>(bytes.begin(), bytes.end());
+    return result;
+}
+
+String String::from_latin1(std::string_view bytes)
+{
+    String result;
+    auto& units = result.m_units.emplace<Latin1Buffer>(bytes.size());
+    std::ranges::transform(bytes, units.begin(), [](char c) { return static_cast<std::uint8_t>(c); });
+    return result;
+}
+
+String String::from_buffer(Latin1Buffer&& code_units) noexcept
+{
+    String result;
+    result.m_units.emplace<Latin1Buffer>(std::move(code_units));
+    return result;
+}
+
+String String::from_buffer(UTF16Buffer&& code_units) noexcept
+{
+    String result;
+    result.m_units.emplace<UTF16Buffer>(std::move(code_units));
+    return result;
+}
+
+String String::concat(String lhs, String rhs, const StringRopeThresholds& thresholds)
+{
+    if (rhs.is_empty()) return lhs;
+    if (lhs.is_empty()) return rhs;
+    const std::size_t length = lhs.size() + rhs.size();
+    const std::size_t depth = std::max(lhs.rope_depth(), rhs.rope_depth()) + 1;
+    if (length < thresholds.min_length || depth > thresholds.max_depth)
+    {
+        lhs.flatten();
+        lhs.append(rhs);
+        return lhs;
+    }
+    const bool is_8bit = lhs.is_8bit() && rhs.is_8bit();
+    String result;
+    result.m_units = std::make_shared<const RopeNode>(std::move(lhs), std::move(rhs), length, depth, is_8bit);
+    return result;
+}
+
+String operator+(String lhs, const String& rhs)
+{
+    return String::concat(std::move(lhs), rhs);
+}
+
+bool String::is_8bit() const noexcept
+{
+    if (const auto* rope = std::get_if<RopeBuffer>(&m_units)) return (*rope)->is_8bit;
+    if (const auto* slice = std::get_if<SliceBuffer>(&m_units)) return slice->is_8bit;
+    return std::holds_alternative<Latin1Buffer>(m_units);
+}
+
+bool String::is_rope() const noexcept { return std::holds_alternative<RopeBuffer>(m_units); }
+
+bool String::is_slice() const noexcept { return std::holds_alternative<SliceBuffer>(m_units); }
+
+std::size_t String::rope_depth() const noexcept
+{
+    if (const auto* rope = std::get_if<RopeBuffer>(&m_units)) return (*rope)->depth;
+    return 0;
+}
+
+void String::flatten()
+{
+    if (const auto* slice = std::get_if<SliceBuffer>(&m_units))
+    {
+        // Copy the window out, releasing this String's share of the buffer.
+        if (slice->is_8bit)
+        {
+            const auto* units = static_cast<const std::uint8_t*>(slice->data);
+            m_units = Latin1Buffer(units, units + slice->length);
+        }
+        else
+        {
+            const auto* units = static_cast<const char16_t*>(slice->data);
+            m_units = UTF16Buffer(units, units + slice->length);
+        }
+        return;
+    }
+    const auto* rope = std::get_if<RopeBuffer>(&m_units);
+    if (!rope) return;
+    const RopeNode& node = **rope;
+    node.flat_units();
+    // The last owner of the node can take its buffer instead of copying it.
+    auto units = rope->use_count() == 1 ? std::move(node.flat) : node.flat;
+    if (auto* latin1 = std::get_if<Latin1Buffer>(&units))
+        m_units = std::move(*latin1);
+    else
+        m_units = std::move(std::get<UTF16Buffer>(units));
+}
+
+std::span<const std::uint8_t> String::latin1_span() const
+{
+    if (const auto* latin1 = std::get_if<Latin1Buffer>(&m_units)) return *latin1;
+    if (const auto* slice = std::get_if<SliceBuffer>(&m_units); slice && slice->is_8bit) return {static_cast<const std::uint8_t*>(slice->data), slice->length};
+    if (const auto* rope = std::get_if<RopeBuffer>(&m_units))
+        if (const auto* latin1 = std::get_if<Latin1Buffer>(&(*rope)->flat_units())) return *latin1;
+    return {};
+}
+
+std::span<const char16_t> String::utf16_span() const
+{
+    if (const auto* utf16 = std::get_if<UTF16Buffer>(&m_units)) return *utf16;
+    if (const auto* slice = std::get_if<SliceBuffer>(&m_units); slice && !slice->is_8bit) return {static_cast<const char16_t*>(slice->data), slice->length};
+    if (const auto* rope = std::get_if<RopeBuffer>(&m_units))
+        if (const auto* utf16 = std::get_if<UTF16Buffer>(&(*rope)->flat_units())) return *utf16;
+    return {};
+}
+
+void String::widen()
+{
+    flatten();
+    if (const auto* latin1 = std::get_if<Latin1Buffer>(&m_units))
+    {
+        UTF16Buffer units(latin1->begin(), latin1->end());
+        m_units = std::move(units);
+    }
+}
+
+bool String::try_narrow()
+{
+    flatten();
+    if (const auto* utf16 = std::get_if<UTF16Buffer>(&m_units))
+    {
+        if (!fits_latin1(*utf16)) return false;
+        Latin1Buffer units(utf16->size());
+        std::ranges::transform(*utf16, units.begin(), [](char16_t unit) { return static_cast<std::uint8_t>(unit); });
+        m_units = std::move(units);
+    }
+    return true;
+}
+
+std::size_t String::size() const noexcept
+{
+    if (const auto* rope = std::get_if<RopeBuffer>(&m_units)) return (*rope)->length;
+    if (const auto* slice = std::get_if<SliceBuffer>(&m_units)) return slice->length;
+    if (const auto* latin1 = std::get_if<Latin1Buffer>(&m_units)) return latin1->size();
+    return std::get<UTF16Buffer>(m_units).size();
+}
+
+bool String::is_empty() const noexcept { return size() == 0; }
+
+CodeUnit String::operator[](std::size_t index) const
+{
+    return visit([index](auto units) { return CodeUnit{static_cast<std::uint16_t>(units[index])}; });
+}
+
+CodeUnit String::at(std::size_t index) const
+{
+    if (index >= size()) throw std::out_of_range("String::at: index out of range");
+    return (*this)[index];
+}
+
+void String::push_back(CodeUnit code_unit)
+{
+    flatten();
+    const std::uint16_t value = code_unit.get_value();
+    invalidate_properties();
+    if (auto* latin1 = std::get_if<Latin1Buffer>(&m_units); latin1 && value <= 0xFF)
+    {
+        latin1->push_back(static_cast<std::uint8_t>(value));
+        return;
+    }
+    widen();
+    std::get<UTF16Buffer>(m_units).push_back(static_cast<char16_t>(value));
+}
+
+void String::append(const String& other)
+{
+    if (is_rope())
+    {
+        // Copy other first: it may be *this, and concat's arguments may be initialized in either order.
+        String tail{other};
+        *this = concat(std::move(*this), std::move(tail));
+        return;
+    }
+    flatten();
+    invalidate_properties();
+    if (&other == this)
+    {
+        // Inserting a range of the buffer being grown breaks vector::insert, so resize and copy the old prefix instead.
+        const std::size_t length = size();
+        if (auto* latin1 = std::get_if<Latin1Buffer>(&m_units))
+        {
+            latin1->resize(length * 2);
+            std::copy_n(latin1->begin(), length, latin1->begin() + static_cast<std::ptrdiff_t>(length));
+        }
+        else
+        {
+            auto& units = std::get<UTF16Buffer>(m_units);
+            units.resize(length * 2);
+            std::copy_n(units.begin(), length, units.begin() + static_cast<std::ptrdiff_t>(length));
+        }
+        return;
+    }
+    if (auto* latin1 = std::get_if<Latin1Buffer>(&m_units); latin1 && other.is_8bit())
+    {
+        const auto source = other.latin1_span();
+        latin1->insert(latin1->end(), source.begin(), source.end());
+        return;
+    }
+    widen();
+    auto& units = std::get<UTF16Buffer>(m_units);
+    other.visit([&units](auto source) { units.insert(units.end(), source.begin(), source.end()); });
+}
+
+void String::clear() noexcept
+{
+    m_units.emplace<Latin1Buffer>();
+    invalidate_properties();
+}
+
+String String::code_unit_substring(std::size_t start, std::size_t length, const StringSliceThresholds& thresholds)
+{
+    if (std::holds_alternative<Latin1Buffer>(m_units) || std::holds_alternative<UTF16Buffer>(m_units))
+    {
+        // Sharing is only worth it for a substring that the const overload would slice.
+        if (start <= size() && length <= size() - start && length >= thresholds.min_length && !wastes_buffer(size(), length, thresholds.max_waste_ratio)) share();
+    }
+    return std::as_const(*this).code_unit_substring(start, length, thresholds);
+}
+
+String String::code_unit_substring(std::size_t start, std::size_t length, const StringSliceThresholds& thresholds) const
+{
+    if (start > size() || length > size() - start) throw std::out_of_range("String::code_unit_substring: range out of bounds");
+    String result;
+    const auto* slice = std::get_if<SliceBuffer>(&m_units);
+    const auto* rope = std::get_if<RopeBuffer>(&m_units);
+    const std::size_t owner_length = slice ? slice->owner_length : size();
+    if ((!slice && !rope) || length < thresholds.min_length || wastes_buffer(owner_length, length, thresholds.max_waste_ratio))
+    {
+        if (is_8bit())
+            result.m_units.emplace<Latin1Buffer>(latin1_span().subspan(start, length).begin(), latin1_span().subspan(start, length).end());
+        else
+            result = String{std::u16string_view{utf16_span().data() + start, length}};
+        return result;
+    }
+
+    SliceBuffer window;
+    if (slice)
+        window = *slice;
+    else
+    {
+        // A rope's flat buffer lives in its tree node, so the slice keeps the node alive.
+        window.owner = *rope;
+        window.owner_length = size();
+        window.is_8bit = is_8bit();
+        window.data = window.is_8bit ? static_cast<const void*>(latin1_span().data()) : static_cast<const void*>(utf16_span().data());
+    }
+    window.data = static_cast<const std::uint8_t*>(window.data) + start * (window.is_8bit ? 1 : 2);
+    window.length = length;
+    result.m_units = std::move(window);
+    return result;
+}
+
+void String::share()
+{
+    const auto share_buffer = [this](auto&& units, bool is_8bit)
+    {
+        using Buffer = std::remove_cvref_t<decltype(units)>;
+        auto owner = std::make_shared<const Buffer>(std::move(units));
+        const void* data = owner->data();
+        const std::size_t length = owner->size();
+        m_units = SliceBuffer{std::move(owner), data, length, length, is_8bit};
+    };
+    if (auto* latin1 = std::get_if<Latin1Buffer>(&m_units))
+        share_buffer(std::move(*latin1), true);
+    else if (auto* utf16 = std::get_if<UTF16Buffer>(&m_units))
+        share_buffer(std::move(*utf16), false);
+}
+
+std::u16string String::to_utf16() const
+{
+    return visit([](auto units) { return std::u16string(units.begin(), units.end()); });
+}
+
+std::size_t String::hash() const
+{
+    if (m_properties.load(std::memory_order_acquire) & HashKnown) return m_hash.load(std::memory_order_relaxed);
+    const std::size_t hash = visit([](auto units) { return hash_code_units(units); });
+    m_hash.store(hash, std::memory_order_relaxed);
+    m_properties.fetch_or(HashKnown, std::memory_order_release);
+    return hash;
+}
+
+bool String::is_ascii() const { return scan_properties() & ASCIIBit; }
+
+bool String::is_scalar_value_string() const { return scan_properties() & ScalarValueBit; }
+
+std::size_t String::code_point_length() const
+{
+    scan_properties();
+    return m_code_point_length.load(std::memory_order_relaxed);
+}
+
+std::uint32_t String::compute_properties(std::size_t& code_point_length) const
+{
+    std::uint32_t bits = ScanKnown;
+    std::size_t length = size();
+    if (is_8bit())
+    {
+        const auto units = latin1_span();
+        bits |= ScalarValueBit;
+        if (SIMD::class_prefix_length(units.data(), units.size(), ascii_range, false) == units.size()) bits |= ASCIIBit;
+    }
+    else
+    {
+        const auto units = utf16_span();
+        if (SIMD::class_prefix_length(units.data(), units.size(), ascii_range, false) == units.size()) bits |= ASCIIBit;
+        bool scalar = true;
+        // Everything before the first surrogate is one code point per code unit.
+        for (std::size_t index = SIMD::class_prefix_length(units.data(), units.size(), surrogate_range, true); index < units.size(); ++index)
+        {
+            const char16_t unit = units[index];
+            if (unit < 0xD800 || unit > 0xDFFF) continue;
+            if (unit <= 0xDBFF && index + 1 < units.size() && units[index + 1] >= 0xDC00 && units[index + 1] <= 0xDFFF)
+            {
+                --length;
+                ++index;
+            }
+            else
+                scalar = false;
+        }
+        if (scalar) bits |= ScalarValueBit;
+    }
+    code_point_length = length;
+    return bits;
+}
+
+std::uint32_t String::scan_properties() const
+{
+    if (const std::uint32_t known = m_properties.load(std::memory_order_acquire); known & ScanKnown) return known;
+    std::size_t length = 0;
+    const std::uint32_t bits = compute_properties(length);
+    m_code_point_length.store(length, std::memory_order_relaxed);
+    return m_properties.fetch_or(bits, std::memory_order_release) | bits;
+}
+
+bool String::hashes_differ(const String& other) const noexcept
+{
+    const std::uint32_t known = m_properties.load(std::memory_order_acquire) & other.m_properties.load(std::memory_order_acquire);
+    return (known & HashKnown) && m_hash.load(std::memory_order_relaxed) != other.m_hash.load(std::memory_order_relaxed);
+}
+
+void String::copy_properties(const String& other) noexcept
+{
+    const std::uint32_t known = other.m_properties.load(std::memory_order_acquire);
+    m_hash.store(other.m_hash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_code_point_length.store(other.m_code_point_length.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_properties.store(known, std::memory_order_release);
+}
+
+void String::invalidate_properties() noexcept
+{
+    m_properties.store(0, std::memory_order_relaxed);
+    delete m_code_point_index.exchange(nullptr, std::memory_order_acquire);
+}
+
+void String::take_code_point_index(String& other) noexcept
+{
+    m_code_point_index.store(other.m_code_point_index.exchange(nullptr, std::memory_order_acquire), std::memory_order_release);
+}
+
+const String::CodePointIndex& String::code_point_index() const
+{
+    if (const CodePointIndex* index = m_code_point_index.load(std::memory_order_acquire)) return *index;
+    auto built = std::make_unique<CodePointIndex>();
+    const auto units = utf16_span();
+    built->unit_offsets.reserve(code_point_length() / code_point_index_stride + 1);
+    for (std::size_t offset = 0; offset < units.size(); offset = advance_code_points(units, offset, code_point_index_stride))
+        built->unit_offsets.push_back(offset);
+    // Threads racing to build the index agree on the first one published.
+    const CodePointIndex* expected = nullptr;
+    if (m_code_point_index.compare_exchange_strong(expected, built.get(), std::memory_order_acq_rel, std::memory_order_acquire)) return *built.release();
+    return *expected;
+}
+
+CodePoint String::code_point_at(std::size_t index) const
+{
+    if (index >= code_point_length()) throw std::out_of_range("String::code_point_at: index out of range");
+    if (is_8bit()) return CodePoint{latin1_span()[index]};
+    const auto units = utf16_span();
+    const std::size_t offset = code_unit_offset(index);
+    const char32_t unit = units[offset];
+    if (unit >= 0xD800 && unit <= 0xDBFF && offset + 1 < units.size() && units[offset + 1] >= 0xDC00 && units[offset + 1] <= 0xDFFF)
+        return CodePoint{0x10000 + ((unit - 0xD800) << 10) + (units[offset + 1] - 0xDC00)};
+    return CodePoint{unit};
+}
+
+std::size_t String::code_unit_offset(std::size_t code_point_offset) const
+{
+    const std::size_t length = code_point_length();
+    if (code_point_offset > length) throw std::out_of_range("String::code_unit_offset: offset out of range");
+    // Without surrogate pairs every code point is one code unit.
+    if (length == size()) return code_point_offset;
+    if (code_point_offset == length) return size();
+    const auto units = utf16_span();
+    if (units.size() < code_point_index_min_length) return advance_code_points(units, 0, code_point_offset);
+    const CodePointIndex& index = code_point_index();
+    return advance_code_points(units, index.unit_offsets[code_point_offset / code_point_index_stride], code_point_offset % code_point_index_stride);
+}
+
+std::size_t String::code_point_offset(std::size_t code_unit_offset) const
+{
+    if (code_unit_offset > size()) throw std::out_of_range("String::code_point_offset: offset out of range");
+    if (code_point_length() == size()) return code_unit_offset;
+    const auto units = utf16_span();
+    std::size_t code_point = 0;
+    std::size_t offset = 0;
+    if (units.size() >= code_point_index_min_length)
+    {
+        // Start from the last indexed code point at or before the code unit.
+        const auto& unit_offsets = code_point_index().unit_offsets;
+        const std::size_t entry = static_cast<std::size_t>(std::ranges::upper_bound(unit_offsets, code_unit_offset) - unit_offsets.begin()) - 1;
+        code_point = entry * code_point_index_stride;
+        offset = unit_offsets[entry];
+    }
+    while (offset < code_unit_offset)
+    {
+        const std::size_t next = advance_code_points(units, offset, 1);
+        if (next > code_unit_offset) break;
+        offset = next;
+        ++code_point;
+    }
+    return code_point;
+}
+
+bool String::operator==(const String& other) const
+{
+    if (size() != other.size() || hashes_differ(other)) return false;
+    return visit([&other](auto lhs)
+    {
+        return other.visit([lhs](auto rhs) { return std::ranges::equal(lhs, rhs); });
+    });
+}
+
+bool String::operator!=(const String& other) const
+{
+    return !(*this == other);
+}
+
+std::strong_ordering String::operator<=>(const String& other) const
+{
+    return visit([&other](auto lhs)
+    {
+        return other.visit([lhs](auto rhs) { return compare_code_units(lhs, rhs); });
+    });
+}
+
+} // namespace Softloq::WHATWG::Infra
@@ -0,0 +1,286 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/StringBuilder.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This implements the StringBuilder type for the WHATWG Infra library, which builds a String from pieces without repeated reallocation.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the implementation of the StringBuilder type.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/Primitive/String/StringBuilder.hpp>
+#include <Softloq/WHATWG/Infra/SIMD/ClassScan.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace Softloq::WHATWG::Infra
+{
+
+namespace
+{
+
+constexpr CodePointRange ascii_range[1]{{0x0000, 0x007F}};
+constexpr CodePointRange latin1_range[1]{{0x0000, 0x00FF}};
+
+} // namespace
+
+StringBuilder::StringBuilder() noexcept = default;
+
+StringBuilder::StringBuilder(std::size_t capacity)
+{
+    reserve(capacity);
+}
+
+std::size_t StringBuilder::size() const noexcept
+{
+    switch (m_storage)
+    {
+    case Storage::Inline: return m_inline_size;
+    case Storage::Latin1: return m_latin1.size();
+    default: return m_utf16.size();
+    }
+}
+
+bool StringBuilder::is_empty() const noexcept { return size() == 0; }
+
+std::size_t StringBuilder::capacity() const noexcept
+{
+    switch (m_storage)
+    {
+    case Storage::Inline: return inline_capacity;
+    case Storage::Latin1: return m_latin1.capacity();
+    default: return m_utf16.capacity();
+    }
+}
+
+bool StringBuilder::is_8bit() const noexcept { return m_storage != Storage::UTF16; }
+
+void StringBuilder::reserve(std::size_t capacity)
+{
+    switch (m_storage)
+    {
+    case Storage::Inline:
+        if (capacity <= inline_capacity) return;
+        m_latin1.clear();
+        m_latin1.reserve(capacity);
+        m_latin1.insert(m_latin1.end(), m_inline.begin(), m_inline.begin() + static_cast<std::ptrdiff_t>(m_inline_size));
+        m_storage = Storage::Latin1;
+        return;
+    case Storage::Latin1: m_latin1.reserve(capacity); return;
+    default: m_utf16.reserve(capacity); return;
+    }
+}
+
+std::size_t StringBuilder::grown_capacity(std::size_t additional) const noexcept
+{
+    return std::max(size() + additional, 2 * capacity());
+}
+
+void StringBuilder::grow_8bit(std::size_t additional)
+{
+    if (size() + additional <= capacity()) return;
+    reserve(grown_capacity(additional));
+}
+
+void StringBuilder::widen(std::size_t additional)
+{
+    if (m_storage == Storage::UTF16) return;
+    const std::span<const std::uint8_t> units = m_storage == Storage::Inline
+        ? std::span<const std::uint8_t>{m_inline.data(), m_inline_size}
+        : std::span<const std::uint8_t>{m_latin1};
+    m_utf16.clear();
+    m_utf16.reserve(std::max(capacity(), units.size() + additional));
+    m_utf16.insert(m_utf16.end(), units.begin(), units.end());
+    m_latin1.clear();
+    m_inline_size = 0;
+    m_storage = Storage::UTF16;
+}
+
+void StringBuilder::push_code_unit(char16_t code_unit)
+{
+    if (m_storage == Storage::UTF16)
+    {
+        m_utf16.push_back(code_unit);
+        return;
+    }
+    if (code_unit > 0xFF)
+    {
+        widen(1);
+        m_utf16.push_back(code_unit);
+        return;
+    }
+    grow_8bit(1);
+    if (m_storage == Storage::Inline)
+        m_inline[m_inline_size++] = static_cast<std::uint8_t>(code_unit);
+    else
+        m_latin1.push_back(static_cast<std::uint8_t>(code_unit));
+}
+
+void StringBuilder::push_code_point(char32_t code_point)
+{
+    if (code_point < 0x10000)
+    {
+        push_code_unit(static_cast<char16_t>(code_point));
+        return;
+    }
+    widen(2);
+    code_point -= 0x10000;
+    m_utf16.push_back(static_cast<char16_t>(0xD800 + (code_point >> 10)));
+    m_utf16.push_back(static_cast<char16_t>(0xDC00 + (code_point & 0x3FF)));
+}
+
+void StringBuilder::append(CodeUnit code_unit) { push_code_unit(static_cast<char16_t>(code_unit.get_value())); }
+
+void StringBuilder::append(CodePoint code_point) { push_code_point(code_point.get_value()); }
+
+void StringBuilder::append(const String& value)
+{
+    if (value.is_8bit())
+        append_latin1(value.latin1_span());
+    else
+        append_code_units(std::u16string_view{value.utf16_span().data(), value.size()});
+}
+
+void StringBuilder::append_code_units(std::u16string_view code_units)
+{
+    if (m_storage != Storage::UTF16 && SIMD::class_prefix_length(code_units.data(), code_units.size(), latin1_range, false) == code_units.size())
+    {
+        grow_8bit(code_units.size());
+        if (m_storage == Storage::Inline)
+        {
+            std::ranges::transform(code_units, m_inline.begin() + static_cast<std::ptrdiff_t>(m_inline_size), [](char16_t unit) { return static_cast<std::uint8_t>(unit); });
+            m_inline_size += code_units.size();
+        }
+        else
+            std::ranges::transform(code_units, std::back_inserter(m_latin1), [](char16_t unit) { return static_cast<std::uint8_t>(unit); });
+        return;
+    }
+    widen(code_units.size());
+    m_utf16.insert(m_utf16.end(), code_units.begin(), code_units.end());
+}
+
+void StringBuilder::append_code_points(std::u32string_view code_points)
+{
+    if (m_storage != Storage::UTF16 && std::ranges::all_of(code_points, [](char32_t value) { return value <= 0xFF; }))
+    {
+        grow_8bit(code_points.size());
+        for (const char32_t value : code_points) push_code_unit(static_cast<char16_t>(value));
+        return;
+    }
+    widen(code_points.size());
+    for (const char32_t value : code_points) push_code_point(value);
+}
+
+void StringBuilder::append_latin1(std::span<const std::uint8_t> bytes)
+{
+    if (m_storage == Storage::UTF16)
+    {
+        m_utf16.insert(m_utf16.end(), bytes.begin(), bytes.end());
+        return;
+    }
+    grow_8bit(bytes.size());
+    if (m_storage == Storage::Inline)
+    {
+        std::ranges::copy(bytes, m_inline.begin() + static_cast<std::ptrdiff_t>(m_inline_size));
+        m_inline_size += bytes.size();
+    }
+    else
+        m_latin1.insert(m_latin1.end(), bytes.begin(), bytes.end());
+}
+
+void StringBuilder::append_latin1(std::string_view bytes)
+{
+    append_latin1(std::span<const std::uint8_t>{reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size()});
+}
+
+void StringBuilder::append_utf8(std::string_view bytes)
+{
+    const std::span<const std::uint8_t> data{reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size()};
+    char32_t code_point = 0;
+    std::size_t bytes_needed = 0;
+    std::size_t bytes_seen = 0;
+    std::uint8_t lower_boundary = 0x80;
+    std::uint8_t upper_boundary = 0xBF;
+    std::size_t index = 0;
+    while (index < data.size())
+    {
+        if (bytes_needed == 0)
+        {
+            // UTF-8 encodes ASCII as itself, so runs of it are appended in bulk.
+            const std::size_t ascii = SIMD::class_prefix_length(data.data() + index, data.size() - index, ascii_range, false);
+            append_latin1(data.subspan(index, ascii));
+            index += ascii;
+            if (index == data.size()) break;
+            const std::uint8_t byte = data[index++];
+            if (byte >= 0xC2 && byte <= 0xDF)
+            {
+                bytes_needed = 1;
+                code_point = byte & 0x1F;
+            }
+            else if (byte >= 0xE0 && byte <= 0xEF)
+            {
+                if (byte == 0xE0) lower_boundary = 0xA0;
+                if (byte == 0xED) upper_boundary = 0x9F;
+                bytes_needed = 2;
+                code_point = byte & 0x0F;
+            }
+            else if (byte >= 0xF0 && byte <= 0xF4)
+            {
+                if (byte == 0xF0) lower_boundary = 0x90;
+                if (byte == 0xF4) upper_boundary = 0x8F;
+                bytes_needed = 3;
+                code_point = byte & 0x07;
+            }
+            else
+                push_code_unit(0xFFFD);
+            continue;
+        }
+        const std::uint8_t byte = data[index];
+        if (byte < lower_boundary || byte > upper_boundary)
+        {
+            // The byte is not consumed: it may start the next sequence.
+            code_point = 0;
+            bytes_needed = 0;
+            bytes_seen = 0;
+            lower_boundary = 0x80;
+            upper_boundary = 0xBF;
+            push_code_unit(0xFFFD);
+            continue;
+        }
+        ++index;
+        lower_boundary = 0x80;
+        upper_boundary = 0xBF;
+        code_point = (code_point << 6) | (byte & 0x3F);
+        if (++bytes_seen != bytes_needed) continue;
+        push_code_point(code_point);
+        code_point = 0;
+        bytes_needed = 0;
+        bytes_seen = 0;
+    }
+    if (bytes_needed != 0) push_code_unit(0xFFFD);
+}
+
+String StringBuilder::release()
+{
+    String result;
+    switch (m_storage)
+    {
+    case Storage::Inline: result = String::from_latin1(std::span<const std::uint8_t>{m_inline.data(), m_inline_size}); break;
+    case Storage::Latin1: result = String::from_buffer(std::exchange(m_latin1, {})); break;
+    default: result = String::from_buffer(std::exchange(m_utf16, {})); break;
+    }
+    m_inline_size = 0;
+    m_storage = Storage::Inline;
+    return result;
+}
+
+void StringBuilder::clear() noexcept
+{
+    m_inline_size = 0;
+    m_latin1.clear();
+    m_utf16.clear();
+    m_storage = Storage::Inline;
+}
+
+} // namespace Softloq::WHATWG::Infra
@@ -0,0 +1,138 @@
+/**
+ * @file Softloq/WHATWG/Infra/Primitive/String/StringSort.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This implements the String sort of the WHATWG Infra library, which sorts Strings in ascending order with code unit less than.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the multikey quicksort specialization for lists of Strings.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/Primitive/String/StringSort.hpp>
+#include <Softloq/WHATWG/Infra/SIMD/Mismatch.hpp>
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Softloq::WHATWG::Infra
+{
+
+namespace
+{
+
+/**
+ * @brief Partitions of at most this many Strings are sorted by insertion sort.
+ */
+constexpr std::size_t insertion_sort_threshold = 16;
+
+/**
+ * @brief The code units of a String being sorted, read without going through the String.
+ */
+struct SortKey
+{
+    const void* code_units;
+    std::size_t size;
+    bool is_8bit;
+    String* string;
+};
+
+/**
+ * @brief Get the code unit at an offset, or -1 past the end so that a prefix sorts first.
+ */
+std::int32_t unit_at(const SortKey& key, std::size_t offset) noexcept
+{
+    if (offset >= key.size) return -1;
+    if (key.is_8bit) return static_cast<const std::uint8_t*>(key.code_units)[offset];
+    return static_cast<const char16_t*>(key.code_units)[offset];
+}
+
+/**
+ * @brief Get the offset of the first code unit from offset at which two keys differ, or common if they do not.
+ */
+template <typename L, typename R>
+std::size_t mismatch_from(const SortKey& lhs, const SortKey& rhs, std::size_t offset, std::size_t common) noexcept
+{
+    return offset + SIMD::mismatch(static_cast<const L*>(lhs.code_units) + offset, static_cast<const R*>(rhs.code_units) + offset, common - offset);
+}
+
+/**
+ * @brief Compares the code units of two keys from an offset up to which they are known to be equal.
+ */
+std::strong_ordering compare_from(const SortKey& lhs, const SortKey& rhs, std::size_t offset) noexcept
+{
+    const std::size_t common = std::min(lhs.size, rhs.size);
+    if (offset < common)
+    {
+        if (lhs.is_8bit && rhs.is_8bit) offset = mismatch_from<std::uint8_t, std::uint8_t>(lhs, rhs, offset, common);
+        else if (lhs.is_8bit) offset = mismatch_from<std::uint8_t, char16_t>(lhs, rhs, offset, common);
+        else if (rhs.is_8bit) offset = mismatch_from<char16_t, std::uint8_t>(lhs, rhs, offset, common);
+        else offset = mismatch_from<char16_t, char16_t>(lhs, rhs, offset, common);
+    }
+    if (offset < common) return unit_at(lhs, offset) <=> unit_at(rhs, offset);
+    return lhs.size <=> rhs.size;
+}
+
+/**
+ * @brief Sorts keys whose code units before offset are all equal.
+ */
+void multikey_quicksort(std::span<SortKey> keys, std::size_t offset)
+{
+    while (keys.size() > insertion_sort_threshold)
+    {
+        const std::int32_t first = unit_at(keys.front(), offset);
+        const std::int32_t middle = unit_at(keys[keys.size() / 2], offset);
+        const std::int32_t last = unit_at(keys.back(), offset);
+        const std::int32_t pivot = std::max(std::min(first, middle), std::min(std::max(first, middle), last));
+
+        // Three-way partition on the code unit at offset: [0, less) < pivot, [less, greater) == pivot.
+        std::size_t less = 0;
+        std::size_t greater = keys.size();
+        for (std::size_t index = 0; index < greater;)
+        {
+            const std::int32_t unit = unit_at(keys[index], offset);
+            if (unit < pivot) std::swap(keys[less++], keys[index++]);
+            else if (unit > pivot) std::swap(keys[index], keys[--greater]);
+            else ++index;
+        }
+        multikey_quicksort(keys.first(less), offset);
+        multikey_quicksort(keys.subspan(greater), offset);
+
+        // Keys equal to a pivot of -1 all end at offset, so they are equal Strings.
+        if (pivot < 0) return;
+        keys = keys.subspan(less, greater - less);
+        ++offset;
+    }
+    for (std::size_t index = 1; index < keys.size(); ++index)
+    {
+        SortKey key = keys[index];
+        std::size_t hole = index;
+        for (; hole > 0 && compare_from(key, keys[hole - 1], offset) < 0; --hole) keys[hole] = keys[hole - 1];
+        keys[hole] = key;
+    }
+}
+
+} // namespace
+
+void sort_code_unit_less_than(std::span<String> strings)
+{
+    if (strings.size() < 2) return;
+    std::vector<SortKey> keys;
+    keys.reserve(strings.size());
+    for (String& string : strings)
+    {
+        if (string.is_8bit()) keys.push_back({string.latin1_span().data(), string.size(), true, &string});
+        else keys.push_back({string.utf16_span().data(), string.size(), false, &string});
+    }
+    multikey_quicksort(keys, 0);
+
+    // Moving a String keeps its buffer, so the keys stay valid while the Strings are permuted.
+    std::vector<String> sorted;
+    sorted.reserve(strings.size());
+    for (const SortKey& key : keys) sorted.push_back(std::move(*key.string));
+    std::ranges::move(sorted, strings.begin());
+}
+
+} // namespace Softloq::WHATWG::Infra
@@ -0,0 +1,70 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/ByteSwap.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This implements the vectorized byte-swapping kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the SSE2 and portable scalar implementations of the byte-swapping kernels.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/SIMD/ByteSwap.hpp>
+#include <Softloq/WHATWG/Infra/SIMD/Target.hpp>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+namespace
+{
+
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+/**
+ * @brief Returns a vector with the byte order of each lane of Width bytes reversed.
+ *
+ * SSE2 has no byte shuffle, so wider lanes first reverse their 16-bit halves with the 16-bit
+ * shuffles, and then every lane swaps the two bytes of each half with shifts.
+ */
+template <std::size_t Width>
+__m128i swap_lanes(__m128i vector) noexcept
+{
+    if constexpr (Width == 4)
+        vector = _mm_shufflehi_epi16(_mm_shufflelo_epi16(vector, 0xB1), 0xB1);
+    else if constexpr (Width == 8)
+        vector = _mm_shufflehi_epi16(_mm_shufflelo_epi16(vector, 0x1B), 0x1B);
+    return _mm_or_si128(_mm_slli_epi16(vector, 8), _mm_srli_epi16(vector, 8));
+}
+#endif
+
+} // namespace
+
+template <std::size_t Width>
+    requires ByteSwapWidth<Width>
+void byte_swap(const std::uint8_t* source, std::size_t count, std::uint8_t* destination) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    const std::size_t size = count * Width;
+    for (; index + 32 <= size; index += 32)
+    {
+        const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+        const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index + 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), swap_lanes<Width>(first));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index + 16), swap_lanes<Width>(second));
+    }
+    if (index + 16 <= size)
+    {
+        const __m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), swap_lanes<Width>(vector));
+        index += 16;
+    }
+#endif
+    ByteSwapPortable::byte_swap<Width>(source + index, count - index / Width, destination + index);
+}
+
+// Explicit instantiations for the 16-bit, 32-bit and 64-bit integers
+template SOFTLOQ_WHATWG_INFRA_API void byte_swap<2>(const std::uint8_t*, std::size_t, std::uint8_t*) noexcept;
+template SOFTLOQ_WHATWG_INFRA_API void byte_swap<4>(const std::uint8_t*, std::size_t, std::uint8_t*) noexcept;
+template SOFTLOQ_WHATWG_INFRA_API void byte_swap<8>(const std::uint8_t*, std::size_t, std::uint8_t*) noexcept;
+
+} // namespace Softloq::WHATWG::Infra::SIMD
@@ -0,0 +1,169 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/CaseFold.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This implements the vectorized ASCII case conversion and case-insensitive comparison kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the SSE2 and portable scalar implementations of the ASCII case kernels.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/SIMD/CaseFold.hpp>
+#include <Softloq/WHATWG/Infra/SIMD/Target.hpp>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+void ascii_case_convert(std::uint8_t* data, std::size_t size, bool to_uppercase) noexcept
+{
+    const char32_t first_letter = to_uppercase ? U'a' : U'A';
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if (size >= 16)
+    {
+        const __m128i first = _mm_set1_epi8(static_cast<char>(first_letter));
+        const __m128i span = _mm_set1_epi8(static_cast<char>(25));
+        const __m128i flip = _mm_set1_epi8(static_cast<char>(0x20));
+        const __m128i zero = _mm_setzero_si128();
+        for (; index + 16 <= size; index += 16)
+        {
+            __m128i* block = reinterpret_cast<__m128i*>(data + index);
+            const __m128i units = _mm_loadu_si128(block);
+            const __m128i letters = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(units, first), span), zero);
+            _mm_storeu_si128(block, _mm_xor_si128(units, _mm_and_si128(letters, flip)));
+        }
+    }
+#endif
+    for (; index < size; ++index)
+        if (data[index] >= first_letter && data[index] <= first_letter + 25) data[index] = static_cast<std::uint8_t>(data[index] ^ 0x20);
+}
+
+void ascii_case_convert(char16_t* data, std::size_t size, bool to_uppercase) noexcept
+{
+    const char32_t first_letter = to_uppercase ? U'a' : U'A';
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if (size >= 8)
+    {
+        const __m128i first = _mm_set1_epi16(static_cast<short>(first_letter));
+        const __m128i span = _mm_set1_epi16(static_cast<short>(25));
+        const __m128i flip = _mm_set1_epi16(static_cast<short>(0x20));
+        const __m128i zero = _mm_setzero_si128();
+        for (; index + 8 <= size; index += 8)
+        {
+            __m128i* block = reinterpret_cast<__m128i*>(data + index);
+            const __m128i units = _mm_loadu_si128(block);
+            const __m128i letters = _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(units, first), span), zero);
+            _mm_storeu_si128(block, _mm_xor_si128(units, _mm_and_si128(letters, flip)));
+        }
+    }
+#endif
+    for (; index < size; ++index)
+        if (data[index] >= first_letter && data[index] <= first_letter + 25) data[index] = static_cast<char16_t>(data[index] ^ 0x20);
+}
+
+void ascii_case_convert(char32_t* data, std::size_t size, bool to_uppercase) noexcept
+{
+    const char32_t first_letter = to_uppercase ? U'a' : U'A';
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if (size >= 4)
+    {
+        const __m128i first = _mm_set1_epi32(static_cast<int>(first_letter));
+        // SSE2 has no unsigned 32-bit compare: bias both sides by 2^31 and compare signed.
+        const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+        const __m128i span = _mm_xor_si128(_mm_set1_epi32(25), bias);
+        const __m128i flip = _mm_set1_epi32(static_cast<int>(0x20));
+        const __m128i zero = _mm_setzero_si128();
+        for (; index + 4 <= size; index += 4)
+        {
+            __m128i* block = reinterpret_cast<__m128i*>(data + index);
+            const __m128i units = _mm_loadu_si128(block);
+            const __m128i letters = _mm_cmpeq_epi32(_mm_cmpgt_epi32(_mm_xor_si128(_mm_sub_epi32(units, first), bias), span), zero);
+            _mm_storeu_si128(block, _mm_xor_si128(units, _mm_and_si128(letters, flip)));
+        }
+    }
+#endif
+    for (; index < size; ++index)
+        if (data[index] >= first_letter && data[index] <= first_letter + 25) data[index] = static_cast<char32_t>(data[index] ^ 0x20);
+}
+
+bool ascii_case_insensitive_equal(const std::uint8_t* lhs, const std::uint8_t* rhs, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if (size >= 16)
+    {
+        const __m128i first = _mm_set1_epi8(static_cast<char>(U'A'));
+        const __m128i span = _mm_set1_epi8(static_cast<char>(25));
+        const __m128i flip = _mm_set1_epi8(static_cast<char>(0x20));
+        const __m128i zero = _mm_setzero_si128();
+        for (; index + 16 <= size; index += 16)
+        {
+            __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index));
+            __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+            left = _mm_xor_si128(left, _mm_and_si128(_mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(left, first), span), zero), flip));
+            right = _mm_xor_si128(right, _mm_and_si128(_mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(right, first), span), zero), flip));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(left, right)) != 0xFFFF) return false;
+        }
+    }
+#endif
+    for (; index < size; ++index)
+        if (ascii_lowercase_unit(lhs[index]) != ascii_lowercase_unit(rhs[index])) return false;
+    return true;
+}
+
+bool ascii_case_insensitive_equal(const char16_t* lhs, const char16_t* rhs, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if (size >= 8)
+    {
+        const __m128i first = _mm_set1_epi16(static_cast<short>(U'A'));
+        const __m128i span = _mm_set1_epi16(static_cast<short>(25));
+        const __m128i flip = _mm_set1_epi16(static_cast<short>(0x20));
+        const __m128i zero = _mm_setzero_si128();
+        for (; index + 8 <= size; index += 8)
+        {
+            __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index));
+            __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+            left = _mm_xor_si128(left, _mm_and_si128(_mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(left, first), span), zero), flip));
+            right = _mm_xor_si128(right, _mm_and_si128(_mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(right, first), span), zero), flip));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(left, right)) != 0xFFFF) return false;
+        }
+    }
+#endif
+    for (; index < size; ++index)
+        if (ascii_lowercase_unit(lhs[index]) != ascii_lowercase_unit(rhs[index])) return false;
+    return true;
+}
+
+bool ascii_case_insensitive_equal(const char32_t* lhs, const char32_t* rhs, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if (size >= 4)
+    {
+        const __m128i first = _mm_set1_epi32(static_cast<int>(U'A'));
+        // SSE2 has no unsigned 32-bit compare: bias both sides by 2^31 and compare signed.
+        const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+        const __m128i span = _mm_xor_si128(_mm_set1_epi32(25), bias);
+        const __m128i flip = _mm_set1_epi32(static_cast<int>(0x20));
+        const __m128i zero = _mm_setzero_si128();
+        for (; index + 4 <= size; index += 4)
+        {
+            __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index));
+            __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+            left = _mm_xor_si128(left, _mm_and_si128(_mm_cmpeq_epi32(_mm_cmpgt_epi32(_mm_xor_si128(_mm_sub_epi32(left, first), bias), span), zero), flip));
+            right = _mm_xor_si128(right, _mm_and_si128(_mm_cmpeq_epi32(_mm_cmpgt_epi32(_mm_xor_si128(_mm_sub_epi32(right, first), bias), span), zero), flip));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(left, right)) != 0xFFFF) return false;
+        }
+    }
+#endif
+    for (; index < size; ++index)
+        if (ascii_lowercase_unit(lhs[index]) != ascii_lowercase_unit(rhs[index])) return false;
+    return true;
+}
+
+} // namespace Softloq::WHATWG::Infra::SIMD
@@ -0,0 +1,129 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/ClassScan.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This implements the vectorized code point class scanning kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the SSE2 and portable scalar implementations of the code point class scanning kernels.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/SIMD/ClassScan.hpp>
+#include <Softloq/WHATWG/Infra/SIMD/Target.hpp>
+#include <bit>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+std::size_t class_prefix_length(const std::uint8_t* data, std::size_t size, std::span<const CodePointRange> ranges, bool inverted) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if (ranges.size() <= class_scan_max_vector_ranges && size >= 16)
+    {
+        // A unit u lies in [first, last] iff (u - first) saturating-minus (last - first) is zero.
+        __m128i firsts[class_scan_max_vector_ranges];
+        __m128i spans[class_scan_max_vector_ranges];
+        std::size_t count = 0;
+        for (const auto& range : ranges)
+        {
+            if (range.first > 0xFF || range.last < range.first) continue;
+            const char32_t last = range.last > 0xFF ? char32_t{0xFF} : range.last;
+            firsts[count] = _mm_set1_epi8(static_cast<char>(range.first));
+            spans[count] = _mm_set1_epi8(static_cast<char>(last - range.first));
+            ++count;
+        }
+        const __m128i zero = _mm_setzero_si128();
+        const unsigned flip = inverted ? 0xFFFFu : 0u;
+        for (; index + 16 <= size; index += 16)
+        {
+            const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+            __m128i in_ranges = zero;
+            for (std::size_t i = 0; i < count; ++i)
+                in_ranges = _mm_or_si128(in_ranges, _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(units, firsts[i]), spans[i]), zero));
+            const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(in_ranges)) ^ flip;
+            if (mask != 0xFFFFu) return index + static_cast<std::size_t>(std::countr_one(mask));
+        }
+    }
+#endif
+    for (; index < size; ++index)
+        if (!unit_in_class(data[index], ranges, inverted)) break;
+    return index;
+}
+
+std::size_t class_prefix_length(const char16_t* data, std::size_t size, std::span<const CodePointRange> ranges, bool inverted) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if (ranges.size() <= class_scan_max_vector_ranges && size >= 8)
+    {
+        __m128i firsts[class_scan_max_vector_ranges];
+        __m128i spans[class_scan_max_vector_ranges];
+        std::size_t count = 0;
+        for (const auto& range : ranges)
+        {
+            if (range.first > 0xFFFF || range.last < range.first) continue;
+            const char32_t last = range.last > 0xFFFF ? char32_t{0xFFFF} : range.last;
+            firsts[count] = _mm_set1_epi16(static_cast<short>(range.first));
+            spans[count] = _mm_set1_epi16(static_cast<short>(last - range.first));
+            ++count;
+        }
+        const __m128i zero = _mm_setzero_si128();
+        const unsigned flip = inverted ? 0xFFFFu : 0u;
+        for (; index + 8 <= size; index += 8)
+        {
+            const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+            __m128i in_ranges = zero;
+            for (std::size_t i = 0; i < count; ++i)
+                in_ranges = _mm_or_si128(in_ranges, _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(units, firsts[i]), spans[i]), zero));
+            const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(in_ranges)) ^ flip;
+            if (mask != 0xFFFFu) return index + static_cast<std::size_t>(std::countr_one(mask)) / 2;
+        }
+    }
+#endif
+    for (; index < size; ++index)
+        if (!unit_in_class(data[index], ranges, inverted)) break;
+    return index;
+}
+
+std::size_t class_prefix_length(const char32_t* data, std::size_t size, std::span<const CodePointRange> ranges, bool inverted) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if (ranges.size() <= class_scan_max_vector_ranges && size >= 4)
+    {
+        // SSE2 has no unsigned 32-bit compare: bias both sides by 2^31 and compare signed.
+        __m128i firsts[class_scan_max_vector_ranges];
+        __m128i spans[class_scan_max_vector_ranges];
+        std::size_t count = 0;
+        const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+        for (const auto& range : ranges)
+        {
+            if (range.last < range.first) continue;
+            firsts[count] = _mm_set1_epi32(static_cast<int>(range.first));
+            spans[count] = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(range.last - range.first)), bias);
+            ++count;
+        }
+        const __m128i zero = _mm_setzero_si128();
+        const unsigned flip = inverted ? 0xFFFFu : 0u;
+        for (; index + 4 <= size; index += 4)
+        {
+            const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+            __m128i in_ranges = zero;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const __m128i offset = _mm_xor_si128(_mm_sub_epi32(units, firsts[i]), bias);
+                in_ranges = _mm_or_si128(in_ranges, _mm_cmpeq_epi32(_mm_cmpgt_epi32(offset, spans[i]), zero));
+            }
+            const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(in_ranges)) ^ flip;
+            if (mask != 0xFFFFu) return index + static_cast<std::size_t>(std::countr_one(mask)) / 4;
+        }
+    }
+#endif
+    for (; index < size; ++index)
+        if (!unit_in_class(data[index], ranges, inverted)) break;
+    return index;
+}
+
+} // namespace Softloq::WHATWG::Infra::SIMD
@@ -0,0 +1,395 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/Columnar.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This implements the vectorized columnar integer kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the SSE2 and portable scalar implementations of the columnar kernels.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/SIMD/Columnar.hpp>
+#include <Softloq/WHATWG/Infra/SIMD/Target.hpp>
+#include <bit>
+#include <cstring>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+namespace
+{
+
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+/**
+ * @brief Returns a vector with every lane set to value.
+ */
+template <ColumnElement T>
+__m128i splat(T value) noexcept
+{
+    if constexpr (sizeof(T) == 1) return _mm_set1_epi8(static_cast<char>(value));
+    else if constexpr (sizeof(T) == 2) return _mm_set1_epi16(static_cast<short>(value));
+    else if constexpr (sizeof(T) == 4) return _mm_set1_epi32(static_cast<int>(value));
+    else return _mm_set1_epi64x(static_cast<long long>(value));
+}
+
+/**
+ * @brief Returns the lane-wise sum of two vectors, wrapping modulo 2^N.
+ */
+template <ColumnElement T>
+__m128i add_lanes(__m128i lhs, __m128i rhs) noexcept
+{
+    if constexpr (sizeof(T) == 1) return _mm_add_epi8(lhs, rhs);
+    else if constexpr (sizeof(T) == 2) return _mm_add_epi16(lhs, rhs);
+    else if constexpr (sizeof(T) == 4) return _mm_add_epi32(lhs, rhs);
+    else return _mm_add_epi64(lhs, rhs);
+}
+
+/**
+ * @brief The bias that maps T onto the lane type SSE2 orders: unsigned for 8-bit lanes, signed for 16-bit and 32-bit lanes.
+ *
+ * Flipping the sign bit maps a signed order onto the unsigned one and back, so one instruction
+ * serves both signednesses.
+ */
+template <ColumnElement T>
+T order_bias() noexcept
+{
+    constexpr bool flip = sizeof(T) == 1 ? std::is_signed_v<T> : std::is_unsigned_v<T>;
+    return flip ? static_cast<T>(std::make_unsigned_t<T>{1} << (8 * sizeof(T) - 1)) : T{};
+}
+
+/**
+ * @brief Returns the lane-wise least or greatest of two biased vectors of 8-bit, 16-bit or 32-bit lanes.
+ */
+template <ColumnElement T, bool Greatest>
+__m128i pick_lanes(__m128i lhs, __m128i rhs) noexcept
+{
+    if constexpr (sizeof(T) == 1) return Greatest ? _mm_max_epu8(lhs, rhs) : _mm_min_epu8(lhs, rhs);
+    else if constexpr (sizeof(T) == 2) return Greatest ? _mm_max_epi16(lhs, rhs) : _mm_min_epi16(lhs, rhs);
+    else
+    {
+        const __m128i greater = _mm_cmpgt_epi32(lhs, rhs);
+        const __m128i keep_lhs = Greatest ? greater : _mm_xor_si128(greater, _mm_set1_epi32(-1));
+        return _mm_or_si128(_mm_and_si128(keep_lhs, lhs), _mm_andnot_si128(keep_lhs, rhs));
+    }
+}
+
+/**
+ * @brief Returns the lane-wise signed comparison lhs > rhs of two biased vectors of 8-bit, 16-bit or 32-bit lanes.
+ */
+template <ColumnElement T>
+__m128i greater_lanes(__m128i lhs, __m128i rhs) noexcept
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        // 8-bit lanes are biased to unsigned order; flip them back to signed for the signed compare.
+        const __m128i flip = _mm_set1_epi8(static_cast<char>(0x80));
+        return _mm_cmpgt_epi8(_mm_xor_si128(lhs, flip), _mm_xor_si128(rhs, flip));
+    }
+    else if constexpr (sizeof(T) == 2) return _mm_cmpgt_epi16(lhs, rhs);
+    else return _mm_cmpgt_epi32(lhs, rhs);
+}
+
+/**
+ * @brief Returns the lane-wise equality of two vectors of 8-bit, 16-bit or 32-bit lanes.
+ */
+template <ColumnElement T>
+__m128i equal_lanes(__m128i lhs, __m128i rhs) noexcept
+{
+    if constexpr (sizeof(T) == 1) return _mm_cmpeq_epi8(lhs, rhs);
+    else if constexpr (sizeof(T) == 2) return _mm_cmpeq_epi16(lhs, rhs);
+    else return _mm_cmpeq_epi32(lhs, rhs);
+}
+
+/**
+ * @brief Returns the inclusive prefix sums of the lanes of a vector.
+ */
+template <ColumnElement T>
+__m128i scan_lanes(__m128i lanes) noexcept
+{
+    lanes = add_lanes<T>(lanes, _mm_slli_si128(lanes, sizeof(T)));
+    if constexpr (sizeof(T) <= 4) lanes = add_lanes<T>(lanes, _mm_slli_si128(lanes, 2 * sizeof(T)));
+    if constexpr (sizeof(T) <= 2) lanes = add_lanes<T>(lanes, _mm_slli_si128(lanes, 4 * sizeof(T)));
+    if constexpr (sizeof(T) == 1) lanes = add_lanes<T>(lanes, _mm_slli_si128(lanes, 8));
+    return lanes;
+}
+
+/**
+ * @brief Returns a vector with every lane set to the last lane of a vector.
+ */
+template <ColumnElement T>
+__m128i broadcast_last_lane(__m128i lanes) noexcept
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        const __m128i pairs = _mm_shufflehi_epi16(_mm_unpackhi_epi8(lanes, lanes), 0xFF);
+        return _mm_unpackhi_epi64(pairs, pairs);
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        const __m128i high = _mm_shufflehi_epi16(lanes, 0xFF);
+        return _mm_unpackhi_epi64(high, high);
+    }
+    else if constexpr (sizeof(T) == 4) return _mm_shuffle_epi32(lanes, 0xFF);
+    else return _mm_shuffle_epi32(lanes, 0xEE);
+}
+
+/**
+ * @brief Returns the two 64-bit lanes of a vector added together.
+ */
+std::uint64_t add_halves(__m128i lanes) noexcept
+{
+    std::uint64_t halves[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(halves), lanes);
+    return halves[0] + halves[1];
+}
+
+/**
+ * @brief Returns the sum of the 32-bit lanes of a vector, each sign-extended to 64 bits.
+ */
+std::uint64_t add_signed_quarters(__m128i lanes) noexcept
+{
+    const __m128i sign = _mm_srai_epi32(lanes, 31);
+    return add_halves(_mm_add_epi64(_mm_unpacklo_epi32(lanes, sign), _mm_unpackhi_epi32(lanes, sign)));
+}
+#endif
+
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+/**
+ * @brief Compares the integers of a run sixteen at a time, writing their mask bytes unless mask is null.
+ *
+ * @param index Receives the number of integers compared, a multiple of sixteen.
+ * @return The number of compared integers for which the comparison holds.
+ */
+template <ColumnElement T>
+std::size_t compare_sixteens(const T* data, std::size_t size, Comparison comparison, T value, std::uint8_t* mask, std::size_t& index) noexcept
+{
+    std::size_t count = 0;
+    index = 0;
+    if constexpr (sizeof(T) <= 4)
+    {
+        // Every comparison is equality, less or greater, possibly negated.
+        const bool negate = comparison == Comparison::NotEqual || comparison == Comparison::LessEqual || comparison == Comparison::GreaterEqual;
+        const __m128i flip = negate ? _mm_set1_epi8(-1) : _mm_setzero_si128();
+        const __m128i bias = splat(order_bias<T>());
+        const __m128i target = _mm_xor_si128(splat(value), bias);
+        const auto compare_lanes = [&](const T* lanes) {
+            const __m128i elements = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes)), bias);
+            switch (comparison)
+            {
+            case Comparison::Equal:
+            case Comparison::NotEqual: return equal_lanes<T>(elements, target);
+            case Comparison::Less:
+            case Comparison::GreaterEqual: return greater_lanes<T>(target, elements);
+            default: return greater_lanes<T>(elements, target);
+            }
+        };
+        constexpr std::size_t lanes = 16 / sizeof(T);
+        for (; index + 16 <= size; index += 16)
+        {
+            // Narrow the lane masks of sixteen integers to sixteen bytes; saturation keeps 0 and -1.
+            __m128i bytes;
+            if constexpr (sizeof(T) == 1) bytes = compare_lanes(data + index);
+            else if constexpr (sizeof(T) == 2) bytes = _mm_packs_epi16(compare_lanes(data + index), compare_lanes(data + index + lanes));
+            else
+            {
+                const __m128i low = _mm_packs_epi32(compare_lanes(data + index), compare_lanes(data + index + lanes));
+                const __m128i high = _mm_packs_epi32(compare_lanes(data + index + 2 * lanes), compare_lanes(data + index + 3 * lanes));
+                bytes = _mm_packs_epi16(low, high);
+            }
+            bytes = _mm_xor_si128(bytes, flip);
+            if (mask != nullptr) _mm_storeu_si128(reinterpret_cast<__m128i*>(mask + index), _mm_and_si128(bytes, _mm_set1_epi8(1)));
+            count += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(_mm_movemask_epi8(bytes))));
+        }
+    }
+    return count;
+}
+#endif
+
+/**
+ * @brief Returns the least or greatest of a nonempty run of integers.
+ */
+template <ColumnElement T, bool Greatest>
+T column_extreme(const T* data, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+    T result = data[0];
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if constexpr (sizeof(T) <= 4)
+    {
+        constexpr std::size_t lanes = 16 / sizeof(T);
+        if (size >= lanes)
+        {
+            const __m128i bias = splat(order_bias<T>());
+            __m128i best = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), bias);
+            for (index = lanes; index + lanes <= size; index += lanes)
+                best = pick_lanes<T, Greatest>(best, _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index)), bias));
+            T candidates[lanes];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(candidates), _mm_xor_si128(best, bias));
+            result = Greatest ? ColumnPortable::max(candidates, lanes) : ColumnPortable::min(candidates, lanes);
+        }
+    }
+#endif
+    for (; index < size; ++index) result = Greatest ? std::max(result, data[index]) : std::min(result, data[index]);
+    return result;
+}
+
+} // namespace
+
+template <ColumnElement T>
+ColumnSum<T> column_sum(const T* data, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+    std::uint64_t total = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    if constexpr (sizeof(T) == 1)
+    {
+        // Sum sixteen bytes into two 64-bit lanes against zero; signed bytes are biased to unsigned first.
+        const __m128i bias = splat(order_bias<T>());
+        const __m128i zero = _mm_setzero_si128();
+        __m128i lanes = zero;
+        for (; index + 16 <= size; index += 16)
+            lanes = _mm_add_epi64(lanes, _mm_sad_epu8(_mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index)), bias), zero));
+        total = add_halves(lanes);
+        if constexpr (std::is_signed_v<T>) total -= 128 * index;
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        // Add neighbouring pairs into 32-bit lanes, which hold at least 16384 iterations of pairs
+        // before they can overflow; unsigned halves are biased to signed first.
+        const __m128i bias = splat(order_bias<T>());
+        const __m128i ones = _mm_set1_epi16(1);
+        while (index + 8 <= size)
+        {
+            __m128i lanes = _mm_setzero_si128();
+            const std::size_t block_end = index + std::min<std::size_t>((size - index) / 8, 16384) * 8;
+            for (; index < block_end; index += 8)
+                lanes = _mm_add_epi32(lanes, _mm_madd_epi16(_mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index)), bias), ones));
+            total += add_signed_quarters(lanes);
+        }
+        if constexpr (std::is_unsigned_v<T>) total += 32768 * index;
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        // Widen each 32-bit lane to 64 bits, with copies of its sign bit or with zeros.
+        const __m128i zero = _mm_setzero_si128();
+        __m128i lanes = zero;
+        for (; index + 4 <= size; index += 4)
+        {
+            const __m128i quarters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+            const __m128i high = std::is_signed_v<T> ? _mm_srai_epi32(quarters, 31) : zero;
+            lanes = _mm_add_epi64(lanes, _mm_add_epi64(_mm_unpacklo_epi32(quarters, high), _mm_unpackhi_epi32(quarters, high)));
+        }
+        total = add_halves(lanes);
+    }
+    else
+    {
+        __m128i lanes = _mm_setzero_si128();
+        for (; index + 2 <= size; index += 2) lanes = _mm_add_epi64(lanes, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index)));
+        total = add_halves(lanes);
+    }
+#endif
+    return static_cast<ColumnSum<T>>(total + static_cast<std::uint64_t>(ColumnPortable::sum(data + index, size - index)));
+}
+
+template <ColumnElement T>
+T column_min(const T* data, std::size_t size) noexcept
+{
+    return column_extreme<T, false>(data, size);
+}
+
+template <ColumnElement T>
+T column_max(const T* data, std::size_t size) noexcept
+{
+    return column_extreme<T, true>(data, size);
+}
+
+template <ColumnElement T>
+void column_prefix_sum(const T* data, std::size_t size, T* out) noexcept
+{
+    std::size_t index = 0;
+    T total{};
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    constexpr std::size_t lanes = 16 / sizeof(T);
+    if (size >= lanes)
+    {
+        __m128i carry = _mm_setzero_si128();
+        for (; index + lanes <= size; index += lanes)
+        {
+            const __m128i sums = add_lanes<T>(scan_lanes<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index))), carry);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index), sums);
+            carry = broadcast_last_lane<T>(sums);
+        }
+        total = out[index - 1];
+    }
+#endif
+    ColumnPortable::prefix_sum(data + index, size - index, out + index, total);
+}
+
+template <ColumnElement T>
+std::size_t column_compare(const T* data, std::size_t size, Comparison comparison, T value, std::uint8_t* mask) noexcept
+{
+    std::size_t index = 0;
+    std::size_t count = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    count = compare_sixteens(data, size, comparison, value, mask, index);
+#endif
+    return count + ColumnPortable::compare(data + index, size - index, comparison, value, mask + index);
+}
+
+template <ColumnElement T>
+std::size_t column_count(const T* data, std::size_t size, Comparison comparison, T value) noexcept
+{
+    std::size_t index = 0;
+    std::size_t count = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    count = compare_sixteens(data, size, comparison, value, static_cast<std::uint8_t*>(nullptr), index);
+#endif
+    return count + ColumnPortable::count(data + index, size - index, comparison, value);
+}
+
+template <ColumnElement T>
+std::size_t column_filter(const T* data, std::size_t size, const std::uint8_t* mask, T* out) noexcept
+{
+    std::size_t index = 0;
+    std::size_t count = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; index + 16 <= size; index += 16)
+    {
+        const unsigned dropped = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mask + index)), zero)));
+        if (dropped == 0xFFFFu) continue;
+        if (dropped == 0)
+        {
+            std::memcpy(out + count, data + index, 16 * sizeof(T));
+            count += 16;
+            continue;
+        }
+        count += ColumnPortable::filter(data + index, 16, mask + index, out + count);
+    }
+#endif
+    return count + ColumnPortable::filter(data + index, size - index, mask + index, out + count);
+}
+
+// Explicit instantiations for the eight fixed-width integers
+#define SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_INSTANTIATE(T) \
+    template SOFTLOQ_WHATWG_INFRA_API ColumnSum<T> column_sum<T>(const T*, std::size_t) noexcept; \
+    template SOFTLOQ_WHATWG_INFRA_API T column_min<T>(const T*, std::size_t) noexcept; \
+    template SOFTLOQ_WHATWG_INFRA_API T column_max<T>(const T*, std::size_t) noexcept; \
+    template SOFTLOQ_WHATWG_INFRA_API void column_prefix_sum<T>(const T*, std::size_t, T*) noexcept; \
+    template SOFTLOQ_WHATWG_INFRA_API std::size_t column_compare<T>(const T*, std::size_t, Comparison, T, std::uint8_t*) noexcept; \
+    template SOFTLOQ_WHATWG_INFRA_API std::size_t column_count<T>(const T*, std::size_t, Comparison, T) noexcept; \
+    template SOFTLOQ_WHATWG_INFRA_API std::size_t column_filter<T>(const T*, std::size_t, const std::uint8_t*, T*) noexcept;
+
+SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_INSTANTIATE(std::int8_t)
+SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_INSTANTIATE(std::int16_t)
+SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_INSTANTIATE(std::int32_t)
+SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_INSTANTIATE(std::int64_t)
+SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_INSTANTIATE(std::uint8_t)
+SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_INSTANTIATE(std::uint16_t)
+SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_INSTANTIATE(std::uint32_t)
+SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_INSTANTIATE(std::uint64_t)
+
+#undef SOFTLOQ_WHATWG_INFRA_SIMD_COLUMNAR_INSTANTIATE
+
+} // namespace Softloq::WHATWG::Infra::SIMD
@@ -0,0 +1,81 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/Digits.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This implements the vectorized decimal digit parsing kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the SSE2 and portable SWAR implementations of the digit parsing kernels.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/SIMD/Digits.hpp>
+#include <Softloq/WHATWG/Infra/SIMD/Target.hpp>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+namespace
+{
+
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+/**
+ * @brief Combines sixteen bytes of ASCII digits into their value, or returns false if one is not a digit.
+ */
+bool combine_sixteen_digits(__m128i bytes, std::uint64_t& value) noexcept
+{
+    const __m128i digits = _mm_sub_epi8(bytes, _mm_set1_epi8('0'));
+    const __m128i nine = _mm_set1_epi8(9);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(digits, nine), nine)) != 0xFFFF) return false;
+
+    // Each 16-bit lane holds two digits, the more significant in its low byte.
+    const __m128i high_digits = _mm_and_si128(digits, _mm_set1_epi16(0x00FF));
+    const __m128i low_digits = _mm_srli_epi16(digits, 8);
+    const __m128i pairs = _mm_add_epi16(_mm_mullo_epi16(high_digits, _mm_set1_epi16(10)), low_digits);
+    const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00010064)); // pairs times (100, 1)
+    const __m128i eights = _mm_madd_epi16(_mm_packs_epi32(quads, quads), _mm_set1_epi32(0x00012710)); // quads times (10000, 1)
+
+    const auto high = static_cast<std::uint32_t>(_mm_cvtsi128_si32(eights));
+    const auto low = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(eights, 4)));
+    value = std::uint64_t{high} * 100000000 + low;
+    return true;
+}
+#else
+/**
+ * @brief Parses sixteen units as two packed words of eight digits.
+ */
+template <typename U>
+bool combine_sixteen_digits(const U* data, std::uint64_t& value) noexcept
+{
+    const std::uint64_t high = pack_eight_units(data);
+    const std::uint64_t low = pack_eight_units(data + 8);
+    if (eight_digit_prefix_length(high) != 8 || eight_digit_prefix_length(low) != 8) return false;
+    value = std::uint64_t{parse_eight_digits(high)} * 100000000 + parse_eight_digits(low);
+    return true;
+}
+#endif
+
+} // namespace
+
+bool parse_sixteen_digits(const std::uint8_t* data, std::uint64_t& value) noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    return combine_sixteen_digits(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), value);
+#else
+    return combine_sixteen_digits(data, value);
+#endif
+}
+
+bool parse_sixteen_digits(const char16_t* data, std::uint64_t& value) noexcept
+{
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    // Units above 0xFF saturate to 0xFF, or to 0 from 0x8000 up; neither is a digit.
+    const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 8));
+    return combine_sixteen_digits(_mm_packus_epi16(first, second), value);
+#else
+    return combine_sixteen_digits(data, value);
+#endif
+}
+
+} // namespace Softloq::WHATWG::Infra::SIMD
@@ -0,0 +1,69 @@
+/**
+ * @file Softloq/WHATWG/Infra/SIMD/Mismatch.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief This implements the vectorized mismatch-finding kernels of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file provides the SSE2 and portable scalar implementations of the mismatch kernels.
+ */
+
+#include <Softloq/WHATWG/Infra/API-Library/Precompiled.pch>
+#include <Softloq/WHATWG/Infra/SIMD/Mismatch.hpp>
+#include <Softloq/WHATWG/Infra/SIMD/Target.hpp>
+#include <bit>
+
+namespace Softloq::WHATWG::Infra::SIMD
+{
+
+std::size_t mismatch(const std::uint8_t* lhs, const std::uint8_t* rhs, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    for (; index + 16 <= size; index += 16)
+    {
+        const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index));
+        const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+        const unsigned differ = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(left, right))) & 0xFFFFu;
+        if (differ != 0) return index + static_cast<std::size_t>(std::countr_zero(differ));
+    }
+#endif
+    while (index < size && lhs[index] == rhs[index]) ++index;
+    return index;
+}
+
+std::size_t mismatch(const char16_t* lhs, const char16_t* rhs, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    for (; index + 8 <= size; index += 8)
+    {
+        const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index));
+        const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+        const unsigned differ = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(left, right))) & 0xFFFFu;
+        // Each 16-bit lane sets two mask bits.
+        if (differ != 0) return index + static_cast<std::size_t>(std::countr_zero(differ)) / 2;
+    }
+#endif
+    while (index < size && lhs[index] == rhs[index]) ++index;
+    return index;
+}
+
+std::size_t mismatch(const std::uint8_t* lhs, const char16_t* rhs, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+#if SOFTLOQ_WHATWG_INFRA_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; index + 8 <= size; index += 8)
+    {
+        const __m128i left = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(lhs + index)), zero);
+        const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+        const unsigned differ = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(left, right))) & 0xFFFFu;
+        if (differ != 0) return index + static_cast<std::size_t>(std::countr_zero(differ)) / 2;
+    }
+#endif
+    while (index < size && lhs[index] == rhs[index]) ++index;
+    return index;
+}
+
+} // namespace Softloq::WHATWG::Infra::SIMD
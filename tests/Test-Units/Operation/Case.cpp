@@ -0,0 +1,164 @@
+/**
+ * @file Test-Units/Operation/Case.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the ASCII case operations in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for the ASCII lowercase, ASCII uppercase and ASCII case-insensitive match operations.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Operation/Case/Case.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+// ---------------------------------------------------------------------------
+// ASCII lowercase and uppercase
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that ASCII lowercase converts only A-Z.
+ */
+TEST(CaseTest, Lowercase)
+{
+    std::u16string value = u"Content-Type: TEXT/HTML; Ä@[`{";
+    ascii_lowercase(value);
+    EXPECT_EQ(value, u"content-type: text/html; Ä@[`{");
+}
+
+/**
+ * @brief Test that ASCII uppercase converts only a-z.
+ */
+TEST(CaseTest, Uppercase)
+{
+    std::u32string value = U"gzip, deflate; ä@[`{";
+    ascii_uppercase(value);
+    EXPECT_EQ(value, U"GZIP, DEFLATE; ä@[`{");
+}
+
+/**
+ * @brief Test that ASCII lowercase of already-lowercase input leaves it unchanged.
+ */
+TEST(CaseTest, LowercaseAlreadyLowercase)
+{
+    std::string value = "already lowercase, 0123456789 and punctuation!";
+    const std::string expected = value;
+    ascii_lowercase(value);
+    EXPECT_EQ(value, expected);
+}
+
+/**
+ * @brief Test that ASCII lowercase does not fold non-ASCII letters whose low bits look like ASCII letters.
+ */
+TEST(CaseTest, LowercaseIgnoresNonASCII)
+{
+    std::u16string value{char16_t{0x0141}, char16_t{0x0241}, char16_t{0xFF21}, char16_t{0x0041}};
+    ascii_lowercase(value);
+    EXPECT_EQ(value, (std::u16string{char16_t{0x0141}, char16_t{0x0241}, char16_t{0xFF21}, char16_t{0x0061}}));
+    std::vector<std::uint8_t> bytes{0xC1, 0xE1, 0x5A};
+    ascii_lowercase(bytes);
+    EXPECT_EQ(bytes, (std::vector<std::uint8_t>{0xC1, 0xE1, 0x7A}));
+}
+
+/**
+ * @brief Test that ASCII lowercase works on a span and on CodePoint primitives.
+ */
+TEST(CaseTest, LowercaseSpanAndPrimitives)
+{
+    char32_t buffer[] = {U'A', U'b', U'C'};
+    ascii_lowercase(std::span<char32_t>{buffer});
+    EXPECT_EQ(std::u32string_view(buffer, 3), U"abc");
+
+    std::vector<CodePoint> points{CodePoint{U'X'}, CodePoint{U'y'}};
+    ascii_uppercase(points);
+    EXPECT_EQ(points[0], CodePoint{U'X'});
+    EXPECT_EQ(points[1], CodePoint{U'Y'});
+}
+
+/**
+ * @brief Test that ASCII lowercase agrees with a scalar definition at every length across vector widths.
+ */
+TEST(CaseTest, LowercaseLongInputs)
+{
+    std::u16string source;
+    for (std::size_t i = 0; i < 70; ++i) source += static_cast<char16_t>(0x3A + (i * 13) % 0x50);
+    for (std::size_t length = 0; length <= source.size(); ++length)
+    {
+        std::u16string value = source.substr(0, length);
+        std::u16string expected = value;
+        for (auto& unit : expected)
+            if (unit >= u'A' && unit <= u'Z') unit = static_cast<char16_t>(unit + 0x20);
+        ascii_lowercase(value);
+        EXPECT_EQ(value, expected) << length;
+
+        std::string narrow(value.begin(), value.end());
+        ascii_uppercase(narrow);
+        for (std::size_t i = 0; i < length; ++i)
+            EXPECT_EQ(narrow[i], (value[i] >= u'a' && value[i] <= u'z') ? static_cast<char>(value[i] - 0x20) : static_cast<char>(value[i]));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// ASCII case-insensitive match
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that sequences differing only in ASCII case match.
+ */
+TEST(CaseTest, CaseInsensitiveMatch)
+{
+    EXPECT_TRUE(ascii_case_insensitive_match(std::u16string_view{u"Text/HTML"}, std::u16string_view{u"text/html"}));
+    EXPECT_TRUE(ascii_case_insensitive_match(std::string_view{""}, std::string_view{""}));
+}
+
+/**
+ * @brief Test that sequences differing in length or letters do not match.
+ */
+TEST(CaseTest, CaseInsensitiveMismatch)
+{
+    EXPECT_FALSE(ascii_case_insensitive_match(std::string_view{"text"}, std::string_view{"texts"}));
+    EXPECT_FALSE(ascii_case_insensitive_match(std::string_view{"text"}, std::string_view{"test"}));
+}
+
+/**
+ * @brief Test that only ASCII letters are folded: @ and `, [ and {, and non-ASCII case pairs do not match.
+ */
+TEST(CaseTest, CaseInsensitiveOnlyASCIILetters)
+{
+    EXPECT_FALSE(ascii_case_insensitive_match(std::string_view{"@["}, std::string_view{"`{"}));
+    EXPECT_FALSE(ascii_case_insensitive_match(std::u16string_view{u"Ä"}, std::u16string_view{u"ä"}));
+    EXPECT_FALSE(ascii_case_insensitive_match(std::u32string_view{U"\u212A"}, std::u32string_view{U"k"}));
+}
+
+/**
+ * @brief Test matching between different element types, including a surrogate pair against a code point.
+ */
+TEST(CaseTest, CaseInsensitiveMixedElementTypes)
+{
+    EXPECT_TRUE(ascii_case_insensitive_match(std::u16string_view{u"CHARSET"}, std::string_view{"charset"}));
+    EXPECT_TRUE(ascii_case_insensitive_match(std::u16string_view{u"A\U0001F600b"}, std::u32string_view{U"a\U0001F600B"}));
+    EXPECT_FALSE(ascii_case_insensitive_match(std::u16string_view{u"A\U0001F600"}, std::u32string_view{U"a"}));
+}
+
+/**
+ * @brief Test that a single differing unit is found at every offset of long inputs.
+ */
+TEST(CaseTest, CaseInsensitiveLongInputs)
+{
+    const std::u16string upper(67, u'Q');
+    const std::u16string lower(67, u'q');
+    EXPECT_TRUE(ascii_case_insensitive_match(upper, lower));
+    for (std::size_t i = 0; i < upper.size(); ++i)
+    {
+        std::u16string changed = lower;
+        changed[i] = u'r';
+        EXPECT_FALSE(ascii_case_insensitive_match(upper, changed)) << i;
+        std::u32string wide(changed.begin(), changed.end());
+        EXPECT_FALSE(ascii_case_insensitive_match(std::u32string(upper.begin(), upper.end()), wide)) << i;
+    }
+}
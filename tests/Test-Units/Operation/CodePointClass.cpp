@@ -0,0 +1,130 @@
+/**
+ * @file Test-Units/Operation/CodePointClass.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the code point classes in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for the code point classes in the WHATWG Infra library.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Operation/CodePointClass/CodePointClass.hpp>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+/**
+ * @brief A user-defined code point class for the Greek and Coptic block (U+0370 to U+03FF).
+ */
+struct GreekAndCoptic
+{
+    static constexpr std::array<CodePointRange, 1> ranges{{{0x0370, 0x03FF}}};
+    static constexpr bool inverted = false;
+};
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Agreement with the CodePoint predicates
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that every code point class agrees with the matching CodePoint predicate over U+0000..U+02FF and the surrogate block.
+ */
+TEST(CodePointClassTest, AgreesWithCodePointPredicates)
+{
+    auto check = [](char32_t value)
+    {
+        const CodePoint cp{value};
+        const auto hex = static_cast<std::uint32_t>(value);
+        EXPECT_EQ(in_code_point_class<Surrogate>(value), cp.is_surrogate()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ScalarValue>(value), cp.is_scalar_value()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ASCIICodePoint>(value), cp.is_ascii()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ASCIITabOrNewline>(value), cp.is_ascii_tab_or_newline()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ASCIIWhitespace>(value), cp.is_ascii_whitespace()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<C0Control>(value), cp.is_c0_control()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<C0ControlOrSpace>(value), cp.is_c0_control_or_space()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<Control>(value), cp.is_control()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ASCIIDigit>(value), cp.is_ascii_digit()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ASCIIUpperHexDigit>(value), cp.is_ascii_upper_hex_digit()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ASCIILowerHexDigit>(value), cp.is_ascii_lower_hex_digit()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ASCIIHexDigit>(value), cp.is_ascii_hex_digit()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ASCIIUpperAlpha>(value), cp.is_ascii_upper_alpha()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ASCIILowerAlpha>(value), cp.is_ascii_lower_alpha()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ASCIIAlpha>(value), cp.is_ascii_alpha()) << std::hex << hex;
+        EXPECT_EQ(in_code_point_class<ASCIIAlphanumeric>(value), cp.is_ascii_alphanumeric()) << std::hex << hex;
+    };
+    for (char32_t value = 0; value < 0x300; ++value) check(value);
+    for (char32_t value = 0xD700; value < 0xE100; ++value) check(value);
+    check(0x10FFFF);
+}
+
+/**
+ * @brief Test that Not<P> matches exactly the code points P does not match.
+ */
+TEST(CodePointClassTest, NotComplementsClass)
+{
+    for (char32_t value : {U'\0', U'\t', U' ', U'0', U'A', U'a', char32_t{0xFF}, char32_t{0x100}, char32_t{0xD800}, char32_t{0x10FFFF}})
+    {
+        EXPECT_NE(in_code_point_class<Not<ASCIIWhitespace>>(value), in_code_point_class<ASCIIWhitespace>(value));
+        EXPECT_NE(in_code_point_class<Not<ASCIIAlphanumeric>>(value), in_code_point_class<ASCIIAlphanumeric>(value));
+        EXPECT_NE(in_code_point_class<Not<ScalarValue>>(value), in_code_point_class<ScalarValue>(value));
+    }
+}
+
+/**
+ * @brief Test that Not<Not<P>> is equivalent to P.
+ */
+TEST(CodePointClassTest, DoubleNotIsIdentity)
+{
+    for (char32_t value = 0; value < 0x200; ++value)
+        EXPECT_EQ(in_code_point_class<Not<Not<ASCIIHexDigit>>>(value), in_code_point_class<ASCIIHexDigit>(value));
+}
+
+/**
+ * @brief Test that a user-defined code point class satisfies the concept and classifies above U+00FF.
+ */
+TEST(CodePointClassTest, UserDefinedClass)
+{
+    static_assert(CodePointClass<GreekAndCoptic>);
+    EXPECT_TRUE(in_code_point_class<GreekAndCoptic>(0x03B1));
+    EXPECT_FALSE(in_code_point_class<GreekAndCoptic>(0x0041));
+    EXPECT_FALSE(in_code_point_class<GreekAndCoptic>(0x0400));
+}
+
+/**
+ * @brief Test that only the surrogate-block classes are excluded from code-unit-wise classification.
+ */
+TEST(CodePointClassTest, BelowSurrogates)
+{
+    EXPECT_TRUE(code_point_class_below_surrogates<ASCIIWhitespace>);
+    EXPECT_TRUE(code_point_class_below_surrogates<Not<ASCIIWhitespace>>);
+    EXPECT_TRUE(code_point_class_below_surrogates<Control>);
+    EXPECT_FALSE(code_point_class_below_surrogates<Surrogate>);
+    EXPECT_FALSE(code_point_class_below_surrogates<ScalarValue>);
+}
+
+// ---------------------------------------------------------------------------
+// Code point predicates
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that classes, CodePoint callables and char32_t callables all satisfy CodePointPredicate.
+ */
+TEST(CodePointClassTest, PredicateConcept)
+{
+    auto by_code_point = [](CodePoint cp) { return cp.is_ascii_digit(); };
+    auto by_value = [](char32_t value) { return value == U'-'; };
+    static_assert(CodePointPredicate<ASCIIDigit>);
+    static_assert(CodePointPredicate<decltype(by_code_point)>);
+    static_assert(CodePointPredicate<decltype(by_value)>);
+    static_assert(!CodePointPredicate<int>);
+
+    EXPECT_TRUE(code_point_predicate_matches(ASCIIDigit{}, U'7'));
+    EXPECT_FALSE(code_point_predicate_matches(ASCIIDigit{}, U'x'));
+    EXPECT_TRUE(code_point_predicate_matches(by_code_point, U'7'));
+    EXPECT_FALSE(code_point_predicate_matches(by_code_point, U'x'));
+    EXPECT_TRUE(code_point_predicate_matches(by_value, U'-'));
+    EXPECT_FALSE(code_point_predicate_matches(by_value, U'+'));
+}
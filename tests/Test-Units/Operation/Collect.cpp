@@ -0,0 +1,336 @@
+/**
+ * @file Test-Units/Operation/Collect.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the collect a sequence of code points operation in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for the collect a sequence of code points and skip ASCII whitespace operations.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Operation/Collect/Collect.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/ByteSequence/ByteSequence.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+// ---------------------------------------------------------------------------
+// Spec behaviour
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that collecting digits returns the leading digit run and advances position past it.
+ */
+TEST(CollectTest, CollectsLeadingRun)
+{
+    const std::string_view input = "123abc";
+    std::size_t position = 0;
+    const auto digits = collect_a_sequence_of_code_points<ASCIIDigit>(input, position);
+    EXPECT_EQ(position, std::size_t{3});
+    EXPECT_EQ(std::string_view(digits.data(), digits.size()), "123");
+}
+
+/**
+ * @brief Test that collection starts at the current position, not the start of the input.
+ */
+TEST(CollectTest, StartsAtPosition)
+{
+    const std::string_view input = "abc123def";
+    std::size_t position = 3;
+    const auto digits = collect_a_sequence_of_code_points<ASCIIDigit>(input, position);
+    EXPECT_EQ(position, std::size_t{6});
+    EXPECT_EQ(digits.data(), input.data() + 3);
+    EXPECT_EQ(digits.size(), std::size_t{3});
+}
+
+/**
+ * @brief Test that no code points are collected when the first one does not meet the condition.
+ */
+TEST(CollectTest, NoMatchLeavesPosition)
+{
+    const std::string_view input = "abc";
+    std::size_t position = 1;
+    const auto digits = collect_a_sequence_of_code_points<ASCIIDigit>(input, position);
+    EXPECT_EQ(position, std::size_t{1});
+    EXPECT_TRUE(digits.empty());
+}
+
+/**
+ * @brief Test that collection runs to the end of the input when every code point matches.
+ */
+TEST(CollectTest, RunsToEnd)
+{
+    const std::string_view input = "  \t\n";
+    std::size_t position = 0;
+    const auto spaces = collect_a_sequence_of_code_points<ASCIIWhitespace>(input, position);
+    EXPECT_EQ(position, input.size());
+    EXPECT_EQ(spaces.size(), input.size());
+}
+
+/**
+ * @brief Test that a position at or past the end yields an empty view and is left unchanged.
+ */
+TEST(CollectTest, PositionPastEnd)
+{
+    const std::string_view input = "123";
+    std::size_t at_end = 3;
+    EXPECT_TRUE(collect_a_sequence_of_code_points<ASCIIDigit>(input, at_end).empty());
+    EXPECT_EQ(at_end, std::size_t{3});
+    std::size_t past_end = 7;
+    EXPECT_TRUE(collect_a_sequence_of_code_points<ASCIIDigit>(input, past_end).empty());
+    EXPECT_EQ(past_end, std::size_t{7});
+}
+
+/**
+ * @brief Test that an empty input yields an empty view.
+ */
+TEST(CollectTest, EmptyInput)
+{
+    std::size_t position = 0;
+    EXPECT_TRUE(collect_a_sequence_of_code_points<ASCIIDigit>(std::string_view{}, position).empty());
+    EXPECT_EQ(position, std::size_t{0});
+}
+
+/**
+ * @brief Test that Not<P> collects up to the first code point matching P.
+ */
+TEST(CollectTest, NotClass)
+{
+    const std::string_view input = "token rest";
+    std::size_t position = 0;
+    const auto token = collect_a_sequence_of_code_points<Not<ASCIIWhitespace>>(input, position);
+    EXPECT_EQ(std::string_view(token.data(), token.size()), "token");
+    EXPECT_EQ(position, std::size_t{5});
+}
+
+// ---------------------------------------------------------------------------
+// Input kinds
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test collection over a ByteSequence.
+ */
+TEST(CollectTest, ByteSequenceInput)
+{
+    const ByteSequence input{0x31u, 0x32u, 0x20u, 0x33u};
+    std::size_t position = 0;
+    const auto digits = collect_a_sequence_of_code_points<ASCIIDigit>(input, position);
+    EXPECT_EQ(position, std::size_t{2});
+    ASSERT_EQ(digits.size(), std::size_t{2});
+    EXPECT_EQ(digits[1].get_value(), std::uint8_t{0x32});
+}
+
+/**
+ * @brief Test that bytes 0x80..0xFF are classified as the code points U+0080..U+00FF.
+ */
+TEST(CollectTest, HighBytesAreLatin1)
+{
+    const std::vector<std::uint8_t> input{0x85, 0x9F, 0xA0, 0x41};
+    std::size_t position = 0;
+    EXPECT_EQ(collect_a_sequence_of_code_points<Control>(input, position).size(), std::size_t{2});
+    position = 0;
+    EXPECT_TRUE(collect_a_sequence_of_code_points<ASCIICodePoint>(input, position).empty());
+}
+
+/**
+ * @brief Test collection over UTF-16 code units.
+ */
+TEST(CollectTest, CodeUnitInput)
+{
+    const std::u16string_view input = u"abcé123";
+    std::size_t position = 0;
+    const auto alpha = collect_a_sequence_of_code_points<ASCIIAlpha>(input, position);
+    EXPECT_EQ(alpha.size(), std::size_t{3});
+    EXPECT_EQ(position, std::size_t{3});
+}
+
+/**
+ * @brief Test collection over a span of CodeUnit primitives.
+ */
+TEST(CollectTest, CodeUnitPrimitiveInput)
+{
+    const std::vector<CodeUnit> input{CodeUnit{0x0020}, CodeUnit{0x0009}, CodeUnit{0x0041}};
+    std::size_t position = 0;
+    skip_ascii_whitespace(input, position);
+    EXPECT_EQ(position, std::size_t{2});
+}
+
+/**
+ * @brief Test collection over code points, including supplementary code points.
+ */
+TEST(CollectTest, CodePointInput)
+{
+    const std::u32string_view input = U"\U0001F600\U0001F601x";
+    std::size_t position = 0;
+    const auto non_ascii = collect_a_sequence_of_code_points<Not<ASCIICodePoint>>(input, position);
+    EXPECT_EQ(non_ascii.size(), std::size_t{2});
+}
+
+/**
+ * @brief Test collection over a vector of CodePoint primitives.
+ */
+TEST(CollectTest, CodePointPrimitiveInput)
+{
+    const std::vector<CodePoint> input{CodePoint{U'4'}, CodePoint{U'2'}, CodePoint{U'!'}};
+    std::size_t position = 0;
+    const auto digits = collect_a_sequence_of_code_points<ASCIIDigit>(input, position);
+    ASSERT_EQ(digits.size(), std::size_t{2});
+    EXPECT_EQ(digits[0], CodePoint{U'4'});
+}
+
+// ---------------------------------------------------------------------------
+// Callable predicates
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test a callable predicate taking a CodePoint.
+ */
+TEST(CollectTest, CodePointCallable)
+{
+    const std::string_view input = "ab12";
+    std::size_t position = 0;
+    const auto alpha = collect_a_sequence_of_code_points(input, position, [](CodePoint cp) { return cp.is_ascii_alpha(); });
+    EXPECT_EQ(alpha.size(), std::size_t{2});
+}
+
+/**
+ * @brief Test a callable predicate taking a char32_t.
+ */
+TEST(CollectTest, Char32Callable)
+{
+    const std::string_view input = "----x";
+    std::size_t position = 1;
+    const auto dashes = collect_a_sequence_of_code_points(input, position, [](char32_t value) { return value == U'-'; });
+    EXPECT_EQ(dashes.size(), std::size_t{3});
+    EXPECT_EQ(position, std::size_t{4});
+}
+
+/**
+ * @brief Test that a callable predicate sees a UTF-16 surrogate pair as one supplementary code point.
+ */
+TEST(CollectTest, SurrogatePairsDecoded)
+{
+    const std::u16string_view input = u"\U0001F600\U0001F600a";
+    std::size_t position = 0;
+    const auto emoji = collect_a_sequence_of_code_points(input, position, [](char32_t value) { return value == 0x1F600; });
+    EXPECT_EQ(emoji.size(), std::size_t{4});
+    EXPECT_EQ(position, std::size_t{4});
+}
+
+/**
+ * @brief Test that the Surrogate class only matches unpaired surrogates in UTF-16 input.
+ */
+TEST(CollectTest, SurrogateClassOnUTF16)
+{
+    const std::u16string input{char16_t{0xD800}, char16_t{0xDC00}, char16_t{0x0041}};
+    std::size_t position = 0;
+    EXPECT_TRUE(collect_a_sequence_of_code_points<Surrogate>(input, position).empty());
+
+    const std::u16string lone{char16_t{0xDC00}, char16_t{0xD800}, char16_t{0x0041}};
+    position = 0;
+    EXPECT_EQ(collect_a_sequence_of_code_points<Surrogate>(lone, position).size(), std::size_t{2});
+}
+
+// ---------------------------------------------------------------------------
+// Vectorized runs
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that the vectorized scan finds the run end at every offset across several vector widths.
+ */
+TEST(CollectTest, LongRunsAtEveryLength)
+{
+    for (std::size_t run = 0; run < 80; ++run)
+    {
+        for (std::size_t start : {std::size_t{0}, std::size_t{1}, std::size_t{7}})
+        {
+            std::string bytes(start, 'x');
+            bytes.append(run, '7');
+            bytes += "x77";
+            std::u16string units(bytes.begin(), bytes.end());
+            std::u32string points(bytes.begin(), bytes.end());
+
+            std::size_t position = start;
+            EXPECT_EQ(collect_a_sequence_of_code_points<ASCIIDigit>(bytes, position).size(), run);
+            EXPECT_EQ(position, start + run);
+            position = start;
+            EXPECT_EQ(collect_a_sequence_of_code_points<ASCIIDigit>(units, position).size(), run);
+            position = start;
+            EXPECT_EQ(collect_a_sequence_of_code_points<ASCIIDigit>(points, position).size(), run);
+        }
+    }
+}
+
+/**
+ * @brief Test that multi-range and inverted classes agree with the scalar definition on long mixed inputs.
+ */
+TEST(CollectTest, VectorizedAgreesWithScalar)
+{
+    std::u32string points;
+    for (char32_t value = 0; value < 0x1A0; ++value) points += value;
+    points += char32_t{0x10FFFF};
+    for (std::size_t start = 0; start < points.size(); ++start)
+    {
+        std::size_t expected = start;
+        while (expected < points.size() && CodePoint{points[expected]}.is_ascii_hex_digit()) ++expected;
+        std::size_t position = start;
+        static_cast<void>(collect_a_sequence_of_code_points<ASCIIHexDigit>(points, position));
+        EXPECT_EQ(position, expected) << start;
+
+        expected = start;
+        while (expected < points.size() && !CodePoint{points[expected]}.is_control()) ++expected;
+        position = start;
+        static_cast<void>(collect_a_sequence_of_code_points<Not<Control>>(points, position));
+        EXPECT_EQ(position, expected) << start;
+    }
+}
+
+/**
+ * @brief Test that inverted classes run across non-ASCII UTF-16 and Latin-1 units.
+ */
+TEST(CollectTest, InvertedClassOverNonASCII)
+{
+    std::u16string units(40, char16_t{0x4E2D});
+    units += u' ';
+    std::size_t position = 0;
+    EXPECT_EQ(collect_a_sequence_of_code_points<Not<ASCIIWhitespace>>(units, position).size(), std::size_t{40});
+
+    std::vector<std::uint8_t> bytes(33, 0xE9);
+    bytes.push_back(0x0A);
+    position = 0;
+    EXPECT_EQ(collect_a_sequence_of_code_points<Not<ASCIIWhitespace>>(bytes, position).size(), std::size_t{33});
+}
+
+// ---------------------------------------------------------------------------
+// Skip ASCII whitespace
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that skip_ascii_whitespace advances past all five ASCII whitespace code points.
+ */
+TEST(CollectTest, SkipASCIIWhitespace)
+{
+    const std::string_view input = " \t\n\f\rvalue";
+    std::size_t position = 0;
+    skip_ascii_whitespace(input, position);
+    EXPECT_EQ(position, std::size_t{5});
+}
+
+/**
+ * @brief Test that skip_ascii_whitespace does not skip U+000B VERTICAL TAB or U+00A0 NO-BREAK SPACE.
+ */
+TEST(CollectTest, SkipASCIIWhitespaceStopsAtNonASCIIWhitespace)
+{
+    const std::u16string_view vertical_tab = u" \u000B";
+    std::size_t position = 0;
+    skip_ascii_whitespace(vertical_tab, position);
+    EXPECT_EQ(position, std::size_t{1});
+
+    const std::u16string_view no_break_space = u"  ";
+    position = 0;
+    skip_ascii_whitespace(no_break_space, position);
+    EXPECT_EQ(position, std::size_t{0});
+}
@@ -0,0 +1,140 @@
+/**
+ * @file Test-Units/Operation/Concatenate.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the concatenate operations in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for the concatenate and concatenate_bytes operations.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Operation/Concatenate/Concatenate.hpp>
+#include <Softloq/WHATWG/Infra/Operation/Split/Split.hpp>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+/**
+ * @brief Build a String from a UTF-16 literal.
+ */
+String string_of(std::u16string_view units) { return String{units}; }
+
+/**
+ * @brief Build a ByteSequence from the bytes of a string literal.
+ */
+ByteSequence bytes_of(std::string_view text)
+{
+    ByteSequence bytes;
+    for (char c : text) bytes.push_back(Byte{static_cast<std::uint8_t>(c)});
+    return bytes;
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Strings
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that the items are joined in order, with the separator only between them.
+ */
+TEST(ConcatenateTest, JoinsStringsWithSeparator)
+{
+    const std::vector<String> list{string_of(u"a"), string_of(u"bc"), string_of(u""), string_of(u"d")};
+    EXPECT_EQ(concatenate(list), string_of(u"abcd"));
+    EXPECT_EQ(concatenate(list, std::u16string_view{u", "}), string_of(u"a, bc, , d"));
+    EXPECT_EQ(concatenate(list, string_of(u"-")), string_of(u"a-bc--d"));
+}
+
+/**
+ * @brief Test that an empty list gives the empty string and a single item gives the item without a separator.
+ */
+TEST(ConcatenateTest, EmptyAndSingleItemLists)
+{
+    EXPECT_TRUE(concatenate(std::vector<String>{}, std::u16string_view{u", "}).is_empty());
+    EXPECT_EQ(concatenate(std::vector<String>{string_of(u"only")}, std::u16string_view{u", "}), string_of(u"only"));
+}
+
+/**
+ * @brief Test that the result is 8-bit when every item and the separator fit, and UTF-16 otherwise.
+ */
+TEST(ConcatenateTest, ChoosesRepresentation)
+{
+    const std::vector<String> narrow{string_of(u"caf"), string_of(u"é")};
+    const String joined = concatenate(narrow, std::u16string_view{u" "});
+    EXPECT_TRUE(joined.is_8bit());
+    EXPECT_EQ(joined, string_of(u"caf é"));
+
+    const String wide_separator = concatenate(narrow, std::u16string_view{u"→"});
+    EXPECT_FALSE(wide_separator.is_8bit());
+    EXPECT_EQ(wide_separator, string_of(u"caf→é"));
+
+    const std::vector<std::u16string> wide_item{u"x", u"☃"};
+    EXPECT_EQ(concatenate(wide_item, std::u16string_view{u"+"}), string_of(u"x+☃"));
+}
+
+/**
+ * @brief Test that code point items are encoded as UTF-16 and byte items are taken as Latin-1.
+ */
+TEST(ConcatenateTest, CodePointAndByteItems)
+{
+    const std::vector<std::u32string> code_points{U"a\U0001F600", U"b"};
+    EXPECT_EQ(concatenate(code_points, std::u16string_view{u"|"}), string_of(u"a\U0001F600|b"));
+
+    const std::vector<std::string> bytes{"x", "\xE9"};
+    EXPECT_EQ(concatenate(bytes, std::u16string_view{u" "}), string_of(u"x é"));
+}
+
+/**
+ * @brief Test that a lazy split view is concatenated directly, without collecting its tokens first.
+ */
+TEST(ConcatenateTest, LazySplitView)
+{
+    const std::u16string classes = u"  btn   btn-primary\tactive ";
+    EXPECT_EQ(concatenate(split_on_ascii_whitespace(classes), std::u16string_view{u" "}), string_of(u"btn btn-primary active"));
+    EXPECT_EQ(concatenate(split_on_commas(classes), std::u16string_view{u";"}), string_of(u"btn   btn-primary\tactive"));
+}
+
+/**
+ * @brief Test that a list that can only be iterated once is concatenated too.
+ */
+TEST(ConcatenateTest, SinglePassInput)
+{
+    std::istringstream words{"alpha beta gamma"};
+    auto list = std::views::istream<std::string>(words);
+    EXPECT_EQ(concatenate(list, std::u16string_view{u"/"}), string_of(u"alpha/beta/gamma"));
+}
+
+// ---------------------------------------------------------------------------
+// Byte sequences
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that byte sequences are joined in order with the separator between them.
+ */
+TEST(ConcatenateTest, JoinsByteSequences)
+{
+    const std::vector<ByteSequence> values{bytes_of("gzip"), bytes_of("br"), bytes_of("deflate")};
+    EXPECT_EQ(concatenate_bytes(values, std::string_view{", "}), bytes_of("gzip, br, deflate"));
+    EXPECT_EQ(concatenate_bytes(values), bytes_of("gzipbrdeflate"));
+    EXPECT_EQ(concatenate_bytes(values, bytes_of("/")), bytes_of("gzip/br/deflate"));
+    EXPECT_TRUE(concatenate_bytes(std::vector<ByteSequence>{}, std::string_view{", "}).is_empty());
+}
+
+/**
+ * @brief Test that a split of a byte string is rejoined, and that single-pass byte lists work.
+ */
+TEST(ConcatenateTest, ByteSplitViewAndSinglePassInput)
+{
+    const std::string header = "text/html ,  application/xml,*/*";
+    EXPECT_EQ(concatenate_bytes(split_on_commas(header), std::string_view{","}), bytes_of("text/html,application/xml,*/*"));
+
+    std::istringstream words{"a b c"};
+    EXPECT_EQ(concatenate_bytes(std::views::istream<std::string>(words), std::string_view{"-"}), bytes_of("a-b-c"));
+}
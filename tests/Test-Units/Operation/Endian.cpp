@@ -0,0 +1,210 @@
+/**
+ * @file Test-Units/Operation/Endian.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the endian-aware Number serialization operations in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file checks the vectorized byte-swapping kernel against its portable version, the byte
+ * layout of single Numbers of every width in both byte orders, and the bulk encode and decode.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Operation/Endian/Endian.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Numbers/Numbers.hpp>
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Check the byte-swapping kernel against its portable version on random runs of every length up to 100, in place and not.
+ */
+template <std::size_t Width>
+void expect_kernel_matches(std::uint64_t seed)
+{
+    std::mt19937_64 engine{seed};
+    for (std::size_t count = 0; count <= 100; ++count)
+    {
+        std::vector<std::uint8_t> source(count * Width);
+        for (std::uint8_t& byte : source) byte = static_cast<std::uint8_t>(engine());
+        std::vector<std::uint8_t> swapped(source.size()), expected(source.size());
+        SIMD::byte_swap<Width>(source.data(), count, swapped.data());
+        SIMD::ByteSwapPortable::byte_swap<Width>(source.data(), count, expected.data());
+        ASSERT_EQ(swapped, expected) << "count " << count;
+
+        SIMD::byte_swap<Width>(swapped.data(), count, swapped.data());
+        ASSERT_EQ(swapped, source) << "count " << count;
+    }
+}
+
+/**
+ * @brief The bytes of a sequence.
+ */
+std::vector<std::uint8_t> bytes_of(const ByteSequence& bytes)
+{
+    std::vector<std::uint8_t> result;
+    for (const Byte& byte : bytes) result.push_back(byte.get_value());
+    return result;
+}
+
+/**
+ * @brief Check that a Number appends as the expected big-endian bytes, as their reverse in little-endian, and reads back.
+ */
+template <typename T>
+void expect_layout(const Number<T>& value, const std::vector<std::uint8_t>& big_endian)
+{
+    ByteSequence bytes;
+    append_number(bytes, value, std::endian::big);
+    ASSERT_EQ(bytes_of(bytes), big_endian);
+    EXPECT_EQ(read_number<T>(bytes, 0, std::endian::big), value);
+
+    bytes.clear();
+    append_number(bytes, value, std::endian::little);
+    ASSERT_EQ(bytes_of(bytes), (std::vector<std::uint8_t>(big_endian.rbegin(), big_endian.rend())));
+    EXPECT_EQ(read_number<T>(bytes, 0, std::endian::little), value);
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Byte-swapping kernel
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that the vectorized kernel agrees with the portable one for every width it is built for.
+ */
+TEST(EndianTest, KernelMatchesPortable)
+{
+    expect_kernel_matches<2>(1);
+    expect_kernel_matches<4>(2);
+    expect_kernel_matches<8>(3);
+}
+
+/**
+ * @brief Test the portable kernel on a wide integer.
+ */
+TEST(EndianTest, PortableSwapsWideIntegers)
+{
+    std::vector<std::uint8_t> bytes(32);
+    for (std::size_t index = 0; index < bytes.size(); ++index) bytes[index] = static_cast<std::uint8_t>(index);
+    SIMD::ByteSwapPortable::byte_swap<16>(bytes.data(), 2, bytes.data());
+    EXPECT_EQ(bytes[0], 15);
+    EXPECT_EQ(bytes[15], 0);
+    EXPECT_EQ(bytes[16], 31);
+    EXPECT_EQ(bytes[31], 16);
+}
+
+// ---------------------------------------------------------------------------
+// Single Numbers
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test the bytes of every built-in width in both byte orders.
+ */
+TEST(EndianTest, BuiltInLayouts)
+{
+    expect_layout(UInt8{0xAB}, {0xAB});
+    expect_layout(Int8{-2}, {0xFE});
+    expect_layout(UInt16{0x1234}, {0x12, 0x34});
+    expect_layout(Int16{-2}, {0xFF, 0xFE});
+    expect_layout(UInt32{0x01020304}, {0x01, 0x02, 0x03, 0x04});
+    expect_layout(Int32{-16909061}, {0xFE, 0xFD, 0xFC, 0xFB});
+    expect_layout(UInt64{0x0102030405060708}, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08});
+    expect_layout(Int64{-1}, std::vector<std::uint8_t>(8, 0xFF));
+}
+
+/**
+ * @brief Test the bytes of uint128_t and WideInt values, whose words are ordered by significance.
+ */
+TEST(EndianTest, WideLayouts)
+{
+    std::vector<std::uint8_t> expected;
+    for (std::uint8_t byte = 1; byte <= 16; ++byte) expected.push_back(byte);
+    expect_layout(UInt128{uint128_t{0x0102030405060708, 0x090A0B0C0D0E0F10}}, expected);
+    expect_layout(Int128{int128_t{uint128_t{0x0102030405060708, 0x090A0B0C0D0E0F10}}}, expected);
+
+    std::vector<std::uint8_t> one(32);
+    one.back() = 1;
+    expect_layout(UInt256{uint256_t{1}}, one);
+    expect_layout(Int512{int512_t{-1}}, std::vector<std::uint8_t>(64, 0xFF));
+}
+
+/**
+ * @brief Test writes and reads at an offset, and that those past the end throw.
+ */
+TEST(EndianTest, OffsetsAndBounds)
+{
+    ByteSequence bytes{0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA};
+    write_number(bytes, 1, UInt32{0xDEADBEEF}, std::endian::big);
+    EXPECT_EQ(bytes, (ByteSequence{0xAA, 0xDE, 0xAD, 0xBE, 0xEF, 0xAA}));
+    EXPECT_EQ(read_number<std::uint16_t>(bytes, 2, std::endian::little), UInt16{0xBEAD});
+    EXPECT_EQ(read_number<std::uint16_t>(bytes, 4, std::endian::big), UInt16{0xEFAA});
+
+    EXPECT_THROW(write_number(bytes, 3, UInt32{0}, std::endian::big), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(read_number<std::uint64_t>(bytes, 0, std::endian::big)), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(read_number<std::uint8_t>(bytes, 6, std::endian::big)), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(read_number<std::uint8_t>(bytes, std::size_t(-1), std::endian::big)), std::out_of_range);
+    EXPECT_EQ(bytes, (ByteSequence{0xAA, 0xDE, 0xAD, 0xBE, 0xEF, 0xAA}));
+}
+
+// ---------------------------------------------------------------------------
+// Bulk encode and decode
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that a bulk append matches appending one Number at a time, and that a bulk read returns the values.
+ */
+TEST(EndianTest, BulkMatchesSingle)
+{
+    std::mt19937_64 engine{47};
+    NumberArray<std::uint32_t> fields;
+    for (int index = 0; index < 1000; ++index) fields.append(UInt32{static_cast<std::uint32_t>(engine())});
+
+    for (const std::endian order : {std::endian::big, std::endian::little})
+    {
+        ByteSequence bulk{0x7F};
+        append_numbers(bulk, fields, order);
+        ByteSequence single{0x7F};
+        for (const UInt32& field : fields.numbers()) append_number(single, field, order);
+        ASSERT_EQ(bulk, single);
+        EXPECT_EQ(read_numbers<std::uint32_t>(bulk, 1, fields.size(), order), fields);
+    }
+}
+
+/**
+ * @brief Test bulk reads and writes of the other widths, signed values and wide integers included.
+ */
+TEST(EndianTest, BulkWidths)
+{
+    const std::vector<std::int16_t> shorts{-1, 2, -300, 32767};
+    ByteSequence bytes;
+    append_numbers(bytes, std::span<const std::int16_t>{shorts}, std::endian::big);
+    EXPECT_EQ(bytes, (ByteSequence{0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xD4, 0x7F, 0xFF}));
+    EXPECT_EQ(read_numbers<std::int16_t>(bytes, 0, 4, std::endian::big), (NumberArray<std::int16_t>{-1, 2, -300, 32767}));
+
+    const NumberArray<std::uint64_t> longs{1, 0x0102030405060708, ~0ULL};
+    bytes.clear();
+    append_numbers(bytes, longs, std::endian::little);
+    EXPECT_EQ(read_number<std::uint64_t>(bytes, 8, std::endian::big), UInt64{0x0807060504030201});
+    EXPECT_EQ(read_numbers<std::uint64_t>(bytes, 0, 3, std::endian::little), longs);
+
+    const NumberArray<uint256_t> wide{uint256_t{1} << 255, uint256_t{42}};
+    bytes.clear();
+    append_numbers(bytes, wide, std::endian::big);
+    EXPECT_EQ(bytes.size(), 64u);
+    EXPECT_EQ(bytes[0].get_value(), 0x80);
+    EXPECT_EQ(bytes[63].get_value(), 42);
+    EXPECT_EQ(read_numbers<uint256_t>(bytes, 0, 2, std::endian::big), wide);
+
+    EXPECT_TRUE(read_numbers<std::uint32_t>(bytes, 64, 0, std::endian::big).is_empty());
+    EXPECT_THROW(static_cast<void>(read_numbers<std::uint32_t>(bytes, 4, 16, std::endian::big)), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(read_numbers<std::uint64_t>(bytes, 0, std::size_t(1) << 62, std::endian::big)), std::out_of_range);
+}
@@ -0,0 +1,297 @@
+/**
+ * @file Test-Units/Operation/ParseFloat.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the floating-point number parsing operation in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file checks the HTML rules for parsing floating-point number values, and their rounding
+ * against std::from_chars on random decimals, exact halfway cases and significands of hundreds of
+ * digits.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Operation/ParseFloat/ParseFloat.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/ByteSequence/ByteSequence.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/Double/Double.hpp>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Parse an ASCII string.
+ */
+FloatParseResult parse(std::string_view text)
+{
+    return parse_floating_point_number(text);
+}
+
+/**
+ * @brief Expect that a decimal parses to the same double as std::from_chars, through the whole text.
+ */
+void expect_matches_from_chars(const std::string& text)
+{
+    double expected = 0;
+    std::from_chars(text.data(), text.data() + text.size(), expected);
+    const auto result = parse(text);
+    ASSERT_TRUE(result) << text;
+    EXPECT_EQ(std::bit_cast<std::uint64_t>(result.value.get_value()), std::bit_cast<std::uint64_t>(expected)) << text;
+    EXPECT_EQ(result.position, text.size()) << text;
+}
+
+/**
+ * @brief The exact decimal of the midpoint between a positive finite double and the next one up.
+ */
+std::string halfway_decimal(double value)
+{
+    const auto bits = std::bit_cast<std::uint64_t>(value);
+    const auto biased_exponent = static_cast<int>(bits >> 52);
+    std::uint64_t significand = bits & ((std::uint64_t{1} << 52) - 1);
+    int exponent = -1074;
+    if (biased_exponent != 0)
+    {
+        significand |= std::uint64_t{1} << 52;
+        exponent = biased_exponent - 1075;
+    }
+    // (2 * significand + 1) * 2^(exponent - 1), with 2^-n written as 5^n * 10^-n.
+    bigint_t midpoint{2 * significand + 1};
+    if (exponent >= 1) return (midpoint << (exponent - 1)).to_decimal();
+    for (int count = 0; count < 1 - exponent; ++count) midpoint.multiply_add(5, 0);
+    return midpoint.to_decimal() + "e" + std::to_string(exponent - 1);
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Rules for parsing floating-point number values
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that leading whitespace and a sign are accepted, and that parsing stops after the number.
+ */
+TEST(ParseFloatTest, WhitespaceAndSign)
+{
+    const auto negative = parse(" \t\n-12.5px");
+    ASSERT_TRUE(negative);
+    EXPECT_EQ(negative.value.get_value(), -12.5);
+    EXPECT_EQ(negative.position, 8u);
+
+    const auto positive = parse("+0.25");
+    ASSERT_TRUE(positive);
+    EXPECT_EQ(positive.value.get_value(), 0.25);
+    EXPECT_EQ(positive.position, 5u);
+}
+
+/**
+ * @brief Test that inputs without a digit where the number should start fail with NoDigits at position 0.
+ */
+TEST(ParseFloatTest, RejectsInputsWithoutDigits)
+{
+    for (const std::string_view text : {"", "   ", "-", "+", ".", "-.", ".e1", "e5", "- 1", "+-1", "Infinity", "NaN", "\v1"})
+    {
+        const auto result = parse(text);
+        EXPECT_EQ(result.error, FloatParseError::NoDigits) << text;
+        EXPECT_EQ(result.position, 0u) << text;
+        EXPECT_EQ(result.value.get_value(), 0.0) << text;
+    }
+}
+
+/**
+ * @brief Test the fraction and exponent forms, and where the rules stop reading in each.
+ */
+TEST(ParseFloatTest, FractionAndExponent)
+{
+    const struct
+    {
+        std::string_view text;
+        double value;
+        std::size_t position;
+    } cases[] = {
+        {".5", 0.5, 2},      {"-.5", -0.5, 3},  {"1.", 1.0, 2},       {"1.x", 1.0, 2},     {"1.e5", 1e5, 4},
+        {"1e", 1.0, 2},      {"1e+", 1.0, 3},   {"1E-", 1.0, 3},      {"1ex", 1.0, 2},     {"2.5E+3", 2500.0, 6},
+        {"25e-1", 2.5, 5},   {"1..5", 1.0, 2},  {"1.5.5", 1.5, 3},    {"007.10", 7.1, 6},  {"1e0010", 1e10, 6},
+    };
+    for (const auto& [text, value, position] : cases)
+    {
+        const auto result = parse(text);
+        ASSERT_TRUE(result) << text;
+        EXPECT_EQ(result.value.get_value(), value) << text;
+        EXPECT_EQ(result.position, position) << text;
+    }
+}
+
+/**
+ * @brief Test that -0 and negative values too small for a double parse as 0, not -0.
+ */
+TEST(ParseFloatTest, NoNegativeZero)
+{
+    for (const std::string_view text : {"-0", "-0.000", "-0e999", "-1e-400"})
+    {
+        const auto result = parse(text);
+        ASSERT_TRUE(result) << text;
+        EXPECT_FALSE(std::signbit(result.value.get_value())) << text;
+    }
+}
+
+/**
+ * @brief Test that values rounding past the largest double fail with OutOfRange, and values below the smallest round to 0.
+ */
+TEST(ParseFloatTest, Range)
+{
+    EXPECT_EQ(parse("1.7976931348623157e308").value.get_value(), std::numeric_limits<double>::max());
+    EXPECT_EQ(parse("1.7976931348623158e308").value.get_value(), std::numeric_limits<double>::max());
+    // The midpoint between the largest double and 2^1024 rounds to the even 2^1024; anything below it to the largest double.
+    std::string halfway = halfway_decimal(std::numeric_limits<double>::max());
+    EXPECT_EQ(parse(halfway).error, FloatParseError::OutOfRange);
+    halfway.back() = static_cast<char>(halfway.back() - 1);
+    EXPECT_EQ(parse(halfway).value.get_value(), std::numeric_limits<double>::max());
+    EXPECT_EQ(parse("-1e309").error, FloatParseError::OutOfRange);
+    EXPECT_EQ(parse("1e99999999999999999999").error, FloatParseError::OutOfRange);
+    EXPECT_EQ(parse("1e99999999999999999999").position, 22u);
+
+    EXPECT_EQ(parse("5e-324").value.get_value(), std::numeric_limits<double>::denorm_min());
+    EXPECT_EQ(parse("2.4703282292062328e-324").value.get_value(), std::numeric_limits<double>::denorm_min());
+    EXPECT_EQ(parse("2.4703282292062327e-324").value.get_value(), 0.0);
+    EXPECT_EQ(parse("1e-99999999999999999999").value.get_value(), 0.0);
+    EXPECT_EQ(parse("0e99999").value.get_value(), 0.0);
+}
+
+// ---------------------------------------------------------------------------
+// Rounding
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that decimal_to_double() takes the exact fast path and Eisel-Lemire alike.
+ */
+TEST(ParseFloatTest, DecimalToDouble)
+{
+    EXPECT_EQ(decimal_to_double(12345, -2), 123.45);
+    EXPECT_EQ(decimal_to_double(9007199254740993, 0), 9007199254740992.0);
+    EXPECT_EQ(decimal_to_double(1, 23), 1e23);
+    EXPECT_EQ(decimal_to_double(17976931348623157, 292), std::numeric_limits<double>::max());
+    EXPECT_EQ(decimal_to_double(std::numeric_limits<std::uint64_t>::max(), -342), 4 * std::numeric_limits<double>::denorm_min());
+    EXPECT_EQ(decimal_to_double(std::numeric_limits<std::uint64_t>::max(), -343), 0.0);
+    EXPECT_EQ(decimal_to_double(1, 309), std::numeric_limits<double>::infinity());
+    EXPECT_EQ(decimal_to_double(0, 400), 0.0);
+}
+
+/**
+ * @brief Test random decimals of up to forty digits and exponents across the whole range against std::from_chars.
+ */
+TEST(ParseFloatTest, MatchesFromChars)
+{
+    std::mt19937_64 engine{2026};
+    char buffer[64];
+    for (int run = 0; run < 50000; ++run)
+    {
+        const double value = std::bit_cast<double>(engine() & 0x7FEFFFFFFFFFFFFFULL);
+        expect_matches_from_chars(std::string{buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr});
+        expect_matches_from_chars(std::string{buffer, std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::scientific, 25).ptr});
+
+        std::string digits;
+        const std::size_t length = 1 + engine() % 40;
+        for (std::size_t index = 0; index < length; ++index) digits.push_back(static_cast<char>('0' + engine() % 10));
+        expect_matches_from_chars(digits + "e" + std::to_string(static_cast<int>(engine() % 640) - 332 - static_cast<int>(length)));
+        expect_matches_from_chars(digits.substr(0, length / 2) + "." + digits.substr(length / 2));
+    }
+}
+
+/**
+ * @brief Test exact midpoints between neighbouring doubles, which round to even, and the decimals just either side of them.
+ */
+TEST(ParseFloatTest, HalfwayCases)
+{
+    std::mt19937_64 engine{7};
+    for (int run = 0; run < 4000; ++run)
+    {
+        std::uint64_t bits = engine() & 0x7FEFFFFFFFFFFFFFULL;
+        if (run % 4 == 0) bits &= 0x000FFFFFFFFFFFFFULL;
+        const std::string halfway = halfway_decimal(std::bit_cast<double>(bits));
+        const std::size_t e = std::min(halfway.find('e'), halfway.size());
+        const std::string significand = halfway.substr(0, e);
+        const std::string exponent = halfway.substr(e);
+        expect_matches_from_chars(halfway);
+        expect_matches_from_chars(significand + "00000000000000000000000000001" + (exponent.empty() ? "e-29" : "e" + std::to_string(std::stoi(exponent.substr(1)) - 29)));
+        std::string below = significand;
+        if (below.back() == '0') continue;
+        below.back() = static_cast<char>(below.back() - 1);
+        expect_matches_from_chars(below + "9999999999" + (exponent.empty() ? "e-10" : "e" + std::to_string(std::stoi(exponent.substr(1)) - 10)));
+    }
+    expect_matches_from_chars("9007199254740993");
+    expect_matches_from_chars("9007199254740993.000000000000000000000000000000000001");
+    expect_matches_from_chars("9007199254740992.999999999999999999999999999999999999");
+}
+
+/**
+ * @brief Test significands past the 800 digits the exact conversion keeps, where the rest only break a tie.
+ */
+TEST(ParseFloatTest, LongSignificands)
+{
+    const std::string halfway = "9007199254740993" + std::string(1000, '0');
+    EXPECT_EQ(parse(halfway + "e-1000").value.get_value(), 9007199254740992.0);
+    EXPECT_EQ(parse(halfway + "1e-1001").value.get_value(), 9007199254740994.0);
+    EXPECT_EQ(parse("0." + std::string(500, '0') + "1e501").value.get_value(), 1.0);
+    expect_matches_from_chars(std::string(900, '7') + "e-600");
+    expect_matches_from_chars("0." + std::string(340, '0') + std::string(500, '3'));
+}
+
+/**
+ * @brief Test that every number string written by write_number_string() parses back to the same double.
+ */
+TEST(ParseFloatTest, NumberStringRoundTrip)
+{
+    std::mt19937_64 engine{11};
+    char buffer[max_number_string_length];
+    for (int run = 0; run < 100000; ++run)
+    {
+        const double value = std::bit_cast<double>(engine() & 0x7FEFFFFFFFFFFFFFULL) * (run % 2 == 0 ? 1 : -1);
+        const std::string_view text{buffer, static_cast<std::size_t>(write_number_string(buffer, value) - buffer)};
+        const auto result = parse(text);
+        ASSERT_TRUE(result) << text;
+        ASSERT_EQ(std::bit_cast<std::uint64_t>(result.value.get_value()), std::bit_cast<std::uint64_t>(value)) << text;
+        ASSERT_EQ(result.position, text.size()) << text;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Input types
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that byte sequences, UTF-16 strings and code point sequences parse alike, with wide units ending the number.
+ */
+TEST(ParseFloatTest, InputTypes)
+{
+    const std::string text = "  -1234567890.12345678901234567890e-5;";
+    const auto expected = parse(text);
+    ASSERT_TRUE(expected);
+
+    ByteSequence bytes;
+    for (const char c : text) bytes.push_back(Byte{static_cast<std::uint8_t>(c)});
+    std::vector<CodePoint> code_points;
+    for (const char c : text) code_points.emplace_back(static_cast<char32_t>(c));
+    for (const auto& result : {parse_floating_point_number(bytes), parse_floating_point_number(std::u16string(text.begin(), text.end())),
+                               parse_floating_point_number(std::u32string(text.begin(), text.end())), parse_floating_point_number(std::span<const CodePoint>{code_points})})
+    {
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result.value.get_value(), expected.value.get_value());
+        EXPECT_EQ(result.position, text.size() - 1);
+    }
+
+    const auto wide = parse_floating_point_number(std::u16string{u"12345678١.5"});
+    ASSERT_TRUE(wide);
+    EXPECT_EQ(wide.value.get_value(), 12345678.0);
+    EXPECT_EQ(wide.position, 8u);
+}
@@ -0,0 +1,330 @@
+/**
+ * @file Test-Units/Operation/ParseInteger.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the integer parsing operations in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for parse_ascii_digits() and the HTML rules for parsing integers and non-negative integers.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Operation/ParseInteger/ParseInteger.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/ByteSequence/ByteSequence.hpp>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Widen an ASCII string to UTF-16.
+ */
+std::u16string to_utf16(std::string_view text)
+{
+    return std::u16string(text.begin(), text.end());
+}
+
+/**
+ * @brief Widen an ASCII string to a sequence of code points.
+ */
+std::vector<CodePoint> to_code_points(std::string_view text)
+{
+    std::vector<CodePoint> code_points;
+    for (const char c : text) code_points.emplace_back(static_cast<char32_t>(c));
+    return code_points;
+}
+
+/**
+ * @brief Expect that parse_integer() gives the same value and position as std::from_chars for a signed or unsigned decimal.
+ */
+template <typename T>
+void expect_matches_from_chars(const std::string& text)
+{
+    T expected{};
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), expected);
+    const auto result = parse_integer<T>(std::string_view{text});
+    if (error == std::errc{})
+    {
+        ASSERT_TRUE(result) << text;
+        EXPECT_EQ(result.value.get_value(), expected) << text;
+        EXPECT_EQ(result.position, static_cast<std::size_t>(end - text.data())) << text;
+    }
+    else
+    {
+        ASSERT_EQ(error, std::errc::result_out_of_range) << text;
+        EXPECT_EQ(result.error, IntegerParseError::OutOfRange) << text;
+        EXPECT_EQ(result.position, static_cast<std::size_t>(end - text.data())) << text;
+    }
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Digits
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that the digit run at a position is parsed and the position stops after it.
+ */
+TEST(ParseIntegerTest, ParsesDigitRun)
+{
+    const auto result = parse_ascii_digits<std::uint32_t>(std::string_view{"ab1234cd"}, 2);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.value.get_value(), 1234u);
+    EXPECT_EQ(result.position, std::size_t{6});
+}
+
+/**
+ * @brief Test that no digit at the position fails with NoDigits and leaves the position where it was.
+ */
+TEST(ParseIntegerTest, DigitsRequireADigit)
+{
+    for (const std::string_view input : {"", "x1", "-1", " 1"})
+    {
+        const auto result = parse_ascii_digits<int>(input);
+        EXPECT_FALSE(result) << input;
+        EXPECT_EQ(result.error, IntegerParseError::NoDigits) << input;
+        EXPECT_EQ(result.position, std::size_t{0}) << input;
+        EXPECT_EQ(result.value.get_value(), 0) << input;
+    }
+    EXPECT_EQ(parse_ascii_digits<int>(std::string_view{"12"}, 2).error, IntegerParseError::NoDigits);
+    EXPECT_EQ(parse_ascii_digits<int>(std::string_view{"12"}, 5).position, std::size_t{5});
+}
+
+/**
+ * @brief Test that the characters on either side of '0' to '9' end the digit run at every length the fast paths handle.
+ */
+TEST(ParseIntegerTest, RunEndsAtNeighbouringCharacters)
+{
+    const std::string digits = "12345678901234567890";
+    for (std::size_t length = 1; length <= digits.size(); ++length)
+    {
+        for (const char terminator : {'/', ':', ' ', '\xFA', '\xFF', '\0'})
+        {
+            std::string text = digits.substr(0, length) + terminator + "987654321098765432";
+            const auto result = parse_ascii_digits<std::uint64_t>(std::string_view{text});
+            ASSERT_TRUE(result) << text;
+            EXPECT_EQ(result.position, length) << text;
+            EXPECT_EQ(result.value.get_value(), std::stoull(digits.substr(0, length))) << text;
+        }
+    }
+}
+
+/**
+ * @brief Test that UTF-16 units whose low byte is a digit are not taken for digits.
+ */
+TEST(ParseIntegerTest, WideUnitsAreNotDigits)
+{
+    for (const char16_t unit : {char16_t{0x0130}, char16_t{0x0139}, char16_t{0xFF10}, char16_t{0xD830}, char16_t{0x8030}})
+    {
+        for (std::size_t length = 0; length <= 17; ++length)
+        {
+            std::u16string text(length, u'7');
+            text += unit;
+            text += u"1111111111111111";
+            const auto result = parse_ascii_digits<std::uint64_t>(text);
+            EXPECT_EQ(result.position, length);
+            EXPECT_EQ(result.error, length == 0 ? IntegerParseError::NoDigits : IntegerParseError::None);
+        }
+    }
+}
+
+/**
+ * @brief Test that leading zeros are accepted and do not count against the range.
+ */
+TEST(ParseIntegerTest, LeadingZeros)
+{
+    const std::string text = std::string(100, '0') + "255";
+    const auto result = parse_ascii_digits<std::uint8_t>(std::string_view{text});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.value.get_value(), 255u);
+    EXPECT_EQ(result.position, text.size());
+}
+
+/**
+ * @brief Test that a digit run too long for the type is consumed whole and reported as OutOfRange.
+ */
+TEST(ParseIntegerTest, OverflowConsumesWholeRun)
+{
+    const std::string text = std::string(100, '9') + "x";
+    const auto result = parse_ascii_digits<std::uint64_t>(std::string_view{text});
+    EXPECT_EQ(result.error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(result.position, std::size_t{100});
+    EXPECT_EQ(result.value.get_value(), 0u);
+}
+
+// ---------------------------------------------------------------------------
+// Rules for parsing integers
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that leading ASCII whitespace and a sign are accepted and trailing characters ignored.
+ */
+TEST(ParseIntegerTest, WhitespaceAndSign)
+{
+    const auto negative = parse_integer<int>(std::string_view{" \t\n\f\r-42px"});
+    ASSERT_TRUE(negative);
+    EXPECT_EQ(negative.value.get_value(), -42);
+    EXPECT_EQ(negative.position, std::size_t{8});
+
+    const auto positive = parse_integer<int>(std::string_view{"  +7"});
+    ASSERT_TRUE(positive);
+    EXPECT_EQ(positive.value.get_value(), 7);
+    EXPECT_EQ(positive.position, std::size_t{4});
+}
+
+/**
+ * @brief Test the inputs the rules reject: no digits, a sign alone, a second sign and whitespace after the sign.
+ */
+TEST(ParseIntegerTest, RejectsInputsWithoutDigits)
+{
+    for (const std::string_view input : {"", "   ", "-", "+", "+-1", "--1", "- 1", "\v1", "abc", "\xA0" "1"})
+    {
+        const auto result = parse_integer<int>(input);
+        EXPECT_EQ(result.error, IntegerParseError::NoDigits) << input;
+        EXPECT_EQ(result.position, std::size_t{0}) << input;
+    }
+}
+
+/**
+ * @brief Test that a negative value is out of range for unsigned types, except for -0.
+ */
+TEST(ParseIntegerTest, NegativeUnsigned)
+{
+    EXPECT_EQ(parse_integer<std::uint32_t>(std::string_view{"-1"}).error, IntegerParseError::OutOfRange);
+    const auto zero = parse_integer<std::uint32_t>(std::string_view{"-000"});
+    ASSERT_TRUE(zero);
+    EXPECT_EQ(zero.value.get_value(), 0u);
+    EXPECT_EQ(parse_integer<uint128_t>(std::string_view{"-1"}).error, IntegerParseError::OutOfRange);
+}
+
+/**
+ * @brief Test the limits of every Number width, and one past them.
+ */
+TEST(ParseIntegerTest, WidthLimits)
+{
+    EXPECT_EQ(parse_integer<std::int8_t>(std::string_view{"-128"}).value.get_value(), -128);
+    EXPECT_EQ(parse_integer<std::int8_t>(std::string_view{"127"}).value.get_value(), 127);
+    EXPECT_EQ(parse_integer<std::int8_t>(std::string_view{"-129"}).error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(parse_integer<std::int8_t>(std::string_view{"128"}).error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(parse_integer<std::uint8_t>(std::string_view{"256"}).error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(parse_integer<std::int16_t>(std::string_view{"-32768"}).value.get_value(), -32768);
+    EXPECT_EQ(parse_integer<std::int16_t>(std::string_view{"32768"}).error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(parse_integer<std::uint16_t>(std::string_view{"65535"}).value.get_value(), 65535u);
+    EXPECT_EQ(parse_integer<std::uint16_t>(std::string_view{"65536"}).error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(parse_integer<std::int32_t>(std::string_view{"-2147483648"}).value.get_value(), std::numeric_limits<std::int32_t>::min());
+    EXPECT_EQ(parse_integer<std::int32_t>(std::string_view{"2147483648"}).error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(parse_integer<std::uint32_t>(std::string_view{"4294967296"}).error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(parse_integer<std::int64_t>(std::string_view{"-9223372036854775808"}).value.get_value(), std::numeric_limits<std::int64_t>::min());
+    EXPECT_EQ(parse_integer<std::int64_t>(std::string_view{"-9223372036854775809"}).error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(parse_integer<std::uint64_t>(std::string_view{"18446744073709551615"}).value.get_value(), std::numeric_limits<std::uint64_t>::max());
+    EXPECT_EQ(parse_integer<std::uint64_t>(std::string_view{"18446744073709551616"}).error, IntegerParseError::OutOfRange);
+
+    const auto max128 = parse_integer<uint128_t>(std::string_view{"340282366920938463463374607431768211455"});
+    ASSERT_TRUE(max128);
+    EXPECT_EQ(max128.value.get_value(), ~uint128_t{});
+    EXPECT_EQ(parse_integer<uint128_t>(std::string_view{"340282366920938463463374607431768211456"}).error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(parse_integer<uint128_t>(std::string_view{"3402823669209384634633746074317682114550"}).error, IntegerParseError::OutOfRange);
+}
+
+/**
+ * @brief Test that 128-bit values round-trip through write_decimal() at every magnitude.
+ */
+TEST(ParseIntegerTest, UInt128RoundTrip)
+{
+    std::mt19937_64 engine{42};
+    for (int i = 0; i < 2000; ++i)
+    {
+        const uint128_t value = uint128_t{engine(), engine()} >> static_cast<int>(engine() % 128);
+        char buffer[max_decimal_length<uint128_t>];
+        const char* end = write_decimal(buffer, value);
+        const auto result = parse_integer<uint128_t>(std::string_view(buffer, static_cast<std::size_t>(end - buffer)));
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result.value.get_value(), value);
+    }
+}
+
+/**
+ * @brief Test parse_integer() against std::from_chars on random values of every length.
+ */
+TEST(ParseIntegerTest, MatchesFromChars)
+{
+    std::mt19937_64 engine{2026};
+    for (int i = 0; i < 20000; ++i)
+    {
+        const std::uint64_t value = engine() >> static_cast<int>(engine() % 64);
+        std::string text = std::to_string(value);
+        if (engine() % 2 == 0) text = "-" + text;
+        if (engine() % 4 == 0) text += std::to_string(engine() % 100); // sometimes past the 64-bit range
+        text += "e5";
+        expect_matches_from_chars<std::int64_t>(text);
+        expect_matches_from_chars<std::int32_t>(text);
+        if (text[0] != '-')
+        {
+            expect_matches_from_chars<std::uint64_t>(text);
+            expect_matches_from_chars<std::uint16_t>(text);
+        }
+    }
+}
+
+/**
+ * @brief Test the rules for parsing non-negative integers.
+ */
+TEST(ParseIntegerTest, NonNegative)
+{
+    EXPECT_EQ(parse_non_negative_integer<int>(std::string_view{" 15"}).value.get_value(), 15);
+    EXPECT_TRUE(parse_non_negative_integer<int>(std::string_view{"-0"}));
+    const auto negative = parse_non_negative_integer<int>(std::string_view{"-3"});
+    EXPECT_EQ(negative.error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(negative.value.get_value(), 0);
+    EXPECT_EQ(parse_non_negative_integer<int>(std::string_view{"x"}).error, IntegerParseError::NoDigits);
+}
+
+// ---------------------------------------------------------------------------
+// Input types
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that byte sequences, UTF-16 strings and code point sequences parse alike.
+ */
+TEST(ParseIntegerTest, InputTypes)
+{
+    const std::string text = "  -12345678901234567890123;";
+    const std::string expected_text = "  -1234567890123456789;";
+    const auto expected = parse_integer<std::int64_t>(std::string_view{expected_text});
+    ASSERT_TRUE(expected);
+
+    ByteSequence bytes;
+    for (const char c : expected_text) bytes.push_back(Byte{static_cast<std::uint8_t>(c)});
+    const auto from_bytes = parse_integer<std::int64_t>(bytes);
+    ASSERT_TRUE(from_bytes);
+    EXPECT_EQ(from_bytes.value.get_value(), expected.value.get_value());
+    EXPECT_EQ(from_bytes.position, expected.position);
+
+    const auto from_utf16 = parse_integer<std::int64_t>(to_utf16(expected_text));
+    EXPECT_EQ(from_utf16.value.get_value(), expected.value.get_value());
+    EXPECT_EQ(from_utf16.position, expected.position);
+
+    const auto from_utf32 = parse_integer<std::int64_t>(std::u32string(expected_text.begin(), expected_text.end()));
+    EXPECT_EQ(from_utf32.value.get_value(), expected.value.get_value());
+
+    const std::vector<CodePoint> code_points = to_code_points(expected_text);
+    const auto from_code_points = parse_integer<std::int64_t>(std::span<const CodePoint>{code_points});
+    EXPECT_EQ(from_code_points.value.get_value(), expected.value.get_value());
+    EXPECT_EQ(from_code_points.position, expected.position);
+
+    for (const auto& result : {parse_integer<std::int64_t>(std::string_view{text}), parse_integer<std::int64_t>(to_utf16(text))})
+    {
+        EXPECT_EQ(result.error, IntegerParseError::OutOfRange);
+        EXPECT_EQ(result.position, text.size() - 1);
+    }
+}
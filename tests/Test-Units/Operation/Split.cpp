@@ -0,0 +1,199 @@
+/**
+ * @file Test-Units/Operation/Split.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the split operations in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for the split on ASCII whitespace, strictly split and split on commas operations.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Operation/Split/Split.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/ByteSequence/ByteSequence.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+/**
+ * @brief Copies the tokens of a split over char input into strings for comparison.
+ */
+std::vector<std::string> tokens_of(SplitView<char> view)
+{
+    std::vector<std::string> tokens;
+    for (std::span<const char> token : view) tokens.emplace_back(token.begin(), token.end());
+    return tokens;
+}
+
+/**
+ * @brief Copies the tokens of a split over char16_t input into strings for comparison.
+ */
+std::vector<std::u16string> tokens_of(SplitView<char16_t> view)
+{
+    std::vector<std::u16string> tokens;
+    for (std::span<const char16_t> token : view) tokens.emplace_back(token.begin(), token.end());
+    return tokens;
+}
+
+using Tokens = std::vector<std::string>;
+using Tokens16 = std::vector<std::u16string>;
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Range concepts
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that SplitView is a borrowed forward view.
+ */
+TEST(SplitTest, ModelsForwardView)
+{
+    static_assert(std::ranges::view<SplitView<char>>);
+    static_assert(std::ranges::forward_range<SplitView<char16_t>>);
+    static_assert(std::ranges::borrowed_range<SplitView<CodePoint>>);
+    SUCCEED();
+}
+
+/**
+ * @brief Test that tokens are views into the input rather than copies.
+ */
+TEST(SplitTest, TokensPointIntoInput)
+{
+    const std::string_view input = "ab cd";
+    auto it = split_on_ascii_whitespace(input).begin();
+    EXPECT_EQ((*it).data(), input.data());
+    ++it;
+    EXPECT_EQ((*it).data(), input.data() + 3);
+}
+
+// ---------------------------------------------------------------------------
+// Split on ASCII whitespace
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that split on ASCII whitespace yields the runs between whitespace.
+ */
+TEST(SplitTest, ASCIIWhitespace)
+{
+    EXPECT_EQ(tokens_of(split_on_ascii_whitespace(std::string_view{"a bc\tdef"})), (Tokens{"a", "bc", "def"}));
+}
+
+/**
+ * @brief Test that leading, trailing and repeated whitespace yields no empty tokens.
+ */
+TEST(SplitTest, ASCIIWhitespaceNoEmptyTokens)
+{
+    EXPECT_EQ(tokens_of(split_on_ascii_whitespace(std::string_view{" \n a \r\f\t b  "})), (Tokens{"a", "b"}));
+    EXPECT_TRUE(tokens_of(split_on_ascii_whitespace(std::string_view{"   "})).empty());
+    EXPECT_TRUE(tokens_of(split_on_ascii_whitespace(std::string_view{})).empty());
+}
+
+/**
+ * @brief Test that split on ASCII whitespace does not split on non-ASCII whitespace.
+ */
+TEST(SplitTest, ASCIIWhitespaceKeepsNonASCIIWhitespace)
+{
+    EXPECT_EQ(tokens_of(split_on_ascii_whitespace(std::u16string_view{u"a b c"})), (Tokens16{u"a b", u"c"}));
+}
+
+/**
+ * @brief Test that split on ASCII whitespace works over a ByteSequence.
+ */
+TEST(SplitTest, ASCIIWhitespaceByteSequence)
+{
+    const ByteSequence bytes{0x61u, 0x20u, 0x62u};
+    std::size_t count = 0;
+    for (auto token : split_on_ascii_whitespace(bytes))
+    {
+        EXPECT_EQ(token.size(), std::size_t{1});
+        ++count;
+    }
+    EXPECT_EQ(count, std::size_t{2});
+}
+
+// ---------------------------------------------------------------------------
+// Strictly split
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that strictly split keeps empty tokens between, before and after delimiters.
+ */
+TEST(SplitTest, StrictKeepsEmptyTokens)
+{
+    EXPECT_EQ(tokens_of(strictly_split(std::string_view{"a,,b,"}, U',')), (Tokens{"a", "", "b", ""}));
+    EXPECT_EQ(tokens_of(strictly_split(std::string_view{",a"}, U',')), (Tokens{"", "a"}));
+}
+
+/**
+ * @brief Test that strictly split of an empty input yields a single empty token.
+ */
+TEST(SplitTest, StrictEmptyInput)
+{
+    EXPECT_EQ(tokens_of(strictly_split(std::string_view{}, U';')), (Tokens{""}));
+}
+
+/**
+ * @brief Test that strictly split does not strip whitespace from tokens.
+ */
+TEST(SplitTest, StrictDoesNotStrip)
+{
+    EXPECT_EQ(tokens_of(strictly_split(std::string_view{" a ; b "}, U';')), (Tokens{" a ", " b "}));
+}
+
+/**
+ * @brief Test that strictly split handles a supplementary delimiter encoded as a surrogate pair.
+ */
+TEST(SplitTest, StrictSupplementaryDelimiter)
+{
+    EXPECT_EQ(tokens_of(strictly_split(std::u16string_view{u"a\U0001F600b\U0001F600"}, U'\U0001F600')), (Tokens16{u"a", u"b", u""}));
+}
+
+/**
+ * @brief Test that strictly split finds delimiters at every offset of long inputs.
+ */
+TEST(SplitTest, StrictLongInputs)
+{
+    for (std::size_t length = 0; length < 70; ++length)
+    {
+        std::string input(length, 'x');
+        input += '|';
+        input.append(length / 2, 'y');
+        EXPECT_EQ(tokens_of(strictly_split(input, U'|')), (Tokens{std::string(length, 'x'), std::string(length / 2, 'y')}));
+        std::u16string wide(input.begin(), input.end());
+        EXPECT_EQ(tokens_of(strictly_split(wide, U'|')).front().size(), length);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Split on commas
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that split on commas strips each token of ASCII whitespace.
+ */
+TEST(SplitTest, Commas)
+{
+    EXPECT_EQ(tokens_of(split_on_commas(std::string_view{" gzip , deflate,br "})), (Tokens{"gzip", "deflate", "br"}));
+}
+
+/**
+ * @brief Test that split on commas keeps inner empty tokens but not a trailing one.
+ */
+TEST(SplitTest, CommasEmptyTokens)
+{
+    EXPECT_EQ(tokens_of(split_on_commas(std::string_view{"a, ,b,"})), (Tokens{"a", "", "b"}));
+    EXPECT_EQ(tokens_of(split_on_commas(std::string_view{","})), (Tokens{""}));
+    EXPECT_TRUE(tokens_of(split_on_commas(std::string_view{})).empty());
+}
+
+/**
+ * @brief Test that split on commas works over UTF-16 input.
+ */
+TEST(SplitTest, CommasUTF16)
+{
+    EXPECT_EQ(tokens_of(split_on_commas(std::u16string_view{u"é, ü"})), (Tokens16{u"é", u"ü"}));
+}
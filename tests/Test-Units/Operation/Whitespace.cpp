@@ -0,0 +1,212 @@
+/**
+ * @file Test-Units/Operation/Whitespace.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the whitespace and newline operations in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for the strip newlines, normalize newlines, strip leading and trailing
+ * ASCII whitespace, and strip and collapse ASCII whitespace operations.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Operation/Whitespace/Whitespace.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/ByteSequence/ByteSequence.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+// ---------------------------------------------------------------------------
+// Strip newlines
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that strip_newlines removes every LF and CR and keeps everything else in order.
+ */
+TEST(WhitespaceTest, StripNewlines)
+{
+    std::string value = "\na\r\nb c\r\r\n\td\n";
+    strip_newlines(value);
+    EXPECT_EQ(value, "ab c\td");
+}
+
+/**
+ * @brief Test that strip_newlines leaves a sequence without newlines unchanged.
+ */
+TEST(WhitespaceTest, StripNewlinesNoNewlines)
+{
+    std::u16string value = u"no newlines here, only\ttabs and spaces";
+    const std::u16string expected = value;
+    strip_newlines(value);
+    EXPECT_EQ(value, expected);
+}
+
+/**
+ * @brief Test that strip_newlines empties a sequence made only of newlines.
+ */
+TEST(WhitespaceTest, StripNewlinesOnlyNewlines)
+{
+    std::u32string value = U"\r\n\n\r";
+    strip_newlines(value);
+    EXPECT_TRUE(value.empty());
+}
+
+/**
+ * @brief Test that strip_newlines works on a ByteSequence in place.
+ */
+TEST(WhitespaceTest, StripNewlinesByteSequence)
+{
+    ByteSequence bytes{0x61u, 0x0Du, 0x0Au, 0x62u};
+    strip_newlines(bytes);
+    EXPECT_EQ(bytes, (ByteSequence{0x61u, 0x62u}));
+}
+
+// ---------------------------------------------------------------------------
+// Normalize newlines
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that normalize_newlines turns CRLF and lone CR into LF.
+ */
+TEST(WhitespaceTest, NormalizeNewlines)
+{
+    std::string value = "a\r\nb\rc\nd\r\r\ne\r";
+    normalize_newlines(value);
+    EXPECT_EQ(value, "a\nb\nc\nd\n\ne\n");
+}
+
+/**
+ * @brief Test that normalize_newlines does not merge LF CR into one newline.
+ */
+TEST(WhitespaceTest, NormalizeNewlinesLFCR)
+{
+    std::u16string value = u"\n\r";
+    normalize_newlines(value);
+    EXPECT_EQ(value, u"\n\n");
+}
+
+/**
+ * @brief Test that normalize_newlines works on CodePoint sequences.
+ */
+TEST(WhitespaceTest, NormalizeNewlinesCodePoints)
+{
+    std::vector<CodePoint> value{CodePoint{U'x'}, CodePoint{U'\r'}, CodePoint{U'\n'}, CodePoint{U'y'}};
+    normalize_newlines(value);
+    ASSERT_EQ(value.size(), std::size_t{3});
+    EXPECT_EQ(value[1], CodePoint{U'\n'});
+    EXPECT_EQ(value[2], CodePoint{U'y'});
+}
+
+// ---------------------------------------------------------------------------
+// Strip leading and trailing ASCII whitespace
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that leading and trailing ASCII whitespace is excluded from the returned view.
+ */
+TEST(WhitespaceTest, StripLeadingAndTrailing)
+{
+    const std::string_view input = " \t\r\n\f value with  inner space \n";
+    const auto stripped = strip_leading_and_trailing_ascii_whitespace(input);
+    EXPECT_EQ(std::string_view(stripped.data(), stripped.size()), "value with  inner space");
+}
+
+/**
+ * @brief Test that an all-whitespace input strips to an empty view.
+ */
+TEST(WhitespaceTest, StripLeadingAndTrailingAllWhitespace)
+{
+    const std::u16string_view input = u" \t \n ";
+    EXPECT_TRUE(strip_leading_and_trailing_ascii_whitespace(input).empty());
+    EXPECT_TRUE(strip_leading_and_trailing_ascii_whitespace(std::u16string_view{}).empty());
+}
+
+/**
+ * @brief Test that non-ASCII whitespace such as U+00A0 and U+000B is not stripped.
+ */
+TEST(WhitespaceTest, StripLeadingAndTrailingKeepsNonASCIIWhitespace)
+{
+    const std::u32string_view input = U" x\u000B";
+    EXPECT_EQ(strip_leading_and_trailing_ascii_whitespace(input).size(), std::size_t{3});
+}
+
+// ---------------------------------------------------------------------------
+// Strip and collapse ASCII whitespace
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that whitespace runs collapse to one space and leading and trailing whitespace is removed.
+ */
+TEST(WhitespaceTest, StripAndCollapse)
+{
+    std::string value = "  \tfoo \n\r bar\fbaz   ";
+    strip_and_collapse_ascii_whitespace(value);
+    EXPECT_EQ(value, "foo bar baz");
+}
+
+/**
+ * @brief Test that strip and collapse empties an all-whitespace sequence.
+ */
+TEST(WhitespaceTest, StripAndCollapseAllWhitespace)
+{
+    std::u16string value = u" \t\n\f\r ";
+    strip_and_collapse_ascii_whitespace(value);
+    EXPECT_TRUE(value.empty());
+}
+
+/**
+ * @brief Test that strip and collapse leaves already-collapsed text unchanged.
+ */
+TEST(WhitespaceTest, StripAndCollapseAlreadyCollapsed)
+{
+    std::u32string value = U"one two three";
+    strip_and_collapse_ascii_whitespace(value);
+    EXPECT_EQ(value, U"one two three");
+}
+
+/**
+ * @brief Test that strip and collapse works on a ByteSequence in place.
+ */
+TEST(WhitespaceTest, StripAndCollapseByteSequence)
+{
+    ByteSequence bytes{0x20u, 0x61u, 0x09u, 0x0Au, 0x62u, 0x20u};
+    strip_and_collapse_ascii_whitespace(bytes);
+    EXPECT_EQ(bytes, (ByteSequence{0x61u, 0x20u, 0x62u}));
+}
+
+/**
+ * @brief Test that strip and collapse agrees with a naive implementation on long inputs crossing vector widths.
+ */
+TEST(WhitespaceTest, StripAndCollapseLongInputs)
+{
+    const std::string_view pieces[] = {"word", " ", "\t\t", "longer-token-that-spans-a-vector", "\n \r", "x"};
+    std::string input;
+    for (std::size_t i = 0; i < 60; ++i)
+    {
+        input += pieces[(i * 7) % 6];
+
+        std::string expected;
+        bool pending_space = false;
+        for (char c : input)
+        {
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f')
+            {
+                pending_space = !expected.empty();
+                continue;
+            }
+            if (pending_space) expected += ' ';
+            pending_space = false;
+            expected += c;
+        }
+
+        std::string value = input;
+        strip_and_collapse_ascii_whitespace(value);
+        EXPECT_EQ(value, expected);
+
+        std::u16string wide(input.begin(), input.end());
+        strip_and_collapse_ascii_whitespace(wide);
+        EXPECT_EQ(wide, std::u16string(expected.begin(), expected.end()));
+    }
+}
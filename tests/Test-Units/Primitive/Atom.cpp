@@ -0,0 +1,206 @@
+/**
+ * @file Test-Units/Primitive/Atom.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the Atom type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for the Atom type, its static atoms and its atom table.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Primitive/String/Atom.hpp>
+#include <algorithm>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+// ---------------------------------------------------------------------------
+// Interning
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that interning equal code units gives equal atoms and different code units give different atoms.
+ */
+TEST(AtomTest, EqualStringsGiveEqualAtoms)
+{
+    const Atom first{std::u16string_view{u"data-atom-test"}};
+    const Atom second{String{std::u16string_view{u"data-atom-test"}}};
+    const Atom other{std::u16string_view{u"data-atom-other"}};
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(first.string(), String{std::u16string_view{u"data-atom-test"}});
+    EXPECT_FALSE(first.is_static());
+}
+
+/**
+ * @brief Test that the representation of the interned String does not matter.
+ */
+TEST(AtomTest, RepresentationIndependent)
+{
+    String wide{std::u16string_view{u"data-atom-wide"}};
+    wide.widen();
+    EXPECT_EQ(Atom{wide}, Atom{String::from_latin1(std::string_view{"data-atom-wide"})});
+
+    const StringRopeThresholds thresholds{.min_length = 1};
+    const String rope = String::concat(String::from_latin1(std::string_view{"data-atom-"}), String{std::u16string_view{u"€"}}, thresholds);
+    EXPECT_EQ(Atom{rope}, Atom{std::u16string_view{u"data-atom-€"}});
+}
+
+/**
+ * @brief Test that the empty string is the default-constructed Atom.
+ */
+TEST(AtomTest, EmptyString)
+{
+    const Atom empty;
+    EXPECT_EQ(empty, Atom{String{}});
+    EXPECT_TRUE(empty.is_static());
+    EXPECT_TRUE(empty.string().is_empty());
+    EXPECT_EQ(empty.hash(), String{}.hash());
+}
+
+/**
+ * @brief Test that the hash of an atom equals the hash of its String, whatever the representation.
+ */
+TEST(AtomTest, HashMatchesString)
+{
+    String value{std::u16string_view{u"data-atom-hash"}};
+    EXPECT_EQ(Atom{value}.hash(), value.hash());
+    value.widen();
+    EXPECT_EQ(Atom{value}.hash(), value.hash());
+    EXPECT_EQ(Atom{StaticAtom::Class}.hash(), String{std::u16string_view{u"class"}}.hash());
+}
+
+// ---------------------------------------------------------------------------
+// Static atoms
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that interning the text of a static atom finds the static atom without adding a table entry.
+ */
+TEST(AtomTest, StaticAtomsArePreSeeded)
+{
+    const std::size_t before = Atom::dynamic_count();
+    const Atom div{std::u16string_view{u"div"}};
+    EXPECT_EQ(div, Atom{StaticAtom::Div});
+    EXPECT_TRUE(div.is_static());
+    EXPECT_EQ(Atom{String::from_latin1(std::string_view{"http://www.w3.org/1999/xhtml"})}, Atom{StaticAtom::HTMLNamespace});
+    EXPECT_EQ(Atom::dynamic_count(), before);
+}
+
+/**
+ * @brief Test that every static atom text is unique and maps back to its own enumerator.
+ */
+TEST(AtomTest, StaticAtomTextsAreUnique)
+{
+    std::set<std::u16string_view> texts;
+    for (std::size_t index = 0; index < static_atom_count; ++index)
+    {
+        EXPECT_TRUE(texts.insert(static_atom_texts[index]).second) << index;
+        const Atom atom{static_atom_texts[index]};
+        EXPECT_EQ(atom, Atom{static_cast<StaticAtom>(index)}) << index;
+        EXPECT_EQ(atom.string(), String{static_atom_texts[index]}) << index;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Atom table
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that unused entries are removed by collect_unused and used ones are kept.
+ */
+TEST(AtomTest, CollectUnused)
+{
+    Atom::collect_unused();
+    const std::size_t before = Atom::dynamic_count();
+    const Atom kept{std::u16string_view{u"data-atom-kept"}};
+    {
+        const Atom dropped{std::u16string_view{u"data-atom-dropped"}};
+        const Atom copy = dropped;
+        EXPECT_EQ(Atom::dynamic_count(), before + 2);
+    }
+    EXPECT_EQ(Atom::collect_unused(), std::size_t{1});
+    EXPECT_EQ(Atom::dynamic_count(), before + 1);
+    EXPECT_EQ(kept, Atom{std::u16string_view{u"data-atom-kept"}});
+}
+
+/**
+ * @brief Test that destroying atoms leaves their entries to the next intern, which sweeps them once enough are unused.
+ */
+TEST(AtomTest, SweepOnIntern)
+{
+    Atom::collect_unused();
+    const std::size_t before = Atom::dynamic_count();
+    {
+        std::vector<Atom> atoms;
+        for (int index = 0; index < 1100; ++index) atoms.emplace_back(String::from_latin1("data-atom-sweep-" + std::to_string(index)));
+    }
+    EXPECT_EQ(Atom::dynamic_count(), before + 1100);
+    const Atom next{std::u16string_view{u"data-atom-sweep-next"}};
+    EXPECT_EQ(Atom::dynamic_count(), before + 1);
+}
+
+/**
+ * @brief Test that assignment keeps the reference counts balanced.
+ */
+TEST(AtomTest, Assignment)
+{
+    Atom::collect_unused();
+    const std::size_t before = Atom::dynamic_count();
+    Atom atom{std::u16string_view{u"data-atom-first"}};
+    atom = Atom{std::u16string_view{u"data-atom-second"}};
+    Atom moved = std::move(atom);
+    atom = moved;
+    EXPECT_EQ(atom, Atom{std::u16string_view{u"data-atom-second"}});
+    EXPECT_EQ(Atom::collect_unused(), std::size_t{1});
+    EXPECT_EQ(Atom::dynamic_count(), before + 1);
+}
+
+/**
+ * @brief Test that threads interning the same strings concurrently agree on their atoms.
+ */
+TEST(AtomTest, ConcurrentInterning)
+{
+    constexpr std::size_t thread_count = 8;
+    constexpr std::size_t name_count = 200;
+    std::vector<std::vector<Atom>> results(thread_count);
+    std::vector<std::thread> threads;
+    for (std::size_t thread = 0; thread < thread_count; ++thread)
+    {
+        threads.emplace_back([&results, thread]
+        {
+            for (int round = 0; round < 5; ++round)
+            {
+                std::vector<Atom> atoms;
+                for (std::size_t name = 0; name < name_count; ++name)
+                {
+                    const std::string text = "data-concurrent-" + std::to_string((name + thread) % name_count);
+                    atoms.emplace_back(String::from_latin1(std::string_view{text}));
+                }
+                std::rotate(atoms.begin(), atoms.begin() + static_cast<std::ptrdiff_t>(name_count - thread), atoms.end());
+                results[thread] = std::move(atoms);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    for (std::size_t thread = 1; thread < thread_count; ++thread)
+        EXPECT_EQ(results[thread], results[0]) << thread;
+    std::unordered_set<Atom> unique(results[0].begin(), results[0].end());
+    EXPECT_EQ(unique.size(), name_count);
+}
+
+/**
+ * @brief Test that Atom and String can be used as keys of unordered containers.
+ */
+TEST(AtomTest, StdHash)
+{
+    std::unordered_set<Atom> atoms{Atom{StaticAtom::Id}, Atom{std::u16string_view{u"id"}}, Atom{StaticAtom::Name}};
+    EXPECT_EQ(atoms.size(), std::size_t{2});
+    std::unordered_set<String> strings{String{std::u16string_view{u"id"}}, String::from_latin1(std::string_view{"id"})};
+    EXPECT_EQ(strings.size(), std::size_t{1});
+}
@@ -0,0 +1,332 @@
+/**
+ * @file Test-Units/Primitive/BigInt.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the bigint_t type and the BigInt Number alias in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file checks bigint_t arithmetic against the 512-bit WideInt on operands of up to 250 bits,
+ * Karatsuba products and long division on operands of thousands of bits against shift-and-add
+ * references, the inline storage of values up to 128 bits, and decimal formatting and parsing.
+ */
+
+#include <gtest/gtest.h>
+#include <Reference.hpp>
+#include <Softloq/WHATWG/Infra/Operation/ParseInteger/ParseInteger.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Numbers/Numbers.hpp>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Exercises the arithmetic in constant evaluation, across the move from inline to heap storage.
+ */
+constexpr bool constant_arithmetic()
+{
+    const bigint_t power = bigint_t{1} << 200;
+    const bigint_t product = power * bigint_t{-3};
+    return product / power == bigint_t{-3} && product % bigint_t{7} == bigint_t{-5} && Reference::division_identity(product, bigint_t{7})
+        && (product >> 200) == bigint_t{-3} && (bigint_t{-5} >> 1) == bigint_t{-3} && bigint_t{-5} / bigint_t{2} == bigint_t{-2}
+        && bigint_t{-5} % bigint_t{2} == bigint_t{-1} && (power - power).limbs().empty() && power.bit_width() == 201
+        && (power * power).to_decimal().size() == 121;
+}
+
+static_assert(constant_arithmetic());
+static_assert(IntegralConcept<bigint_t> && std::numeric_limits<bigint_t>::is_signed && !std::numeric_limits<bigint_t>::is_bounded);
+static_assert(!FixedWidthInteger<bigint_t>);
+
+/**
+ * @brief A random int512_t of up to 250 bits, so sums and products of two never overflow the 512 bits.
+ */
+int512_t random_wide(std::mt19937_64& engine)
+{
+    uint512_t::words_type words{};
+    for (std::size_t index = 0; index < 4; ++index) words[index] = engine();
+    const int512_t value{uint512_t::from_words(words) >> static_cast<int>(6 + engine() % 256)};
+    return engine() % 2 == 0 ? value : -value;
+}
+
+/**
+ * @brief A random bigint_t of the given number of limbs, with runs of all-zero and all-one limbs mixed in.
+ */
+bigint_t random_big(std::mt19937_64& engine, std::size_t size)
+{
+    std::vector<std::uint64_t> limbs(size);
+    for (std::uint64_t& limb : limbs)
+    {
+        switch (engine() % 8)
+        {
+        case 0: limb = 0; break;
+        case 1: limb = std::numeric_limits<std::uint64_t>::max(); break;
+        default: limb = engine(); break;
+        }
+    }
+    limbs.back() |= 1;
+    return bigint_t::from_limbs(limbs, engine() % 2 == 0);
+}
+
+/**
+ * @brief Multiply one limb of the right operand at a time, which never takes the Karatsuba path.
+ */
+bigint_t reference_multiply(const bigint_t& lhs, const bigint_t& rhs)
+{
+    bigint_t product;
+    const auto limbs = rhs.limbs();
+    for (std::size_t index = 0; index < limbs.size(); ++index) product += (lhs * bigint_t{limbs[index]}) << static_cast<int>(64 * index);
+    return rhs.is_negative() ? -product : product;
+}
+
+/**
+ * @brief Write the decimal form one digit at a time, by division by ten.
+ */
+std::string reference_decimal(bigint_t value)
+{
+    const bool negative = value.is_negative();
+    std::string digits;
+    do
+    {
+        digits.insert(digits.begin(), static_cast<char>('0' + static_cast<int>(static_cast<std::int64_t>(value % bigint_t{10})) * (negative ? -1 : 1)));
+        value /= bigint_t{10};
+    } while (value);
+    return negative ? "-" + digits : digits;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Construction and storage
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test the conversions from and to the built-in and wide integers.
+ */
+TEST(BigIntTest, Conversions)
+{
+    EXPECT_EQ(bigint_t{std::numeric_limits<std::int64_t>::min()}.to_decimal(), "-9223372036854775808");
+    EXPECT_EQ(static_cast<std::int64_t>(bigint_t{std::numeric_limits<std::int64_t>::min()}), std::numeric_limits<std::int64_t>::min());
+    EXPECT_EQ(static_cast<std::uint8_t>(bigint_t{-1}), 0xFF);
+    EXPECT_EQ(static_cast<uint128_t>(bigint_t{uint128_t{5, 6}}), (uint128_t{5, 6}));
+    EXPECT_EQ(static_cast<uint128_t>(bigint_t{-2}), ~uint128_t{} - uint128_t{1});
+
+    const int512_t min{std::numeric_limits<int512_t>::min()};
+    const bigint_t big_min{min};
+    EXPECT_TRUE(big_min.is_negative());
+    EXPECT_EQ(big_min.bit_width(), 512u);
+    EXPECT_EQ(static_cast<int512_t>(big_min), min);
+    EXPECT_EQ(static_cast<int256_t>(big_min << 1), int256_t{});
+    EXPECT_EQ(static_cast<uint256_t>(bigint_t{-1}), ~uint256_t{});
+    EXPECT_EQ(bigint_t::from_limbs(std::vector<std::uint64_t>{7, 0, 0}, true), bigint_t{-7});
+    EXPECT_EQ(bigint_t::from_limbs(std::vector<std::uint64_t>{0, 0}, true), bigint_t{});
+    EXPECT_FALSE(bigint_t{-0}.is_negative());
+}
+
+/**
+ * @brief Test that magnitudes of up to 128 bits stay inside the object, and move back when a result shrinks.
+ */
+TEST(BigIntTest, InlineStorage)
+{
+    const bigint_t max128{~uint128_t{}};
+    EXPECT_TRUE(max128.is_inline());
+    EXPECT_TRUE((max128 * bigint_t{-1}).is_inline());
+    EXPECT_TRUE((bigint_t{std::numeric_limits<std::uint64_t>::max()} * bigint_t{std::numeric_limits<std::uint64_t>::max()}).is_inline());
+
+    const bigint_t wider = max128 + bigint_t{1};
+    EXPECT_FALSE(wider.is_inline());
+    EXPECT_EQ(wider.limbs().size(), 3u);
+
+    const bigint_t back = wider - bigint_t{1};
+    EXPECT_TRUE(back.is_inline());
+    EXPECT_EQ(back, max128);
+    EXPECT_TRUE((wider >> 1).is_inline());
+    EXPECT_TRUE(((wider * wider) / wider / bigint_t{2}).is_inline());
+}
+
+/**
+ * @brief Test ordering across signs and lengths.
+ */
+TEST(BigIntTest, Ordering)
+{
+    const bigint_t big = bigint_t{1} << 300;
+    EXPECT_LT(-big, bigint_t{-1});
+    EXPECT_LT(bigint_t{-1}, bigint_t{});
+    EXPECT_LT(bigint_t{}, bigint_t{1});
+    EXPECT_LT(bigint_t{~uint128_t{}}, big);
+    EXPECT_GT(-bigint_t{~uint128_t{}}, -big);
+    EXPECT_EQ(big, bigint_t{1} << 300);
+    EXPECT_NE(big, -big);
+}
+
+// ---------------------------------------------------------------------------
+// Arithmetic
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test every operator against int512_t on random operands of up to 250 bits.
+ */
+TEST(BigIntTest, RandomPairsMatchWideInt)
+{
+    std::mt19937_64 engine{49};
+    for (int i = 0; i < 5000; ++i)
+    {
+        const int512_t a = random_wide(engine);
+        const int512_t b = random_wide(engine);
+        const bigint_t lhs{a};
+        const bigint_t rhs{b};
+        ASSERT_EQ(static_cast<int512_t>(lhs), a);
+        ASSERT_EQ(static_cast<int512_t>(lhs + rhs), a + b);
+        ASSERT_EQ(static_cast<int512_t>(lhs - rhs), a - b);
+        ASSERT_EQ(static_cast<int512_t>(lhs * rhs), a * b);
+        ASSERT_EQ(lhs < rhs, a < b);
+        if (b != int512_t{})
+        {
+            ASSERT_EQ(static_cast<int512_t>(lhs / rhs), a / b) << lhs << " / " << rhs;
+            ASSERT_EQ(static_cast<int512_t>(lhs % rhs), a % b) << lhs << " % " << rhs;
+        }
+        const int shift = static_cast<int>(engine() % 200);
+        ASSERT_EQ(static_cast<int512_t>(lhs >> shift), a >> shift) << lhs << " >> " << shift;
+        ASSERT_EQ(static_cast<int512_t>(lhs << (shift / 2)), a << (shift / 2));
+    }
+}
+
+/**
+ * @brief Test Karatsuba products, balanced and unbalanced, against one-limb-at-a-time products.
+ */
+TEST(BigIntTest, KaratsubaMatchesSchoolbook)
+{
+    std::mt19937_64 engine{4900};
+    const std::size_t threshold = bigint_t::karatsuba_threshold;
+    for (const std::size_t size : {threshold - 1, threshold, threshold + 1, 2 * threshold + 3, 5 * threshold})
+    {
+        for (const std::size_t other : {size, size - 1, size / 2 + 1, size / 3})
+        {
+            const bigint_t lhs = random_big(engine, size);
+            const bigint_t rhs = random_big(engine, other);
+            ASSERT_EQ(lhs * rhs, reference_multiply(lhs, rhs)) << size << " x " << other << " limbs";
+            ASSERT_EQ(rhs * lhs, lhs * rhs);
+        }
+    }
+
+    // All-ones operands make every middle term carry.
+    const bigint_t ones = (bigint_t{1} << (64 * 3 * static_cast<int>(threshold))) - bigint_t{1};
+    EXPECT_EQ(ones * ones, (bigint_t{1} << (2 * 64 * 3 * static_cast<int>(threshold))) - (bigint_t{1} << (64 * 3 * static_cast<int>(threshold) + 1)) + bigint_t{1});
+}
+
+/**
+ * @brief Test that long division reproduces the dividend on operands of up to thousands of bits.
+ */
+TEST(BigIntTest, LongDivision)
+{
+    std::mt19937_64 engine{4901};
+    for (int i = 0; i < 300; ++i)
+    {
+        const bigint_t divisor = random_big(engine, 1 + engine() % 40);
+        const bigint_t quotient = random_big(engine, 1 + engine() % 40);
+        const bigint_t offset = random_big(engine, 1 + engine() % 40) % divisor;
+        // The remainder takes the dividend's sign, so offset it towards zero from the product.
+        const bigint_t product = quotient * divisor;
+        const bigint_t dividend = product.is_negative() == offset.is_negative() ? product + offset : product - offset;
+        bigint_t remainder;
+        ASSERT_EQ(bigint_t::divide(dividend, divisor, remainder), quotient) << dividend << " / " << divisor;
+        ASSERT_EQ(remainder.is_negative() ? -remainder : remainder, offset.is_negative() ? -offset : offset);
+    }
+
+    // Knuth's add-back case, scaled up from the WideInt test.
+    const bigint_t dividend = bigint_t::from_limbs(std::vector<std::uint64_t>{0, 0, 0x8000000000000000, 0x7FFFFFFFFFFFFFFF});
+    const bigint_t divisor = bigint_t::from_limbs(std::vector<std::uint64_t>{1, 0, 0x8000000000000000});
+    EXPECT_EQ(dividend / divisor * divisor + dividend % divisor, dividend);
+    EXPECT_LT(dividend % divisor, divisor);
+    EXPECT_THROW(static_cast<void>(dividend / bigint_t{}), std::domain_error);
+}
+
+/**
+ * @brief Test the increment and decrement operators across a limb boundary.
+ */
+TEST(BigIntTest, IncrementAndDecrement)
+{
+    bigint_t value{std::numeric_limits<std::uint64_t>::max()};
+    EXPECT_EQ((++value).limbs().size(), 2u);
+    EXPECT_EQ(value--, bigint_t{1} << 64);
+    EXPECT_EQ(value, bigint_t{std::numeric_limits<std::uint64_t>::max()});
+
+    bigint_t zero{1};
+    --zero;
+    --zero;
+    EXPECT_EQ(zero, bigint_t{-1});
+    EXPECT_EQ(++zero, bigint_t{});
+}
+
+// ---------------------------------------------------------------------------
+// Decimal conversion and the BigInt Number
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test the decimal form against division by ten, including chunks that need leading zeros.
+ */
+TEST(BigIntTest, DecimalMatchesReference)
+{
+    std::mt19937_64 engine{4902};
+    for (const std::size_t size : {1u, 2u, 3u, 4u, 7u, 20u, 33u})
+    {
+        const bigint_t value = random_big(engine, size);
+        ASSERT_EQ(value.to_decimal(), reference_decimal(value));
+    }
+
+    bigint_t power{1};
+    for (int exponent = 0; exponent < 60; ++exponent) power *= bigint_t{10};
+    EXPECT_EQ(power.to_decimal(), "1" + std::string(60, '0'));
+    EXPECT_EQ((-power - bigint_t{1}).to_decimal(), "-1" + std::string(59, '0') + "1");
+    EXPECT_EQ(bigint_t{}.to_decimal(), "0");
+}
+
+/**
+ * @brief Test that formatting and parsing a BigInt round trip for values of up to a few thousand digits.
+ */
+TEST(BigIntTest, ParseRoundTrip)
+{
+    std::mt19937_64 engine{4903};
+    for (const std::size_t size : {1u, 2u, 3u, 50u, 200u})
+    {
+        const bigint_t value = random_big(engine, size);
+        const std::string text = std::format("{}", BigInt{value});
+        const auto result = parse_integer<bigint_t>(std::string_view{text});
+        ASSERT_TRUE(result) << text;
+        ASSERT_EQ(result.position, text.size());
+        ASSERT_EQ(result.value.get_value(), value) << text;
+        ASSERT_EQ(parse_integer<bigint_t>(std::u16string{text.begin(), text.end()}).value.get_value(), value);
+    }
+
+    const auto padded = parse_integer<bigint_t>(std::string_view{"  +000123456789012345678901234567890123456789x"});
+    ASSERT_TRUE(padded);
+    EXPECT_EQ(padded.value.get_value().to_decimal(), "123456789012345678901234567890123456789");
+    EXPECT_TRUE(parse_integer<bigint_t>(std::string_view{"-0"}));
+    EXPECT_EQ(parse_integer<bigint_t>(std::string_view{"-"}).error, IntegerParseError::NoDigits);
+    EXPECT_EQ(parse_non_negative_integer<bigint_t>(std::string_view{"-99999999999999999999999"}).error, IntegerParseError::OutOfRange);
+
+    std::ostringstream oss;
+    oss << BigInt{bigint_t{1} << 64} << ' ' << -(bigint_t{1} << 128);
+    EXPECT_EQ(oss.str(), "18446744073709551616 -340282366920938463463374607431768211456");
+}
+
+/**
+ * @brief Test the BigInt Number operators.
+ */
+TEST(BigIntTest, NumberOperators)
+{
+    BigInt factorial{bigint_t{1}};
+    for (int factor = 2; factor <= 30; ++factor) factorial *= BigInt{bigint_t{factor}};
+    EXPECT_EQ(std::format("{}", factorial), "265252859812191058636308480000000");
+    EXPECT_EQ(std::format("{}", factorial / BigInt{bigint_t{30}}), "8841761993739701954543616000000");
+    EXPECT_EQ(factorial % BigInt{bigint_t{31}}, BigInt{bigint_t{30}});
+    EXPECT_LT(BigInt{} - factorial, BigInt{});
+}
@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 #include <Softloq/WHATWG/Infra/Primitive/Boolean/Boolean.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/PrimitiveRef.hpp>
 #include <sstream>
 
 using namespace Softloq::WHATWG::Infra;
@@ -28,13 +29,13 @@ TEST(BooleanPrimitiveTest, BooleanType)
 }
 
 /**
- * @brief Test that get_type() returns PrimitiveType::Boolean when accessed through the base class pointer.
+ * @brief Test that get_type() returns PrimitiveType::Boolean when accessed through a PrimitiveRef.
  */
 TEST(BooleanPrimitiveTest, PolymorphicType)
 {
     Boolean b;
-    const Primitive* base = &b;
-    EXPECT_EQ(base->get_type(), PrimitiveType::Boolean);
+    const PrimitiveRef base = b;
+    EXPECT_EQ(base.get_type(), PrimitiveType::Boolean);
 }
 
 // ---------------------------------------------------------------------------
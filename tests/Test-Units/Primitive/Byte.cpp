@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 #include <Softloq/WHATWG/Infra/Primitive/Byte/Byte.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/PrimitiveRef.hpp>
 #include <limits>
 #include <sstream>
 
@@ -29,13 +30,13 @@ TEST(BytePrimitiveTest, ByteType)
 }
 
 /**
- * @brief Test that get_type() returns PrimitiveType::Byte when accessed through the base class pointer.
+ * @brief Test that get_type() returns PrimitiveType::Byte when accessed through a PrimitiveRef.
  */
 TEST(BytePrimitiveTest, PolymorphicType)
 {
     Byte b;
-    const Primitive* base = &b;
-    EXPECT_EQ(base->get_type(), PrimitiveType::Byte);
+    const PrimitiveRef base = b;
+    EXPECT_EQ(base.get_type(), PrimitiveType::Byte);
 }
 
 // ---------------------------------------------------------------------------
@@ -10,8 +10,10 @@
 
 #include <gtest/gtest.h>
 #include <Softloq/WHATWG/Infra/Primitive/ByteSequence/ByteSequence.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/PrimitiveRef.hpp>
 #include <sstream>
 #include <stdexcept>
+#include <string>
 
 using namespace Softloq::WHATWG::Infra;
 
@@ -29,13 +31,13 @@ TEST(ByteSequencePrimitiveTest, ByteSequenceType)
 }
 
 /**
- * @brief Test that get_type() returns PrimitiveType::ByteSequence when accessed through the base class pointer.
+ * @brief Test that get_type() returns PrimitiveType::ByteSequence when accessed through a PrimitiveRef.
  */
 TEST(ByteSequencePrimitiveTest, PolymorphicType)
 {
     ByteSequence bs;
-    const Primitive* base = &bs;
-    EXPECT_EQ(base->get_type(), PrimitiveType::ByteSequence);
+    const PrimitiveRef base = bs;
+    EXPECT_EQ(base.get_type(), PrimitiveType::ByteSequence);
 }
 
 // ---------------------------------------------------------------------------
@@ -309,6 +311,30 @@ TEST(ByteSequencePrimitiveTest, Clear_ThenPushBack)
     EXPECT_EQ(bs[0].get_value(), std::uint8_t{0xFF});
 }
 
+// ---------------------------------------------------------------------------
+// Container interface — resize
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that resize() to a smaller size keeps the leading bytes.
+ */
+TEST(ByteSequencePrimitiveTest, Resize_Shrink)
+{
+    ByteSequence bs{0x01u, 0x02u, 0x03u};
+    bs.resize(2);
+    EXPECT_EQ(bs, (ByteSequence{0x01u, 0x02u}));
+}
+
+/**
+ * @brief Test that resize() to a larger size appends 0x00 bytes.
+ */
+TEST(ByteSequencePrimitiveTest, Resize_Grow)
+{
+    ByteSequence bs{0x01u};
+    bs.resize(3);
+    EXPECT_EQ(bs, (ByteSequence{0x01u, 0x00u, 0x00u}));
+}
+
 // ---------------------------------------------------------------------------
 // Container interface — iteration
 // ---------------------------------------------------------------------------
@@ -686,6 +712,30 @@ TEST(ByteSequencePrimitiveTest, StartsWith_EmptyDoesNotStartWithNonEmpty)
     EXPECT_FALSE(empty.starts_with(bs));
 }
 
+// ---------------------------------------------------------------------------
+// Isomorphic decode
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that isomorphic decode maps every byte to the code unit of equal value.
+ */
+TEST(ByteSequencePrimitiveTest, IsomorphicDecode)
+{
+    ByteSequence bs{0x41u, 0x00u, 0xE9u, 0xFFu};
+    const String decoded = bs.isomorphic_decode();
+    EXPECT_TRUE(decoded.is_8bit());
+    EXPECT_EQ(decoded.to_utf16(), (std::u16string{u'A', u'\0', u'é', u'ÿ'}));
+}
+
+/**
+ * @brief Test that isomorphic decode of an empty sequence is the empty String.
+ */
+TEST(ByteSequencePrimitiveTest, IsomorphicDecode_Empty)
+{
+    ByteSequence empty;
+    EXPECT_TRUE(empty.isomorphic_decode().is_empty());
+}
+
 // ---------------------------------------------------------------------------
 // Formatting
 // ---------------------------------------------------------------------------
@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 #include <Softloq/WHATWG/Infra/Primitive/CodePoint/CodePoint.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/PrimitiveRef.hpp>
 #include <sstream>
 
 using namespace Softloq::WHATWG::Infra;
@@ -28,13 +29,13 @@ TEST(CodePointPrimitiveTest, CodePointType)
 }
 
 /**
- * @brief Test that get_type() returns PrimitiveType::CodePoint when accessed through the base class pointer.
+ * @brief Test that get_type() returns PrimitiveType::CodePoint when accessed through a PrimitiveRef.
  */
 TEST(CodePointPrimitiveTest, PolymorphicType)
 {
     CodePoint cp;
-    const Primitive* base = &cp;
-    EXPECT_EQ(base->get_type(), PrimitiveType::CodePoint);
+    const PrimitiveRef base = cp;
+    EXPECT_EQ(base.get_type(), PrimitiveType::CodePoint);
 }
 
 // ---------------------------------------------------------------------------
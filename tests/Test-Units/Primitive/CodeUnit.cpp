@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 #include <Softloq/WHATWG/Infra/Primitive/CodeUnit/CodeUnit.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/PrimitiveRef.hpp>
 #include <sstream>
 
 using namespace Softloq::WHATWG::Infra;
@@ -28,13 +29,13 @@ TEST(CodeUnitPrimitiveTest, CodeUnitType)
 }
 
 /**
- * @brief Test that get_type() returns PrimitiveType::CodeUnit when accessed through the base class pointer.
+ * @brief Test that get_type() returns PrimitiveType::CodeUnit when accessed through a PrimitiveRef.
  */
 TEST(CodeUnitPrimitiveTest, PolymorphicType)
 {
     CodeUnit cu;
-    const Primitive* base = &cu;
-    EXPECT_EQ(base->get_type(), PrimitiveType::CodeUnit);
+    const PrimitiveRef base = cu;
+    EXPECT_EQ(base.get_type(), PrimitiveType::CodeUnit);
 }
 
 // ---------------------------------------------------------------------------
@@ -0,0 +1,185 @@
+/**
+ * @file Test-Units/Primitive/Decimal.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the decimal formatting of integers in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file checks write_decimal() against std::to_chars at every digit-count boundary and over
+ * random values, and checks the 128-bit path against repeated division by ten.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Primitive/Numbers/Numbers.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/Decimal.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Format with write_decimal().
+ */
+template <typename T>
+std::string decimal(T value)
+{
+    char buffer[max_decimal_length<T>];
+    return std::string(buffer, write_decimal(buffer, value));
+}
+
+/**
+ * @brief Format with std::to_chars.
+ */
+template <typename T>
+std::string to_chars_decimal(T value)
+{
+    char buffer[64];
+    return std::string(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+}
+
+/**
+ * @brief Format a uint128_t by repeated division by ten.
+ */
+std::string reference_decimal(uint128_t value)
+{
+    std::string digits;
+    do
+    {
+        digits.push_back(static_cast<char>('0' + (value % uint128_t{10}).low()));
+        value /= uint128_t{10};
+    } while (value);
+    std::ranges::reverse(digits);
+    return digits;
+}
+
+/**
+ * @brief Check every power of ten that fits in T, and its neighbours, against std::to_chars.
+ */
+template <typename T>
+void expect_boundaries_match()
+{
+    for (T power = 1;; power = static_cast<T>(power * 10))
+    {
+        for (const T value : {static_cast<T>(power - 1), power, static_cast<T>(power + 1)})
+        {
+            EXPECT_EQ(decimal(value), to_chars_decimal(value));
+            if constexpr (std::numeric_limits<T>::is_signed) EXPECT_EQ(decimal(static_cast<T>(-value)), to_chars_decimal(static_cast<T>(-value)));
+        }
+        if (power > std::numeric_limits<T>::max() / 10) break;
+    }
+    EXPECT_EQ(decimal(std::numeric_limits<T>::min()), to_chars_decimal(std::numeric_limits<T>::min()));
+    EXPECT_EQ(decimal(std::numeric_limits<T>::max()), to_chars_decimal(std::numeric_limits<T>::max()));
+    EXPECT_LE(decimal(std::numeric_limits<T>::min()).size(), max_decimal_length<T>);
+}
+
+/**
+ * @brief Writes a value in constant evaluation and compares it with the expected text.
+ */
+template <typename T>
+constexpr bool writes(T value, std::string_view expected)
+{
+    char buffer[max_decimal_length<T>]{};
+    return std::string_view(buffer, write_decimal(buffer, value)) == expected;
+}
+
+static_assert(writes(std::uint32_t{4294967295}, "4294967295"));
+static_assert(writes(std::int64_t{-9000000000000000001}, "-9000000000000000001"));
+static_assert(writes(uint128_t(0x4B3B4CA85A86C47A, 0x098A224000000000), "100000000000000000000000000000000000000"));
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Built-in integers
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test every width at each digit-count boundary, including the minimum and maximum.
+ */
+TEST(DecimalTest, BoundariesMatchToChars)
+{
+    expect_boundaries_match<std::int8_t>();
+    expect_boundaries_match<std::uint8_t>();
+    expect_boundaries_match<std::int16_t>();
+    expect_boundaries_match<std::uint16_t>();
+    expect_boundaries_match<std::int32_t>();
+    expect_boundaries_match<std::uint32_t>();
+    expect_boundaries_match<std::int64_t>();
+    expect_boundaries_match<std::uint64_t>();
+}
+
+/**
+ * @brief Test random values of every digit count against std::to_chars.
+ */
+TEST(DecimalTest, RandomValuesMatchToChars)
+{
+    std::mt19937_64 engine{2026};
+    for (int i = 0; i < 200000; ++i)
+    {
+        const std::uint64_t value = engine() >> (engine() % 64);
+        ASSERT_EQ(decimal(value), to_chars_decimal(value));
+        ASSERT_EQ(decimal(static_cast<std::uint32_t>(value)), to_chars_decimal(static_cast<std::uint32_t>(value)));
+        ASSERT_EQ(decimal(static_cast<std::int64_t>(value)), to_chars_decimal(static_cast<std::int64_t>(value)));
+        ASSERT_EQ(decimal(-static_cast<std::int32_t>(value >> 33)), to_chars_decimal(-static_cast<std::int32_t>(value >> 33)));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 128-bit integers
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test the 128-bit path around the 10^19 chunk boundaries and at the maximum.
+ */
+TEST(DecimalTest, UInt128ChunkBoundaries)
+{
+    const uint128_t ten_pow_19{10000000000000000000ULL};
+    const uint128_t ten_pow_38 = ten_pow_19 * ten_pow_19;
+    for (const uint128_t& power : {ten_pow_19, ten_pow_38, uint128_t(1, 0)})
+    {
+        EXPECT_EQ(decimal(power - uint128_t{1}), reference_decimal(power - uint128_t{1}));
+        EXPECT_EQ(decimal(power), reference_decimal(power));
+        EXPECT_EQ(decimal(power + uint128_t{1}), reference_decimal(power + uint128_t{1}));
+    }
+    EXPECT_EQ(decimal(ten_pow_38), "1" + std::string(38, '0'));
+    EXPECT_EQ(decimal(ten_pow_19 * ten_pow_19 + uint128_t{7}), "1" + std::string(37, '0') + "7");
+    EXPECT_EQ(decimal(uint128_t(~0ULL, ~0ULL)), "340282366920938463463374607431768211455");
+    EXPECT_EQ(decimal(uint128_t{}), "0");
+}
+
+/**
+ * @brief Test random 128-bit values against repeated division by ten.
+ */
+TEST(DecimalTest, UInt128RandomValues)
+{
+    std::mt19937_64 engine{2026};
+    for (int i = 0; i < 20000; ++i)
+    {
+        const uint128_t value{engine() >> (engine() % 64), engine()};
+        ASSERT_EQ(decimal(value), reference_decimal(value));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Number formatting
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that std::format and operator<< write UInt128 and uint128_t in decimal.
+ */
+TEST(DecimalTest, UInt128FormatAndStream)
+{
+    const UInt128 value{uint128_t(1, 0)};
+    EXPECT_EQ(std::format("{}", value), "18446744073709551616");
+    std::ostringstream oss;
+    oss << value << ' ' << uint128_t{42};
+    EXPECT_EQ(oss.str(), "18446744073709551616 42");
+}
@@ -0,0 +1,236 @@
+/**
+ * @file Test-Units/Primitive/Divider.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the Divider type template in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file checks Divider against operator/ and operator% exhaustively for the 8-bit types, for every
+ * 16-bit divisor, and on edge and random operands for the 32-bit to 512-bit types, and checks the
+ * Number and NumberArray operations that take a Divider.
+ */
+
+#include <gtest/gtest.h>
+#include <Reference.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/Divider.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/NumberArray.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Numbers/Numbers.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+static_assert(Divider<std::uint32_t>{7}.divide(100) == 14);
+static_assert(Divider<std::int32_t>{-7}.modulo(-100) == -2);
+static_assert(Divider<uint128_t>{uint128_t{10}}.divide(uint128_t{1, 0}) == uint128_t{0x1999999999999999});
+
+/**
+ * @brief A value in a form the failure messages can print, promoting the 8-bit types so they print as numbers.
+ */
+template <typename T>
+auto printable(const T& value)
+{
+    if constexpr (std::integral<T>)
+        return +value;
+    else
+        return value;
+}
+
+/**
+ * @brief Check the quotient and remainder of one dividend against operator/ and operator%.
+ *
+ * INT_MIN / -1 overflows the built-in operator, so its expected quotient is the wrapped INT_MIN.
+ */
+template <typename T>
+void expect_divides(const Divider<T>& divider, T dividend)
+{
+    using U = divider_unsigned_t<T>;
+    const T divisor = divider.get_divisor();
+    T quotient = dividend;
+    T remainder{};
+    if (!std::numeric_limits<T>::is_signed || divisor != from_unsigned<T>(static_cast<U>(~U{})))
+    {
+        quotient = static_cast<T>(dividend / divisor);
+        remainder = static_cast<T>(dividend % divisor);
+    }
+    else
+        quotient = from_unsigned<T>(static_cast<U>(U{} - to_unsigned(dividend)));
+    ASSERT_EQ(divider.divide(dividend), quotient) << "dividend " << printable(dividend) << ", divisor " << printable(divisor);
+    ASSERT_EQ(divider.modulo(dividend), remainder) << "dividend " << printable(dividend) << ", divisor " << printable(divisor);
+}
+
+/**
+ * @brief A random value of T whose magnitude is spread over every bit length.
+ */
+template <typename T>
+T random_value(std::mt19937_64& engine)
+{
+    using U = divider_unsigned_t<T>;
+    U bits{};
+    for (std::size_t word = 0; word < (sizeof(U) + 7) / 8; ++word) bits = static_cast<U>(static_cast<U>(bits << (sizeof(U) > 8 ? 64 : 0)) | static_cast<U>(engine()));
+    return from_unsigned<T>(static_cast<U>(bits >> static_cast<int>(engine() % (8 * sizeof(U)))));
+}
+
+/**
+ * @brief Check every pair of edge values and random values, with the edge values and random values as divisors.
+ */
+template <typename T>
+void expect_divides_edges_and_random(std::uint64_t seed, int random_count)
+{
+    std::mt19937_64 engine{seed};
+    std::vector<T> divisors = Reference::edge_values<T>();
+    std::vector<T> dividends = Reference::edge_values<T>();
+    for (int index = 0; index < random_count; ++index)
+    {
+        divisors.push_back(random_value<T>(engine));
+        dividends.push_back(random_value<T>(engine));
+    }
+    for (const T divisor : divisors)
+    {
+        if (to_unsigned(divisor) == divider_unsigned_t<T>{}) continue;
+        const Divider<T> divider{divisor};
+        for (const T dividend : dividends) ASSERT_NO_FATAL_FAILURE(expect_divides(divider, dividend));
+    }
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Built-in widths
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test every dividend and divisor of the 8-bit types.
+ */
+TEST(DividerTest, ExhaustiveEightBit)
+{
+    for (int divisor = 1; divisor <= 255; ++divisor)
+    {
+        const Divider<std::uint8_t> divider{static_cast<std::uint8_t>(divisor)};
+        for (int dividend = 0; dividend <= 255; ++dividend) ASSERT_NO_FATAL_FAILURE(expect_divides(divider, static_cast<std::uint8_t>(dividend)));
+    }
+    for (int divisor = -128; divisor <= 127; ++divisor)
+    {
+        if (divisor == 0) continue;
+        const Divider<std::int8_t> divider{static_cast<std::int8_t>(divisor)};
+        for (int dividend = -128; dividend <= 127; ++dividend) ASSERT_NO_FATAL_FAILURE(expect_divides(divider, static_cast<std::int8_t>(dividend)));
+    }
+}
+
+/**
+ * @brief Test every 16-bit divisor against the dividends around it, the limits and a random sample.
+ */
+TEST(DividerTest, EverySixteenBitDivisor)
+{
+    std::mt19937_64 engine{48};
+    std::vector<std::uint16_t> sample;
+    for (int index = 0; index < 8; ++index) sample.push_back(static_cast<std::uint16_t>(engine()));
+    for (int divisor = 1; divisor <= 0xFFFF; ++divisor)
+    {
+        const Divider<std::uint16_t> unsigned_divider{static_cast<std::uint16_t>(divisor)};
+        const Divider<std::int16_t> signed_divider{static_cast<std::int16_t>(divisor)};
+        std::vector<std::uint16_t> dividends = sample;
+        for (const int dividend : {0, 1, divisor - 1, divisor, divisor + 1, 2 * divisor - 1, 2 * divisor, 0x7FFF, 0x8000, 0xFFFF})
+            dividends.push_back(static_cast<std::uint16_t>(dividend));
+        for (const std::uint16_t dividend : dividends)
+        {
+            ASSERT_NO_FATAL_FAILURE(expect_divides(unsigned_divider, dividend));
+            ASSERT_NO_FATAL_FAILURE(expect_divides(signed_divider, static_cast<std::int16_t>(dividend)));
+        }
+    }
+}
+
+/**
+ * @brief Test the 32-bit and 64-bit types on edge and random operands.
+ */
+TEST(DividerTest, ThirtyTwoAndSixtyFourBit)
+{
+    expect_divides_edges_and_random<std::uint32_t>(1, 200);
+    expect_divides_edges_and_random<std::int32_t>(2, 200);
+    expect_divides_edges_and_random<std::uint64_t>(3, 200);
+    expect_divides_edges_and_random<std::int64_t>(4, 200);
+}
+
+/**
+ * @brief Test that a zero divisor throws.
+ */
+TEST(DividerTest, ZeroThrows)
+{
+    EXPECT_THROW(Divider<std::uint32_t>{0u}, std::invalid_argument);
+    EXPECT_THROW(Divider<std::int8_t>{Int8{0}}, std::invalid_argument);
+    EXPECT_THROW(Divider<uint128_t>{uint128_t{}}, std::invalid_argument);
+    EXPECT_THROW(Divider<int256_t>{int256_t{}}, std::invalid_argument);
+}
+
+// ---------------------------------------------------------------------------
+// Wide widths
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test uint128_t and the 128-bit to 512-bit WideInt types on edge and random operands.
+ */
+TEST(DividerTest, WideIntegers)
+{
+    expect_divides_edges_and_random<uint128_t>(5, 100);
+    expect_divides_edges_and_random<int128_t>(6, 100);
+    expect_divides_edges_and_random<uint256_t>(7, 40);
+    expect_divides_edges_and_random<int256_t>(8, 40);
+    expect_divides_edges_and_random<uint512_t>(9, 20);
+    expect_divides_edges_and_random<int512_t>(10, 20);
+}
+
+// ---------------------------------------------------------------------------
+// Numbers and NumberArrays
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test the Number operators that take a Divider.
+ */
+TEST(DividerTest, NumberOperators)
+{
+    const Divider<std::int64_t> divider{Int64{-1000}};
+    EXPECT_EQ(divider.get_divisor(), -1000);
+    EXPECT_EQ(Int64{123456} / divider, Int64{-123});
+    EXPECT_EQ(Int64{-123456} % divider, Int64{-456});
+
+    UInt128 value{uint128_t{1, 0}};
+    value /= Divider<uint128_t>{uint128_t{1} << 60};
+    EXPECT_EQ(value, UInt128{uint128_t{16}});
+    value %= Divider<uint128_t>{uint128_t{3}};
+    EXPECT_EQ(value, UInt128{uint128_t{1}});
+}
+
+/**
+ * @brief Test that NumberArray division and modulo, and the in-place run kernels, match dividing one element at a time.
+ */
+TEST(DividerTest, NumberArrayColumns)
+{
+    std::mt19937_64 engine{480};
+    NumberArray<std::int32_t> column;
+    for (int index = 0; index < 1000; ++index) column.append(Int32{static_cast<std::int32_t>(engine())});
+
+    for (const std::int32_t divisor : {1, -1, 7, -7, 64, 1000000, std::numeric_limits<std::int32_t>::min()})
+    {
+        const Divider<std::int32_t> divider{divisor};
+        const NumberArray<std::int32_t> quotients = column.divide(divider);
+        const NumberArray<std::int32_t> remainders = column.modulo(divider);
+        ASSERT_EQ(quotients.size(), column.size());
+        for (std::size_t index = 0; index < column.size(); ++index)
+        {
+            ASSERT_EQ(quotients[index], column[index] / divider);
+            ASSERT_EQ(remainders[index], column[index] % divider);
+        }
+
+        NumberArray<std::int32_t> in_place = column;
+        divider.modulo(in_place.data(), in_place.size(), in_place.data());
+        ASSERT_EQ(in_place, remainders);
+    }
+    EXPECT_TRUE(NumberArray<std::uint64_t>{}.divide(Divider<std::uint64_t>{3u}).is_empty());
+}
@@ -0,0 +1,218 @@
+/**
+ * @file Test-Units/Primitive/Double.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the shortest decimal formatting of doubles and the Double Number alias in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file checks shortest_decimal() against the shortest scientific output of std::to_chars on
+ * random, subnormal, integral and power-of-two doubles, the ECMAScript Number::toString layout of
+ * write_number_string(), and the Double formatter, stream operator and arithmetic.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Primitive/Numbers/Numbers.hpp>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Whether write_number_string() writes the expected text, in constant evaluation too.
+ */
+constexpr bool writes(double value, std::string_view expected)
+{
+    char buffer[max_number_string_length]{};
+    const char* end = write_number_string(buffer, value);
+    return std::string_view{buffer, static_cast<std::size_t>(end - buffer)} == expected;
+}
+
+static_assert(shortest_decimal(0.3) == DecimalDouble{3, -1});
+static_assert(shortest_decimal(5e-324) == DecimalDouble{5, -324});
+static_assert(shortest_decimal(1e23) == DecimalDouble{1, 23});
+static_assert(writes(0.1 + 0.2, "0.30000000000000004") && writes(-1e21, "-1e+21") && writes(1.5e-7, "1.5e-7"));
+
+/**
+ * @brief Write a double with write_number_string().
+ */
+std::string number_string(double value)
+{
+    char buffer[max_number_string_length];
+    char* end = write_number_string(buffer, value);
+    return std::string{buffer, end};
+}
+
+/**
+ * @brief The shortest decimal of a positive finite double, from the shortest scientific output of std::to_chars.
+ */
+DecimalDouble to_chars_decimal(double value)
+{
+    char buffer[32];
+    const char* end = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::scientific).ptr;
+    const std::string_view text{buffer, static_cast<std::size_t>(end - buffer)};
+    const std::size_t e = text.find('e');
+    std::uint64_t significand = 0;
+    int fraction_digits = 0;
+    for (std::size_t index = 0; index < e; ++index)
+    {
+        if (text[index] == '.') continue;
+        significand = significand * 10 + static_cast<std::uint64_t>(text[index] - '0');
+        if (index > 1) ++fraction_digits;
+    }
+    int exponent = 0;
+    std::from_chars(text.data() + e + (text[e + 1] == '+' ? 2 : 1), end, exponent);
+    while (significand % 10 == 0)
+    {
+        significand /= 10;
+        --fraction_digits;
+    }
+    return {significand, exponent - fraction_digits};
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Shortest decimal
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that shortest_decimal() matches std::to_chars on random bit patterns, normal and subnormal.
+ */
+TEST(DoubleTest, ShortestMatchesToChars)
+{
+    std::mt19937_64 engine{2026};
+    for (int run = 0; run < 200000; ++run)
+    {
+        std::uint64_t bits = engine() & 0x7FFFFFFFFFFFFFFFULL;
+        if (run % 8 == 0) bits &= 0x000FFFFFFFFFFFFFULL;
+        const double value = std::bit_cast<double>(bits);
+        if (!std::isfinite(value) || value == 0) continue;
+        ASSERT_EQ(shortest_decimal(value), to_chars_decimal(value)) << std::bit_cast<std::uint64_t>(value);
+    }
+}
+
+/**
+ * @brief Test the powers of two, whose lower neighbour is closer, and the integers, which skip the scaling.
+ */
+TEST(DoubleTest, PowersOfTwoAndIntegers)
+{
+    for (int exponent = -1074; exponent <= 1023; ++exponent)
+    {
+        const double value = std::ldexp(1.0, exponent);
+        ASSERT_EQ(shortest_decimal(value), to_chars_decimal(value)) << exponent;
+    }
+    std::mt19937_64 engine{7};
+    for (int run = 0; run < 10000; ++run)
+    {
+        const auto integer = static_cast<double>((engine() >> (11 + engine() % 53)) | 1);
+        ASSERT_EQ(shortest_decimal(integer), to_chars_decimal(integer)) << integer;
+    }
+    EXPECT_EQ(shortest_decimal(9007199254740992.0), (DecimalDouble{9007199254740992, 0}));
+    EXPECT_EQ(shortest_decimal(1000.0), (DecimalDouble{1, 3}));
+    EXPECT_EQ(shortest_decimal(0.0), DecimalDouble{});
+}
+
+/**
+ * @brief Test the extremes: the smallest subnormal and normal doubles and the largest double.
+ */
+TEST(DoubleTest, Extremes)
+{
+    EXPECT_EQ(shortest_decimal(std::numeric_limits<double>::denorm_min()), (DecimalDouble{5, -324}));
+    EXPECT_EQ(shortest_decimal(std::numeric_limits<double>::min()), (DecimalDouble{22250738585072014, -324}));
+    EXPECT_EQ(shortest_decimal(std::numeric_limits<double>::max()), (DecimalDouble{17976931348623157, 292}));
+}
+
+// ---------------------------------------------------------------------------
+// Number strings
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test the layouts of ECMAScript's Number::toString: positional from 1e-7 to 1e21, exponential outside.
+ */
+TEST(DoubleTest, NumberStrings)
+{
+    EXPECT_EQ(number_string(0.0), "0");
+    EXPECT_EQ(number_string(-0.0), "0");
+    EXPECT_EQ(number_string(1.0), "1");
+    EXPECT_EQ(number_string(-42.0), "-42");
+    EXPECT_EQ(number_string(123.456), "123.456");
+    EXPECT_EQ(number_string(0.5), "0.5");
+    EXPECT_EQ(number_string(0.000001), "0.000001");
+    EXPECT_EQ(number_string(0.0000001), "1e-7");
+    EXPECT_EQ(number_string(1.2345e-7), "1.2345e-7");
+    EXPECT_EQ(number_string(1e20), "100000000000000000000");
+    EXPECT_EQ(number_string(123456789012345680000.0), "123456789012345680000");
+    EXPECT_EQ(number_string(1e21), "1e+21");
+    EXPECT_EQ(number_string(1.5e300), "1.5e+300");
+    EXPECT_EQ(number_string(5e-324), "5e-324");
+    EXPECT_EQ(number_string(-std::numeric_limits<double>::max()), "-1.7976931348623157e+308");
+    EXPECT_EQ(number_string(-0.00000123456789012345678), "-0.0000012345678901234567");
+    EXPECT_EQ(number_string(-0.0000001234567890123456), "-1.234567890123456e-7");
+}
+
+/**
+ * @brief Test NaN and the infinities.
+ */
+TEST(DoubleTest, SpecialValues)
+{
+    EXPECT_EQ(number_string(std::numeric_limits<double>::quiet_NaN()), "NaN");
+    EXPECT_EQ(number_string(std::numeric_limits<double>::infinity()), "Infinity");
+    EXPECT_EQ(number_string(-std::numeric_limits<double>::infinity()), "-Infinity");
+}
+
+/**
+ * @brief Test that no string is longer than max_number_string_length.
+ */
+TEST(DoubleTest, LongestString)
+{
+    EXPECT_EQ(number_string(-0.0000012345678901234567).size(), max_number_string_length);
+    std::mt19937_64 engine{11};
+    for (int run = 0; run < 100000; ++run) ASSERT_LE(number_string(std::bit_cast<double>(engine())).size(), max_number_string_length);
+}
+
+// ---------------------------------------------------------------------------
+// Double
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that std::format and operator<< write Double as ECMAScript does, whatever the stream precision.
+ */
+TEST(DoubleTest, FormatAndStream)
+{
+    EXPECT_EQ(std::format("{}", Double{0.1}), "0.1");
+    EXPECT_EQ(std::format("{}", Double{1e21}), "1e+21");
+
+    std::ostringstream stream;
+    stream.precision(3);
+    stream << Double{3.14159} << ' ' << Double{-2.5e-9} << ' ' << Double{std::numeric_limits<double>::infinity()};
+    EXPECT_EQ(stream.str(), "3.14159 -2.5e-9 Infinity");
+}
+
+/**
+ * @brief Test the Number operators on Double.
+ */
+TEST(DoubleTest, NumberOperators)
+{
+    Double value{1.5};
+    value += Double{2.25};
+    EXPECT_EQ(value.get_value(), 3.75);
+    EXPECT_EQ((value / Double{2.0}).get_value(), 1.875);
+    EXPECT_EQ((value * Double{-2.0}).get_value(), -7.5);
+    EXPECT_EQ((value++).get_value(), 3.75);
+    EXPECT_EQ((--value).get_value(), 3.75);
+    EXPECT_TRUE(Double{0.1} < Double{0.2});
+    EXPECT_TRUE(Double{0.0} == Double{-0.0});
+    EXPECT_FALSE(Double{std::numeric_limits<double>::quiet_NaN()} == Double{std::numeric_limits<double>::quiet_NaN()});
+    EXPECT_EQ(Double{}.get_type(), PrimitiveType::Number);
+}
@@ -0,0 +1,134 @@
+/**
+ * @file Test-Units/Primitive/IsomorphicStringView.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the IsomorphicStringView type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for the IsomorphicStringView type.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Primitive/String/IsomorphicStringView.hpp>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Build a ByteSequence from the bytes of a string literal.
+ */
+ByteSequence bytes_of(std::string_view text)
+{
+    ByteSequence bytes;
+    for (char c : text) bytes.push_back(Byte{static_cast<std::uint8_t>(c)});
+    return bytes;
+}
+
+static_assert(std::is_constructible_v<IsomorphicStringView, const ByteSequence&>);
+static_assert(!std::is_constructible_v<IsomorphicStringView, ByteSequence>, "a view of a temporary would dangle");
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Element access
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that the code units of the view are the values of the bytes.
+ */
+TEST(IsomorphicStringViewTest, CodeUnitsAreByteValues)
+{
+    const ByteSequence bytes = bytes_of("a\xE9\xFF");
+    const IsomorphicStringView view{bytes};
+    EXPECT_EQ(view.size(), std::size_t{3});
+    EXPECT_FALSE(view.is_empty());
+    EXPECT_EQ(view[0], CodeUnit{0x0061});
+    EXPECT_EQ(view[1], CodeUnit{0x00E9});
+    EXPECT_EQ(view.at(2), CodeUnit{0x00FF});
+    EXPECT_THROW((void)view.at(3), std::out_of_range);
+}
+
+/**
+ * @brief Test that the view reflects changes to the viewed ByteSequence.
+ */
+TEST(IsomorphicStringViewTest, ViewsLiveBytes)
+{
+    ByteSequence bytes = bytes_of("gzip");
+    const IsomorphicStringView view{bytes};
+    bytes.byte_uppercase();
+    EXPECT_EQ(view, std::u16string_view{u"GZIP"});
+    bytes.clear();
+    EXPECT_TRUE(view.is_empty());
+}
+
+// ---------------------------------------------------------------------------
+// Comparison
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that the view equals Strings with the decoded code units, whatever their representation.
+ */
+TEST(IsomorphicStringViewTest, EqualsString)
+{
+    const ByteSequence bytes = bytes_of("caf\xE9");
+    const IsomorphicStringView view{bytes};
+    String narrow{std::u16string_view{u"café"}};
+    EXPECT_TRUE(view == narrow);
+    String wide = narrow;
+    wide.widen();
+    EXPECT_TRUE(view == wide);
+    EXPECT_TRUE(wide == view);
+    EXPECT_TRUE(view != String{std::u16string_view{u"cafe"}});
+    EXPECT_TRUE(view != String{std::u16string_view{u"café!"}});
+    EXPECT_EQ(view.to_string(), narrow);
+}
+
+/**
+ * @brief Test that code units above 0x00FF never equal a byte.
+ */
+TEST(IsomorphicStringViewTest, WideCodeUnitsNeverMatch)
+{
+    const ByteSequence bytes = bytes_of("\xAC");
+    const IsomorphicStringView view{bytes};
+    EXPECT_FALSE(view == std::u16string_view{u"€"});
+    EXPECT_EQ(view.find(CodeUnit{0x20AC}), IsomorphicStringView::npos);
+}
+
+/**
+ * @brief Test that two views compare by their bytes.
+ */
+TEST(IsomorphicStringViewTest, EqualsView)
+{
+    const ByteSequence first = bytes_of("text/html");
+    const ByteSequence second = bytes_of("text/html");
+    const ByteSequence third = bytes_of("text/xml");
+    EXPECT_EQ(IsomorphicStringView{first}, IsomorphicStringView{second});
+    EXPECT_NE(IsomorphicStringView{first}, IsomorphicStringView{third});
+}
+
+// ---------------------------------------------------------------------------
+// Searching
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test starts_with and find on a decoded header value.
+ */
+TEST(IsomorphicStringViewTest, Search)
+{
+    const ByteSequence bytes = bytes_of("text/html; charset=utf-8");
+    const IsomorphicStringView view{bytes};
+    EXPECT_TRUE(view.starts_with(String{std::u16string_view{u"text/"}}));
+    EXPECT_FALSE(view.starts_with(String{std::u16string_view{u"text/xml"}}));
+    EXPECT_EQ(view.find(CodeUnit{0x003B}), std::size_t{9});
+    EXPECT_EQ(view.find(CodeUnit{0x0074}, 1), std::size_t{3});
+    EXPECT_EQ(view.find(String{std::u16string_view{u"charset="}}), std::size_t{11});
+    EXPECT_EQ(view.find(String{std::u16string_view{u"charset="}}, 12), IsomorphicStringView::npos);
+    EXPECT_EQ(view.find(String{std::u16string_view{u"utf-8"}}), bytes.size() - 5);
+    EXPECT_EQ(view.find(String{}, 4), std::size_t{4});
+    EXPECT_EQ(view.find(String{}, bytes.size() + 1), IsomorphicStringView::npos);
+}
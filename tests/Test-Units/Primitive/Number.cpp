@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 #include <Softloq/WHATWG/Infra/Primitive/Numbers/Numbers.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/PrimitiveRef.hpp>
 #include <limits>
 #include <sstream>
 
@@ -92,13 +93,13 @@ TEST(NumberPrimitiveTest, Int64Type)
 }
 
 /**
- * @brief Test that get_type() returns PrimitiveType::Number through the base class pointer.
+ * @brief Test that get_type() returns PrimitiveType::Number through a PrimitiveRef.
  */
 TEST(NumberPrimitiveTest, PolymorphicType)
 {
     Int32 n;
-    const Primitive* base = &n;
-    EXPECT_EQ(base->get_type(), PrimitiveType::Number);
+    const PrimitiveRef base = n;
+    EXPECT_EQ(base.get_type(), PrimitiveType::Number);
 }
 
 // ---------------------------------------------------------------------------
@@ -0,0 +1,240 @@
+/**
+ * @file Test-Units/Primitive/NumberArray.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the NumberArray type and the columnar kernels in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file checks the vectorized columnar kernels against their portable versions for every
+ * fixed-width integer, and checks the NumberArray element access, reductions and transforms.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Primitive/Number/NumberArray.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Numbers/Numbers.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr Comparison comparisons[] = {
+    Comparison::Equal, Comparison::NotEqual, Comparison::Less, Comparison::LessEqual, Comparison::Greater, Comparison::GreaterEqual};
+
+/**
+ * @brief Random values of T, drawn from a narrow range about once in four runs so that equal values and long kept or dropped runs occur.
+ */
+template <typename T>
+std::vector<T> random_values(std::mt19937_64& engine, std::size_t size)
+{
+    const bool narrow = engine() % 4 == 0;
+    std::vector<T> values(size);
+    for (T& value : values) value = narrow ? static_cast<T>(engine() % 3) : static_cast<T>(engine());
+    return values;
+}
+
+/**
+ * @brief Check every vectorized kernel against its portable version on random runs of every length up to 200.
+ */
+template <typename T>
+void expect_kernels_match(std::uint64_t seed)
+{
+    std::mt19937_64 engine{seed};
+    for (std::size_t size = 0; size <= 200; ++size)
+    {
+        const std::vector<T> values = random_values<T>(engine, size);
+        const T* data = values.data();
+        ASSERT_EQ(SIMD::column_sum(data, size), SIMD::ColumnPortable::sum(data, size)) << "size " << size;
+        if (size != 0)
+        {
+            ASSERT_EQ(SIMD::column_min(data, size), SIMD::ColumnPortable::min(data, size)) << "size " << size;
+            ASSERT_EQ(SIMD::column_max(data, size), SIMD::ColumnPortable::max(data, size)) << "size " << size;
+        }
+
+        std::vector<T> scanned(size), expected_scan(size);
+        SIMD::column_prefix_sum(data, size, scanned.data());
+        SIMD::ColumnPortable::prefix_sum(data, size, expected_scan.data());
+        ASSERT_EQ(scanned, expected_scan) << "size " << size;
+
+        const T value = size != 0 && engine() % 2 == 0 ? values[engine() % size] : static_cast<T>(engine() % 3);
+        for (const Comparison comparison : comparisons)
+        {
+            std::vector<std::uint8_t> mask(size), expected_mask(size);
+            ASSERT_EQ(SIMD::column_compare(data, size, comparison, value, mask.data()),
+                      SIMD::ColumnPortable::compare(data, size, comparison, value, expected_mask.data()))
+                << "size " << size << " comparison " << static_cast<int>(comparison);
+            ASSERT_EQ(mask, expected_mask) << "size " << size << " comparison " << static_cast<int>(comparison);
+            ASSERT_EQ(SIMD::column_count(data, size, comparison, value), SIMD::ColumnPortable::count(data, size, comparison, value))
+                << "size " << size << " comparison " << static_cast<int>(comparison);
+
+            std::vector<T> kept(size), expected_kept(size);
+            kept.resize(SIMD::column_filter(data, size, mask.data(), kept.data()));
+            expected_kept.resize(SIMD::ColumnPortable::filter(data, size, expected_mask.data(), expected_kept.data()));
+            ASSERT_EQ(kept, expected_kept) << "size " << size;
+        }
+    }
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Columnar kernels
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that the vectorized kernels agree with the portable ones for the signed integers.
+ */
+TEST(NumberArrayTest, KernelsMatchPortableSigned)
+{
+    expect_kernels_match<std::int8_t>(1);
+    expect_kernels_match<std::int16_t>(2);
+    expect_kernels_match<std::int32_t>(3);
+    expect_kernels_match<std::int64_t>(4);
+}
+
+/**
+ * @brief Test that the vectorized kernels agree with the portable ones for the unsigned integers.
+ */
+TEST(NumberArrayTest, KernelsMatchPortableUnsigned)
+{
+    expect_kernels_match<std::uint8_t>(5);
+    expect_kernels_match<std::uint16_t>(6);
+    expect_kernels_match<std::uint32_t>(7);
+    expect_kernels_match<std::uint64_t>(8);
+}
+
+/**
+ * @brief Test sums that leave the range of the element type, and long runs whose partial sums are flushed in blocks.
+ */
+TEST(NumberArrayTest, KernelSumWidens)
+{
+    const std::vector<std::int8_t> bytes(1000, -128);
+    EXPECT_EQ(SIMD::column_sum(bytes.data(), bytes.size()), -128000);
+    const std::vector<std::uint16_t> halves(300001, 65535);
+    EXPECT_EQ(SIMD::column_sum(halves.data(), halves.size()), 65535ULL * 300001);
+    const std::vector<std::int16_t> signed_halves(300001, -32768);
+    EXPECT_EQ(SIMD::column_sum(signed_halves.data(), signed_halves.size()), -32768LL * 300001);
+    const std::vector<std::uint32_t> words(17, 4294967295u);
+    EXPECT_EQ(SIMD::column_sum(words.data(), words.size()), 4294967295ULL * 17);
+    const std::vector<std::int64_t> wide{std::numeric_limits<std::int64_t>::max(), 1};
+    EXPECT_EQ(SIMD::column_sum(wide.data(), wide.size()), std::numeric_limits<std::int64_t>::min());
+}
+
+// ---------------------------------------------------------------------------
+// NumberArray
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test construction and element access through Numbers.
+ */
+TEST(NumberArrayTest, ElementAccess)
+{
+    NumberArray<std::int32_t> array{4, -7, 12};
+    EXPECT_EQ(array.size(), 3u);
+    EXPECT_FALSE(array.is_empty());
+    EXPECT_EQ(array[1], Int32{-7});
+    EXPECT_EQ(array.at(2).get_value(), 12);
+    EXPECT_THROW(static_cast<void>(array.at(3)), std::out_of_range);
+
+    array.set(0, Int32{40});
+    array.append(Int32{5});
+    EXPECT_EQ(array, (NumberArray<std::int32_t>{40, -7, 12, 5}));
+    EXPECT_THROW(array.set(4, Int32{0}), std::out_of_range);
+    array.data()[1] = 70;
+    EXPECT_EQ(array.values()[1], 70);
+
+    std::int32_t total = 0;
+    for (const Int32& number : array.numbers()) total += number.get_value();
+    EXPECT_EQ(total, 127);
+
+    EXPECT_EQ(NumberArray<std::uint8_t>(3, UInt8{9}), (NumberArray<std::uint8_t>{9, 9, 9}));
+    array.clear();
+    EXPECT_TRUE(array.is_empty());
+}
+
+/**
+ * @brief Test sum, min and max, including an empty array.
+ */
+TEST(NumberArrayTest, Reductions)
+{
+    const NumberArray<std::int16_t> array{300, -32768, 32767, 5};
+    EXPECT_EQ(array.sum(), Int64{304});
+    EXPECT_EQ(array.min(), Int16{-32768});
+    EXPECT_EQ(array.max(), Int16{32767});
+
+    const NumberArray<std::uint64_t> empty;
+    EXPECT_EQ(empty.sum(), UInt64{0});
+    EXPECT_THROW(static_cast<void>(empty.min()), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(empty.max()), std::out_of_range);
+}
+
+/**
+ * @brief Test prefix sums, which wrap in the element type.
+ */
+TEST(NumberArrayTest, PrefixSum)
+{
+    EXPECT_EQ((NumberArray<std::int32_t>{1, 2, 3, -10}.prefix_sum()), (NumberArray<std::int32_t>{1, 3, 6, -4}));
+    EXPECT_EQ((NumberArray<std::uint8_t>{200, 100}.prefix_sum()), (NumberArray<std::uint8_t>{200, 44}));
+    EXPECT_TRUE(NumberArray<std::int64_t>{}.prefix_sum().is_empty());
+}
+
+/**
+ * @brief Test compare masks, counts and filters, by mask and fused.
+ */
+TEST(NumberArrayTest, CompareAndFilter)
+{
+    const NumberArray<std::int32_t> array{5, -1, 8, 5, 0, 12};
+    const NumberArray<std::uint8_t> mask = array.compare(Comparison::GreaterEqual, Int32{5});
+    EXPECT_EQ(mask, (NumberArray<std::uint8_t>{1, 0, 1, 1, 0, 1}));
+    EXPECT_EQ(mask.sum(), UInt64{4});
+    EXPECT_EQ(array.count(Comparison::Equal, Int32{5}), 2u);
+    EXPECT_EQ(array.count(Comparison::Less, Int32{0}), 1u);
+    EXPECT_EQ(array.filter(mask), (NumberArray<std::int32_t>{5, 8, 5, 12}));
+    EXPECT_EQ(array.filter(Comparison::NotEqual, Int32{5}), (NumberArray<std::int32_t>{-1, 8, 0, 12}));
+    EXPECT_THROW(static_cast<void>(array.filter(NumberArray<std::uint8_t>{1, 0})), std::invalid_argument);
+}
+
+/**
+ * @brief Test that a fused filter over several blocks keeps the same elements as a filter by a whole mask.
+ */
+TEST(NumberArrayTest, FilterAcrossBlocks)
+{
+    std::mt19937_64 engine{44};
+    NumberArray<std::uint16_t> array;
+    for (int index = 0; index < 20000; ++index) array.append(UInt16{static_cast<std::uint16_t>(engine())});
+    const NumberArray<std::uint16_t> kept = array.filter(Comparison::Less, UInt16{1000});
+    EXPECT_EQ(kept, array.filter(array.compare(Comparison::Less, UInt16{1000})));
+    EXPECT_EQ(kept.size(), array.count(Comparison::Less, UInt16{1000}));
+    EXPECT_LT(kept.max(), UInt16{1000});
+}
+
+/**
+ * @brief Test the portable path taken for uint128_t elements.
+ */
+TEST(NumberArrayTest, UInt128Elements)
+{
+    const uint128_t max = ~uint128_t{};
+    const NumberArray<uint128_t> array{max, uint128_t{2}, uint128_t{1, 0}};
+    EXPECT_EQ(array.sum(), (UInt128{uint128_t{1, 1}}));
+    EXPECT_EQ(array.min(), UInt128{uint128_t{2}});
+    EXPECT_EQ(array.max(), UInt128{max});
+    EXPECT_EQ(array.prefix_sum(), (NumberArray<uint128_t>{max, uint128_t{1}, uint128_t{1, 1}}));
+    EXPECT_EQ(array.filter(Comparison::Greater, UInt128{uint128_t{2}}), (NumberArray<uint128_t>{max, uint128_t{1, 0}}));
+}
+
+/**
+ * @brief Test the portable path taken for WideInt elements, which are summed in their own width.
+ */
+TEST(NumberArrayTest, WideIntElements)
+{
+    const NumberArray<int256_t> array{int256_t{-5}, int256_t{1} << 200, int256_t{7}};
+    EXPECT_EQ(array.sum(), Int256{(int256_t{1} << 200) + int256_t{2}});
+    EXPECT_EQ(array.min(), Int256{int256_t{-5}});
+    EXPECT_EQ(array.max(), Int256{int256_t{1} << 200});
+    EXPECT_EQ(array.count(Comparison::Less, Int256{int256_t{}}), 1u);
+}
@@ -0,0 +1,233 @@
+/**
+ * @file Test-Units/Primitive/Overflow.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the checked, saturating and wrapping arithmetic of Number in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file checks overflowing_add(), overflowing_sub() and overflowing_mul(), with and without the
+ * compiler builtins, against exact arithmetic on a wider type, and checks the Number member families.
+ */
+
+#include <gtest/gtest.h>
+#include <Reference.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Numbers/Numbers.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/Overflow.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Check both implementations of the three operations on one pair against the exact results, computed in 64 bits.
+ */
+template <typename T>
+void expect_exact(T lhs, T rhs)
+{
+    // Unsigned operands are widened unsigned, so a negative difference wraps to a value above the maximum.
+    using Wide = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+    const auto out_of_range = [](Wide exact) {
+        if constexpr (std::is_signed_v<T>)
+            return exact < std::numeric_limits<T>::min() || exact > std::numeric_limits<T>::max();
+        else
+            return exact > std::numeric_limits<T>::max();
+    };
+    const Wide sum = static_cast<Wide>(lhs) + static_cast<Wide>(rhs);
+    const Wide difference = static_cast<Wide>(lhs) - static_cast<Wide>(rhs);
+    const Wide product = static_cast<Wide>(lhs) * static_cast<Wide>(rhs);
+
+    T result{};
+    ASSERT_EQ(overflowing_add(lhs, rhs, result), out_of_range(sum)) << +lhs << " + " << +rhs;
+    ASSERT_EQ(result, static_cast<T>(sum));
+    ASSERT_EQ(OverflowPortable::add(lhs, rhs, result), out_of_range(sum)) << +lhs << " + " << +rhs;
+    ASSERT_EQ(result, static_cast<T>(sum));
+    ASSERT_EQ(overflowing_sub(lhs, rhs, result), out_of_range(difference)) << +lhs << " - " << +rhs;
+    ASSERT_EQ(result, static_cast<T>(difference));
+    ASSERT_EQ(OverflowPortable::sub(lhs, rhs, result), out_of_range(difference)) << +lhs << " - " << +rhs;
+    ASSERT_EQ(result, static_cast<T>(difference));
+    ASSERT_EQ(overflowing_mul(lhs, rhs, result), out_of_range(product)) << +lhs << " * " << +rhs;
+    ASSERT_EQ(result, static_cast<T>(product));
+    ASSERT_EQ(OverflowPortable::mul(lhs, rhs, result), out_of_range(product)) << +lhs << " * " << +rhs;
+    ASSERT_EQ(result, static_cast<T>(product));
+}
+
+/**
+ * @brief Check that the portable implementations agree with the dispatching ones on one pair.
+ */
+template <typename T>
+void expect_portable_agrees(T lhs, T rhs)
+{
+    T expected{};
+    T result{};
+    ASSERT_EQ(OverflowPortable::add(lhs, rhs, result), overflowing_add(lhs, rhs, expected));
+    ASSERT_EQ(result, expected);
+    ASSERT_EQ(OverflowPortable::sub(lhs, rhs, result), overflowing_sub(lhs, rhs, expected));
+    ASSERT_EQ(result, expected);
+    ASSERT_EQ(OverflowPortable::mul(lhs, rhs, result), overflowing_mul(lhs, rhs, expected));
+    ASSERT_EQ(result, expected);
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Overflow detection
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test every pair of 8-bit operands against exact arithmetic.
+ */
+TEST(OverflowTest, Exhaustive8Bit)
+{
+    for (int lhs = 0; lhs < 256; ++lhs)
+    {
+        for (int rhs = 0; rhs < 256; ++rhs)
+        {
+            expect_exact(static_cast<std::uint8_t>(lhs), static_cast<std::uint8_t>(rhs));
+            expect_exact(static_cast<std::int8_t>(lhs), static_cast<std::int8_t>(rhs));
+        }
+    }
+}
+
+/**
+ * @brief Test random and edge 16-bit and 32-bit operands against exact arithmetic.
+ */
+TEST(OverflowTest, Random16And32Bit)
+{
+    std::mt19937_64 engine{43};
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint64_t bits = engine();
+        const int shift = static_cast<int>(engine() % 32);
+        expect_exact(static_cast<std::uint16_t>(bits), static_cast<std::uint16_t>(bits >> 16 >> (shift % 16)));
+        expect_exact(static_cast<std::int16_t>(bits), static_cast<std::int16_t>(static_cast<std::int16_t>(bits >> 16) >> (shift % 16)));
+        expect_exact(static_cast<std::uint32_t>(bits), static_cast<std::uint32_t>(bits >> 32 >> shift));
+        expect_exact(static_cast<std::int32_t>(bits), static_cast<std::int32_t>(static_cast<std::int32_t>(bits >> 32) >> shift));
+    }
+    for (const std::int32_t lhs : Reference::edge_values<std::int32_t>())
+        for (const std::int32_t rhs : Reference::edge_values<std::int32_t>()) expect_exact(lhs, rhs);
+    for (const std::uint32_t lhs : Reference::edge_values<std::uint32_t>())
+        for (const std::uint32_t rhs : Reference::edge_values<std::uint32_t>()) expect_exact(lhs, rhs);
+}
+
+/**
+ * @brief Test that the portable 64-bit and 128-bit implementations agree with the builtins on random and edge operands.
+ */
+TEST(OverflowTest, Portable64And128Bit)
+{
+    std::mt19937_64 engine{44};
+    for (int i = 0; i < 100000; ++i)
+    {
+        const int shift = static_cast<int>(engine() % 64);
+        const std::uint64_t lhs = engine() >> shift;
+        const std::uint64_t rhs = engine() >> (63 - shift);
+        expect_portable_agrees(lhs, rhs);
+        expect_portable_agrees(static_cast<std::int64_t>(lhs), static_cast<std::int64_t>(rhs));
+        expect_portable_agrees(static_cast<std::int64_t>(lhs) >> 1, -(static_cast<std::int64_t>(rhs) >> 1));
+        expect_portable_agrees(uint128_t{engine(), engine()} >> (2 * shift), uint128_t{engine(), engine()} >> (127 - 2 * shift));
+    }
+    for (const std::int64_t lhs : Reference::edge_values<std::int64_t>())
+        for (const std::int64_t rhs : Reference::edge_values<std::int64_t>()) expect_portable_agrees(lhs, rhs);
+    for (const std::uint64_t lhs : Reference::edge_values<std::uint64_t>())
+        for (const std::uint64_t rhs : Reference::edge_values<std::uint64_t>()) expect_portable_agrees(lhs, rhs);
+}
+
+/**
+ * @brief Test 64-bit and 128-bit overflow at the exact boundaries.
+ */
+TEST(OverflowTest, WideBoundaries)
+{
+    std::int64_t signed_result = 0;
+    EXPECT_FALSE(overflowing_mul<std::int64_t>(-3037000499, 3037000499, signed_result));
+    EXPECT_TRUE(overflowing_mul<std::int64_t>(std::numeric_limits<std::int64_t>::min(), -1, signed_result));
+    EXPECT_EQ(signed_result, std::numeric_limits<std::int64_t>::min());
+    EXPECT_FALSE(overflowing_mul<std::int64_t>(std::numeric_limits<std::int64_t>::min() / 2, 2, signed_result));
+    EXPECT_TRUE(overflowing_mul<std::int64_t>(std::numeric_limits<std::int64_t>::max() / 2 + 1, 2, signed_result));
+
+    const uint128_t max = ~uint128_t{};
+    uint128_t result;
+    EXPECT_TRUE(overflowing_add(max, uint128_t{1}, result));
+    EXPECT_EQ(result, uint128_t{});
+    EXPECT_TRUE(overflowing_sub(uint128_t{}, uint128_t{1}, result));
+    EXPECT_EQ(result, max);
+    EXPECT_FALSE(overflowing_mul(uint128_t{1, 0}, uint128_t{0xFFFFFFFFFFFFFFFF}, result));
+    EXPECT_EQ(result, uint128_t(0xFFFFFFFFFFFFFFFF, 0));
+    EXPECT_TRUE(overflowing_mul(uint128_t{1, 0}, uint128_t{1, 0}, result));
+    EXPECT_EQ(result, uint128_t{});
+    EXPECT_TRUE(OverflowPortable::mul(uint128_t{1, 0}, uint128_t{1, 0}, result));
+    EXPECT_TRUE(OverflowPortable::mul(max, uint128_t{2}, result));
+    EXPECT_EQ(result, max - uint128_t{1});
+}
+
+/**
+ * @brief Test that the operations can be evaluated at compile time.
+ */
+TEST(OverflowTest, Constexpr)
+{
+    constexpr bool checks = [] {
+        std::int32_t result = 0;
+        const bool overflow = overflowing_add<std::int32_t>(std::numeric_limits<std::int32_t>::max(), 1, result);
+        uint128_t wide;
+        return overflow && result == std::numeric_limits<std::int32_t>::min()
+            && OverflowPortable::mul(~uint128_t{}, ~uint128_t{}, wide) && wide == uint128_t{1};
+    }();
+    static_assert(checks);
+    EXPECT_TRUE(checks);
+}
+
+// ---------------------------------------------------------------------------
+// Number families
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that checked operations return the wrapped value and the overflow flag.
+ */
+TEST(OverflowTest, CheckedFamily)
+{
+    const auto [sum, sum_overflow] = UInt8{200}.checked_add(UInt8{100});
+    EXPECT_TRUE(sum_overflow);
+    EXPECT_EQ(sum.get_value(), 44u);
+    const auto [difference, difference_overflow] = Int32{-5}.checked_sub(Int32{10});
+    EXPECT_FALSE(difference_overflow);
+    EXPECT_EQ(difference.get_value(), -15);
+    const auto product = UInt64{1ULL << 32}.checked_mul(UInt64{1ULL << 32});
+    EXPECT_TRUE(product.overflow);
+    EXPECT_EQ(product.value.get_value(), 0u);
+    EXPECT_FALSE(UInt128{uint128_t{1ULL << 63}}.checked_mul(UInt128{uint128_t{2}}).overflow);
+}
+
+/**
+ * @brief Test that saturating operations clamp to the bound in the direction of the overflow.
+ */
+TEST(OverflowTest, SaturatingFamily)
+{
+    EXPECT_EQ(UInt8{200}.saturating_add(UInt8{100}).get_value(), 255u);
+    EXPECT_EQ(UInt8{10}.saturating_sub(UInt8{20}).get_value(), 0u);
+    EXPECT_EQ(UInt16{300}.saturating_mul(UInt16{300}).get_value(), 65535u);
+    EXPECT_EQ(Int8{100}.saturating_add(Int8{100}).get_value(), 127);
+    EXPECT_EQ(Int8{-100}.saturating_add(Int8{-100}).get_value(), -128);
+    EXPECT_EQ(Int8{-100}.saturating_sub(Int8{100}).get_value(), -128);
+    EXPECT_EQ(Int8{100}.saturating_sub(Int8{-100}).get_value(), 127);
+    EXPECT_EQ(Int32{-65536}.saturating_mul(Int32{65536}).get_value(), std::numeric_limits<std::int32_t>::min());
+    EXPECT_EQ(Int64{std::numeric_limits<std::int64_t>::min()}.saturating_mul(Int64{-1}).get_value(), std::numeric_limits<std::int64_t>::max());
+    EXPECT_EQ(Int32{7}.saturating_mul(Int32{-6}).get_value(), -42);
+    EXPECT_EQ(UInt128{~uint128_t{}}.saturating_add(UInt128{uint128_t{1}}).get_value(), ~uint128_t{});
+    EXPECT_EQ(UInt128{uint128_t{}}.saturating_sub(UInt128{uint128_t{1}}).get_value(), uint128_t{});
+}
+
+/**
+ * @brief Test that wrapping operations wrap modulo 2^N, for signed types too.
+ */
+TEST(OverflowTest, WrappingFamily)
+{
+    EXPECT_EQ(Int32{std::numeric_limits<std::int32_t>::max()}.wrapping_add(Int32{1}).get_value(), std::numeric_limits<std::int32_t>::min());
+    EXPECT_EQ(Int64{std::numeric_limits<std::int64_t>::min()}.wrapping_sub(Int64{1}).get_value(), std::numeric_limits<std::int64_t>::max());
+    EXPECT_EQ(Int16{256}.wrapping_mul(Int16{256}).get_value(), 0);
+    EXPECT_EQ(UInt32{0}.wrapping_sub(UInt32{1}).get_value(), std::numeric_limits<std::uint32_t>::max());
+    EXPECT_EQ(UInt128{~uint128_t{}}.wrapping_mul(UInt128{~uint128_t{}}).get_value(), uint128_t{1});
+}
@@ -0,0 +1,116 @@
+/**
+ * @file Test-Units/Primitive/Primitive.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the Primitive base class template and the PrimitiveRef type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file checks the static primitive type trait, the layout of the value primitives, and the
+ * runtime type queries of PrimitiveRef.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Primitives/Primitives.hpp>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Whether T can be copied with memcpy and passed in registers, and is no larger than its value.
+ */
+template <typename T, typename Value>
+constexpr bool is_bare_value = std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T> && sizeof(T) == sizeof(Value);
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Static type trait
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that every primitive type reports its PrimitiveType at compile time.
+ */
+TEST(PrimitiveTest, StaticType)
+{
+    static_assert(primitive_type_v<Null> == PrimitiveType::Null);
+    static_assert(primitive_type_v<Boolean> == PrimitiveType::Boolean);
+    static_assert(primitive_type_v<Byte> == PrimitiveType::Byte);
+    static_assert(primitive_type_v<ByteSequence> == PrimitiveType::ByteSequence);
+    static_assert(primitive_type_v<CodePoint> == PrimitiveType::CodePoint);
+    static_assert(primitive_type_v<CodeUnit> == PrimitiveType::CodeUnit);
+    static_assert(primitive_type_v<String> == PrimitiveType::String);
+    static_assert(primitive_type_v<Int8> == PrimitiveType::Number);
+    static_assert(primitive_type_v<UInt128> == PrimitiveType::Number);
+    static_assert(Byte::get_type() == PrimitiveType::Byte);
+    static_assert(!PrimitiveConcept<int>);
+
+    const CodeUnit unit{0x41};
+    EXPECT_EQ(unit.get_type(), PrimitiveType::CodeUnit);
+}
+
+/**
+ * @brief Test that the value primitives are trivially copyable and exactly as large as their values.
+ */
+TEST(PrimitiveTest, ValueLayout)
+{
+    static_assert(std::is_empty_v<Null> && std::is_trivially_copyable_v<Null>);
+    static_assert(is_bare_value<Boolean, bool>);
+    static_assert(is_bare_value<Byte, std::uint8_t>);
+    static_assert(is_bare_value<CodePoint, char32_t>);
+    static_assert(is_bare_value<CodeUnit, std::uint16_t>);
+    static_assert(is_bare_value<Int8, std::int8_t>);
+    static_assert(is_bare_value<UInt16, std::uint16_t>);
+    static_assert(is_bare_value<Int32, std::int32_t>);
+    static_assert(is_bare_value<UInt64, std::uint64_t>);
+    static_assert(is_bare_value<UInt128, uint128_t>);
+    static_assert(is_bare_value<Double, double>);
+
+    const std::vector<Int32> numbers{Int32{1}, Int32{2}, Int32{3}};
+    EXPECT_EQ(reinterpret_cast<const std::int32_t*>(numbers.data())[2], 3);
+}
+
+// ---------------------------------------------------------------------------
+// PrimitiveRef
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test the type of a PrimitiveRef and the casts back to the referred type.
+ */
+TEST(PrimitiveTest, RefCasts)
+{
+    const Int32 number{-5};
+    const PrimitiveRef ref = number;
+    EXPECT_EQ(ref.get_type(), PrimitiveType::Number);
+    EXPECT_TRUE(ref.holds<Int32>());
+    EXPECT_FALSE(ref.holds<UInt32>());
+    ASSERT_NE(ref.get_if<Int32>(), nullptr);
+    EXPECT_EQ(ref.get_if<Int32>()->get_value(), -5);
+    EXPECT_EQ(ref.get_if<UInt32>(), nullptr);
+    EXPECT_EQ(ref.get_if<Byte>(), nullptr);
+    EXPECT_EQ(ref, PrimitiveRef{number});
+
+    static_assert(std::is_convertible_v<Int32&, PrimitiveRef>);
+    static_assert(!std::is_convertible_v<Int32, PrimitiveRef> && !std::is_constructible_v<PrimitiveRef, const Int32&&>, "a reference to a temporary would dangle");
+}
+
+/**
+ * @brief Test a sequence of references to primitives of mixed types.
+ */
+TEST(PrimitiveTest, RefSequence)
+{
+    const Null null;
+    const Boolean boolean{true};
+    const String string{u"text"};
+    const UInt8 number{7};
+    const std::vector<PrimitiveRef> refs{null, boolean, string, number};
+
+    const PrimitiveType expected[] = {PrimitiveType::Null, PrimitiveType::Boolean, PrimitiveType::String, PrimitiveType::Number};
+    for (std::size_t index = 0; index < refs.size(); ++index) EXPECT_EQ(refs[index].get_type(), expected[index]);
+    EXPECT_EQ(refs[2].get_if<String>(), &string);
+    EXPECT_TRUE(refs[1].get_if<Boolean>()->get_value());
+}
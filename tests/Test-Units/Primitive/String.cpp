@@ -0,0 +1,743 @@
+/**
+ * @file Test-Units/Primitive/String.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the String primitive type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for the String primitive type in the WHATWG Infra library.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Primitive/String/String.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/PrimitiveRef.hpp>
+#include <format>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+// ---------------------------------------------------------------------------
+// Type identity
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that get_type() returns PrimitiveType::String, also through a PrimitiveRef.
+ */
+TEST(StringPrimitiveTest, StringType)
+{
+    String s;
+    const PrimitiveRef base = s;
+    EXPECT_EQ(s.get_type(), PrimitiveType::String);
+    EXPECT_EQ(base.get_type(), PrimitiveType::String);
+}
+
+// ---------------------------------------------------------------------------
+// Construction and representation
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that the default-constructed String is empty and 8-bit.
+ */
+TEST(StringPrimitiveTest, DefaultConstructorIsEmpty)
+{
+    String s;
+    EXPECT_TRUE(s.is_empty());
+    EXPECT_EQ(s.size(), std::size_t{0});
+    EXPECT_TRUE(s.is_8bit());
+}
+
+/**
+ * @brief Test that UTF-16 input whose code units all fit in a byte is stored 8-bit.
+ */
+TEST(StringPrimitiveTest, UTF16ConstructionNarrows)
+{
+    String s{std::u16string_view{u"café"}};
+    EXPECT_TRUE(s.is_8bit());
+    EXPECT_EQ(s.latin1_span().size(), std::size_t{4});
+    EXPECT_TRUE(s.utf16_span().empty());
+    EXPECT_EQ(s.to_utf16(), u"café");
+}
+
+/**
+ * @brief Test that UTF-16 input with a code unit above 0x00FF is stored as UTF-16, at every position across vector widths.
+ */
+TEST(StringPrimitiveTest, UTF16ConstructionKeepsWide)
+{
+    for (std::size_t position = 0; position < 40; ++position)
+    {
+        std::u16string units(40, u'a');
+        units[position] = u'Ā';
+        String s{units};
+        EXPECT_FALSE(s.is_8bit()) << position;
+        EXPECT_EQ(s.to_utf16(), units) << position;
+    }
+}
+
+/**
+ * @brief Test that code point input encodes supplementary code points as surrogate pairs.
+ */
+TEST(StringPrimitiveTest, CodePointConstruction)
+{
+    String s{std::u32string_view{U"a\U0001F600"}};
+    EXPECT_FALSE(s.is_8bit());
+    EXPECT_EQ(s.to_utf16(), u"a\U0001F600");
+    EXPECT_EQ(s.size(), std::size_t{3});
+    EXPECT_TRUE(String{std::u32string_view{U"ÿ"}}.is_8bit());
+}
+
+/**
+ * @brief Test that from_latin1 maps every byte to the code unit of equal value.
+ */
+TEST(StringPrimitiveTest, FromLatin1)
+{
+    const String s = String::from_latin1(std::string_view{"\xE9\x41"});
+    EXPECT_TRUE(s.is_8bit());
+    EXPECT_EQ(s[0], CodeUnit{0x00E9});
+    EXPECT_EQ(s[1], CodeUnit{0x0041});
+}
+
+/**
+ * @brief Test that widen and try_narrow switch representations without changing the code units.
+ */
+TEST(StringPrimitiveTest, WidenAndNarrow)
+{
+    String s{std::u16string_view{u"abc"}};
+    s.widen();
+    EXPECT_FALSE(s.is_8bit());
+    EXPECT_EQ(s.to_utf16(), u"abc");
+    EXPECT_TRUE(s.try_narrow());
+    EXPECT_TRUE(s.is_8bit());
+    EXPECT_EQ(s.to_utf16(), u"abc");
+
+    String wide{std::u16string_view{u"€"}};
+    EXPECT_FALSE(wide.try_narrow());
+    EXPECT_FALSE(wide.is_8bit());
+}
+
+// ---------------------------------------------------------------------------
+// Element access and mutation
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that at() returns code units and throws when out of range.
+ */
+TEST(StringPrimitiveTest, At)
+{
+    const String s{std::u16string_view{u"x€"}};
+    EXPECT_EQ(s.at(1), CodeUnit{0x20AC});
+    EXPECT_THROW((void)s.at(2), std::out_of_range);
+}
+
+/**
+ * @brief Test that push_back stays 8-bit for small code units and widens for larger ones.
+ */
+TEST(StringPrimitiveTest, PushBack)
+{
+    String s;
+    s.push_back(CodeUnit{0x0041});
+    EXPECT_TRUE(s.is_8bit());
+    s.push_back(CodeUnit{0xD83D});
+    EXPECT_FALSE(s.is_8bit());
+    s.push_back(CodeUnit{0x0042});
+    EXPECT_EQ(s.to_utf16(), (std::u16string{u'A', char16_t{0xD83D}, u'B'}));
+}
+
+/**
+ * @brief Test that appending widens only when the appended String is not 8-bit.
+ */
+TEST(StringPrimitiveTest, Append)
+{
+    String s = String::from_latin1(std::string_view{"ab"});
+    s.append(String::from_latin1(std::string_view{"cd"}));
+    EXPECT_TRUE(s.is_8bit());
+    s.append(String{std::u16string_view{u"π"}});
+    EXPECT_FALSE(s.is_8bit());
+    s.append(String::from_latin1(std::string_view{"e"}));
+    EXPECT_EQ(s.to_utf16(), u"abcdπe");
+}
+
+/**
+ * @brief Test that a String appended to itself doubles, in 8-bit, UTF-16 and slice storage.
+ */
+TEST(StringPrimitiveTest, AppendSelf)
+{
+    String latin1 = String::from_latin1(std::string_view{"abc"});
+    latin1.append(latin1);
+    EXPECT_TRUE(latin1.is_8bit());
+    EXPECT_EQ(latin1, String::from_latin1(std::string_view{"abcabc"}));
+
+    String wide{std::u16string_view{u"aπ€"}};
+    wide.append(wide);
+    EXPECT_EQ(wide.to_utf16(), u"aπ€aπ€");
+
+    String text = String::from_latin1(std::string(64, 'a') + std::string(64, 'b'));
+    String slice = text.code_unit_substring(32, 64);
+    ASSERT_TRUE(slice.is_slice());
+    slice.append(slice);
+    EXPECT_FALSE(slice.is_slice());
+    EXPECT_EQ(slice, String::from_latin1(std::string(32, 'a') + std::string(32, 'b') + std::string(32, 'a') + std::string(32, 'b')));
+    EXPECT_EQ(text.size(), std::size_t{128});
+}
+
+/**
+ * @brief Test that clear empties the String and returns it to the 8-bit representation.
+ */
+TEST(StringPrimitiveTest, Clear)
+{
+    String s{std::u16string_view{u"€"}};
+    s.clear();
+    EXPECT_TRUE(s.is_empty());
+    EXPECT_TRUE(s.is_8bit());
+}
+
+// ---------------------------------------------------------------------------
+// Comparison and visiting
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that equality ignores the representation.
+ */
+TEST(StringPrimitiveTest, EqualityAcrossRepresentations)
+{
+    String narrow{std::u16string_view{u"hello"}};
+    String wide = narrow;
+    wide.widen();
+    EXPECT_EQ(narrow, wide);
+    wide.push_back(CodeUnit{0x0021});
+    EXPECT_NE(narrow, wide);
+}
+
+/**
+ * @brief Test that ordering is code unit less than: the first differing code unit decides, and a prefix is less.
+ */
+TEST(StringPrimitiveTest, CodeUnitLessThanOrdering)
+{
+    const String a{std::u16string_view{u"a"}};
+    const String ab{std::u16string_view{u"ab"}};
+    const String b{std::u16string_view{u"b"}};
+    EXPECT_LT(a, ab);
+    EXPECT_LT(ab, b);
+    EXPECT_LT(String{}, a);
+    EXPECT_EQ(a <=> String{std::u16string_view{u"a"}}, std::strong_ordering::equal);
+
+    // Code units, not code points: U+FFFD sorts after a surrogate pair's lead unit 0xD83D.
+    EXPECT_LT(String{std::u16string_view{u"😀"}}, String{std::u16string_view{u"�"}});
+}
+
+/**
+ * @brief Test that ordering past the vector width is the same for every pairing of 8-bit and UTF-16 representations.
+ */
+TEST(StringPrimitiveTest, OrderingAcrossRepresentations)
+{
+    std::u16string prefix(37, u'x');
+    const String lower{std::u16string_view{prefix + u"a" + prefix}};
+    const String higher{std::u16string_view{prefix + u"é"}};
+    for (const bool widen_lower : {false, true})
+        for (const bool widen_higher : {false, true})
+        {
+            String lhs = lower;
+            String rhs = higher;
+            if (widen_lower) lhs.widen();
+            if (widen_higher) rhs.widen();
+            EXPECT_LT(lhs, rhs);
+            EXPECT_GT(rhs, lhs);
+            EXPECT_EQ(lhs <=> lower, std::strong_ordering::equal);
+        }
+    const String wide{std::u16string_view{prefix + u"Ā"}};
+    EXPECT_LT(higher, wide);
+}
+
+/**
+ * @brief Test that visit hands the storage to the visitor with the matching span type.
+ */
+TEST(StringPrimitiveTest, Visit)
+{
+    const auto unit_width = [](auto units) { return sizeof(typename decltype(units)::element_type); };
+    String s{std::u16string_view{u"ab"}};
+    EXPECT_EQ(s.visit(unit_width), std::size_t{1});
+    s.widen();
+    EXPECT_EQ(s.visit(unit_width), std::size_t{2});
+}
+
+/**
+ * @brief Test that the hash depends on the code units only, not on the representation.
+ */
+TEST(StringPrimitiveTest, HashAcrossRepresentations)
+{
+    String narrow{std::u16string_view{u"hash"}};
+    String wide = narrow;
+    wide.widen();
+    EXPECT_EQ(narrow.hash(), wide.hash());
+    EXPECT_EQ(std::hash<String>{}(narrow), narrow.hash());
+    EXPECT_NE(narrow.hash(), String{std::u16string_view{u"hasi"}}.hash());
+}
+
+// ---------------------------------------------------------------------------
+// Cached properties
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test is_ascii on 8-bit and UTF-16 Strings, at every position of a non-ASCII code unit across vector widths.
+ */
+TEST(StringPrimitiveTest, IsASCII)
+{
+    EXPECT_TRUE(String{}.is_ascii());
+    EXPECT_TRUE(String::from_latin1(std::string_view{"text/html"}).is_ascii());
+    for (std::size_t position = 0; position < 40; ++position)
+    {
+        std::u16string units(40, u'a');
+        units[position] = u'€';
+        EXPECT_FALSE(String{units}.is_ascii()) << position;
+        units[position] = u'€';
+        EXPECT_FALSE(String{units}.is_ascii()) << position;
+    }
+    String wide{std::u16string_view{u"abc"}};
+    wide.widen();
+    EXPECT_TRUE(wide.is_ascii());
+}
+
+/**
+ * @brief Test that surrogate pairs count as one code point and lone surrogates make the String not a scalar value string.
+ */
+TEST(StringPrimitiveTest, ScalarValueStringAndCodePointLength)
+{
+    const String pair{std::u16string_view{u"a\U0001F600b"}};
+    EXPECT_TRUE(pair.is_scalar_value_string());
+    EXPECT_EQ(pair.size(), std::size_t{4});
+    EXPECT_EQ(pair.code_point_length(), std::size_t{3});
+
+    const String lone{std::u16string{u'a', char16_t{0xDC00}, char16_t{0xD800}}};
+    EXPECT_FALSE(lone.is_scalar_value_string());
+    EXPECT_EQ(lone.code_point_length(), std::size_t{3});
+
+    const String latin1 = String::from_latin1(std::string_view{"caf\xE9"});
+    EXPECT_TRUE(latin1.is_scalar_value_string());
+    EXPECT_EQ(latin1.code_point_length(), std::size_t{4});
+}
+
+/**
+ * @brief Test that mutating a String invalidates its cached properties.
+ */
+TEST(StringPrimitiveTest, MutationInvalidatesProperties)
+{
+    String s = String::from_latin1(std::string_view{"key"});
+    const std::size_t hash = s.hash();
+    EXPECT_TRUE(s.is_ascii());
+    EXPECT_EQ(s.code_point_length(), std::size_t{3});
+
+    s.push_back(CodeUnit{0xD83D});
+    EXPECT_NE(s.hash(), hash);
+    EXPECT_FALSE(s.is_ascii());
+    EXPECT_FALSE(s.is_scalar_value_string());
+    EXPECT_EQ(s.code_point_length(), std::size_t{4});
+
+    s.append(String{std::u16string_view{u"\xDE00"}});
+    EXPECT_TRUE(s.is_scalar_value_string());
+    EXPECT_EQ(s.code_point_length(), std::size_t{4});
+    EXPECT_EQ(s.hash(), String{s.to_utf16()}.hash());
+
+    s.clear();
+    EXPECT_TRUE(s.is_ascii());
+    EXPECT_EQ(s.code_point_length(), std::size_t{0});
+    EXPECT_EQ(s.hash(), String{}.hash());
+}
+
+/**
+ * @brief Test that copies keep the cached properties of the original, and a moved-from String is empty.
+ */
+TEST(StringPrimitiveTest, PropertiesSurviveCopyAndMove)
+{
+    String original{std::u16string_view{u"€uro"}};
+    const std::size_t hash = original.hash();
+    EXPECT_FALSE(original.is_ascii());
+    String copy = original;
+    EXPECT_EQ(copy.hash(), hash);
+    EXPECT_FALSE(copy.is_ascii());
+    copy.clear();
+    EXPECT_EQ(original.hash(), hash);
+
+    String moved = std::move(original);
+    EXPECT_EQ(moved.hash(), hash);
+    EXPECT_EQ(moved.code_point_length(), std::size_t{4});
+    EXPECT_TRUE(original.is_empty());
+    EXPECT_TRUE(original.is_ascii());
+    EXPECT_EQ(original.hash(), String{}.hash());
+}
+
+/**
+ * @brief Test that equal Strings with cached hashes still compare equal and different ones do not.
+ */
+TEST(StringPrimitiveTest, EqualityWithCachedHashes)
+{
+    const String a{std::u16string_view{u"content-type"}};
+    const String b = String::from_latin1(std::string_view{"content-type"});
+    const String c = String::from_latin1(std::string_view{"content-typf"});
+    (void)a.hash();
+    (void)b.hash();
+    (void)c.hash();
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+}
+
+/**
+ * @brief Test that a rope reports the properties of its concatenated code units.
+ */
+TEST(StringPrimitiveTest, RopeProperties)
+{
+    const StringRopeThresholds thresholds{.min_length = 1};
+    const String rope = String::concat(String::from_latin1(std::string_view{"ab"}), String{std::u16string_view{u"\U0001F600"}}, thresholds);
+    EXPECT_TRUE(rope.is_rope());
+    EXPECT_FALSE(rope.is_ascii());
+    EXPECT_TRUE(rope.is_scalar_value_string());
+    EXPECT_EQ(rope.code_point_length(), std::size_t{3});
+    EXPECT_EQ(rope.hash(), String{std::u16string_view{u"ab\U0001F600"}}.hash());
+}
+
+// ---------------------------------------------------------------------------
+// Code points
+// ---------------------------------------------------------------------------
+
+namespace
+{
+
+/**
+ * @brief Build UTF-16 code units mixing ASCII, BMP code units, surrogate pairs and a lone surrogate, with their code points.
+ */
+std::u16string mixed_code_units(std::size_t code_point_count, std::u32string& code_points)
+{
+    std::u16string units;
+    for (std::size_t i = 0; i < code_point_count; ++i)
+    {
+        char32_t value = U'a' + static_cast<char32_t>(i % 26);
+        if (i % 7 == 3) value = 0x1F600 + static_cast<char32_t>(i % 50);
+        else if (i % 11 == 5) value = 0x20AC;
+        else if (i == code_point_count / 2) value = 0xDC00;
+        code_points += value;
+        if (value >= 0x10000)
+        {
+            units += static_cast<char16_t>(0xD800 + ((value - 0x10000) >> 10));
+            units += static_cast<char16_t>(0xDC00 + ((value - 0x10000) & 0x3FF));
+        }
+        else
+            units += static_cast<char16_t>(value);
+    }
+    return units;
+}
+
+} // namespace
+
+/**
+ * @brief Test code point access and offset mapping against a reference walk, on Strings below and above the index threshold.
+ */
+TEST(StringPrimitiveTest, CodePointOffsets)
+{
+    for (const std::size_t count : {std::size_t{40}, std::size_t{1000}})
+    {
+        std::u32string code_points;
+        const std::u16string units = mixed_code_units(count, code_points);
+        const String s{units};
+        ASSERT_EQ(s.code_point_length(), count);
+        std::size_t unit_offset = 0;
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            EXPECT_EQ(s.code_point_at(index), CodePoint{code_points[index]}) << index;
+            EXPECT_EQ(s.code_unit_offset(index), unit_offset) << index;
+            EXPECT_EQ(s.code_point_offset(unit_offset), index) << index;
+            if (code_points[index] >= 0x10000)
+                EXPECT_EQ(s.code_point_offset(++unit_offset), index) << index;
+            ++unit_offset;
+        }
+        EXPECT_EQ(s.code_unit_offset(count), s.size());
+        EXPECT_EQ(s.code_point_offset(s.size()), count);
+        EXPECT_THROW((void)s.code_point_at(count), std::out_of_range);
+        EXPECT_THROW((void)s.code_unit_offset(count + 1), std::out_of_range);
+        EXPECT_THROW((void)s.code_point_offset(s.size() + 1), std::out_of_range);
+    }
+}
+
+/**
+ * @brief Test that code point access on Strings without surrogate pairs maps offsets one to one.
+ */
+TEST(StringPrimitiveTest, CodePointOffsetsWithoutPairs)
+{
+    const String latin1 = String::from_latin1(std::string_view{"caf\xE9"});
+    EXPECT_EQ(latin1.code_point_at(3), CodePoint{0x00E9});
+    EXPECT_EQ(latin1.code_unit_offset(2), std::size_t{2});
+    const String wide{std::u16string_view{u"€uro"}};
+    EXPECT_EQ(wide.code_point_at(0), CodePoint{0x20AC});
+    EXPECT_EQ(wide.code_point_offset(3), std::size_t{3});
+}
+
+/**
+ * @brief Test that mutation rebuilds the code point index and moving keeps it valid.
+ */
+TEST(StringPrimitiveTest, CodePointIndexAfterMutationAndMove)
+{
+    std::u32string code_points;
+    String s{mixed_code_units(600, code_points)};
+    EXPECT_EQ(s.code_point_at(599), CodePoint{code_points[599]});
+    s.push_back(CodeUnit{0xD83D});
+    s.push_back(CodeUnit{0xDE00});
+    EXPECT_EQ(s.code_point_length(), std::size_t{601});
+    EXPECT_EQ(s.code_point_at(600), CodePoint{0x1F600});
+    EXPECT_EQ(s.code_unit_offset(600), s.size() - 2);
+
+    const String moved = std::move(s);
+    EXPECT_EQ(moved.code_point_at(600), CodePoint{0x1F600});
+    EXPECT_EQ(moved.code_point_offset(moved.size() - 1), std::size_t{600});
+    const String copy = moved;
+    EXPECT_EQ(copy.code_point_at(300), CodePoint{code_points[300]});
+}
+
+/**
+ * @brief Test that threads building the code point index of a shared String concurrently get the same answers.
+ */
+TEST(StringPrimitiveTest, CodePointIndexConcurrentBuild)
+{
+    std::u32string code_points;
+    const String s{mixed_code_units(2000, code_points)};
+    std::vector<std::thread> threads;
+    std::vector<std::size_t> mismatches(4, 0);
+    for (std::size_t thread = 0; thread < mismatches.size(); ++thread)
+    {
+        threads.emplace_back([&, thread]
+        {
+            for (std::size_t index = thread; index < code_points.size(); index += 3)
+                if (s.code_point_at(index) != CodePoint{code_points[index]}) ++mismatches[thread];
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    for (const std::size_t count : mismatches) EXPECT_EQ(count, std::size_t{0});
+}
+
+// ---------------------------------------------------------------------------
+// Formatting
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that formatting writes UTF-8 and replaces lone surrogates with U+FFFD.
+ */
+TEST(StringPrimitiveTest, Formatting)
+{
+    EXPECT_EQ(std::format("{}", String{std::u16string_view{u"café \U0001F600"}}), "caf\xC3\xA9 \xF0\x9F\x98\x80");
+    EXPECT_EQ(std::format("{}", String{std::u16string{char16_t{0xDC00}, u'x'}}), "\xEF\xBF\xBDx");
+    std::ostringstream oss;
+    oss << String::from_latin1(std::string_view{"ok"});
+    EXPECT_EQ(oss.str(), "ok");
+}
+
+// ---------------------------------------------------------------------------
+// Rope concatenation
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that short concatenations are copied flat and long ones build a rope.
+ */
+TEST(StringPrimitiveTest, ConcatThresholds)
+{
+    const String fragment = String::from_latin1(std::string_view{"abcd"});
+    EXPECT_FALSE((fragment + fragment).is_rope());
+    const String rope = String::concat(fragment, fragment, {.min_length = 8});
+    EXPECT_TRUE(rope.is_rope());
+    EXPECT_EQ(rope.size(), std::size_t{8});
+    EXPECT_TRUE(rope.is_8bit());
+}
+
+/**
+ * @brief Test that indexed access to a rope sees the code units of both operands in order.
+ */
+TEST(StringPrimitiveTest, RopeAccess)
+{
+    const StringRopeThresholds thresholds{.min_length = 1};
+    const String rope = String::concat(String::from_latin1(std::string_view{"ab"}), String{std::u16string_view{u"€c"}}, thresholds);
+    EXPECT_FALSE(rope.is_8bit());
+    EXPECT_EQ(rope[2], CodeUnit{0x20AC});
+    EXPECT_EQ(rope.to_utf16(), u"ab€c");
+    EXPECT_EQ(rope, String{std::u16string_view{u"ab€c"}});
+    EXPECT_EQ(std::format("{}", rope), "ab\xE2\x82\xAC" "c");
+}
+
+/**
+ * @brief Test that a rope exceeding the depth threshold is flattened, and that many fragments concatenate in order.
+ */
+TEST(StringPrimitiveTest, RopeDepthThreshold)
+{
+    const StringRopeThresholds thresholds{.min_length = 1, .max_depth = 8};
+    String result;
+    std::u16string expected;
+    for (int i = 0; i < 100; ++i)
+    {
+        const char16_t unit = static_cast<char16_t>(u'a' + i % 26);
+        result = String::concat(result, String{std::u16string_view{&unit, 1}}, thresholds);
+        expected += unit;
+        EXPECT_EQ(result.size(), expected.size());
+    }
+    EXPECT_EQ(result.to_utf16(), expected);
+}
+
+/**
+ * @brief Test that a rope shared by copies is unaffected by mutating one of them.
+ */
+TEST(StringPrimitiveTest, RopeCopiesAreIndependent)
+{
+    const StringRopeThresholds thresholds{.min_length = 1};
+    const String rope = String::concat(String::from_latin1(std::string_view{"ab"}), String::from_latin1(std::string_view{"cd"}), thresholds);
+    String copy = rope;
+    copy.push_back(CodeUnit{0x0100});
+    EXPECT_FALSE(copy.is_rope());
+    EXPECT_EQ(copy.to_utf16(), u"abcdĀ");
+    EXPECT_TRUE(rope.is_rope());
+    EXPECT_EQ(rope.to_utf16(), u"abcd");
+}
+
+/**
+ * @brief Test that appending to a rope extends the rope and flatten() makes it flat again.
+ */
+TEST(StringPrimitiveTest, RopeAppendAndFlatten)
+{
+    String rope = String::concat(String::from_latin1(std::string(300, 'x')), String::from_latin1(std::string(300, 'y')));
+    EXPECT_TRUE(rope.is_rope());
+    rope.append(String::from_latin1(std::string_view{"z"}));
+    EXPECT_TRUE(rope.is_rope());
+    EXPECT_EQ(rope.size(), std::size_t{601});
+    rope.flatten();
+    EXPECT_FALSE(rope.is_rope());
+    EXPECT_EQ(rope[600], CodeUnit{0x007A});
+    EXPECT_EQ(rope.latin1_span().size(), std::size_t{601});
+}
+
+/**
+ * @brief Test that a rope appended to itself doubles.
+ */
+TEST(StringPrimitiveTest, RopeAppendSelf)
+{
+    String rope = String::concat(String::from_latin1(std::string(300, 'x')), String{std::u16string(300, u'€')});
+    ASSERT_TRUE(rope.is_rope());
+    rope.append(rope);
+    EXPECT_TRUE(rope.is_rope());
+    EXPECT_EQ(rope.size(), std::size_t{1200});
+    const std::u16string half = std::u16string(300, u'x') + std::u16string(300, u'€');
+    EXPECT_EQ(rope.to_utf16(), half + half);
+}
+
+// ---------------------------------------------------------------------------
+// Slices
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that a long substring is a slice pointing into its String's buffer, which stays equal and shared.
+ */
+TEST(StringPrimitiveTest, SliceSharesBuffer)
+{
+    String text = String::from_latin1(std::string(40, 'a') + std::string(40, 'b'));
+    const String slice = text.code_unit_substring(20, 40);
+    EXPECT_TRUE(slice.is_slice());
+    EXPECT_TRUE(text.is_slice());
+    EXPECT_EQ(slice.latin1_span().data(), text.latin1_span().data() + 20);
+    EXPECT_EQ(slice, String::from_latin1(std::string(20, 'a') + std::string(20, 'b')));
+    EXPECT_EQ(text.size(), std::size_t{80});
+    EXPECT_EQ(text, String::from_latin1(std::string(40, 'a') + std::string(40, 'b')));
+
+    String wide{std::u16string(64, u'€')};
+    const String wide_slice = wide.code_unit_substring(8, 32);
+    EXPECT_TRUE(wide_slice.is_slice());
+    EXPECT_FALSE(wide_slice.is_8bit());
+    EXPECT_EQ(wide_slice.utf16_span().data(), wide.utf16_span().data() + 8);
+    EXPECT_EQ(wide_slice.to_utf16(), std::u16string(32, u'€'));
+}
+
+/**
+ * @brief Test that short substrings and substrings pinning a much larger buffer are copied.
+ */
+TEST(StringPrimitiveTest, SliceCompaction)
+{
+    String text = String::from_latin1(std::string(1000, 'x'));
+    const String short_substring = text.code_unit_substring(10, 5);
+    EXPECT_FALSE(short_substring.is_slice());
+    EXPECT_FALSE(text.is_slice());
+    EXPECT_EQ(short_substring, String::from_latin1(std::string_view{"xxxxx"}));
+
+    const String wasteful = text.code_unit_substring(0, 40);
+    EXPECT_FALSE(wasteful.is_slice());
+    EXPECT_EQ(wasteful.size(), std::size_t{40});
+
+    const String shared = text.code_unit_substring(0, 100);
+    EXPECT_TRUE(shared.is_slice());
+    const String tiny = shared.code_unit_substring(0, 40);
+    EXPECT_FALSE(tiny.is_slice());
+
+    const String tuned = text.code_unit_substring(0, 40, {.min_length = 1, .max_waste_ratio = 100});
+    EXPECT_TRUE(tuned.is_slice());
+
+    // 1000 > 16 * 62, but not 16 * 63.
+    EXPECT_FALSE(text.code_unit_substring(0, 62).is_slice());
+    EXPECT_TRUE(text.code_unit_substring(0, 63).is_slice());
+    EXPECT_FALSE(text.code_unit_substring(0, 500, {.max_waste_ratio = 0}).is_slice());
+    EXPECT_TRUE(text.code_unit_substring(0, 1, {.min_length = 1, .max_waste_ratio = std::numeric_limits<std::size_t>::max()}).is_slice());
+}
+
+/**
+ * @brief Test that the const overload copies a flat String and shares a slice or a rope.
+ */
+TEST(StringPrimitiveTest, SliceConstOverload)
+{
+    const String flat = String::from_latin1(std::string(100, 'f'));
+    const String copied = flat.code_unit_substring(0, 64);
+    EXPECT_FALSE(copied.is_slice());
+    EXPECT_FALSE(flat.is_slice());
+
+    const String rope = String::concat(String::from_latin1(std::string(300, 'x')), String{std::u16string(300, u'€')});
+    ASSERT_TRUE(rope.is_rope());
+    const String slice = rope.code_unit_substring(280, 40);
+    EXPECT_TRUE(slice.is_slice());
+    EXPECT_FALSE(slice.is_8bit());
+    EXPECT_EQ(slice.to_utf16(), std::u16string(20, u'x') + std::u16string(20, u'€'));
+
+    const String nested = slice.code_unit_substring(2, 38);
+    EXPECT_TRUE(nested.is_slice());
+    EXPECT_EQ(nested.utf16_span().data(), slice.utf16_span().data() + 2);
+}
+
+/**
+ * @brief Test that a slice outlives its String and that mutating it leaves the shared buffer untouched.
+ */
+TEST(StringPrimitiveTest, SliceMutationAndLifetime)
+{
+    String slice;
+    String other;
+    {
+        String text = String::from_latin1(std::string(64, 'm'));
+        slice = text.code_unit_substring(0, 32);
+        other = text.code_unit_substring(0, 32);
+    }
+    EXPECT_EQ(slice, String::from_latin1(std::string(32, 'm')));
+
+    slice.push_back(CodeUnit{0x0100});
+    EXPECT_FALSE(slice.is_slice());
+    EXPECT_EQ(slice.size(), std::size_t{33});
+    EXPECT_EQ(slice[32], CodeUnit{0x0100});
+    EXPECT_TRUE(other.is_slice());
+    EXPECT_EQ(other, String::from_latin1(std::string(32, 'm')));
+
+    other.append(String::from_latin1(std::string_view{"!"}));
+    EXPECT_FALSE(other.is_slice());
+    EXPECT_TRUE(other.is_8bit());
+    EXPECT_EQ(other[32], CodeUnit{0x0021});
+}
+
+/**
+ * @brief Test that a substring range past the end throws std::out_of_range.
+ */
+TEST(StringPrimitiveTest, SliceOutOfRange)
+{
+    String text = String::from_latin1(std::string(64, 'o'));
+    EXPECT_THROW((void)text.code_unit_substring(60, 5), std::out_of_range);
+    EXPECT_THROW((void)text.code_unit_substring(65, 0), std::out_of_range);
+    EXPECT_THROW((void)text.code_unit_substring(1, static_cast<std::size_t>(-1)), std::out_of_range);
+    EXPECT_TRUE(text.code_unit_substring(64, 0).is_empty());
+}
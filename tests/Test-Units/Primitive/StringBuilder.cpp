@@ -0,0 +1,188 @@
+/**
+ * @file Test-Units/Primitive/StringBuilder.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the StringBuilder type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for the StringBuilder type.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Primitive/String/StringBuilder.hpp>
+#include <string>
+#include <string_view>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Decode UTF-8 bytes with a fresh builder.
+ */
+String decode_utf8(std::string_view bytes)
+{
+    StringBuilder builder;
+    builder.append_utf8(bytes);
+    return builder.release();
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Storage
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that a short result is built in the inline storage and released as an 8-bit String.
+ */
+TEST(StringBuilderTest, ShortResultStaysInline)
+{
+    StringBuilder builder;
+    EXPECT_TRUE(builder.is_empty());
+    builder.append_latin1(std::string_view{"abc"});
+    builder.append(CodeUnit{u'd'});
+    EXPECT_EQ(builder.size(), 4u);
+    EXPECT_EQ(builder.capacity(), StringBuilder::inline_capacity);
+    EXPECT_TRUE(builder.is_8bit());
+
+    const String result = builder.release();
+    EXPECT_EQ(result, String{u"abcd"});
+    EXPECT_TRUE(result.is_8bit());
+    EXPECT_TRUE(builder.is_empty());
+}
+
+/**
+ * @brief Test that appending past the inline capacity moves the code units to the heap and keeps them.
+ */
+TEST(StringBuilderTest, SpillsToHeap)
+{
+    StringBuilder builder;
+    std::u16string expected;
+    for (std::size_t i = 0; i < StringBuilder::inline_capacity * 3; ++i)
+    {
+        const char16_t unit = static_cast<char16_t>(u'a' + i % 26);
+        builder.append(CodeUnit{unit});
+        expected.push_back(unit);
+    }
+    EXPECT_GT(builder.capacity(), StringBuilder::inline_capacity);
+    EXPECT_TRUE(builder.is_8bit());
+    EXPECT_EQ(builder.release(), String{expected});
+}
+
+/**
+ * @brief Test that a code unit above 0xFF switches the builder to UTF-16 and keeps the earlier code units.
+ */
+TEST(StringBuilderTest, WidensOnNonLatin1CodeUnit)
+{
+    StringBuilder builder;
+    builder.append_latin1(std::string_view{"caf\xE9"});
+    builder.append_code_units(u" ☃");
+    EXPECT_FALSE(builder.is_8bit());
+    builder.append_latin1(std::string_view{"!"});
+
+    const String result = builder.release();
+    EXPECT_FALSE(result.is_8bit());
+    EXPECT_EQ(result, String{u"café ☃!"});
+}
+
+/**
+ * @brief Test that code units that all fit in 8 bits do not widen the builder.
+ */
+TEST(StringBuilderTest, Latin1CodeUnitsStayNarrow)
+{
+    StringBuilder builder;
+    builder.append_code_units(u"naïve");
+    builder.append(String{u"!"});
+    EXPECT_TRUE(builder.is_8bit());
+    EXPECT_EQ(builder.release(), String{u"naïve!"});
+}
+
+/**
+ * @brief Test that reserve() allocates exactly the requested capacity and release() hands that buffer to the String.
+ */
+TEST(StringBuilderTest, ReserveIsExactAndReleaseDoesNotCopy)
+{
+    StringBuilder builder(1000);
+    EXPECT_EQ(builder.capacity(), 1000u);
+    for (std::size_t i = 0; i < 1000; ++i) builder.append(CodeUnit{u'x'});
+    EXPECT_EQ(builder.capacity(), 1000u);
+
+    StringBuilder wide(300);
+    wide.append(CodeUnit{u'Ā'});
+    EXPECT_EQ(wide.capacity(), 300u);
+    for (std::size_t i = 1; i < 300; ++i) wide.append(CodeUnit{u'y'});
+    EXPECT_EQ(wide.capacity(), 300u);
+
+    const String result = wide.release();
+    EXPECT_EQ(result.size(), 300u);
+    EXPECT_EQ(result.utf16_span()[0], u'Ā');
+    EXPECT_TRUE(wide.is_empty());
+    EXPECT_EQ(wide.capacity(), StringBuilder::inline_capacity);
+}
+
+/**
+ * @brief Test that clear() empties the builder and returns it to 8-bit storage.
+ */
+TEST(StringBuilderTest, ClearResetsToNarrow)
+{
+    StringBuilder builder;
+    builder.append_code_units(u"☃");
+    builder.clear();
+    EXPECT_TRUE(builder.is_empty());
+    EXPECT_TRUE(builder.is_8bit());
+    builder.append_latin1(std::string_view{"ok"});
+    EXPECT_EQ(builder.release(), String{u"ok"});
+}
+
+// ---------------------------------------------------------------------------
+// Code points
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that supplementary code points are appended as surrogate pairs.
+ */
+TEST(StringBuilderTest, AppendsSupplementaryCodePointsAsSurrogatePairs)
+{
+    StringBuilder builder;
+    builder.append(CodePoint{U'a'});
+    builder.append(CodePoint{0x1F600});
+    builder.append_code_points(U"b\U0001F601");
+    EXPECT_EQ(builder.release(), String{u"a\U0001F600b\U0001F601"});
+}
+
+// ---------------------------------------------------------------------------
+// UTF-8
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that well-formed UTF-8 is decoded, including a byte order mark, which is kept.
+ */
+TEST(StringBuilderTest, DecodesWellFormedUTF8)
+{
+    EXPECT_EQ(decode_utf8("plain ascii"), String{u"plain ascii"});
+    EXPECT_EQ(decode_utf8("\xC3\xA9t\xC3\xA9"), String{u"été"});
+    EXPECT_EQ(decode_utf8("\xE2\x98\x83 \xF0\x9F\x98\x80"), String{u"☃ \U0001F600"});
+    EXPECT_EQ(decode_utf8("\xEF\xBB\xBFx"), String{u"﻿x"});
+    EXPECT_TRUE(decode_utf8("\xC3\xA9").is_8bit());
+}
+
+/**
+ * @brief Test that each maximal ill-formed subsequence becomes one U+FFFD REPLACEMENT CHARACTER.
+ */
+TEST(StringBuilderTest, ReplacesIllFormedUTF8)
+{
+    // Overlong encodings.
+    EXPECT_EQ(decode_utf8("\xC0\xAF"), String{u"��"});
+    EXPECT_EQ(decode_utf8("\xE0\x80\xAF"), String{u"���"});
+    // Encoded surrogate.
+    EXPECT_EQ(decode_utf8("\xED\xA0\x80"), String{u"���"});
+    // Above U+10FFFF.
+    EXPECT_EQ(decode_utf8("\xF4\x90\x80\x80"), String{u"����"});
+    // Truncated sequences, in the middle and at the end.
+    EXPECT_EQ(decode_utf8("\xE2\x98x"), String{u"�x"});
+    EXPECT_EQ(decode_utf8("a\xF0\x9F\x98"), String{u"a�"});
+    // Stray continuation and invalid bytes.
+    EXPECT_EQ(decode_utf8("\x80z\xFF"), String{u"�z�"});
+}
@@ -0,0 +1,85 @@
+/**
+ * @file Test-Units/Primitive/StringSort.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the String sort in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file contains unit tests for sort_code_unit_less_than.
+ */
+
+#include <gtest/gtest.h>
+#include <Softloq/WHATWG/Infra/Primitive/String/StringSort.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+/**
+ * @brief Build random Strings over a small alphabet, so that prefixes and duplicates are common.
+ */
+std::vector<String> random_strings(std::size_t count, std::uint32_t seed)
+{
+    static constexpr char16_t alphabet[] = {u'a', u'b', u'c', 0x00E9, 0x0100, 0xD83D, 0xFFFD};
+    std::mt19937 engine{seed};
+    std::uniform_int_distribution<std::size_t> length{0, 40};
+    std::uniform_int_distribution<std::size_t> pick{0, 2};
+    std::uniform_int_distribution<std::size_t> pick_any{0, std::size(alphabet) - 1};
+    std::vector<String> strings;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const bool wide = i % 3 == 0;
+        std::u16string units(length(engine), u'a');
+        for (char16_t& unit : units) unit = alphabet[wide ? pick_any(engine) : pick(engine)];
+        String string{std::u16string_view{units}};
+        // Mix representations of Strings that fit in 8 bits.
+        if (i % 5 == 0) string.widen();
+        strings.push_back(std::move(string));
+    }
+    return strings;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Sorting
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that the sort gives the order of std::sort with operator<.
+ */
+TEST(StringSortTest, MatchesStdSort)
+{
+    for (const std::size_t count : {0u, 1u, 2u, 15u, 17u, 300u, 5000u})
+    {
+        std::vector<String> strings = random_strings(count, static_cast<std::uint32_t>(count));
+        std::vector<String> expected = strings;
+        std::ranges::sort(expected, std::less<>{});
+        sort_code_unit_less_than(strings);
+        EXPECT_EQ(strings, expected) << "count " << count;
+    }
+}
+
+/**
+ * @brief Test that prefixes sort before longer Strings and that equal Strings, including empty ones, are kept.
+ */
+TEST(StringSortTest, PrefixesAndDuplicates)
+{
+    std::vector<String> strings;
+    for (std::size_t i = 0; i < 40; ++i)
+    {
+        strings.push_back(String{std::u16string_view{std::u16string(i % 4, u'z')}});
+        strings.push_back(String{std::u16string_view{std::u16string(64, u'p') + u"q"}});
+    }
+    sort_code_unit_less_than(strings);
+    ASSERT_EQ(strings.size(), 80u);
+    EXPECT_TRUE(std::ranges::is_sorted(strings, std::less<>{}));
+    EXPECT_TRUE(strings.front().is_empty());
+    EXPECT_EQ(strings.back(), String{std::u16string_view{u"zzz"}});
+    EXPECT_EQ(std::ranges::count(strings, String{std::u16string_view{std::u16string(64, u'p') + u"q"}}), 40);
+}
@@ -0,0 +1,242 @@
+/**
+ * @file Test-Units/Primitive/UInt128.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the uint128_t type and the UInt128 primitive type in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file checks the multiply, divide and modulo of uint128_t and of its portable two-word
+ * arithmetic against a bit-at-a-time reference, over every pair of boundary values and over
+ * random operands.
+ */
+
+#include <gtest/gtest.h>
+#include <Reference.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Number/UInt128/UInt128.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr std::uint64_t max64 = std::numeric_limits<std::uint64_t>::max();
+
+/**
+ * @brief Values at the edges of the 32-bit digits and 64-bit words, where carries and quotient estimates go wrong.
+ */
+std::vector<uint128_t> boundary_values()
+{
+    const std::uint64_t words[] = {0, 1, 2, 3, 10, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFF, 0x100000000, 0x100000001, 0x7FFFFFFFFFFFFFFF, 0x8000000000000000, 0x8000000000000001, max64 - 1, max64};
+    std::vector<uint128_t> values;
+    for (const std::uint64_t high : words)
+        for (const std::uint64_t low : words) values.emplace_back(high, low);
+    return values;
+}
+
+/**
+ * @brief Random operands whose words are often zero, small, or near a power of two, so both division paths are hit.
+ */
+uint128_t random_value(std::mt19937_64& engine)
+{
+    const std::uint64_t high = Reference::random_word(engine);
+    return uint128_t{high, Reference::random_word(engine)};
+}
+
+/**
+ * @brief Check multiply, divide and modulo, native and portable, against the reference for one pair.
+ */
+void expect_matches_reference(const uint128_t& lhs, const uint128_t& rhs)
+{
+    const uint128_t expected_product = Reference::multiply(lhs, rhs);
+    ASSERT_EQ(lhs * rhs, expected_product) << lhs.high() << ':' << lhs.low() << " * " << rhs.high() << ':' << rhs.low();
+    ASSERT_EQ(UInt128Portable::multiply(lhs.low(), rhs.low()), Reference::multiply(uint128_t{lhs.low()}, uint128_t{rhs.low()}));
+    if (!rhs) return;
+
+    uint128_t expected_remainder;
+    const uint128_t expected_quotient = Reference::divide(lhs, rhs, expected_remainder);
+    ASSERT_EQ(lhs / rhs, expected_quotient) << lhs.high() << ':' << lhs.low() << " / " << rhs.high() << ':' << rhs.low();
+    ASSERT_EQ(lhs % rhs, expected_remainder) << lhs.high() << ':' << lhs.low() << " % " << rhs.high() << ':' << rhs.low();
+
+    uint128_t remainder;
+    ASSERT_EQ(UInt128Portable::divide(lhs, rhs, remainder), expected_quotient) << lhs.high() << ':' << lhs.low() << " / " << rhs.high() << ':' << rhs.low();
+    ASSERT_EQ(remainder, expected_remainder);
+}
+
+/**
+ * @brief Exercises the portable arithmetic and the carries in constant evaluation.
+ */
+constexpr bool constant_arithmetic()
+{
+    const uint128_t a{0x0123456789ABCDEF, 0xFEDCBA9876543210};
+    const uint128_t b{0, 0xFFFFFFFFFFFFFFC5};
+    uint128_t portable_remainder;
+    const uint128_t portable_quotient = UInt128Portable::divide(a, b, portable_remainder);
+    return portable_quotient == a / b && portable_remainder == a % b
+        && uint128_t::multiply(max64, max64) == uint128_t{max64 - 1, 1}
+        && UInt128Portable::multiply(max64, max64) == uint128_t{max64 - 1, 1}
+        && (uint128_t{1} << 127) >> 127 == uint128_t{1}
+        && uint128_t{1, 0} - uint128_t{1} == uint128_t{max64};
+}
+
+static_assert(Reference::matches_reference(uint128_t{0x0123456789ABCDEF, 0xFEDCBA9876543210}, uint128_t{0, 0xFFFFFFFFFFFFFFC5}));
+static_assert(constant_arithmetic());
+static_assert(IntegralConcept<uint128_t>);
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Construction and access
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that the parts, the 64-bit constructor and the explicit conversions agree.
+ */
+TEST(UInt128Test, PartsAndConversions)
+{
+    const uint128_t value{7, 9};
+    EXPECT_EQ(value.high(), std::uint64_t{7});
+    EXPECT_EQ(value.low(), std::uint64_t{9});
+    EXPECT_EQ(static_cast<std::uint64_t>(value), std::uint64_t{9});
+    EXPECT_EQ(uint128_t{42}, uint128_t(0, 42));
+    EXPECT_TRUE(static_cast<bool>(uint128_t(1, 0)));
+    EXPECT_FALSE(static_cast<bool>(uint128_t{}));
+#if SOFTLOQ_WHATWG_INFRA_UINT128_NATIVE
+    const auto native = static_cast<uint128_t::native_type>(value);
+    EXPECT_EQ(uint128_t{native}, value);
+    EXPECT_EQ(static_cast<std::uint64_t>(native >> 64), std::uint64_t{7});
+#endif
+}
+
+/**
+ * @brief Test that values order by the high part first.
+ */
+TEST(UInt128Test, Ordering)
+{
+    EXPECT_LT(uint128_t(0, max64), uint128_t(1, 0));
+    EXPECT_GT(uint128_t(2, 0), uint128_t(1, max64));
+    EXPECT_LE(uint128_t(1, 1), uint128_t(1, 1));
+    EXPECT_EQ(uint128_t(3, 4) <=> uint128_t(3, 5), std::strong_ordering::less);
+}
+
+// ---------------------------------------------------------------------------
+// Arithmetic
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that addition and subtraction carry and borrow across the words and wrap modulo 2^128.
+ */
+TEST(UInt128Test, AddSubtractCarry)
+{
+    EXPECT_EQ(uint128_t(0, max64) + uint128_t{1}, uint128_t(1, 0));
+    EXPECT_EQ(uint128_t(1, 0) - uint128_t{1}, uint128_t(0, max64));
+    EXPECT_EQ(uint128_t(max64, max64) + uint128_t{1}, uint128_t{});
+    EXPECT_EQ(uint128_t{} - uint128_t{1}, uint128_t(max64, max64));
+    uint128_t counter{0, max64};
+    EXPECT_EQ(++counter, uint128_t(1, 0));
+    EXPECT_EQ(counter--, uint128_t(1, 0));
+    EXPECT_EQ(counter, uint128_t(0, max64));
+}
+
+/**
+ * @brief Test that the low words' product keeps its high half, which used to be dropped.
+ */
+TEST(UInt128Test, MultiplyKeepsHighHalf)
+{
+    EXPECT_EQ(uint128_t{max64} * uint128_t{max64}, uint128_t(max64 - 1, 1));
+    EXPECT_EQ(uint128_t{0x100000000} * uint128_t{0x100000000}, uint128_t(1, 0));
+    EXPECT_EQ(uint128_t::multiply(0xFFFFFFFF00000000, 0x10), uint128_t(0xF, 0xFFFFFFF000000000));
+    EXPECT_EQ(uint128_t(1, 1) * uint128_t(1, 1), uint128_t(2, 1));
+}
+
+/**
+ * @brief Test division and modulo by divisors narrower and wider than 64 bits.
+ */
+TEST(UInt128Test, DivideAndModulo)
+{
+    const uint128_t ten_pow_38{0x4B3B4CA85A86C47A, 0x098A224000000000};
+    const uint128_t ten_pow_19{10000000000000000000ULL};
+    EXPECT_EQ(ten_pow_38 / ten_pow_19, ten_pow_19);
+    EXPECT_EQ(ten_pow_38 % ten_pow_19, uint128_t{});
+    EXPECT_EQ((ten_pow_38 + uint128_t{7}) % ten_pow_19, uint128_t{7});
+    EXPECT_EQ(uint128_t(max64, max64) / uint128_t(1, 0), uint128_t{max64});
+    EXPECT_EQ(uint128_t(max64, max64) % uint128_t(1, 0), uint128_t{max64});
+    EXPECT_EQ(uint128_t(5, 0) / uint128_t(max64, max64), uint128_t{});
+    EXPECT_EQ(uint128_t(max64, max64) / uint128_t(max64, max64), uint128_t{1});
+
+    uint128_t remainder;
+    EXPECT_EQ(uint128_t::divide(uint128_t{100}, uint128_t{7}, remainder), uint128_t{14});
+    EXPECT_EQ(remainder, uint128_t{2});
+}
+
+/**
+ * @brief Test the shift operators, including shifts by zero, by the word size, and past the width.
+ */
+TEST(UInt128Test, Shifts)
+{
+    const uint128_t value{0x1, 0x8000000000000001};
+    EXPECT_EQ(value << 0, value);
+    EXPECT_EQ(value >> 0, value);
+    EXPECT_EQ(value << 1, uint128_t(0x3, 0x2));
+    EXPECT_EQ(value >> 1, uint128_t(0x0, 0xC000000000000000));
+    EXPECT_EQ(value << 64, uint128_t(0x8000000000000001, 0));
+    EXPECT_EQ(value >> 64, uint128_t{1});
+    EXPECT_EQ(value << 128, uint128_t{});
+    EXPECT_EQ(value >> 200, uint128_t{});
+}
+
+// ---------------------------------------------------------------------------
+// Differential checks against the reference
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test every pair of boundary values against the bit-at-a-time reference.
+ */
+TEST(UInt128Test, BoundaryPairsMatchReference)
+{
+    const std::vector<uint128_t> values = boundary_values();
+    for (const uint128_t& lhs : values)
+        for (const uint128_t& rhs : values) expect_matches_reference(lhs, rhs);
+}
+
+/**
+ * @brief Test random operands against the bit-at-a-time reference.
+ */
+TEST(UInt128Test, RandomPairsMatchReference)
+{
+    std::mt19937_64 engine{2026};
+    for (int i = 0; i < 20000; ++i) expect_matches_reference(random_value(engine), random_value(engine));
+}
+
+/**
+ * @brief Test that divisions whose first quotient estimate is too large are corrected.
+ */
+TEST(UInt128Test, PortableDivideCorrectsEstimates)
+{
+    // Divisor digits that make Knuth's trial quotient overshoot by two.
+    expect_matches_reference(uint128_t(0x7FFFFFFF80000000, 0), uint128_t{0x800000000000FFFF});
+    expect_matches_reference(uint128_t(0x8000000000000000, 0x00000000FFFFFFFE), uint128_t(0x8000000000000000, 0x00000000FFFFFFFF));
+    expect_matches_reference(uint128_t(0xFFFFFFFFFFFFFFFE, max64), uint128_t(0, max64));
+    expect_matches_reference(uint128_t(max64, max64), uint128_t(0x1, max64));
+}
+
+// ---------------------------------------------------------------------------
+// UInt128 primitive
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that UInt128 arithmetic goes through the full-width uint128_t operations.
+ */
+TEST(UInt128Test, NumberArithmetic)
+{
+    const UInt128 a{uint128_t{max64}};
+    const UInt128 b{uint128_t{3}};
+    EXPECT_EQ(a.get_type(), PrimitiveType::Number);
+    EXPECT_EQ((a * b).get_value(), uint128_t(2, max64 - 2));
+    EXPECT_EQ(((a * b) / b).get_value(), uint128_t{max64});
+    EXPECT_EQ((a % b).get_value(), uint128_t{0});
+    EXPECT_LT(a, a * b);
+}
@@ -0,0 +1,340 @@
+/**
+ * @file Test-Units/Primitive/WideInt.cpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Unit tests for the WideInt type template and the wide Number aliases in the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This file checks 128-bit WideInt arithmetic against the compiler's 128-bit integers, the 256-bit
+ * and 512-bit multiply and divide against bit-at-a-time references, and the formatting, parsing and
+ * overflow-detecting arithmetic of Int128, UInt256 and the other wide Numbers.
+ */
+
+#include <gtest/gtest.h>
+#include <Reference.hpp>
+#include <Softloq/WHATWG/Infra/Operation/ParseInteger/ParseInteger.hpp>
+#include <Softloq/WHATWG/Infra/Primitive/Numbers/Numbers.hpp>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Softloq::WHATWG::Infra;
+
+namespace
+{
+
+constexpr std::uint64_t max64 = std::numeric_limits<std::uint64_t>::max();
+
+/**
+ * @brief Random operands whose words are often zero, small, or near a power of two, so every division path is hit.
+ */
+template <std::size_t Bits>
+WideInt<Bits, false> random_value(std::mt19937_64& engine)
+{
+    typename WideInt<Bits, false>::words_type words{};
+    // Leading words are dropped about half the time, so operands of every length occur.
+    const std::size_t length = engine() % 2 == 0 ? words.size() : 1 + engine() % words.size();
+    for (std::size_t index = 0; index < length; ++index) words[index] = Reference::random_word(engine);
+    return WideInt<Bits, false>::from_words(words);
+}
+
+/**
+ * @brief Check the product, quotient and remainder of one pair against the references.
+ */
+template <std::size_t Bits>
+void expect_matches_reference(const WideInt<Bits, false>& lhs, const WideInt<Bits, false>& rhs)
+{
+    ASSERT_EQ(lhs * rhs, Reference::multiply(lhs, rhs)) << lhs << " * " << rhs;
+    if (!rhs) return;
+
+    using Unsigned = WideInt<Bits, false>;
+    Unsigned expected_remainder;
+    const Unsigned expected_quotient = Reference::divide(lhs, rhs, expected_remainder);
+    Unsigned remainder;
+    ASSERT_EQ(Unsigned::divide(lhs, rhs, remainder), expected_quotient) << lhs << " / " << rhs;
+    ASSERT_EQ(remainder, expected_remainder) << lhs << " % " << rhs;
+    ASSERT_EQ(expected_quotient * rhs + expected_remainder, lhs);
+}
+
+#ifdef __SIZEOF_INT128__
+using native_uint128 = unsigned __int128;
+using native_int128 = __int128;
+
+/**
+ * @brief The compiler's 128-bit integer with the same bits as a 128-bit WideInt.
+ */
+template <typename N, bool Signed>
+N to_native(const WideInt<128, Signed>& value)
+{
+    return static_cast<N>((static_cast<native_uint128>(value.word(1)) << 64) | value.word(0));
+}
+#endif
+
+/**
+ * @brief Exercises the full-width product, the signed operations and the carries in constant evaluation.
+ */
+constexpr bool constant_arithmetic()
+{
+    uint256_t high;
+    const uint256_t low = uint256_t::multiply(~uint256_t{}, ~uint256_t{}, high);
+    std::uint64_t sum = 0;
+    std::uint64_t portable_sum = 0;
+    return low == uint256_t{1} && high == ~uint256_t{} - uint256_t{1}
+        && int256_t{-7} / int256_t{2} == int256_t{-3} && int256_t{-7} % int256_t{2} == int256_t{-1} && Reference::division_identity(int256_t{-7}, int256_t{2})
+        && (int512_t{-1} >> 300) == int512_t{-1} && (uint512_t{1} << 511) >> 511 == uint512_t{1}
+        && add_with_carry(1, max64, 0, sum) == 1 && WideIntPortable::add_with_carry(1, max64, 0, portable_sum) == 1 && sum == portable_sum;
+}
+
+static_assert(Reference::matches_reference(uint256_t::from_words({0xFEDCBA9876543210, 0x0123456789ABCDEF, 0x1111111111111111, 0x8000000000000001}),
+                                           uint256_t::from_words({0xFFFFFFFFFFFFFFC5, 0x7FFFFFFFFFFFFFFF, 0, 0})));
+static_assert(constant_arithmetic());
+static_assert(IntegralConcept<int128_t> && IntegralConcept<uint256_t> && IntegralConcept<int512_t>);
+static_assert(sizeof(uint256_t) == 32 && sizeof(int512_t) == 64);
+static_assert(std::numeric_limits<int256_t>::digits == 255 && std::numeric_limits<uint512_t>::digits10 == 154);
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Construction and access
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that built-in integers are sign-extended and that conversions between widths keep the value.
+ */
+TEST(WideIntTest, ConversionsExtendBySign)
+{
+    const int256_t minus_one{-1};
+    for (const std::uint64_t word : minus_one.words()) EXPECT_EQ(word, max64);
+    EXPECT_TRUE(minus_one.is_negative());
+    EXPECT_FALSE(uint256_t{~uint256_t{}}.is_negative());
+    EXPECT_EQ(static_cast<std::int32_t>(minus_one), -1);
+    EXPECT_EQ(static_cast<std::uint64_t>(uint256_t{uint128_t{5, 7}}), 7u);
+    EXPECT_EQ(static_cast<uint128_t>(uint256_t{uint128_t{5, 7}}), (uint128_t{5, 7}));
+
+    EXPECT_EQ(int512_t{int256_t{-42}}, int512_t{-42});
+    EXPECT_EQ(int256_t{int512_t{-42}}, int256_t{-42});
+    EXPECT_EQ(uint512_t{uint256_t{~uint256_t{}}}.word(4), 0u);
+    EXPECT_EQ(uint256_t{int256_t{-1}}, ~uint256_t{});
+    EXPECT_FALSE(uint256_t{});
+    EXPECT_TRUE(uint256_t{1} << 200);
+}
+
+/**
+ * @brief Test ordering, which is signed for signed WideInts.
+ */
+TEST(WideIntTest, Ordering)
+{
+    EXPECT_LT(int256_t{-1}, int256_t{0});
+    EXPECT_LT(std::numeric_limits<int256_t>::min(), int256_t{-1});
+    EXPECT_GT(std::numeric_limits<int256_t>::max(), int256_t{1} << 200);
+    EXPECT_LT(uint256_t{1} << 64, uint256_t{1} << 65);
+    EXPECT_GT(~uint256_t{}, uint256_t{1} << 255);
+    EXPECT_EQ(std::numeric_limits<uint512_t>::min(), uint512_t{});
+    EXPECT_EQ(std::numeric_limits<int128_t>::max() + int128_t{1}, std::numeric_limits<int128_t>::min());
+}
+
+/**
+ * @brief Test shifts across word boundaries, and that right shifts of signed values fill with the sign.
+ */
+TEST(WideIntTest, Shifts)
+{
+    const uint256_t one{1};
+    for (int shift = 0; shift < 256; ++shift)
+    {
+        ASSERT_EQ((one << shift).word(static_cast<std::size_t>(shift) / 64), std::uint64_t{1} << (shift % 64));
+        ASSERT_EQ((one << shift) >> shift, one);
+    }
+    EXPECT_EQ(one << 256, uint256_t{});
+    EXPECT_EQ(~uint256_t{} >> 256, uint256_t{});
+    EXPECT_EQ(int256_t{-256} >> 4, int256_t{-16});
+    EXPECT_EQ(int256_t{-1} >> 256, int256_t{-1});
+    EXPECT_EQ(int256_t{1} >> 256, int256_t{});
+}
+
+// ---------------------------------------------------------------------------
+// Arithmetic
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that the carry chains and the portable word arithmetic agree on every carry combination.
+ */
+TEST(WideIntTest, CarryChainsMatchPortable)
+{
+    const std::uint64_t words[] = {0, 1, 0x7FFFFFFFFFFFFFFF, 0x8000000000000000, max64 - 1, max64};
+    for (const unsigned char carry : {0, 1})
+        for (const std::uint64_t lhs : words)
+            for (const std::uint64_t rhs : words)
+            {
+                std::uint64_t result = 0;
+                std::uint64_t expected = 0;
+                ASSERT_EQ(add_with_carry(carry, lhs, rhs, result), WideIntPortable::add_with_carry(carry, lhs, rhs, expected));
+                ASSERT_EQ(result, expected);
+                ASSERT_EQ(subtract_with_borrow(carry, lhs, rhs, result), WideIntPortable::subtract_with_borrow(carry, lhs, rhs, expected));
+                ASSERT_EQ(result, expected);
+            }
+    EXPECT_EQ(uint512_t{~uint512_t{}} + uint512_t{1}, uint512_t{});
+    EXPECT_EQ(uint512_t{} - uint512_t{1}, ~uint512_t{});
+}
+
+#ifdef __SIZEOF_INT128__
+/**
+ * @brief Test 128-bit WideInt arithmetic against the compiler's 128-bit integers on random operands.
+ */
+TEST(WideIntTest, RandomPairsMatchNative128)
+{
+    using uint128_wide = WideInt<128, false>;
+    std::mt19937_64 engine{46};
+    for (int i = 0; i < 20000; ++i)
+    {
+        const uint128_wide lhs = random_value<128>(engine);
+        const uint128_wide rhs = random_value<128>(engine);
+        const auto a = to_native<native_uint128>(lhs);
+        const auto b = to_native<native_uint128>(rhs);
+        ASSERT_EQ(to_native<native_uint128>(lhs + rhs), a + b);
+        ASSERT_EQ(to_native<native_uint128>(lhs - rhs), a - b);
+        ASSERT_EQ(to_native<native_uint128>(lhs * rhs), a * b);
+        ASSERT_EQ(lhs < rhs, a < b);
+        if (b != 0)
+        {
+            ASSERT_EQ(to_native<native_uint128>(lhs / rhs), a / b);
+            ASSERT_EQ(to_native<native_uint128>(lhs % rhs), a % b);
+        }
+
+        const int128_t signed_lhs{lhs};
+        const int128_t signed_rhs{rhs};
+        const auto c = to_native<native_int128>(signed_lhs);
+        const auto d = to_native<native_int128>(signed_rhs);
+        ASSERT_EQ(signed_lhs < signed_rhs, c < d);
+        ASSERT_EQ(to_native<native_int128>(signed_lhs >> 7), c >> 7);
+        // The most negative value divided by -1 overflows the native type.
+        if (d != 0 && !(d == -1 && signed_lhs == std::numeric_limits<int128_t>::min()))
+        {
+            ASSERT_EQ(to_native<native_int128>(signed_lhs / signed_rhs), c / d);
+            ASSERT_EQ(to_native<native_int128>(signed_lhs % signed_rhs), c % d);
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Test 256-bit and 512-bit products and quotients against the bit-at-a-time references on random operands.
+ */
+TEST(WideIntTest, RandomPairsMatchReference)
+{
+    std::mt19937_64 engine{2026};
+    for (int i = 0; i < 3000; ++i) expect_matches_reference(random_value<256>(engine), random_value<256>(engine));
+    for (int i = 0; i < 1000; ++i) expect_matches_reference(random_value<512>(engine), random_value<512>(engine));
+}
+
+/**
+ * @brief Test divisions whose trial quotient digits need correcting or adding back.
+ */
+TEST(WideIntTest, LongDivisionCorrectsEstimates)
+{
+    // Knuth's add-back case: the trial digit is one too large after the two-word correction.
+    expect_matches_reference(uint256_t::from_words({0, 0, 0x8000000000000000, 0x7FFFFFFFFFFFFFFF}),
+                             uint256_t::from_words({1, 0, 0x8000000000000000, 0}));
+    expect_matches_reference(uint256_t::from_words({0, 0xFFFFFFFFFFFFFFFE, 0, 0x8000000000000000}),
+                             uint256_t::from_words({max64, 0, 0x8000000000000000, 0}));
+    expect_matches_reference(uint256_t::from_words({max64, max64, max64, max64}), uint256_t::from_words({max64, max64, 1, 0}));
+    expect_matches_reference(uint512_t::from_words({0, 0, 0, 0, 0, 0, 0x8000000000000000, 0x7FFFFFFFFFFFFFFF}),
+                             uint512_t::from_words({1, 0, 0, 0, 0, 0x8000000000000000, 0, 0}));
+    expect_matches_reference(uint512_t{~uint512_t{}}, uint512_t{3});
+    expect_matches_reference(uint512_t{~uint512_t{}}, uint512_t{1} << 511);
+}
+
+/**
+ * @brief Test that full-width products and multiply-adds keep the high half.
+ */
+TEST(WideIntTest, MultiplyKeepsHighHalf)
+{
+    uint256_t high;
+    EXPECT_EQ(uint256_t::multiply(uint256_t{1} << 255, uint256_t{4}, high), uint256_t{});
+    EXPECT_EQ(high, uint256_t{2});
+
+    uint256_t result;
+    EXPECT_EQ(uint256_t::multiply_add(~uint256_t{}, 10, 9, result), 9u);
+    EXPECT_EQ(result, ~uint256_t{});
+    EXPECT_EQ(uint256_t::multiply_add(uint256_t{12}, 10, 3, result), 0u);
+    EXPECT_EQ(result, uint256_t{123});
+}
+
+// ---------------------------------------------------------------------------
+// Wide Number primitives
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test that std::format and operator<< write the extreme values in decimal.
+ */
+TEST(WideIntTest, FormatExtremes)
+{
+    EXPECT_EQ(std::format("{}", UInt256{std::numeric_limits<uint256_t>::max()}),
+              "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+    EXPECT_EQ(std::format("{}", Int128{std::numeric_limits<int128_t>::min()}), "-170141183460469231731687303715884105728");
+    EXPECT_EQ(std::format("{}", Int256{int256_t{-1}}), "-1");
+    EXPECT_EQ(std::format("{}", UInt512{uint512_t{}}), "0");
+    EXPECT_EQ(std::format("{}", Int512{std::numeric_limits<int512_t>::min()}),
+              "-6703903964971298549787012499102923063739682910296196688861780721860882015036773488400937149083451713845015929093243025426876941405973284973216824503042048");
+
+    std::ostringstream oss;
+    oss << Int256{int256_t{-1234567890123456789} * int256_t{1000000000000000000}} << ' ' << uint256_t{uint128_t{1, 0}};
+    EXPECT_EQ(oss.str(), "-1234567890123456789000000000000000000 18446744073709551616");
+}
+
+/**
+ * @brief Test that formatting and parsing round trip, and that values past the range fail to parse.
+ */
+TEST(WideIntTest, ParseRoundTrip)
+{
+    std::mt19937_64 engine{7};
+    for (int i = 0; i < 500; ++i)
+    {
+        const int256_t value{random_value<256>(engine)};
+        const std::string text = std::format("{}", Int256{value});
+        const auto result = parse_integer<int256_t>(std::string_view{text});
+        ASSERT_TRUE(result) << text;
+        ASSERT_EQ(result.value.get_value(), value) << text;
+    }
+
+    const auto max = parse_integer<uint256_t>(std::string_view{"115792089237316195423570985008687907853269984665640564039457584007913129639935"});
+    ASSERT_TRUE(max);
+    EXPECT_EQ(max.value.get_value(), ~uint256_t{});
+    EXPECT_EQ(parse_integer<uint256_t>(std::string_view{"115792089237316195423570985008687907853269984665640564039457584007913129639936"}).error,
+              IntegerParseError::OutOfRange);
+    EXPECT_EQ(parse_integer<int128_t>(std::string_view{"-170141183460469231731687303715884105728"}).value.get_value(),
+              std::numeric_limits<int128_t>::min());
+    EXPECT_EQ(parse_integer<int128_t>(std::string_view{"170141183460469231731687303715884105728"}).error, IntegerParseError::OutOfRange);
+    EXPECT_EQ(parse_integer<uint512_t>(std::string_view{"-1"}).error, IntegerParseError::OutOfRange);
+    EXPECT_TRUE(parse_integer<uint512_t>(std::string_view{"-0"}));
+    EXPECT_EQ(parse_non_negative_integer<int256_t>(std::string_view{"-5"}).error, IntegerParseError::OutOfRange);
+}
+
+/**
+ * @brief Test checked, saturating and wrapping arithmetic on the wide Numbers.
+ */
+TEST(WideIntTest, OverflowDetection)
+{
+    const UInt256 max{std::numeric_limits<uint256_t>::max()};
+    EXPECT_TRUE(max.checked_add(UInt256{uint256_t{1}}).overflow);
+    EXPECT_FALSE(max.checked_sub(UInt256{uint256_t{1}}).overflow);
+    EXPECT_TRUE(UInt256{uint256_t{1} << 128}.checked_mul(UInt256{uint256_t{1} << 128}).overflow);
+    EXPECT_FALSE(UInt256{uint256_t{1} << 127}.checked_mul(UInt256{uint256_t{1} << 128}).overflow);
+    EXPECT_EQ(max.saturating_add(UInt256{uint256_t{1}}), max);
+    EXPECT_EQ(UInt256{uint256_t{}}.saturating_sub(UInt256{uint256_t{1}}).get_value(), uint256_t{});
+    EXPECT_EQ(max.wrapping_add(UInt256{uint256_t{2}}).get_value(), uint256_t{1});
+
+    const Int128 min{std::numeric_limits<int128_t>::min()};
+    EXPECT_TRUE(min.checked_sub(Int128{int128_t{1}}).overflow);
+    EXPECT_TRUE(min.checked_mul(Int128{int128_t{-1}}).overflow);
+    EXPECT_FALSE(min.checked_mul(Int128{int128_t{1}}).overflow);
+    EXPECT_FALSE(Int128{int128_t{1} << 126}.checked_mul(Int128{int128_t{-2}}).overflow);
+    EXPECT_TRUE(Int128{int128_t{1} << 126}.checked_mul(Int128{int128_t{2}}).overflow);
+    EXPECT_EQ(min.saturating_sub(Int128{int128_t{1}}), min);
+    EXPECT_EQ(Int512{std::numeric_limits<int512_t>::max()}.saturating_add(Int512{int512_t{1}}).get_value(), std::numeric_limits<int512_t>::max());
+    EXPECT_EQ(Int256{int256_t{-3}}.saturating_mul(Int256{std::numeric_limits<int256_t>::max()}).get_value(), std::numeric_limits<int256_t>::min());
+}
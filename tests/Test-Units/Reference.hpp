@@ -0,0 +1,138 @@
+/**
+ * @file Test-Units/Reference.hpp
+ * @author Softloq CEO - Brandon Foster (Paradox Gene)
+ * @brief Reference arithmetic and operand generators shared by the integer tests and benchmarks of the WHATWG Infra library.
+ *
+ * Copyright (c) 2026 Softloq. All rights reserved.
+ * Softloq implementation of the WHATWG Infra library.
+ * This header provides the bit-at-a-time multiply and divide that the fast integer arithmetic is
+ * checked and timed against, and the edge and random operands the checks run over.
+ */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_TEST_UNITS_REFERENCE_HPP
+#define SOFTLOQ_WHATWG_INFRA_TEST_UNITS_REFERENCE_HPP
+
+#include <Softloq/WHATWG/Infra/Primitive/Number/Divider.hpp>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace Softloq::WHATWG::Infra::Reference
+{
+
+/**
+ * @brief Multiply by shifting and adding, one bit of the right operand at a time.
+ *
+ * T is uint128_t or an unsigned WideInt; the product wraps like T's own.
+ */
+template <typename T>
+constexpr T multiply(const T& lhs, const T& rhs)
+{
+    T product{};
+    for (int bit = 0; bit < static_cast<int>(8 * sizeof(T)); ++bit)
+    {
+        if (((rhs >> bit) & T{1}) != T{}) product += lhs << bit;
+    }
+    return product;
+}
+
+/**
+ * @brief Divide by shifting and subtracting, one quotient bit at a time.
+ *
+ * T is uint128_t or an unsigned WideInt.
+ *
+ * @param remainder Set to the remainder.
+ * @return The quotient.
+ */
+template <typename T>
+constexpr T divide(const T& dividend, const T& divisor, T& remainder)
+{
+    T quotient{};
+    remainder = T{};
+    for (int bit = static_cast<int>(8 * sizeof(T)) - 1; bit >= 0; --bit)
+    {
+        remainder = (remainder << 1) | ((dividend >> bit) & T{1});
+        if (remainder >= divisor)
+        {
+            remainder -= divisor;
+            quotient |= T{1} << bit;
+        }
+    }
+    return quotient;
+}
+
+/**
+ * @brief Whether T's quotient and remainder put the dividend back together: (dividend / divisor) * divisor + dividend % divisor == dividend.
+ *
+ * This holds for every integer T with truncating division, signed or not, fixed-width or not.
+ */
+template <typename T>
+constexpr bool division_identity(const T& dividend, const T& divisor)
+{
+    return (dividend / divisor) * divisor + dividend % divisor == dividend;
+}
+
+/**
+ * @brief Whether T's product, quotient and remainder of one pair equal the references, for checking in constant evaluation.
+ */
+template <typename T>
+constexpr bool matches_reference(const T& lhs, const T& rhs)
+{
+    T remainder{};
+    const T quotient = divide(lhs, rhs, remainder);
+    return lhs * rhs == multiply(lhs, rhs) && lhs / rhs == quotient && lhs % rhs == remainder && division_identity(lhs, rhs);
+}
+
+/**
+ * @brief A random 64-bit word that is often zero, small, or near a power of two, so every path of word arithmetic is hit.
+ */
+inline std::uint64_t random_word(std::mt19937_64& engine)
+{
+    const std::uint64_t value = engine();
+    switch (engine() % 4)
+    {
+    case 0: return 0;
+    case 1: return value >> (engine() % 64);
+    case 2: return std::numeric_limits<std::uint64_t>::max() - (value % 4);
+    default: return value;
+    }
+}
+
+/**
+ * @brief The values near zero, the powers of two and their neighbours, and the limits of T and their neighbours.
+ *
+ * The wide types take every (N / 32)th power of two and the top one, to keep the pairs to tens of thousands.
+ */
+template <FixedWidthInteger T>
+std::vector<T> edge_values()
+{
+    using U = divider_unsigned_t<T>;
+    constexpr int width = static_cast<int>(8 * sizeof(U));
+    std::vector<int> bits;
+    for (int bit = 0; bit < width; bit += width <= 64 ? 1 : width / 32) bits.push_back(bit);
+    if (bits.back() != width - 1) bits.push_back(width - 1);
+
+    std::vector<T> values;
+    for (const int bit : bits)
+    {
+        const U power = static_cast<U>(U{1} << bit);
+        for (const U value : {power, static_cast<U>(power - U{1}), static_cast<U>(power + U{1}), static_cast<U>(U{} - power), static_cast<U>(U{} - power + U{1})})
+            values.push_back(from_unsigned<T>(value));
+    }
+    for (const unsigned small : {3u, 5u, 6u, 7u, 10u, 100u, 641u, 1000u}) values.push_back(from_unsigned<T>(static_cast<U>(small)));
+
+    // The minimum is 0 or the top bit alone, and the maximum is one below it, wrapping.
+    const U min = std::same_as<T, U> ? U{} : static_cast<U>(U{1} << (width - 1));
+    for (unsigned offset = 0; offset < 3; ++offset)
+    {
+        values.push_back(from_unsigned<T>(static_cast<U>(min + static_cast<U>(offset))));
+        values.push_back(from_unsigned<T>(static_cast<U>(min - U{1} - static_cast<U>(offset))));
+    }
+    return values;
+}
+
+} // namespace Softloq::WHATWG::Infra::Reference
+
+#endif // SOFTLOQ_WHATWG_INFRA_TEST_UNITS_REFERENCE_HPP